@@ -1,4 +1,5 @@
 #include "DEV_Config.h"
+#include "src/profiler/Profiler.h"
 
 uint slice_num;
 SPIClass * vspi = NULL;
@@ -21,87 +22,57 @@ uint8_t DEV_Digital_Read(uint16_t Pin)
 void DEV_SPI_WriteByte(uint8_t Value)
 {
     vspi->transfer(Value);
+    PROFILE_COUNT_SPI(1);
 }
 
-void DEV_SPI_Write_nByte(uint8_t pData[], uint32_t Len)
+// Write-only: transfer(buf, len) is full duplex and would overwrite the
+// buffer with whatever comes back on MISO
+void DEV_SPI_Write_nByte(const uint8_t pData[], uint32_t Len)
 {
-     vspi->transfer(pData, Len);
+     vspi->writeBytes(pData, Len);
+     PROFILE_COUNT_SPI(Len);
 }
 
 /**
- * I2C
+ * I2C, queued on the bus task of DEV_I2C_Bus
  **/
+I2CBus DEV_I2C_Bus(Wire, "i2c0");
 
 void DEV_I2C_Write_Byte(uint8_t addr, uint8_t reg, uint8_t Value)
 {
-    Wire.beginTransmission(addr);
-    Wire.write(reg);
-    Wire.write(Value);
-    Wire.endTransmission();
+    DEV_I2C_Bus.writeByte(addr, reg, Value);
 }
 
 void DEV_I2C_Write_Register(uint8_t addr, uint8_t reg, uint16_t value)
 {
-    uint8_t tmpi[3];
-    tmpi[0] = reg;
-    tmpi[1] = (value >> 8) & 0xFF;
-    tmpi[2] = value & 0xFF;
-    Wire.beginTransmission(addr);
-    Wire.write(tmpi,3);
-    Wire.endTransmission();
-    
+    uint8_t tmpi[2];
+    tmpi[0] = (value >> 8) & 0xFF;
+    tmpi[1] = value & 0xFF;
+    DEV_I2C_Bus.write(addr, reg, tmpi, 2);
 }
 
 void DEV_I2C_Write_nByte(uint8_t addr,uint8_t *pData, uint32_t Len)
 {
-    Wire.beginTransmission(addr);
-    Wire.write(pData,Len);
-    Wire.endTransmission();
+    DEV_I2C_Bus.writeRaw(addr, pData, Len);
 }
 
 uint8_t DEV_I2C_Read_Byte(uint8_t addr, uint8_t reg)
 {
-    uint8_t value;
-  
-    Wire.beginTransmission(addr);
-    Wire.write((byte)reg);
-    Wire.endTransmission();
-  
-    Wire.requestFrom(addr, (byte)1);
-    value = Wire.read();
-  
+    uint8_t value = 0;
+    DEV_I2C_Bus.read(addr, reg, &value, 1);
     return value;
 }
+
 void DEV_I2C_Read_Register(uint8_t addr, uint8_t reg, uint16_t *value)
 {
-    uint8_t tmpi[2];
-    
-    Wire.beginTransmission(addr);
-    Wire.write(reg);
-    // Wire.endTransmission();
-    Wire.requestFrom(addr, 2);
-  
-    uint8_t i = 0;
-    for(i = 0; i < 2; i++) {
-      tmpi[i] =  Wire.read();
-    }
-    Wire.endTransmission();
+    uint8_t tmpi[2] = {0, 0};
+    DEV_I2C_Bus.read(addr, reg, tmpi, 2);
     *value = (((uint16_t)tmpi[0] << 8) | (uint16_t)tmpi[1]);
 }
 
 void DEV_I2C_Read_nByte(uint8_t addr, uint8_t reg, uint8_t *pData, uint32_t Len)
 {
-    Wire.beginTransmission(addr);
-    Wire.write(reg);
-    Wire.endTransmission();
-    
-    Wire.requestFrom(addr, Len);
-  
-    uint8_t i = 0;
-    for(i = 0; i < Len; i++) {
-      pData[i] =  Wire.read();
-    }
-    Wire.endTransmission();
+    DEV_I2C_Bus.read(addr, reg, pData, Len);
 }
 
 uint16_t DEC_ADC_Read(void)
@@ -7,6 +7,7 @@
 #include <SPI.h>
 #include <Wire.h>
 #include "Debug.h"
+#include "src/i2c/I2CBus.h"
 /**
  * data
  **/
@@ -39,7 +40,13 @@
 #define Touch_INT_PIN   (5)
 #define Touch_RST_PIN   (13)
 
+#define IMU_INT1_PIN    (4)
+#define IMU_INT2_PIN    (3)
+
 #define BAT_ADC_PIN     (1)
+
+#define TCS_INT_PIN     (18)  // TCS34725 INT, open drain, active low
+
 // #define BAR_CHANNEL     (A3)
 
 /*------------------------------------------------------------------------------------------------------*/
@@ -55,11 +62,12 @@ uint8_t DEV_Digital_Read(uint16_t Pin);
 uint16_t DEC_ADC_Read(void);
 
 void DEV_SPI_WriteByte(uint8_t Value);
-void DEV_SPI_Write_nByte(uint8_t *pData, uint32_t Len);
+void DEV_SPI_Write_nByte(const uint8_t *pData, uint32_t Len);
 
 void DEV_Delay_ms(uint32_t xms);
 void DEV_Delay_us(uint32_t xus);
 
+extern I2CBus DEV_I2C_Bus;  // Wire
 void DEV_I2C_Write_Byte(uint8_t addr, uint8_t reg, uint8_t Value);
 void DEV_I2C_Write_nByte(uint8_t addr, uint8_t *pData, uint32_t Len);
 void DEV_I2C_Write_Register(uint8_t addr,uint8_t reg, uint16_t value);
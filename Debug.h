@@ -15,12 +15,15 @@
 #define __DEBUG_H
 
 #include "stdio.h"
+#include "src/logging/Log.h"
 
+// Debug() goes through the deferred log ring at debug level, so it costs
+// nothing unless LOG_LEVEL is LOG_LEVEL_DEBUG and never blocks on UART.
 #define DEV_DEBUG 1
 #if DEV_DEBUG
-  #define Debug(__info,...) printf("Debug : " __info,##__VA_ARGS__)
+  #define Debug(__info,...) LOG_D("Debug : " __info,##__VA_ARGS__)
 #else
-  #define DEBUG(__info,...)  
+  #define Debug(__info,...)
 #endif
 
 #endif
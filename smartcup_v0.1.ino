@@ -7,28 +7,60 @@
 #include "sensors.h"
 #include "src/fonts/fonts.h"
 #include "src/bluetooth/BluetoothManager.h"
+#include "src/scheduler/TaskScheduler.h"
+#include "src/sensing/SensorHub.h"
+#include "src/ui/Widgets.h"
+#include "src/ui/Sprite.h"
+#include "src/ui/ColorGauge.h"
+#include "src/profiler/Profiler.h"
+#include "src/logging/Log.h"
+#include "src/power/DisplayPower.h"
+#include "src/power/PowerScheduler.h"
+#include "src/power/BatteryMonitor.h"
+#include "src/screen/FrameBuffer.h"
+#include "src/screen/Blit.h"
+#include "src/sensing/SensorTiming.h"
 
 // TCS34725 LED Wire
 #define LED_PIN 15
 
 uint16_t SCREEN_W;
 uint16_t SCREEN_H;
-uint32_t NumPixels;
 
 // Sensor & Touch
 Adafruit_TCS34725 tcs = Adafruit_TCS34725(
-  TCS34725_INTEGRATIONTIME_360MS, TCS34725_GAIN_1X);
+  COLOR_INTEGRATION_TIME, TCS34725_GAIN_1X);
 CST816S touch(6, 7, 13, 5);  // SDA, SCL, RST, IRQ
 TwoWire IMUWire(1);          // Use bus #1 (Wire1)
+I2CBus imuBus(IMUWire, "i2c1");  // touch + IMU, arbitrated by the bus task
 
-// Buffers
-UWORD* FrameBuffer = NULL;
-UWORD* LogoImage = NULL;
 ColorProcessor* colorProcessor = nullptr;
 
 FlipDetector flipDetector(IMUWire);
 TouchManager touchManager(touch);
 BluetoothManager ble;
+TaskScheduler scheduler;          // UI core: rendering, touch, BLE
+SensorHub sensorHub(tcs, flipDetector, LED_PIN);  // sensor core: color + IMU
+PowerScheduler power(scheduler, sensorHub.taskScheduler());
+BatteryMonitor battery;
+
+// Wait-for-flip screen: only the widgets that change are redrawn and flushed
+Button startButton(90, 6, 60, 18, "Start", &Font12, 0x229f);
+Label waitLabel(45, 200, 150, &FontSans12);
+Label bleLabel(60, 213, 120, &FontSans12);
+WidgetTree* waitScreen = nullptr;
+
+// Spinner under the logo, blitted into its own 20x20 window
+static const uint8_t SPINNER_SIZE = 20;
+static const int16_t SPINNER_X = (240 - SPINNER_SIZE) / 2;
+static const int16_t SPINNER_Y = 177;
+Sprite spinner;
+Animator* spinnerAnim = nullptr;
+
+// Live analysis screen fed from the sample queue
+ColorGauge* colorGauge = nullptr;
+
+DisplayPower* displayPower = nullptr;
 
 // App State
 enum AppState {
@@ -39,63 +71,168 @@ enum AppState {
 };
 AppState currentState = STATE_SPLASH;
 
-static unsigned long lastSampleMs = 0;
-static const uint32_t SAMPLE_PERIOD_MS = 200; // send 5 Hz; tweak as needed
+static unsigned long firstMeasurementMs = 0;
+static const uint32_t UART_PERIOD_MS = 20;
+static const uint32_t TOUCH_TICK_MS = 30;     // recognizer tick while a finger is down
+static const uint32_t BLE_EVENT_PERIOD_MS = 100;
+static const uint32_t SPINNER_FRAME_MS = 33;  // ~30 fps
+static const uint32_t GAUGE_FRAME_MS = 100;   // 10 Hz partial updates
+static const uint32_t LOG_DRAIN_MS = 50;
+static const uint16_t LOG_DRAIN_BATCH = 8;    // bound the UART time per run
+static const uint32_t DISPLAY_CHECK_MS = 1000;
 static const uint8_t BACKLIGHT_BRIGHT = 100;
-static const uint8_t BACKLIGHT_DIM = 20;
-static const uint32_t BACKLIGHT_IDLE_MS = 300000;
-
-static unsigned long lastInteractionMs = 0;
-static bool backlightDimmed = false;
-
-void showLogoWithLoading() {
-  drawImageToFrameBuffer(newgensmall);
-  const char* msg = "loading";
-  int x = (240 - strlen(msg) * 8) / 2;
-  Paint_DrawString_EN(x, 200, msg, &Font12, WHITE, BLACK);
-  LCD_1IN28_Display(FrameBuffer);
+static const uint32_t BATTERY_PERIOD_MS = 30000;
+
+// Scheduler task ids
+static uint8_t uartTask, touchTask, bleTask, sensorTask, splashTask, spinnerTask, gaugeTask, displayTask, logTask, batteryTask;
+
+// Each state only enables the tasks it needs; everything else stays asleep.
+void enterState(AppState next) {
+  if (next == STATE_ANALYSIS && currentState != STATE_ANALYSIS) colorGauge->show();
+
+  currentState = next;
+  scheduler.setEnabled(splashTask, next == STATE_SPLASH);
+  scheduler.setEnabled(spinnerTask, next == STATE_WAIT_FLIP);
+  scheduler.setEnabled(gaugeTask, next == STATE_ANALYSIS);
+
+  if (next == STATE_WAIT_FLIP) sensorHub.setMode(SENSOR_MODE_WAIT_FLIP);
+  else if (next == STATE_ANALYSIS) sensorHub.setMode(SENSOR_MODE_SAMPLING);
+  else sensorHub.setMode(SENSOR_MODE_IDLE);
 }
 
-void sendBleSample() {
-  uint16_t r, g, b, c;
+void IRAM_ATTR onTouchIrq() {
+  scheduler.triggerFromISR(touchTask);
+}
+
+// Runs on the I2C bus task once the report queued by the IRQ has been read
+void onTouchReport() {
+  scheduler.trigger(touchTask);
+}
 
-  // light the TCS LED briefly for a stable reading (uses your LED_PIN 15)
-  digitalWrite(LED_PIN, HIGH);
-  delay(3);
-  tcs.getRawData(&r, &g, &b, &c);
-  digitalWrite(LED_PIN, LOW);
+// Light-sleep wake callbacks: the edge that woke us never reached the ISR
+void onTouchWake() {
+  touchManager.requestRead();
+  scheduler.trigger(touchTask);
+}
 
+void onImuWake() {
+  sensorHub.imuWake();
+}
+
+void onColorWake() {
+  sensorHub.colorWake();
+}
+
+// The controller keeps the connection only if the host stays reachable on
+// every connection event; advertising alone tolerates sleep
+bool lightSleepAllowed() {
+  return !ble.isDeviceConnected();
+}
+
+// Samples are taken on the sensor core while in STATE_ANALYSIS and shown by
+// the gauge task; colorProcessor->runAnalysis() blocks for too long to be
+// used for streaming. notifyJSON drops the payload while no client is listening.
+void sendBleSample(const ColorSample& s) {
   // compact JSON under 180 bytes
   char buf[128];
   snprintf(buf, sizeof(buf),
            "{\"r\":%u,\"g\":%u,\"b\":%u,\"c\":%u,\"t\":%lu}",
-           r, g, b, c, millis());
+           s.r, s.g, s.b, s.c, (unsigned long)s.t);
   ble.notifyJSON(String(buf));
+
+  // Boot benchmark: how long from reset until the first reading was taken
+  if (firstMeasurementMs == 0) {
+    firstMeasurementMs = s.t;
+    LOG_I("Boot: time to first measurement %lu ms", firstMeasurementMs);
+  }
 }
 
-void markInteraction() {
-  lastInteractionMs = millis();
-  if (backlightDimmed) {
-    DEV_SET_PWM(BACKLIGHT_BRIGHT);
-    backlightDimmed = false;
+// "sensors" task: triggered by SensorHub whenever it queues data.
+void drainSensors() {
+  SensorEvent ev;
+  while (sensorHub.popEvent(ev)) {
+    if (ev.type == SENSOR_EVENT_FLIPPED && currentState == STATE_WAIT_FLIP) {
+      markInteraction();
+      enterState(STATE_ANALYSIS);     // start streaming loop
+    } else if (ev.type == SENSOR_EVENT_MOTION) {
+      markInteraction();
+    } else if (ev.type == SENSOR_EVENT_AMBIENT) {
+      displayPower->setAmbient(ev.value);
+      scheduler.trigger(displayTask);
+    }
+  }
+
+  ColorSample sample;
+  while (sensorHub.popSample(sample)) {
+    sendBleSample(sample);
+    if (currentState == STATE_ANALYSIS) {
+      colorGauge->addSample(sample);
+      displayPower->activity();  // a live reading keeps the gauge visible
+    }
+  }
+}
+
+void handleBleEvents() {
+  bool connected;
+  if (ble.takeConnectionChange(connected)) {
+    LOG_I("BLE: %s", connected ? "client connected" : "advertising");
+    bleLabel.setText(connected ? "BLE connected" : "BLE advertising");
+    if (currentState == STATE_WAIT_FLIP) waitScreen->render();
+  }
+
+  char cmd;
+  if (ble.takeCommand(cmd) && cmd == 'p') {
+    Profiler::dumpJSON(notifyProfileLine);
   }
 }
 
-void updateBacklight() {
-  if (!backlightDimmed && millis() - lastInteractionMs >= BACKLIGHT_IDLE_MS) {
-    DEV_SET_PWM(BACKLIGHT_DIM);
-    backlightDimmed = true;
+void notifyProfileLine(const char* line) {
+  ble.notifyJSON(String(line));
+}
+
+// Touch and motion keep the display awake; waking from sleep starts at once
+void markInteraction() {
+  displayPower->activity();
+  scheduler.trigger(displayTask);
+}
+
+// Ramps the backlight and applies the idle timeouts; runs fast only while
+// a ramp or wake-up is in progress
+void updateDisplayPower() {
+  scheduler.setPeriod(displayTask, displayPower->update());
+}
+
+// Low-rate battery check; publishes the level over BLE and steps the
+// display into power saving as the charge drops
+void updateBattery() {
+  if (!battery.update()) return;
+  LOG_I("Battery: %u%% %u mV (%s)", battery.percent(), battery.millivolts(),
+        BatteryMonitor::levelName(battery.level()));
+  ble.setBatteryLevel(battery.percent());
+
+  switch (battery.level()) {
+    case BATTERY_OK:       displayPower->setLimits(0); break;
+    case BATTERY_LOW:      displayPower->setLimits(50, 20000, 60000); break;
+    case BATTERY_CRITICAL: displayPower->setLimits(20, 5000, 15000); break;
   }
+  scheduler.trigger(displayTask);
 }
 
-void logTouchIfAny() {
-  if (touchManager.isTouched()) {
+void handleTouch() {
+  if (touchManager.update()) {
     markInteraction();
-    Serial.printf("Touch: x=%u y=%u gesture=%s\n",
-                  touchManager.getTouchX(),
-                  touchManager.getTouchY(),
-                  touchManager.getGestureName().c_str());
   }
+
+  GestureEvent g;
+  while (touchManager.popGesture(g)) {
+    LOG_I("Touch: %s x=%u y=%u v=(%d,%d)px/s %lums",
+          TouchManager::gestureName(g.type), g.x, g.y,
+          g.vx, g.vy, (unsigned long)g.durationMs);
+    if (currentState == STATE_WAIT_FLIP) waitScreen->dispatch(g);
+  }
+
+  // Event-only while idle; tick only while a finger is down
+  scheduler.setPeriod(touchTask, touchManager.isPressed() ? TOUCH_TICK_MS : 0);
 }
 
 void handleUartCommands() {
@@ -103,179 +240,212 @@ void handleUartCommands() {
     char c = Serial.read();
     if (c == '1') {
       Serial.println("UART: forcing analysis state");
-      showLogoWithLoading();
-      currentState = STATE_ANALYSIS;
+      enterState(STATE_ANALYSIS);
     } else if (c == '2') {
       Serial.printf("UART: last touch x=%u y=%u gesture=%s\n",
                     touchManager.getTouchX(),
                     touchManager.getTouchY(),
-                    touchManager.getGestureName().c_str());
+                    TouchManager::gestureName(touchManager.lastGesture()));
+    } else if (c == '3') {
+      scheduler.printStats(Serial);
+      sensorHub.taskScheduler().printStats(Serial);
+      displayPower->printStats(Serial);
+      FrameBuffers.printStats(Serial);
+      power.printStats(Serial);
+      battery.printStats(Serial);
+      imuBus.printStats(Serial);
+      QMI8658BusStats imu;
+      QMI8658_get_bus_stats(&imu);
+      Serial.printf("QMI8658: %lu reads, %lu writes, %lu writes skipped by the shadow\n",
+                    imu.reads, imu.writes, imu.skippedWrites);
+      DEV_I2C_Bus.printStats(Serial);
+    } else if (c == '4') {
+      Profiler::dump(Serial);
+    } else if (c == '5') {
+      Profiler::reset();
+      Serial.println("UART: profiler reset");
+    } else if (c == '6') {
+      unsigned long failures = Blit_SelfTest();
+      Serial.printf("UART: blit self test %s, %lu failing cases\n",
+                    failures ? "FAILED" : "passed", failures);
     }
   }
 }
 
-// Button UI
-const int BTN_X = 20;
-const int BTN_Y = 100;
-const int BTN_W = 200;
-const int BTN_H = 50;
-
 void setup() {
   Serial.begin(115200);
   Serial.println("Booting...");
-  delay(200);
 
   // ✅ Set screen size early
   SCREEN_W = LCD_1IN28_WIDTH;
   SCREEN_H = LCD_1IN28_HEIGHT;
-  NumPixels = SCREEN_W * SCREEN_H;
 
   pinMode(LED_PIN, OUTPUT);
 
   Wire.begin(21, 33);
   IMUWire.begin(6, 7);
-  IMUWire.setClock(100000);
   ble.begin();
-  Wire.setClock(100000);
 
   if (DEV_Module_Init() != 0) Serial.println("GPIO Init Fail!");
   LCD_1IN28_Init(HORIZONTAL);
-  DEV_SET_PWM(BACKLIGHT_BRIGHT);
-  markInteraction();
+  imuBus.begin();
+  DEV_I2C_Bus.begin();
 
-  touchManager.begin(IMUWire);
+  touchManager.begin(imuBus);
+  touch.onInterrupt(onTouchIrq);
+  touch.onReport(onTouchReport);
 
   if (!psramInit()) {
     Serial.println("PSRAM not available, falling back to heap (reduced buffer reliability)");
   }
 
-  // ✅ Allocate framebuffer after knowing NumPixels
-  FrameBuffer = (UWORD*)ps_malloc(NumPixels * sizeof(UWORD));
-  if (!FrameBuffer) {
-    FrameBuffer = (UWORD*)malloc(NumPixels * sizeof(UWORD));
-  }
-  if (!FrameBuffer) {
+  // ✅ Allocate display buffers: a full frame in PSRAM, or internal-RAM
+  // strips with FB_STRIP_RENDER
+  if (FrameBuffers.begin(SCREEN_W, SCREEN_H, FB_STRIP_RENDER ? 2 : 1) == 0) {
     Serial.println("FrameBuffer allocation failed!");
     while (1);
   }
+  FrameBuffers.onRepaint(repaintScreen);
 
   if (!tcs.begin()) Serial.println("TCS34725 not found!");
   else Serial.println("TCS34725 OK");
 
-  // ✅ Create ColorProcessor after FrameBuffer is ready
-  colorProcessor = new ColorProcessor(tcs, FrameBuffer, NumPixels, LED_PIN);
+  // ✅ Create ColorProcessor
+  colorProcessor = new ColorProcessor(tcs, LED_PIN);
   colorProcessor->begin();
 
+  waitScreen = new WidgetTree();
+  waitScreen->setBackground(drawWaitBackground);
+  waitScreen->add(startButton);
+  waitScreen->add(waitLabel);
+  waitScreen->add(bleLabel);
+  waitLabel.setText("Waiting for flip");
+  startButton.onTap(onStartTapped);
+
+  colorGauge = new ColorGauge();
+  displayPower = new DisplayPower();
+  displayPower->begin(BACKLIGHT_BRIGHT);
+
+  spinnerAnim = new Animator();
+  if (!spinner.buildSpinner(SPINNER_SIZE, 8, 3, 0x229f, WHITE)) {
+    Serial.println("Spinner allocation failed");
+  }
+
   Serial.println("Touch OK");
 
-  if (!QMI8658_init(IMUWire)) {
-    Serial.println("IMU init failed!");
+  bool imuOk = QMI8658_init(imuBus);
+  if (!imuOk) {
+    Serial.println("IMU init failed! Flip detection off, use the Start button");
   } else Serial.println("QMI8658 IMU init OK");
 
-  flipDetector.begin();
+  negotiateI2CClocks();
 
-  Paint_NewImage((UBYTE*)FrameBuffer, SCREEN_W, SCREEN_H, 0, WHITE);
-  delay(100);
+  if (imuOk) flipDetector.begin();
 
-  Paint_SetScale(65);
+  Paint_NewImage((UBYTE*)FrameBuffers.front(), SCREEN_W, SCREEN_H, 0, WHITE);
+
+  Paint_SetScale(FB_PALETTE ? 256 : 65);
   Paint_SetRotate(ROTATE_0);
   Paint_Clear(WHITE);
 
-  // Skip splash and BLE if debug mode is enabled
+  scheduler.begin();
+  uartTask = scheduler.addTask("uart", handleUartCommands, UART_PERIOD_MS);
+  touchTask = scheduler.addTask("touch", handleTouch);
+  bleTask = scheduler.addTask("ble", handleBleEvents, BLE_EVENT_PERIOD_MS);
+  sensorTask = scheduler.addTask("sensors", drainSensors);
+  splashTask = scheduler.addTask("splash", endSplash, SPLASH_MS);
+  spinnerTask = scheduler.addTask("spinner", stepSpinner, SPINNER_FRAME_MS);
+  gaugeTask = scheduler.addTask("gauge", updateGauge, GAUGE_FRAME_MS);
+  logTask = scheduler.addTask("log", drainLog, LOG_DRAIN_MS);
+  displayTask = scheduler.addTask("display", updateDisplayPower, DISPLAY_CHECK_MS);
+  batteryTask = scheduler.addTask("battery", updateBattery, BATTERY_PERIOD_MS);
+  scheduler.trigger(batteryTask);  // first reading right after boot
+  sensorHub.begin(scheduler, sensorTask, SAMPLE_PERIOD_MS, FLIP_CHECK_MS, AMBIENT_PERIOD_MS);
+
+  power.begin();
+  power.addWakePin("touch", Touch_INT_PIN, LOW, FALLING, onTouchWake);
+  power.addWakePin("imu1", IMU_INT1_PIN, PowerScheduler::WAKE_ON_CHANGE, CHANGE, onImuWake);
+  power.addWakePin("imu2", IMU_INT2_PIN, HIGH, RISING, onImuWake);
+  power.addWakePin("tcs", TCS_INT_PIN, LOW, FALLING, onColorWake);
+  power.addBus(imuBus);
+  power.addBus(DEV_I2C_Bus);
+  power.setSleepAllowed(lightSleepAllowed);
+
+  // Skip splash and flip detection if debug mode is enabled
   if (DEBUG_SKIP_TO_ANALYSIS) {
-    Serial.println("DEBUG MODE: Skipping logo, BLE, and flip detection...");
-    currentState = STATE_ANALYSIS;
+    Serial.println("DEBUG MODE: Skipping logo and flip detection...");
+    enterState(STATE_ANALYSIS);
     return;
   }
 
-  drawImageToFrameBuffer(newgenbig);
-  LCD_1IN28_Display(FrameBuffer);
-  delay(3000);
-
-  drawImageToFrameBuffer(newgensmall);
-  LCD_1IN28_Display(FrameBuffer);
-
-  Serial.println("Waiting for BLE client connection...");
-  int dotCount = 0;
-  while (!ble.isDeviceConnected()) {
-    drawImageToFrameBuffer(newgensmall);
+  // BLE keeps advertising in the background; a connection is handled as an
+  // event in loop() instead of gating boot.
+  FrameBuffers.renderFrame(drawSplash, nullptr);
+  enterState(STATE_SPLASH);
+}
 
-    const char* line1 = "Waiting for";
-    int line1_x = (240 - strlen(line1) * 8) / 2;
-    Paint_DrawString_EN(line1_x, 180, line1, &Font12, WHITE, BLACK);
+// Every device is rated for 400 kHz; each bus runs at the fastest rate up
+// to that which its devices read their IDs back at reliably
+void negotiateI2CClocks() {
+  const I2CProbe imuProbes[] = {
+    {"qmi8658", 0x6B, 0x00, 0x05, 0xFF, 400000},           // WhoAmI
+    {"cst816s", touch.address(), 0xA7, 0x00, 0x00, 400000}, // chip ID, any value
+  };
+  const I2CProbe wireProbes[] = {
+    {"tcs34725", TCS34725_ADDRESS, TCS34725_COMMAND_BIT | TCS34725_ID, 0x40, 0xF0, 400000},  // 0x44 or 0x4D
+  };
+  imuBus.negotiateClock(imuProbes, 2);
+  DEV_I2C_Bus.negotiateClock(wireProbes, 1);
+}
 
-    char msg[40];
-    snprintf(msg, sizeof(msg), "BLE Connection%.*s", dotCount, "...");
-    int line2_x = (240 - strlen(msg) * 8) / 2;
-    Paint_DrawString_EN(line2_x, 200, msg, &Font12, WHITE, BLACK);
+void endSplash() {
+  bleLabel.setText(ble.isDeviceConnected() ? "BLE connected" : "BLE advertising");
+  waitScreen->renderAll();
+  spinnerAnim->play(spinner, SPINNER_X, SPINNER_Y);
+  enterState(STATE_WAIT_FLIP);
+}
 
-    LCD_1IN28_Display(FrameBuffer);
+void onStartTapped() {
+  enterState(STATE_ANALYSIS);
+}
 
-    dotCount = (dotCount + 1) % 4;
-    delay(500);
-  }
+// Redraws only the gauge widgets that changed since the last frame
+void updateGauge() {
+  if (!displayPower->isOn()) return;
+  colorGauge->update();
+}
 
-  Serial.println("BLE client connected. Proceeding with sketch...");
-  drawImageToFrameBuffer(newgensmall);
-  LCD_1IN28_Display(FrameBuffer);
+// Formats queued log records on the UI core, a few per run
+void drainLog() {
+  Log::drain(Serial, LOG_DRAIN_BATCH);
+}
 
-  currentState = STATE_WAIT_FLIP;
+// One spinner frame: 800 bytes on SPI instead of a 90 KB full refresh
+void stepSpinner() {
+  if (!displayPower->isOn()) return;
+  spinnerAnim->step();
 }
 
+// Every subsystem is a scheduler task; loop() only runs what is due and then
+// sleeps until the next deadline or an interrupt-driven trigger, in
+// light-sleep when both cores are idle long enough.
 void loop() {
-  static int dotCount = 0;
-  static unsigned long lastAnim = 0;
-  handleUartCommands();
-  logTouchIfAny();
-  switch (currentState) {
-    case STATE_WAIT_FLIP:
-      if (millis() - lastAnim > 500) {
-        lastAnim = millis();
-        drawImageToFrameBuffer(newgensmall);
-
-        const char* baseMsg = "Waiting for flip";
-        char msg[40];
-        snprintf(msg, sizeof(msg), "%s%.*s", baseMsg, dotCount, "...");
-        int string_xpos = ((240 - strlen(msg) * 8) / 2) + 5;
-        Paint_DrawString_EN(string_xpos, 190, msg, &Font12, WHITE, BLACK);
-        LCD_1IN28_Display(FrameBuffer);
-
-        dotCount = (dotCount + 1) % 4;
-      }
-
-      if (flipDetector.isFlipped()) {
-			showLogoWithLoading();          // <<< only logo + "loading"
-			currentState = STATE_ANALYSIS;  // start streaming loop
-		}
-
-      break;
-
-	case STATE_ANALYSIS:
-	  // Do NOT call colorProcessor->runAnalysis() here anymore.
-	  if (ble.isDeviceConnected() && millis() - lastSampleMs >= SAMPLE_PERIOD_MS) {
-		lastSampleMs = millis();
-		sendBleSample();
-	  }
-	  break;
-
-
-    default:
-      break;
-  }
+  scheduler.runDue();
+  power.idle();
+}
 
-  updateBacklight();
-  delay(100);
+// Full-screen images only need their visible circle copied
+void drawSplash(void*) {
+  Paint_DrawFullImage(newgenbig);
 }
 
-void drawStartButton() {
-  Paint_Clear(WHITE);
-  Paint_DrawRectangle(BTN_X, BTN_Y, BTN_X + BTN_W, BTN_Y + BTN_H, 0x229f, DOT_PIXEL_2X2, DRAW_FILL_FULL);
-  Paint_DrawString_EN(BTN_X + 10, BTN_Y + 15, "Starting Analysis", &Font16, WHITE, WHITE);
-  LCD_1IN28_Display(FrameBuffer);
+void drawWaitBackground() {
+  Paint_DrawFullImage(newgensmall);
 }
 
-void drawImageToFrameBuffer(const uint16_t* imgData) {
-  for (uint32_t i = 0; i < NumPixels; i++) {
-    FrameBuffer[i] = pgm_read_word(&imgData[i]);
-  }
+// Strip rendering keeps no frame, so waking the panel redraws the screen
+void repaintScreen() {
+  if (currentState == STATE_SPLASH) FrameBuffers.renderFrame(drawSplash, nullptr);
+  else if (currentState == STATE_WAIT_FLIP) waitScreen->renderAll();
+  else if (currentState == STATE_ANALYSIS) colorGauge->show();
 }
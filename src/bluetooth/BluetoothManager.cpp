@@ -1,8 +1,11 @@
 #include "BluetoothManager.h"
 #include <Arduino.h>
+#include "src/profiler/Profiler.h"
 
 #define SERVICE_UUID        "4fafc201-1fb5-459e-8fcc-c5c9c331914b"
 #define CHARACTERISTIC_UUID "beb5483e-36e1-4688-b7f5-ea07361b26a8"
+#define BATTERY_SERVICE_UUID ((uint16_t)0x180F)
+#define BATTERY_LEVEL_UUID   ((uint16_t)0x2A19)
 
 void BluetoothManager::begin() {
     BLEDevice::init("SmartCup"); // match what your site expects
@@ -23,12 +26,23 @@ void BluetoothManager::begin() {
     pCCCD = new BLE2902();
     pCCCD->setNotifications(true);
     pCharacteristic->addDescriptor(pCCCD);
+    pCharacteristic->setCallbacks(this);
 
     pCharacteristic->setValue("Hello from SmartCup");
     pService->start();
 
+    pBatteryService = pServer->createService(BLEUUID(BATTERY_SERVICE_UUID));
+    pBatteryLevel = pBatteryService->createCharacteristic(
+        BLEUUID(BATTERY_LEVEL_UUID),
+        BLECharacteristic::PROPERTY_READ | BLECharacteristic::PROPERTY_NOTIFY
+    );
+    pBatteryLevel->addDescriptor(new BLE2902());
+    pBatteryLevel->setValue(&batteryPercent, 1);
+    pBatteryService->start();
+
     BLEAdvertising* adv = pServer->getAdvertising();
     adv->addServiceUUID(SERVICE_UUID);
+    adv->addServiceUUID(BLEUUID(BATTERY_SERVICE_UUID));
     adv->setScanResponse(true);
     adv->start();
 
@@ -39,20 +53,52 @@ bool BluetoothManager::isDeviceConnected() const {
     return deviceConnected;
 }
 
+// onConnect/onDisconnect run on the BLE stack task, so they only latch the
+// change here and the main loop consumes it.
+bool BluetoothManager::takeConnectionChange(bool& connected) {
+    if (!connectionChanged) return false;
+    connectionChanged = false;
+    connected = deviceConnected;
+    return true;
+}
+
+bool BluetoothManager::takeCommand(char& cmd) {
+    if (!commandPending) return false;
+    commandPending = false;
+    cmd = pendingCommand;
+    return true;
+}
+
+// Single-character commands written by the client, e.g. 'p' for a profile
+// dump. Like the connection callbacks this runs on the BLE stack task.
+void BluetoothManager::onWrite(BLECharacteristic* c) {
+    if (c->getLength() == 0) return;
+    pendingCommand = (char)c->getData()[0];
+    commandPending = true;
+}
+
 void BluetoothManager::onConnect(BLEServer* /*pServer*/) {
     deviceConnected = true;
-    Serial.println("BLE client connected.");
+    connectionChanged = true;
 }
 
 void BluetoothManager::onDisconnect(BLEServer* pServer) {
     deviceConnected = false;
-    Serial.println("BLE client disconnected.");
+    connectionChanged = true;
     pServer->getAdvertising()->start();
 }
 
+void BluetoothManager::setBatteryLevel(uint8_t percent) {
+    batteryPercent = percent > 100 ? 100 : percent;
+    if (!pBatteryLevel) return;
+    pBatteryLevel->setValue(&batteryPercent, 1);
+    if (deviceConnected) pBatteryLevel->notify();
+}
+
 // Safe notify: copy into a temp String to satisfy non-const API
 void BluetoothManager::notifyJSON(const String& json) {
     if (!deviceConnected || !pCharacteristic) return;
+    PROFILE_ZONE("ble.notify");
     const size_t CHUNK = 180;
     for (size_t sent = 0; sent < json.length(); ) {
         size_t n = min(CHUNK, json.length() - sent);
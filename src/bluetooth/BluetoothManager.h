@@ -6,22 +6,35 @@
 #include <BLEServer.h>
 #include <BLE2902.h>
 
-class BluetoothManager : public BLEServerCallbacks {
+class BluetoothManager : public BLEServerCallbacks, public BLECharacteristicCallbacks {
 public:
     void begin();
     bool isDeviceConnected() const;
+    // Returns true once per connect/disconnect, reporting the new state.
+    bool takeConnectionChange(bool& connected);
+    // Returns true once per command byte written to the characteristic.
+    bool takeCommand(char& cmd);
     void notifyJSON(const String& json);
+    // Standard Battery Service (0x180F) level, notified while connected.
+    void setBatteryLevel(uint8_t percent);
 
 private:
     BLEServer* pServer = nullptr;
     BLEService* pService = nullptr;
     BLECharacteristic* pCharacteristic = nullptr;
     BLE2902* pCCCD = nullptr;
+    BLEService* pBatteryService = nullptr;
+    BLECharacteristic* pBatteryLevel = nullptr;
+    uint8_t batteryPercent = 0;
 
-    bool deviceConnected = false;
+    volatile bool deviceConnected = false;
+    volatile bool connectionChanged = false;
+    volatile bool commandPending = false;
+    volatile char pendingCommand = 0;
 
     void onConnect(BLEServer* pServer) override;
     void onDisconnect(BLEServer* pServer) override;
+    void onWrite(BLECharacteristic* c) override;
 };
 
 #endif
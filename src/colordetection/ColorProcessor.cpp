@@ -4,13 +4,13 @@
 #include "LCD_Test.h"
 #include "ColorCalibration.h"
 #include <pgmspace.h>
+#include "src/logging/Log.h"
+#include "src/screen/FrameBuffer.h"
 
 ColorProcessor::ColorProcessor(
   Adafruit_TCS34725& tcsSensor,
-  uint16_t* framebuffer,
-  uint32_t numPixels,
   uint8_t ledPin
-) : tcs(tcsSensor), FrameBuffer(framebuffer), NumPixels(numPixels), LEDPin(ledPin) {}
+) : tcs(tcsSensor), LEDPin(ledPin) {}
 
 
 unsigned long lastSensorResetTime = 0;
@@ -21,13 +21,16 @@ void ColorProcessor::begin() {
   pinMode(LEDPin, OUTPUT);
   digitalWrite(LEDPin, LOW);
 
-  // Configure TCS34725 interrupt pin (GPIO 18)
-  pinMode(18, INPUT_PULLUP);
+  // Configure TCS34725 interrupt pin
+  pinMode(TCS_INT_PIN, INPUT_PULLUP);
 
-  // Setup interrupt to trigger on any reading
+  // Assert INT at the end of every integration: with no persistence
+  // filter each RGBC cycle interrupts, whatever the threshold limits. It
+  // stays low until cleared, which SensorHub does after each read, so the
+  // "tcs" wake pin sees one falling edge per fresh reading.
+  tcs.write8(TCS34725_PERS, TCS34725_PERS_NONE);
   tcs.setInterrupt(true);     // Enable hardware interrupt
   tcs.clearInterrupt();       // Clear pending
-  tcs.setIntLimits(0, 65535); // Trigger on any ADC value
 }
 
 void ColorProcessor::runAnalysis() {
@@ -38,7 +41,7 @@ void ColorProcessor::runAnalysis() {
   // Check if it's time to reset the sensor
   unsigned long currentTime = millis();
   if (currentTime - lastSensorResetTime > SENSOR_RESET_INTERVAL) {
-    Serial.println("Resetting TCS34725 sensor...");
+    LOG_I("Resetting TCS34725 sensor...");
     tcs.disable();   // Power down
     delay(100);      // Allow full shutdown
     tcs.enable();    // Power up
@@ -51,9 +54,9 @@ void ColorProcessor::runAnalysis() {
 
   // Wait for interrupt signal (GPIO 18 goes LOW)
   unsigned long startTime = millis();
-  while (digitalRead(18) == HIGH) {
+  while (digitalRead(TCS_INT_PIN) == HIGH) {
     if (millis() - startTime > 1000) {
-      Serial.println("Timeout waiting for color sensor interrupt.");
+      LOG_W("Timeout waiting for color sensor interrupt.");
       digitalWrite(LEDPin, LOW);
       return;
     }
@@ -69,55 +72,76 @@ void ColorProcessor::runAnalysis() {
   digitalWrite(LEDPin, LOW);        // Turn off LED
 
   // Debug output
-  Serial.printf("R=%u G=%u B=%u C=%u\n", r, g, b, c);
+  LOG_D("R=%u G=%u B=%u C=%u", r, g, b, c);
 
   // === Processing ===
   float normR = normalize(r, calib.blackR, calib.whiteR);
   float normG = normalize(g, calib.blackG, calib.whiteG);
   float normB = normalize(b, calib.blackB, calib.whiteB);
-  float normC = normalize(c, calib.blackC, calib.whiteC);
 
-  uint8_t r255 = gammaCorrect(normR);
-  uint8_t g255 = gammaCorrect(normG);
-  uint8_t b255 = gammaCorrect(normB);
-
-  boostSaturation(r255, g255, b255, 1.5);
-
-  Paint_Clear(WHITE);
-  char buf[32];
+  CorrectedColor corrected = correct(r, g, b);
   bool showCorrectedColor = true;  // Set to true if you want gamma/saturation corrected color
 
   if (showCorrectedColor) {
-    sprintf(buf, "R: %3d = %4d raw", r255, r);
-    Paint_DrawString_EN(20, 48, buf, &Font16, RED, WHITE);
-    sprintf(buf, "G: %3d = %4d raw", g255, g);
-    Paint_DrawString_EN(20, 73, buf, &Font16, GREEN, WHITE);
-    sprintf(buf, "B: %3d = %4d raw", b255, b);
-    Paint_DrawString_EN(20, 98, buf, &Font16, BLUE, WHITE);
-    sprintf(buf, "C: %5u", c);
-    Paint_DrawString_EN(20, 123, buf, &Font16, BLACK, WHITE);
+    shown.r = corrected.r;
+    shown.g = corrected.g;
+    shown.b = corrected.b;
   } else {
-    uint8_t r8 = normR * 255;
-    uint8_t g8 = normG * 255;
-    uint8_t b8 = normB * 255;
-
-    sprintf(buf, "R: %3d = %4d raw", r8, r);
-    Paint_DrawString_EN(20, 48, buf, &Font16, RED, WHITE);
-    sprintf(buf, "G: %3d = %4d raw", g8, g);
-    Paint_DrawString_EN(20, 73, buf, &Font16, GREEN, WHITE);
-    sprintf(buf, "B: %3d = %4d raw", b8, b);
-    Paint_DrawString_EN(20, 98, buf, &Font16, BLUE, WHITE);
-    sprintf(buf, "C: %5u", c);
-    Paint_DrawString_EN(20, 123, buf, &Font16, BLACK, WHITE);
+    shown.r = normR * 255;
+    shown.g = normG * 255;
+    shown.b = normB * 255;
   }
+  shown.rgb565 = corrected.rgb565;
+  raw[0] = r;
+  raw[1] = g;
+  raw[2] = b;
+  raw[3] = c;
+
+  // Push to screen
+  FrameBuffers.renderFrame(drawResult, this);
+}
+
+// "R: %3d = %4d raw" with the numbers drawn straight from their digits.
+// Paint_DrawString_EN(..., color, WHITE) draws white on color; the number
+// calls take their colors in order, so they pass WHITE, color to match.
+static void drawValueLine(UWORD y, const char* name, int32_t value, int32_t raw, UWORD color) {
+  UWORD x = 20;
+  Paint_DrawString_EN(x, y, name, &Font16, color, WHITE);
+  x += Paint_MeasureString(name, &Font16);
+  x += Paint_DrawFixed(x, y, value, 0, 3, &Font16, WHITE, color);
+  Paint_DrawString_EN(x, y, " = ", &Font16, color, WHITE);
+  x += Paint_MeasureString(" = ", &Font16);
+  x += Paint_DrawFixed(x, y, raw, 0, 4, &Font16, WHITE, color);
+  Paint_DrawString_EN(x, y, " raw", &Font16, color, WHITE);
+}
+
+// Runs once per strip in strip mode, so it only draws the stored result
+void ColorProcessor::drawResult(void* ctx) {
+  ColorProcessor* self = static_cast<ColorProcessor*>(ctx);
+
+  Paint_Clear(WHITE);
+  drawValueLine(48, "R: ", self->shown.r, self->raw[0], RED);
+  drawValueLine(73, "G: ", self->shown.g, self->raw[1], GREEN);
+  drawValueLine(98, "B: ", self->shown.b, self->raw[2], BLUE);
+  Paint_DrawString_EN(20, 123, "C: ", &Font16, BLACK, WHITE);
+  Paint_DrawFixed(20 + Paint_MeasureString("C: ", &Font16), 123, self->raw[3], 0, 5, &Font16,
+                  WHITE, BLACK);
 
-  // Convert RGB888 to RGB565
-  uint16_t color565 = ((r255 & 0xF8) << 8) | ((g255 & 0xFC) << 3) | (b255 >> 3);
   Paint_DrawString_EN(20, 153, "Detected Color:", &Font16, BLACK, WHITE);
-  Paint_DrawRectangle(0, 180, 240, 240, color565, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+  Paint_DrawRectangle(0, 180, 240, 240, self->shown.rgb565, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+}
 
-  // Push to screen
-  LCD_1IN28_Display(FrameBuffer);
+CorrectedColor ColorProcessor::correct(uint16_t r, uint16_t g, uint16_t b) {
+  CorrectedColor out;
+  out.r = gammaCorrect(normalize(r, calib.blackR, calib.whiteR));
+  out.g = gammaCorrect(normalize(g, calib.blackG, calib.whiteG));
+  out.b = gammaCorrect(normalize(b, calib.blackB, calib.whiteB));
+
+  boostSaturation(out.r, out.g, out.b, 1.5);
+
+  // Convert RGB888 to RGB565
+  out.rgb565 = ((out.r & 0xF8) << 8) | ((out.g & 0xFC) << 3) | (out.b >> 3);
+  return out;
 }
 
 float ColorProcessor::normalize(uint16_t val, uint16_t black, uint16_t white) {
@@ -3,22 +3,31 @@
 
 #include <Adafruit_TCS34725.h>
 
+// Calibrated, gamma-corrected and saturation-boosted reading.
+struct CorrectedColor {
+    uint8_t r, g, b;
+    uint16_t rgb565;
+};
+
 class ColorProcessor {
 public:
-    ColorProcessor(Adafruit_TCS34725& sensor, uint16_t* frameBuffer, uint32_t numPixels, uint8_t ledPin);
+    ColorProcessor(Adafruit_TCS34725& sensor, uint8_t ledPin);
     void begin();
     void runAnalysis();
 
+    // The correction pipeline used by runAnalysis, usable on streamed samples.
+    static CorrectedColor correct(uint16_t r, uint16_t g, uint16_t b);
+
 private:
     Adafruit_TCS34725& tcs;
-    uint16_t* FrameBuffer;
-    uint32_t NumPixels;
     uint8_t LEDPin;
+    CorrectedColor shown = {0, 0, 0, 0};   // last result on screen
+    uint16_t raw[4] = {0, 0, 0, 0};        // R, G, B, C counts
 
-    float normalize(uint16_t val, uint16_t black, uint16_t white);
-    uint8_t gammaCorrect(float val);
-    void boostSaturation(uint8_t& r, uint8_t& g, uint8_t& b, float satBoost = 1.5);
-    void drawImageToFrameBuffer(const uint16_t* imgData);
+    static float normalize(uint16_t val, uint16_t black, uint16_t white);
+    static uint8_t gammaCorrect(float val);
+    static void boostSaturation(uint8_t& r, uint8_t& g, uint8_t& b, float satBoost = 1.5);
+    static void drawResult(void* ctx);
 };
 
 #endif // COLOR_PROCESSOR_H
@@ -1,39 +1,93 @@
 #include "FlipDetector.h"
-#include "sensors.h"  // For QMI8658_read_xyz
+#include "src/profiler/Profiler.h"
+#include "src/logging/Log.h"
+#include "sensors.h"  // For QMI8658 FIFO access
 
 FlipDetector::FlipDetector(TwoWire& imuWire) : wire(imuWire) {}
 
-void FlipDetector::begin() {
-    // Any initialization needed later
+bool FlipDetector::begin(int int1Pin, int int2Pin) {
+    if (!estimator.configure(QMI8658_get_acc_lsb_div(), QMI8658_get_gyro_lsb_div(), SAMPLE_PERIOD_US)) {
+        LOG_E("FlipDetector: IMU reports no sensor scale, flip detection off");
+        return false;
+    }
+    enabled = true;
+
+    pinMode(int1Pin, INPUT);
+    pinMode(int2Pin, INPUT);
+    // WoM toggles INT1 on every event, the FIFO watermark raises INT2
+    attachInterruptArg(int1Pin, handleISR, this, CHANGE);
+    attachInterruptArg(int2Pin, handleISR, this, RISING);
+    QMI8658_enableInterrupts(QMI8658_CTRL1_INT1_ENABLE | QMI8658_CTRL1_INT2_ENABLE);
+
+    // Settle the estimator on a live burst first, then drop into WoM
+    startStreaming();
+    return true;
+}
+
+void FlipDetector::onInterrupt(void (*cb)()) {
+    irqCallback = cb;
+}
+
+void IRAM_ATTR FlipDetector::handleISR(void* arg) {
+    FlipDetector* self = static_cast<FlipDetector*>(arg);
+    self->irqPending = true;
+    if (self->irqCallback) self->irqCallback();
+}
+
+void FlipDetector::armWakeOnMotion() {
+    streaming = false;
+    QMI8658_enableWakeOnMotion(QMI8658_Int1, QMI8658WomThreshold_low, 0x01);
+}
+
+void FlipDetector::startStreaming() {
+    QMI8658_disableWakeOnMotion();
+    QMI8658_config_fifo(QMI8658FifoMode_Fifo, QMI8658FifoSize_32, FIFO_WATERMARK);
+    streaming = true;
+    lastMotionMs = millis();
+    // Gyro was off during WoM; re-seed gravity from the next accel frame
+    estimator.reset();
+}
+
+void FlipDetector::restart() {
+    if (!enabled) return;
+    irqPending = false;
+    startStreaming();
+}
+
+bool FlipDetector::takeMotionStart() {
+    bool started = motionStarted;
+    motionStarted = false;
+    return started;
 }
 
 bool FlipDetector::isFlipped() {
-    float acc[3], gyro[3];
-    unsigned int tim;
-    QMI8658_read_xyz(acc, gyro, &tim);
-
-    if (!initialized) {
-        baselineZ = acc[2];  // assume this is upright
-        initialized = true;
-        Serial.printf("Baseline Z set: %.2f\n", baselineZ);
-        return false;
-    }
+    if (!enabled) return false;
+    // Nothing moved since the last call: no bus traffic at all
+    if (!irqPending && !streaming) return estimator.state() == ORIENT_INVERTED;
+    PROFILE_ZONE("flip.update");
+    irqPending = false;
 
-    // Debounce: check every 500ms
-    if (millis() - lastFlipCheck < 500) return false;
-    lastFlipCheck = millis();
+    if (!streaming) {
+        startStreaming();
+        motionStarted = true;
+        return estimator.state() == ORIENT_INVERTED;
+    }
 
-    float deltaZ = acc[2] - baselineZ;
-    Serial.printf("Flip delta Z: %.2f\n", deltaZ);
-    Serial.printf("ACC X: %.2f\n", acc[0]);
-    Serial.printf("ACC Y: %.2f\n", acc[1]);
-    Serial.printf("ACC Z: %.2f\n", acc[2]);
+    static short rawAcc[MAX_FRAMES][3], rawGyro[MAX_FRAMES][3];
+    unsigned short frames = QMI8658_read_fifo_raw(rawAcc, rawGyro, MAX_FRAMES);
 
-    // Flip threshold
-    if (deltaZ > 1600.0f) {
-        Serial.println("Cup flipped detected.");
-        return true;
+    for (unsigned short f = 0; f < frames; f++) {
+        if (estimator.update(rawAcc[f], rawGyro[f])) {
+            static const char* const NAMES[] = {"unknown", "upright", "tilted", "inverted", "moving"};
+            LOG_I("Orientation: %s (tilt %u deg)", NAMES[estimator.state()], estimator.tiltDegrees());
+        }
+        if (!estimator.isStill()) lastMotionMs = millis();
     }
 
+    if (estimator.state() == ORIENT_INVERTED) return true;
+
+    if (millis() - lastMotionMs > STILL_REARM_MS) {
+        armWakeOnMotion();
+    }
     return false;
 }
@@ -3,19 +3,55 @@
 
 #include <Arduino.h>
 #include <Wire.h>
+#include "DEV_Config.h"
+#include "OrientationEstimator.h"
 
+// Event-driven flip detection. While the cup is still the IMU sits in
+// wake-on-motion mode (INT1) and isFlipped() does no I2C at all. Motion
+// switches it to a low-ODR FIFO with a watermark interrupt (INT2), which is
+// drained in bursts until the cup has been still for a while again.
+// Every drained frame goes through OrientationEstimator, so a flip is judged
+// on the fused gravity vector rather than a single Z reading.
 class FlipDetector {
 public:
     FlipDetector(TwoWire& imuWire);
 
-    void begin();
+    // Call only after QMI8658_init() succeeded. Returns false and leaves
+    // detection off (isFlipped() always false) when the IMU reports no
+    // sensor scale.
+    bool begin(int int1Pin = IMU_INT1_PIN, int int2Pin = IMU_INT2_PIN);
+    bool isEnabled() const { return enabled; }
+    void onInterrupt(void (*cb)());  // called from the IRQ handler
     bool isFlipped();
+    Orientation orientation() const { return estimator.state(); }
+    // True once each time wake-on-motion fires, i.e. the cup was picked up.
+    bool takeMotionStart();
+    // Flags an IMU event seen outside the ISR, e.g. a line that changed
+    // while the chip was in light-sleep.
+    void markPending() { irqPending = true; }
+    // Starts a fresh burst, dropping frames queued while nobody was
+    // draining them. Call when flip checks are (re)enabled.
+    void restart();
 
 private:
+    static const uint8_t FIFO_WATERMARK = 8;     // frames, ~128 ms at 62.5 Hz
+    static const uint8_t MAX_FRAMES = 32;
+    static const uint32_t STILL_REARM_MS = 2000; // back to wake-on-motion
+    static const uint32_t SAMPLE_PERIOD_US = 16000; // 62.5 Hz ODR
+
     TwoWire& wire;
-    bool initialized = false;
-    float baselineZ = 0.0f;
-    unsigned long lastFlipCheck = 0;
+    OrientationEstimator estimator;
+    bool enabled = false;
+    bool streaming = false;
+    bool motionStarted = false;
+    unsigned long lastMotionMs = 0;
+
+    volatile bool irqPending = false;
+    void (*irqCallback)() = nullptr;
+
+    static void IRAM_ATTR handleISR(void* arg);
+    void armWakeOnMotion();
+    void startStreaming();
 };
 
 #endif // FLIP_DETECTOR_H
@@ -0,0 +1,120 @@
+#include "OrientationEstimator.h"
+
+static uint32_t isqrt32(uint32_t v) {
+    uint32_t res = 0;
+    uint32_t bit = 1UL << 30;
+    while (bit > v) bit >>= 2;
+    while (bit) {
+        if (v >= res + bit) {
+            v -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return res;
+}
+
+static int32_t iabs(int32_t v) {
+    return v < 0 ? -v : v;
+}
+
+// acos in whole degrees for a cosine given in Q8 (-256..256)
+static uint8_t acosDeg(int32_t cosQ8) {
+    // cos(d) * 256 for d = 0, 10, ..., 180
+    static const int16_t COS_Q8[19] = {
+        256, 252, 241, 222, 196, 165, 128, 88, 44, 0,
+        -44, -88, -128, -165, -196, -222, -241, -252, -256
+    };
+    if (cosQ8 >= 256) return 0;
+    if (cosQ8 <= -256) return 180;
+    uint8_t i = 0;
+    while (i < 18 && COS_Q8[i + 1] > cosQ8) i++;
+    int32_t span = COS_Q8[i] - COS_Q8[i + 1];
+    return i * 10 + (uint8_t)(((COS_Q8[i] - cosQ8) * 10 + span / 2) / span);
+}
+
+bool OrientationEstimator::configure(uint16_t accLsbPerG, uint16_t gyroLsbPerDps, uint32_t samplePeriodUs) {
+    // update() divides by both scales
+    if (accLsbPerG == 0 || gyroLsbPerDps == 0 || samplePeriodUs == 0) return false;
+    accLsb = accLsbPerG;
+    gyroLsb = gyroLsbPerDps;
+    // (pi / 180) * dt / lsb, in Q30 rad per LSB
+    gyroToRadQ30 = (int32_t)((18740330LL * samplePeriodUs) / (1000000LL * gyroLsb));
+    reset();
+    return true;
+}
+
+void OrientationEstimator::reset() {
+    seeded = false;
+    candidateCount = 0;
+}
+
+void OrientationEstimator::gravityMg(int32_t out[3]) const {
+    for (int i = 0; i < 3; i++) out[i] = g[i] >> 8;
+}
+
+bool OrientationEstimator::update(const int16_t acc[3], const int16_t gyro[3]) {
+    int32_t a[3];
+    for (int i = 0; i < 3; i++) a[i] = ((int32_t)acc[i] * 1000) / accLsb;   // mg
+    int32_t accMag = isqrt32((uint32_t)(a[0] * a[0] + a[1] * a[1] + a[2] * a[2]));
+
+    int32_t gyroDps = 0;
+    for (int i = 0; i < 3; i++) {
+        int32_t d = iabs(gyro[i]) / gyroLsb;
+        if (d > gyroDps) gyroDps = d;
+    }
+
+    if (!seeded) {
+        for (int i = 0; i < 3; i++) g[i] = a[i] << 8;
+        seeded = true;
+    } else {
+        // Rotate gravity by the gyro: g -= (w * dt) x g
+        int32_t th[3];
+        for (int i = 0; i < 3; i++) th[i] = (int32_t)gyro[i] * gyroToRadQ30;
+        int64_t cx = (int64_t)th[1] * g[2] - (int64_t)th[2] * g[1];
+        int64_t cy = (int64_t)th[2] * g[0] - (int64_t)th[0] * g[2];
+        int64_t cz = (int64_t)th[0] * g[1] - (int64_t)th[1] * g[0];
+        g[0] -= (int32_t)(cx >> 30);
+        g[1] -= (int32_t)(cy >> 30);
+        g[2] -= (int32_t)(cz >> 30);
+
+        // Only trust the accelerometer when it mostly measures gravity
+        if (iabs(accMag - 1000) < MOVING_ACC_MG) {
+            for (int i = 0; i < 3; i++) g[i] += ((a[i] << 8) - g[i]) >> ACC_WEIGHT_SHIFT;
+        }
+    }
+
+    int32_t gm[3];
+    gravityMg(gm);
+    int32_t gMag = isqrt32((uint32_t)(gm[0] * gm[0] + gm[1] * gm[1] + gm[2] * gm[2]));
+    if (gMag > 0) tiltDeg = acosDeg((UPRIGHT_Z_SIGN * gm[2] * 256) / gMag);
+    still = gyroDps < STILL_GYRO_DPS && iabs(accMag - 1000) < MOVING_ACC_MG / 2;
+
+    Orientation next = classify(accMag, gyroDps);
+    if (next == stableState) {
+        candidateCount = 0;
+        return false;
+    }
+    if (next != candidate) {
+        candidate = next;
+        candidateCount = 0;
+    }
+    if (++candidateCount < DEBOUNCE_SAMPLES) return false;
+
+    stableState = candidate;
+    candidateCount = 0;
+    return true;
+}
+
+Orientation OrientationEstimator::classify(int32_t accMagMg, int32_t gyroDps) const {
+    if (iabs(accMagMg - 1000) > MOVING_ACC_MG || gyroDps > MOVING_GYRO_DPS) return ORIENT_MOVING;
+
+    // Hysteresis: leaving a settled state needs a bigger angle than entering it
+    if (stableState == ORIENT_UPRIGHT && tiltDeg < UPRIGHT_EXIT_DEG) return ORIENT_UPRIGHT;
+    if (stableState == ORIENT_INVERTED && tiltDeg > INVERTED_EXIT_DEG) return ORIENT_INVERTED;
+    if (tiltDeg < UPRIGHT_ENTER_DEG) return ORIENT_UPRIGHT;
+    if (tiltDeg > INVERTED_ENTER_DEG) return ORIENT_INVERTED;
+    return ORIENT_TILTED;
+}
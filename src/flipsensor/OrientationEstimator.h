@@ -0,0 +1,61 @@
+#ifndef ORIENTATION_ESTIMATOR_H
+#define ORIENTATION_ESTIMATOR_H
+
+#include <stdint.h>
+
+enum Orientation : uint8_t {
+    ORIENT_UNKNOWN,
+    ORIENT_UPRIGHT,
+    ORIENT_TILTED,
+    ORIENT_INVERTED,
+    ORIENT_MOVING
+};
+
+// Fixed-point complementary filter that tracks the gravity vector from raw
+// accel + gyro samples, plus a debounced hysteresis state machine on top of
+// it. No floats and no Arduino dependencies, so traces replay on the host.
+class OrientationEstimator {
+public:
+    // Sign of the accel Z axis when the cup stands upright on this board.
+    static const int8_t UPRIGHT_Z_SIGN = -1;
+
+    // Returns false, keeping the previous scale, when a scale or the period
+    // is zero, e.g. from an IMU that never finished init.
+    bool configure(uint16_t accLsbPerG, uint16_t gyroLsbPerDps, uint32_t samplePeriodUs);
+    void reset();  // next sample re-seeds gravity from the accelerometer
+
+    // Returns true when the debounced state changed on this sample.
+    bool update(const int16_t acc[3], const int16_t gyro[3]);
+
+    Orientation state() const { return stableState; }
+    bool isStill() const { return still; }
+    // Angle between gravity and the upright axis, in degrees (0..180).
+    uint8_t tiltDegrees() const { return tiltDeg; }
+    void gravityMg(int32_t out[3]) const;
+
+private:
+    static const uint8_t ACC_WEIGHT_SHIFT = 4;     // accel correction 1/16 per sample
+    static const uint8_t DEBOUNCE_SAMPLES = 6;     // ~100 ms at 62.5 Hz
+    static const uint8_t UPRIGHT_ENTER_DEG = 30, UPRIGHT_EXIT_DEG = 40;
+    static const uint8_t INVERTED_ENTER_DEG = 150, INVERTED_EXIT_DEG = 140;
+    static const int32_t MOVING_ACC_MG = 250;      // |a| deviation from 1 g
+    static const int32_t MOVING_GYRO_DPS = 60;
+    static const int32_t STILL_GYRO_DPS = 5;
+
+    uint16_t accLsb = 4096;
+    uint16_t gyroLsb = 64;
+    int32_t gyroToRadQ30 = 0;   // raw gyro LSB -> rotation per sample, Q30 rad
+
+    bool seeded = false;
+    int32_t g[3] = {0, 0, 0};   // gravity estimate, mg in Q8
+    uint8_t tiltDeg = 0;
+    bool still = false;
+
+    Orientation stableState = ORIENT_UNKNOWN;
+    Orientation candidate = ORIENT_UNKNOWN;
+    uint8_t candidateCount = 0;
+
+    Orientation classify(int32_t accMagMg, int32_t gyroDps) const;
+};
+
+#endif // ORIENTATION_ESTIMATOR_H
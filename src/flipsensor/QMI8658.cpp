@@ -4,7 +4,7 @@
 #define QMI8658_SLAVE_ADDR_L 0x6b
 #define QMI8658_SLAVE_ADDR_H 0x6b
 
-static TwoWire* qmiWire = &Wire;
+static I2CBus* qmiBus = nullptr;
 static unsigned char QMI8658_slave_addr = QMI8658_SLAVE_ADDR_L;
 
 static unsigned short acc_lsb_div = 0;
@@ -13,41 +13,119 @@ static unsigned short ae_q_lsb_div = (1 << 14);
 static unsigned short ae_v_lsb_div = (1 << 10);
 static unsigned int imu_timestamp = 0;
 static struct QMI8658Config QMI8658_config;
+static unsigned char fifo_ctrl_value = QMI8658FifoMode_Bypass;
+static struct QMI8658BusStats bus_stats;
+
+// Shadow of CTRL1..CTRL8, seeded from the chip at init. Only this driver
+// writes them, so read-modify-write needs no bus read and writes of an
+// unchanged value are dropped. CTRL9 is a command register and not cached.
+#define QMI8658_CTRL_COUNT 8
+#define QMI8658_CTRL_INDEX(reg) ((reg) - QMI8658Register_Ctrl1)
+static unsigned char ctrl_shadow[QMI8658_CTRL_COUNT];
+static bool ctrl_shadow_valid = false;
+
+// Timestamp (3), temperature (2), accel (6) and gyro (6): one 17-byte burst
+#define QMI8658_SAMPLE_BURST (QMI8658Register_Gz_H - QMI8658Register_Timestamp_L + 1)
 
 unsigned char QMI8658_write_reg(unsigned char reg, unsigned char value) {
-    qmiWire->beginTransmission(QMI8658_slave_addr);
-    qmiWire->write(reg);
-    qmiWire->write(value);
-    return (qmiWire->endTransmission() == 0) ? 1 : 0;
+    bus_stats.writes++;
+    return qmiBus->writeByte(QMI8658_slave_addr, reg, value) == I2C_OK ? 1 : 0;
 }
 
 unsigned char QMI8658_write_regs(unsigned char reg, unsigned char *value, unsigned char len) {
-    qmiWire->beginTransmission(QMI8658_slave_addr);
-    qmiWire->write(reg);
-    for (int i = 0; i < len; i++) {
-        qmiWire->write(value[i]);
-    }
-    return (qmiWire->endTransmission() == 0) ? 1 : 0;
+    bus_stats.writes++;
+    return qmiBus->write(QMI8658_slave_addr, reg, value, len) == I2C_OK ? 1 : 0;
 }
 
 unsigned char QMI8658_read_reg(unsigned char reg, unsigned char *buf, unsigned short len) {
-    qmiWire->beginTransmission(QMI8658_slave_addr);
-    qmiWire->write(reg);
-    if (qmiWire->endTransmission(false) != 0) return 0;
-    if (qmiWire->requestFrom(QMI8658_slave_addr, len) != len) return 0;
-    for (int i = 0; i < len && qmiWire->available(); i++) {
-        buf[i] = qmiWire->read();
+    bus_stats.reads++;
+    return qmiBus->read(QMI8658_slave_addr, reg, buf, len) == I2C_OK ? 1 : 0;
+}
+
+static unsigned char QMI8658_write_ctrl(unsigned char reg, unsigned char value) {
+    unsigned char* cached = &ctrl_shadow[QMI8658_CTRL_INDEX(reg)];
+    if (ctrl_shadow_valid && *cached == value) {
+        bus_stats.skippedWrites++;
+        return 1;
     }
+    if (!QMI8658_write_reg(reg, value)) return 0;
+    *cached = value;
     return 1;
 }
 
-// Custom init for any TwoWire instance
-unsigned char QMI8658_init(TwoWire& wire) {
-    qmiWire = &wire;
-    return QMI8658_init();
+// Writes the control registers that differ from the shadow, one burst per
+// run of adjacent changes. Runs go out in ascending order, so CTRL7
+// (sensor enable) still lands after the range/ODR registers.
+static unsigned char QMI8658_apply_ctrl(const unsigned char target[QMI8658_CTRL_COUNT]) {
+    int i = 0;
+    while (i < QMI8658_CTRL_COUNT) {
+        if (ctrl_shadow_valid && target[i] == ctrl_shadow[i]) {
+            bus_stats.skippedWrites++;
+            i++;
+            continue;
+        }
+        int j = i + 1;
+        while (j < QMI8658_CTRL_COUNT && !(ctrl_shadow_valid && target[j] == ctrl_shadow[j])) j++;
+        if (!QMI8658_write_regs(QMI8658Register_Ctrl1 + i, (unsigned char*)&target[i], j - i)) return 0;
+        memcpy(&ctrl_shadow[i], &target[i], j - i);
+        i = j;
+    }
+    return 1;
+}
+
+static unsigned char QMI8658_acc_ctrl(QMI8658_AccRange range, QMI8658_AccOdr odr, QMI8658_StConfig st) {
+    switch (range) {
+        case QMI8658AccRange_2g:  acc_lsb_div = (1 << 14); break;
+        case QMI8658AccRange_4g:  acc_lsb_div = (1 << 13); break;
+        case QMI8658AccRange_8g:  acc_lsb_div = (1 << 12); break;
+        case QMI8658AccRange_16g: acc_lsb_div = (1 << 11); break;
+        default: acc_lsb_div = (1 << 12); break;
+    }
+    unsigned char data = range | odr;
+    if (st == QMI8658St_Enable) data |= 0x80;
+    return data;
+}
+
+static unsigned char QMI8658_gyro_ctrl(QMI8658_GyrRange range, QMI8658_GyrOdr odr, QMI8658_StConfig st) {
+    switch (range) {
+        case QMI8658GyrRange_32dps: gyro_lsb_div = 1024; break;
+        case QMI8658GyrRange_64dps: gyro_lsb_div = 512; break;
+        case QMI8658GyrRange_128dps: gyro_lsb_div = 256; break;
+        case QMI8658GyrRange_256dps: gyro_lsb_div = 128; break;
+        case QMI8658GyrRange_512dps: gyro_lsb_div = 64; break;
+        case QMI8658GyrRange_1024dps: gyro_lsb_div = 32; break;
+        case QMI8658GyrRange_2048dps: gyro_lsb_div = 16; break;
+        case QMI8658GyrRange_4096dps: gyro_lsb_div = 8; break;
+        default: gyro_lsb_div = 64; break;
+    }
+    unsigned char data = range | odr;
+    if (st == QMI8658St_Enable) data |= 0x80;
+    return data;
+}
+
+// CTRL5: accelerometer LPF in the low nibble, gyroscope LPF in the high one
+static unsigned char QMI8658_ctrl5_acc(unsigned char ctrl5, QMI8658_LpfConfig lpf) {
+    return (ctrl5 & 0xf0) | ((lpf == QMI8658Lpf_Enable) ? (A_LSP_MODE_3 | 0x01) : 0);
+}
+
+static unsigned char QMI8658_ctrl5_gyro(unsigned char ctrl5, QMI8658_LpfConfig lpf) {
+    return (ctrl5 & 0x0f) | ((lpf == QMI8658Lpf_Enable) ? (G_LSP_MODE_3 | 0x10) : 0);
+}
+
+void QMI8658_get_bus_stats(struct QMI8658BusStats* stats) {
+    *stats = bus_stats;
+}
+
+// FIFO drains are bulk traffic; touch reads on the shared bus go first
+unsigned char QMI8658_init(I2CBus& bus) {
+    qmiBus = &bus;
+    if (!QMI8658_init()) return 0;
+    bus.addDevice("qmi8658", QMI8658_slave_addr, I2C_PRIORITY_LOW);
+    return 1;
 }
 
 unsigned char QMI8658_init(void) {
+    if (!qmiBus) return 0;
     unsigned char QMI8658_chip_id = 0x00;
     unsigned char QMI8658_revision_id = 0x00;
     unsigned char QMI8658_slave[2] = { QMI8658_SLAVE_ADDR_L, QMI8658_SLAVE_ADDR_H };
@@ -71,6 +149,7 @@ unsigned char QMI8658_init(void) {
     }
 
     QMI8658_read_reg(QMI8658Register_Revision, &QMI8658_revision_id, 1);
+    ctrl_shadow_valid = QMI8658_read_reg(QMI8658Register_Ctrl1, ctrl_shadow, QMI8658_CTRL_COUNT);
 
     Serial.print("QMI8658_init slave = ");
     Serial.println(QMI8658_slave_addr);
@@ -79,13 +158,14 @@ unsigned char QMI8658_init(void) {
     Serial.print(" Revision = ");
     Serial.println(QMI8658_revision_id);
 
-    QMI8658_write_reg(QMI8658Register_Ctrl1, 0x60);
+    QMI8658_write_ctrl(QMI8658Register_Ctrl1, 0x60);
 
+    // Orientation only needs a few tens of Hz; 1 kHz just burns I2C and CPU.
     QMI8658_config.inputSelection = QMI8658_CONFIG_ACCGYR_ENABLE;
     QMI8658_config.accRange = QMI8658AccRange_8g;
-    QMI8658_config.accOdr = QMI8658AccOdr_1000Hz;
+    QMI8658_config.accOdr = QMI8658AccOdr_62_5Hz;
     QMI8658_config.gyrRange = QMI8658GyrRange_512dps;
-    QMI8658_config.gyrOdr = QMI8658GyrOdr_1000Hz;
+    QMI8658_config.gyrOdr = QMI8658GyrOdr_62_5Hz;
     QMI8658_config.magOdr = QMI8658MagOdr_125Hz;
     QMI8658_config.magDev = MagDev_AKM09918;
     QMI8658_config.aeOdr = QMI8658AeOdr_128Hz;
@@ -95,102 +175,187 @@ unsigned char QMI8658_init(void) {
 }
 
 void QMI8658_config_acc(QMI8658_AccRange range, QMI8658_AccOdr odr, QMI8658_LpfConfig lpf, QMI8658_StConfig st) {
-    unsigned char data;
-
-    switch (range) {
-        case QMI8658AccRange_2g:  acc_lsb_div = (1 << 14); break;
-        case QMI8658AccRange_4g:  acc_lsb_div = (1 << 13); break;
-        case QMI8658AccRange_8g:  acc_lsb_div = (1 << 12); break;
-        case QMI8658AccRange_16g: acc_lsb_div = (1 << 11); break;
-        default: acc_lsb_div = (1 << 12); break;
-    }
-
-    data = range | odr;
-    if (st == QMI8658St_Enable) data |= 0x80;
-    QMI8658_write_reg(QMI8658Register_Ctrl2, data);
-
-    QMI8658_read_reg(QMI8658Register_Ctrl5, &data, 1);
-    data &= 0xf0;
-    data |= (lpf == QMI8658Lpf_Enable) ? (A_LSP_MODE_3 | 0x01) : 0;
-    QMI8658_write_reg(QMI8658Register_Ctrl5, data);
+    QMI8658_write_ctrl(QMI8658Register_Ctrl2, QMI8658_acc_ctrl(range, odr, st));
+    unsigned char ctrl5 = ctrl_shadow[QMI8658_CTRL_INDEX(QMI8658Register_Ctrl5)];
+    QMI8658_write_ctrl(QMI8658Register_Ctrl5, QMI8658_ctrl5_acc(ctrl5, lpf));
 }
 
 void QMI8658_config_gyro(QMI8658_GyrRange range, QMI8658_GyrOdr odr, QMI8658_LpfConfig lpf, QMI8658_StConfig st) {
-    unsigned char data;
-
-    switch (range) {
-        case QMI8658GyrRange_32dps: gyro_lsb_div = 1024; break;
-        case QMI8658GyrRange_64dps: gyro_lsb_div = 512; break;
-        case QMI8658GyrRange_128dps: gyro_lsb_div = 256; break;
-        case QMI8658GyrRange_256dps: gyro_lsb_div = 128; break;
-        case QMI8658GyrRange_512dps: gyro_lsb_div = 64; break;
-        case QMI8658GyrRange_1024dps: gyro_lsb_div = 32; break;
-        case QMI8658GyrRange_2048dps: gyro_lsb_div = 16; break;
-        case QMI8658GyrRange_4096dps: gyro_lsb_div = 8; break;
-        default: gyro_lsb_div = 64; break;
-    }
-
-    data = range | odr;
-    if (st == QMI8658St_Enable) data |= 0x80;
-    QMI8658_write_reg(QMI8658Register_Ctrl3, data);
-
-    QMI8658_read_reg(QMI8658Register_Ctrl5, &data, 1);
-    data &= 0x0f;
-    data |= (lpf == QMI8658Lpf_Enable) ? (G_LSP_MODE_3 | 0x10) : 0;
-    QMI8658_write_reg(QMI8658Register_Ctrl5, data);
+    QMI8658_write_ctrl(QMI8658Register_Ctrl3, QMI8658_gyro_ctrl(range, odr, st));
+    unsigned char ctrl5 = ctrl_shadow[QMI8658_CTRL_INDEX(QMI8658Register_Ctrl5)];
+    QMI8658_write_ctrl(QMI8658Register_Ctrl5, QMI8658_ctrl5_gyro(ctrl5, lpf));
 }
 
 void QMI8658_config_mag(QMI8658_MagDev dev, QMI8658_MagOdr odr) {
-    QMI8658_write_reg(QMI8658Register_Ctrl4, dev | odr);
+    QMI8658_write_ctrl(QMI8658Register_Ctrl4, dev | odr);
 }
 
 void QMI8658_config_ae(QMI8658_AeOdr odr) {
     QMI8658_config_acc(QMI8658_config.accRange, QMI8658_config.accOdr, QMI8658Lpf_Enable, QMI8658St_Disable);
     QMI8658_config_gyro(QMI8658_config.gyrRange, QMI8658_config.gyrOdr, QMI8658Lpf_Enable, QMI8658St_Disable);
     QMI8658_config_mag(QMI8658_config.magDev, QMI8658_config.magOdr);
-    QMI8658_write_reg(QMI8658Register_Ctrl6, odr);
+    QMI8658_write_ctrl(QMI8658Register_Ctrl6, odr);
 }
 
-void QMI8658_enableSensors(unsigned char flags) {
+static unsigned char QMI8658_sensor_flags(unsigned char flags) {
     if (flags & QMI8658_CONFIG_AE_ENABLE)
         flags |= QMI8658_CTRL7_ACC_ENABLE | QMI8658_CTRL7_GYR_ENABLE;
-    QMI8658_write_reg(QMI8658Register_Ctrl7, flags & QMI8658_CTRL7_ENABLE_MASK);
+    return flags & QMI8658_CTRL7_ENABLE_MASK;
 }
 
+void QMI8658_enableSensors(unsigned char flags) {
+    QMI8658_write_ctrl(QMI8658Register_Ctrl7, QMI8658_sensor_flags(flags));
+}
+
+// Builds the whole CTRL1..CTRL8 image first and then writes only what
+// differs from the chip, e.g. just CTRL2 + CTRL7 when leaving wake-on-motion.
 void QMI8658_Config_apply(const QMI8658Config* config) {
     unsigned char input = config->inputSelection;
-
-    if (input & QMI8658_CONFIG_AE_ENABLE) {
-        QMI8658_config_ae(config->aeOdr);
-    } else {
-        if (input & QMI8658_CONFIG_ACC_ENABLE)
-            QMI8658_config_acc(config->accRange, config->accOdr, QMI8658Lpf_Enable, QMI8658St_Disable);
-        if (input & QMI8658_CONFIG_GYR_ENABLE)
-            QMI8658_config_gyro(config->gyrRange, config->gyrOdr, QMI8658Lpf_Enable, QMI8658St_Disable);
+    unsigned char target[QMI8658_CTRL_COUNT];
+    memcpy(target, ctrl_shadow, QMI8658_CTRL_COUNT);
+    unsigned char& ctrl5 = target[QMI8658_CTRL_INDEX(QMI8658Register_Ctrl5)];
+
+    bool ae = input & QMI8658_CONFIG_AE_ENABLE;
+    if (ae || (input & QMI8658_CONFIG_ACC_ENABLE)) {
+        target[QMI8658_CTRL_INDEX(QMI8658Register_Ctrl2)] =
+            QMI8658_acc_ctrl(config->accRange, config->accOdr, QMI8658St_Disable);
+        ctrl5 = QMI8658_ctrl5_acc(ctrl5, QMI8658Lpf_Enable);
     }
+    if (ae || (input & QMI8658_CONFIG_GYR_ENABLE)) {
+        target[QMI8658_CTRL_INDEX(QMI8658Register_Ctrl3)] =
+            QMI8658_gyro_ctrl(config->gyrRange, config->gyrOdr, QMI8658St_Disable);
+        ctrl5 = QMI8658_ctrl5_gyro(ctrl5, QMI8658Lpf_Enable);
+    }
+    if (ae || (input & QMI8658_CONFIG_MAG_ENABLE))
+        target[QMI8658_CTRL_INDEX(QMI8658Register_Ctrl4)] = config->magDev | config->magOdr;
+    if (ae)
+        target[QMI8658_CTRL_INDEX(QMI8658Register_Ctrl6)] = config->aeOdr;
+    target[QMI8658_CTRL_INDEX(QMI8658Register_Ctrl7)] = QMI8658_sensor_flags(input);
 
-    if (input & QMI8658_CONFIG_MAG_ENABLE)
-        QMI8658_config_mag(config->magDev, config->magOdr);
-
-    QMI8658_enableSensors(input);
+    QMI8658_apply_ctrl(target);
 }
 
+// A failed read reports a zero sample and timestamp rather than leaving the
+// outputs as they were.
 void QMI8658_read_xyz(float acc[3], float gyro[3], unsigned int* tim_count) {
-    unsigned char buf[12];
+    unsigned char buf[QMI8658_SAMPLE_BURST];
     short raw_acc[3], raw_gyro[3];
 
+    if (!QMI8658_read_reg(QMI8658Register_Timestamp_L, buf, sizeof(buf))) memset(buf, 0, sizeof(buf));
     if (tim_count) {
-        unsigned char t[3];
-        QMI8658_read_reg(QMI8658Register_Timestamp_L, t, 3);
-        *tim_count = ((uint32_t)t[2] << 16) | ((uint32_t)t[1] << 8) | t[0];
+        *tim_count = ((uint32_t)buf[2] << 16) | ((uint32_t)buf[1] << 8) | buf[0];
     }
 
-    QMI8658_read_reg(QMI8658Register_Ax_L, buf, 12);
-
+    const unsigned char* data = &buf[QMI8658Register_Ax_L - QMI8658Register_Timestamp_L];
     for (int i = 0; i < 3; i++) {
-        raw_acc[i] = (int16_t)((buf[2 * i + 1] << 8) | buf[2 * i]);
-        raw_gyro[i] = (int16_t)((buf[2 * (i + 3) + 1] << 8) | buf[2 * (i + 3)]);
+        raw_acc[i] = (int16_t)((data[2 * i + 1] << 8) | data[2 * i]);
+        raw_gyro[i] = (int16_t)((data[2 * (i + 3) + 1] << 8) | data[2 * (i + 3)]);
         acc[i] = (float)(raw_acc[i] * 1000.0f) / acc_lsb_div;
         gyro[i] = (float)(raw_gyro[i]) / gyro_lsb_div;
     }
 }
+
+unsigned short QMI8658_get_acc_lsb_div(void) {
+    return acc_lsb_div;
+}
+
+unsigned short QMI8658_get_gyro_lsb_div(void) {
+    return gyro_lsb_div;
+}
+
+// Issues a CTRL9 command and completes the CmdDone/ack handshake.
+unsigned char QMI8658_send_ctrl9(enum QMI8658_Ctrl9Command cmd) {
+    unsigned char status = 0;
+
+    QMI8658_write_reg(QMI8658Register_Ctrl9, cmd);
+    for (int i = 0; i < 100; i++) {
+        QMI8658_read_reg(QMI8658Register_StatusInt, &status, 1);
+        if (status & QMI8658_STATUSINT_CMD_DONE) break;
+        delay(1);
+    }
+    if (!(status & QMI8658_STATUSINT_CMD_DONE)) return 0;
+
+    QMI8658_write_reg(QMI8658Register_Ctrl9, QMI8658_Ctrl9_Cmd_Ack);
+    for (int i = 0; i < 100; i++) {
+        QMI8658_read_reg(QMI8658Register_StatusInt, &status, 1);
+        if (!(status & QMI8658_STATUSINT_CMD_DONE)) return 1;
+        delay(1);
+    }
+    return 0;
+}
+
+void QMI8658_enableInterrupts(unsigned char ctrl1Flags) {
+    unsigned char ctrl1 = ctrl_shadow[QMI8658_CTRL_INDEX(QMI8658Register_Ctrl1)];
+    ctrl1 = (ctrl1 & ~(QMI8658_CTRL1_INT1_ENABLE | QMI8658_CTRL1_INT2_ENABLE | QMI8658_CTRL1_FIFO_INT1)) | ctrl1Flags;
+    QMI8658_write_ctrl(QMI8658Register_Ctrl1, ctrl1);
+}
+
+void QMI8658_enableWakeOnMotion(void) {
+    QMI8658_enableWakeOnMotion(QMI8658_Int1, QMI8658WomThreshold_low, 0x01);
+}
+
+// Accelerometer-only low power mode; the selected INT line toggles on motion.
+void QMI8658_enableWakeOnMotion(enum QMI8658_Interrupt pin, enum QMI8658_WakeOnMotionThreshold threshold, unsigned char blankingTime) {
+    QMI8658_enableSensors(QMI8658_CTRL7_DISABLE_ALL);
+    QMI8658_config_fifo(QMI8658FifoMode_Bypass, QMI8658FifoSize_16, 0);
+    QMI8658_config_acc(QMI8658_config.accRange, QMI8658AccOdr_LowPower_21Hz, QMI8658Lpf_Disable, QMI8658St_Disable);
+
+    QMI8658_write_reg(QMI8658Register_Cal1_L, threshold);
+    QMI8658_write_reg(QMI8658Register_Cal1_H, pin | QMI8658State_low | (blankingTime & 0x3F));
+    QMI8658_send_ctrl9(QMI8658_Ctrl9_Cmd_WoM_Setting);
+
+    QMI8658_enableSensors(QMI8658_CTRL7_ACC_ENABLE);
+}
+
+void QMI8658_disableWakeOnMotion(void) {
+    QMI8658_enableSensors(QMI8658_CTRL7_DISABLE_ALL);
+    QMI8658_write_reg(QMI8658Register_Cal1_L, 0);
+    QMI8658_send_ctrl9(QMI8658_Ctrl9_Cmd_WoM_Setting);
+    QMI8658_Config_apply(&QMI8658_config);
+}
+
+// watermark is in ODR frames; the FIFO interrupt follows CTRL1.FIFO_INT_SEL.
+void QMI8658_config_fifo(enum QMI8658_FifoMode mode, enum QMI8658_FifoSize size, unsigned char watermark) {
+    fifo_ctrl_value = mode | size;
+    QMI8658_write_reg(QMI8658Register_FifoWtmTh, watermark);
+    QMI8658_write_reg(QMI8658Register_FifoCtrl, fifo_ctrl_value);
+    if (mode != QMI8658FifoMode_Bypass) QMI8658_send_ctrl9(QMI8658_Ctrl9_Cmd_Rst_Fifo);
+}
+
+// Drains up to max_frames accel+gyro frames in as few bursts as the Wire
+// buffer allows. Returns the number of frames read.
+unsigned short QMI8658_read_fifo_raw(short raw_acc[][3], short raw_gyro[][3], unsigned short max_frames) {
+    const unsigned short FRAMES_PER_BURST = 120 / QMI8658_FIFO_FRAME_SIZE;
+    unsigned char cnt[2];
+    unsigned char buf[FRAMES_PER_BURST * QMI8658_FIFO_FRAME_SIZE];
+
+    if (!QMI8658_send_ctrl9(QMI8658_Ctrl9_Cmd_Req_Fifo)) return 0;
+
+    // FIFO_SMPL_CNT and the two MSBs in FIFO_STATUS count 2-byte words. If
+    // the count can't be read, drain nothing but still leave read mode.
+    unsigned short frames = 0;
+    if (QMI8658_read_reg(QMI8658Register_FifoSmplCnt, cnt, 2)) {
+        unsigned short bytes = (((unsigned short)(cnt[1] & 0x03) << 8) | cnt[0]) * 2;
+        frames = bytes / QMI8658_FIFO_FRAME_SIZE;
+        if (frames > max_frames) frames = max_frames;
+    }
+
+    unsigned short done = 0;
+    while (done < frames) {
+        unsigned short n = frames - done;
+        if (n > FRAMES_PER_BURST) n = FRAMES_PER_BURST;
+        if (!QMI8658_read_reg(QMI8658Register_FifoData, buf, n * QMI8658_FIFO_FRAME_SIZE)) break;
+        for (unsigned short f = 0; f < n; f++) {
+            const unsigned char* p = &buf[f * QMI8658_FIFO_FRAME_SIZE];
+            for (int i = 0; i < 3; i++) {
+                raw_acc[done + f][i] = (int16_t)((p[2 * i + 1] << 8) | p[2 * i]);
+                raw_gyro[done + f][i] = (int16_t)((p[2 * (i + 3) + 1] << 8) | p[2 * (i + 3)]);
+            }
+        }
+        done += n;
+    }
+
+    // Leave FIFO read mode
+    QMI8658_write_reg(QMI8658Register_FifoCtrl, fifo_ctrl_value & ~QMI8658_FIFO_CTRL_RD_MODE);
+    return done;
+}
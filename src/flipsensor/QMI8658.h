@@ -6,10 +6,10 @@
 #include <stdlib.h> //itoa()
 #include <stdio.h>
 
-#include <Wire.h>
+#include "src/i2c/I2CBus.h"
 
-unsigned char QMI8658_init();              // Default Wire
-unsigned char QMI8658_init(TwoWire& wire); // Overload for custom Wire
+unsigned char QMI8658_init();              // Re-init on the bus given before
+unsigned char QMI8658_init(I2CBus& bus);   // All transfers go through the bus task
 
 #ifndef M_PI
 #define M_PI (3.14159265358979323846f)
@@ -36,6 +36,18 @@ unsigned char QMI8658_init(TwoWire& wire); // Overload for custom Wire
 
 #define QMI8658_STATUS1_CMD_DONE (0x01)
 #define QMI8658_STATUS1_WAKEUP_EVENT (0x04)
+#define QMI8658_STATUSINT_CMD_DONE (0x80)
+
+#define QMI8658_CTRL1_INT1_ENABLE (0x08)
+#define QMI8658_CTRL1_INT2_ENABLE (0x10)
+#define QMI8658_CTRL1_FIFO_INT1 (0x04) /* FIFO interrupt on INT1 instead of INT2 */
+
+#define QMI8658_FIFO_CTRL_RD_MODE (0x80)
+#define QMI8658_FIFO_STATUS_FULL (0x80)
+#define QMI8658_FIFO_STATUS_WTM (0x40)
+#define QMI8658_FIFO_STATUS_OVERFLOW (0x20)
+#define QMI8658_FIFO_STATUS_NOT_EMPTY (0x10)
+#define QMI8658_FIFO_FRAME_SIZE (12) /* accel + gyro, 6 bytes each */
 
 enum QMI8658Register
 {
@@ -77,12 +89,16 @@ enum QMI8658Register
     QMI8658Register_Cal4_L,
     /*! \brief Calibration register 4 least significant byte. */
     QMI8658Register_Cal4_H,
+    /*! \brief FIFO watermark level, in ODR frames. */
+    QMI8658Register_FifoWtmTh = 19,
     /*! \brief FIFO control register. */
-    QMI8658Register_FifoCtrl = 19,
-    /*! \brief FIFO data register. */
-    QMI8658Register_FifoData, // 20
+    QMI8658Register_FifoCtrl, // 20
+    /*! \brief FIFO sample count, least significant byte. */
+    QMI8658Register_FifoSmplCnt, // 21
     /*! \brief FIFO status register. */
-    QMI8658Register_FifoStatus, // 21
+    QMI8658Register_FifoStatus, // 22
+    /*! \brief FIFO data register. */
+    QMI8658Register_FifoData, // 23
     /*! \brief Output data overrun and availability. */
     QMI8658Register_StatusInt = 45,
     /*! \brief Output data overrun and availability. */
@@ -227,8 +243,11 @@ enum QMI8658_Ois_Register
 enum QMI8658_Ctrl9Command
 {
     QMI8658_Ctrl9_Cmd_NOP = 0X00,
+    QMI8658_Ctrl9_Cmd_Ack = 0X00,
     QMI8658_Ctrl9_Cmd_GyroBias = 0X01,
     QMI8658_Ctrl9_Cmd_Rqst_Sdi_Mod = 0X03,
+    QMI8658_Ctrl9_Cmd_Rst_Fifo = 0X04,
+    QMI8658_Ctrl9_Cmd_Req_Fifo = 0X05,
     QMI8658_Ctrl9_Cmd_WoM_Setting = 0x08,
     QMI8658_Ctrl9_Cmd_AccelHostDeltaOffset = 0x09,
     QMI8658_Ctrl9_Cmd_GyroHostDeltaOffset = 0x0A,
@@ -236,6 +255,21 @@ enum QMI8658_Ctrl9Command
 
 };
 
+enum QMI8658_FifoMode
+{
+    QMI8658FifoMode_Bypass = 0x00, /*!< \brief FIFO disabled. */
+    QMI8658FifoMode_Fifo = 0x01,   /*!< \brief Stop collecting when full. */
+    QMI8658FifoMode_Stream = 0x02  /*!< \brief Overwrite oldest when full. */
+};
+
+enum QMI8658_FifoSize
+{
+    QMI8658FifoSize_16 = 0x00 << 2,  /*!< \brief 16 frames. */
+    QMI8658FifoSize_32 = 0x01 << 2,  /*!< \brief 32 frames. */
+    QMI8658FifoSize_64 = 0x02 << 2,  /*!< \brief 64 frames. */
+    QMI8658FifoSize_128 = 0x03 << 2  /*!< \brief 128 frames. */
+};
+
 enum QMI8658_LpfConfig
 {
     QMI8658Lpf_Disable, /*!< \brief Disable low pass filter. */
@@ -476,6 +510,13 @@ enum QMI8658_WakeOnMotionThreshold
     QMI8658WomThreshold_low = 32    /*!< Low threshold - small motion needed to wake. */
 };
 
+struct QMI8658BusStats
+{
+    unsigned long reads;          /*!< read transactions */
+    unsigned long writes;         /*!< write transactions (a burst counts once) */
+    unsigned long skippedWrites;  /*!< control writes the shadow made redundant */
+};
+
 extern unsigned char QMI8658_write_reg(unsigned char reg, unsigned char value);
 extern unsigned char QMI8658_read_reg(unsigned char reg, unsigned char *buf, unsigned short len);
 extern unsigned char QMI8658_init(void);
@@ -490,6 +531,16 @@ extern unsigned char QMI8658_readStatus0(void);
 extern unsigned char QMI8658_readStatus1(void);
 extern float QMI8658_readTemp(void);
 extern void QMI8658_enableWakeOnMotion(void);
+extern void QMI8658_enableWakeOnMotion(enum QMI8658_Interrupt pin, enum QMI8658_WakeOnMotionThreshold threshold, unsigned char blankingTime);
 extern void QMI8658_disableWakeOnMotion(void);
+extern void QMI8658_config_acc(enum QMI8658_AccRange range, enum QMI8658_AccOdr odr, enum QMI8658_LpfConfig lpf, enum QMI8658_StConfig st);
+extern void QMI8658_config_gyro(enum QMI8658_GyrRange range, enum QMI8658_GyrOdr odr, enum QMI8658_LpfConfig lpf, enum QMI8658_StConfig st);
+extern unsigned char QMI8658_send_ctrl9(enum QMI8658_Ctrl9Command cmd);
+extern void QMI8658_enableInterrupts(unsigned char ctrl1Flags);
+extern void QMI8658_config_fifo(enum QMI8658_FifoMode mode, enum QMI8658_FifoSize size, unsigned char watermark);
+extern unsigned short QMI8658_read_fifo_raw(short raw_acc[][3], short raw_gyro[][3], unsigned short max_frames);
+extern unsigned short QMI8658_get_acc_lsb_div(void);
+extern unsigned short QMI8658_get_gyro_lsb_div(void);
+extern void QMI8658_get_bus_stats(struct QMI8658BusStats *stats);
 
 #endif
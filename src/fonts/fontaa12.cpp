@@ -0,0 +1,1350 @@
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.h"
+
+// 
+//  Font data for DejaVuSansMono.ttf, 12 pixels high, anti-aliased
+//  Generated by tools/fontgen.py: 4 bits of coverage per pixel, two pixels
+//  per byte with the left one in the high nibble
+// 
+
+const uint8_t FontAA12_Table[] = 
+{
+	// @0 ' ' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @36 '!' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x44, 0x00, //  ::  
+	0x00, 0x88, 0x00, //  ++  
+	0x00, 0x88, 0x00, //  ++  
+	0x00, 0x88, 0x00, //  ++  
+	0x00, 0x77, 0x00, //  ==  
+	0x00, 0x44, 0x00, //  ::  
+	0x00, 0x22, 0x00, //  ..  
+	0x00, 0x88, 0x00, //  ++  
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @72 '"' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x03, 0x44, 0x30, // :::: 
+	0x06, 0x77, 0x60, // ==== 
+	0x06, 0x77, 0x60, // ==== 
+	0x02, 0x22, 0x20, // .... 
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @108 '#' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x32, 0x32, //  :.:.
+	0x00, 0xA2, 0xA2, //  *.*.
+	0x25, 0xD5, 0xD5, //.-%-%-
+	0x39, 0xB8, 0xC7, //:+#+#=
+	0x07, 0x66, 0x60, // ==== 
+	0xCE, 0xDE, 0xD6, //#%%%%=
+	0x0C, 0x0C, 0x00, // # #  
+	0x39, 0x2A, 0x00, //:+.*  
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @144 '$' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x25, 0x00, //  .-  
+	0x03, 0x9B, 0x70, // :+#= 
+	0x1D, 0x47, 0x50, //.%:=- 
+	0x1D, 0x36, 0x00, //.%:=  
+	0x06, 0xDC, 0x60, // =%#= 
+	0x00, 0x27, 0xB5, //  .=#-
+	0x11, 0x26, 0x86, //...=+=
+	0x1B, 0xBD, 0xA1, //.##%*.
+	0x00, 0x26, 0x00, //  .=  
+	0x00, 0x13, 0x00, //  .:  
+
+	// @180 '%' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x02, 0x10, 0x00, // ..   
+	0x98, 0xB1, 0x00, //++#.  
+	0xA0, 0x74, 0x00, //* =:  
+	0x6B, 0xA2, 0x76, //=#*.==
+	0x04, 0x87, 0x40, // :+=: 
+	0x54, 0x1B, 0x89, //-:.#++
+	0x00, 0x37, 0x0B, //  := #
+	0x00, 0x0A, 0xB6, //   *#=
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @216 '&' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x02, 0x99, 0x20, // .++. 
+	0x0C, 0x43, 0x20, // #::. 
+	0x0C, 0x20, 0x00, // #.   
+	0x0A, 0xB0, 0x00, // *#   
+	0x77, 0x97, 0x0A, //==+= *
+	0xC2, 0x1C, 0x3B, //#..#:#
+	0xA5, 0x03, 0xE6, //*- :%=
+	0x2D, 0xAB, 0xAA, //.%*#**
+	0x00, 0x21, 0x00, //  ..  
+	0x00, 0x00, 0x00, //      
+
+	// @252 ''' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x33, 0x00, //  ::  
+	0x00, 0x76, 0x00, //  ==  
+	0x00, 0x76, 0x00, //  ==  
+	0x00, 0x22, 0x00, //  ..  
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @288 '(' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x08, 0x20, //   +. 
+	0x00, 0x3A, 0x00, //  :*  
+	0x00, 0x95, 0x00, //  +-  
+	0x00, 0xC2, 0x00, //  #.  
+	0x00, 0xE1, 0x00, //  %.  
+	0x00, 0xE1, 0x00, //  %.  
+	0x00, 0xB3, 0x00, //  #:  
+	0x00, 0x67, 0x00, //  ==  
+	0x00, 0x1C, 0x00, //  .#  
+	0x00, 0x03, 0x10, //   :. 
+
+	// @324 ')' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x02, 0x80, 0x00, // .+   
+	0x00, 0xA3, 0x00, //  *:  
+	0x00, 0x59, 0x00, //  -+  
+	0x00, 0x2C, 0x00, //  .#  
+	0x00, 0x1E, 0x00, //  .%  
+	0x00, 0x1E, 0x00, //  .%  
+	0x00, 0x3B, 0x00, //  :#  
+	0x00, 0x86, 0x00, //  +=  
+	0x00, 0xC1, 0x00, //  #.  
+	0x01, 0x30, 0x00, // .:   
+
+	// @360 '*' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x33, 0x00, //  ::  
+	0x17, 0x55, 0x71, //.=--=.
+	0x02, 0xCC, 0x20, // .##. 
+	0x19, 0x88, 0x91, //.++++.
+	0x00, 0x44, 0x00, //  ::  
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @396 '+' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x66, 0x00, //  ==  
+	0x00, 0x66, 0x00, //  ==  
+	0x7A, 0xCC, 0xA7, //=*##*=
+	0x23, 0x88, 0x32, //.:++:.
+	0x00, 0x66, 0x00, //  ==  
+	0x00, 0x33, 0x00, //  ::  
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @432 ',' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x45, 0x00, //  :-  
+	0x00, 0x99, 0x00, //  ++  
+	0x00, 0xC3, 0x00, //  #:  
+	0x00, 0x50, 0x00, //  -   
+
+	// @468 '-' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x01, 0x44, 0x10, // .::. 
+	0x03, 0x88, 0x30, // :++: 
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @504 '.' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x55, 0x00, //  --  
+	0x00, 0xA9, 0x00, //  *+  
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @540 '/' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x62, //    =.
+	0x00, 0x02, 0xC0, //   .# 
+	0x00, 0x09, 0x60, //   += 
+	0x00, 0x1D, 0x00, //  .%  
+	0x00, 0x87, 0x00, //  +=  
+	0x01, 0xD1, 0x00, // .%.  
+	0x07, 0x80, 0x00, // =+   
+	0x0D, 0x10, 0x00, // %.   
+	0x58, 0x00, 0x00, //-+    
+	0x00, 0x00, 0x00, //      
+
+	// @576 '0' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x02, 0x99, 0x20, // .++. 
+	0x0D, 0x55, 0xD0, // %--% 
+	0x4B, 0x00, 0xB4, //:#  #:
+	0x69, 0x33, 0x96, //=+::+=
+	0x69, 0x77, 0x96, //=+==+=
+	0x5A, 0x00, 0xA5, //-*  *-
+	0x2D, 0x11, 0xD2, //.%..%.
+	0x08, 0xCC, 0x70, // +##= 
+	0x00, 0x11, 0x00, //  ..  
+	0x00, 0x00, 0x00, //      
+
+	// @612 '1' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x03, 0x76, 0x00, // :==  
+	0x09, 0x9D, 0x00, // ++%  
+	0x00, 0x2D, 0x00, //  .%  
+	0x00, 0x2D, 0x00, //  .%  
+	0x00, 0x2D, 0x00, //  .%  
+	0x00, 0x2D, 0x00, //  .%  
+	0x00, 0x2D, 0x00, //  .%  
+	0x0A, 0xDF, 0xD5, // *%@%-
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @648 '2' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x17, 0x98, 0x20, //.=++. 
+	0x37, 0x47, 0xD0, //:=:=% 
+	0x00, 0x00, 0xE2, //    %.
+	0x00, 0x03, 0xD0, //   :% 
+	0x00, 0x1C, 0x40, //  .#: 
+	0x01, 0xB5, 0x00, // .#-  
+	0x0B, 0x60, 0x00, // #=   
+	0x5F, 0xDD, 0xD3, //-@%%%:
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @684 '3' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x17, 0x98, 0x20, //.=++. 
+	0x26, 0x36, 0xD0, //.=:=% 
+	0x00, 0x00, 0xE2, //    %.
+	0x01, 0x7A, 0x90, // .=*+ 
+	0x01, 0x69, 0xA0, // .=+* 
+	0x00, 0x00, 0xB4, //    #:
+	0x10, 0x00, 0xD3, //.   %:
+	0x5D, 0xBD, 0x90, //-%#%+ 
+	0x00, 0x21, 0x00, //  ..  
+	0x00, 0x00, 0x00, //      
+
+	// @720 '4' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x06, 0x50, //   =- 
+	0x00, 0x3D, 0x90, //  :%+ 
+	0x00, 0xB7, 0x90, //  #=+ 
+	0x07, 0x56, 0x90, // =-=+ 
+	0x2B, 0x06, 0x90, //.# =+ 
+	0x9B, 0x9C, 0xD6, //+#+#%=
+	0x23, 0x38, 0xA2, //.::+*.
+	0x00, 0x06, 0x90, //   =+ 
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @756 '5' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x08, 0x88, 0x60, // +++= 
+	0x1E, 0x55, 0x30, //.%--: 
+	0x1D, 0x00, 0x00, //.%    
+	0x1E, 0xDD, 0x50, //.%%%- 
+	0x01, 0x03, 0xE1, // . :%.
+	0x00, 0x00, 0xC4, //    #:
+	0x10, 0x01, 0xE2, //.  .%.
+	0x5D, 0xBE, 0x70, //-%#%= 
+	0x01, 0x21, 0x00, // ...  
+	0x00, 0x00, 0x00, //      
+
+	// @792 '6' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x01, 0x79, 0x70, // .=+= 
+	0x0C, 0x83, 0x50, // #+:- 
+	0x3B, 0x00, 0x00, //:#    
+	0x6A, 0xBC, 0x80, //=*##+ 
+	0x6E, 0x10, 0xC4, //=%. #:
+	0x5B, 0x00, 0x96, //-#  +=
+	0x2D, 0x00, 0xB5, //.%  #-
+	0x08, 0xCB, 0xB0, // +### 
+	0x00, 0x11, 0x00, //  ..  
+	0x00, 0x00, 0x00, //      
+
+	// @828 '7' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x38, 0x88, 0x82, //:++++.
+	0x25, 0x55, 0xE2, //.---%.
+	0x00, 0x04, 0xB0, //   :# 
+	0x00, 0x0A, 0x50, //   *- 
+	0x00, 0x1E, 0x00, //  .%  
+	0x00, 0x79, 0x00, //  =+  
+	0x00, 0xC3, 0x00, //  #:  
+	0x03, 0xC0, 0x00, // :#   
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @864 '8' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x03, 0x99, 0x30, // :++: 
+	0x2E, 0x44, 0xE2, //.%::%.
+	0x3C, 0x00, 0xC3, //:#  #:
+	0x0A, 0x77, 0xA0, // *==* 
+	0x1A, 0x88, 0xA1, //.*++*.
+	0x5A, 0x00, 0xA5, //-*  *-
+	0x5B, 0x00, 0xB5, //-#  #-
+	0x1B, 0xCC, 0xB1, //.####.
+	0x00, 0x11, 0x00, //  ..  
+	0x00, 0x00, 0x00, //      
+
+	// @900 '9' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x04, 0x98, 0x20, // :++. 
+	0x2D, 0x45, 0xD0, //.%:-% 
+	0x69, 0x00, 0xC4, //=+  #:
+	0x69, 0x00, 0xC6, //=+  #=
+	0x2D, 0x78, 0xD6, //.%=+%=
+	0x02, 0x64, 0xA4, // .=:*:
+	0x00, 0x02, 0xD1, //   .%.
+	0x0C, 0xBD, 0x50, // ##%- 
+	0x00, 0x20, 0x00, //  .   
+	0x00, 0x00, 0x00, //      
+
+	// @936 ':' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x44, 0x00, //  ::  
+	0x00, 0xA9, 0x00, //  *+  
+	0x00, 0x22, 0x00, //  ..  
+	0x00, 0x00, 0x00, //      
+	0x00, 0x55, 0x00, //  --  
+	0x00, 0xA9, 0x00, //  *+  
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @972 ';' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x44, 0x00, //  ::  
+	0x00, 0xA9, 0x00, //  *+  
+	0x00, 0x22, 0x00, //  ..  
+	0x00, 0x00, 0x00, //      
+	0x00, 0x45, 0x00, //  :-  
+	0x00, 0x99, 0x00, //  ++  
+	0x00, 0xC3, 0x00, //  #:  
+	0x00, 0x50, 0x00, //  -   
+
+	// @1008 '<' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x46, //    :=
+	0x02, 0x8C, 0x93, // .+#+:
+	0x8D, 0x51, 0x00, //+%-.  
+	0x3A, 0xC7, 0x10, //:*#=. 
+	0x00, 0x17, 0xC7, //  .=#=
+	0x00, 0x00, 0x02, //     .
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @1044 '=' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x7A, 0xAA, 0xA7, //=****=
+	0x23, 0x33, 0x32, //.::::.
+	0x69, 0x99, 0x96, //=++++=
+	0x24, 0x44, 0x42, //.::::.
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @1080 '>' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x64, 0x00, 0x00, //=:    
+	0x39, 0xC8, 0x20, //:+#+. 
+	0x00, 0x15, 0xD8, //  .-%+
+	0x01, 0x7C, 0xA3, // .=#*:
+	0x7C, 0x71, 0x00, //=#=.  
+	0x20, 0x00, 0x00, //.     
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @1116 '?' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x04, 0x99, 0x30, // :++: 
+	0x08, 0x45, 0xE1, // +:-%.
+	0x00, 0x01, 0xE1, //   .%.
+	0x00, 0x0B, 0x60, //   #= 
+	0x00, 0x78, 0x00, //  =+  
+	0x00, 0x95, 0x00, //  +-  
+	0x00, 0x21, 0x00, //  ..  
+	0x00, 0xA6, 0x00, //  *=  
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @1152 '@' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x05, 0xBB, 0xB2, // -###.
+	0x4A, 0x00, 0x3A, //:*  :*
+	0xB1, 0x4B, 0xAB, //#.:#*#
+	0xB0, 0xC1, 0x2C, //# #..#
+	0xB0, 0xC0, 0x0B, //# #  #
+	0xB0, 0xA7, 0x8C, //# *=+#
+	0x85, 0x05, 0x43, //+- -::
+	0x1B, 0x62, 0x30, //.#=.: 
+	0x00, 0x59, 0x81, //  -++.
+
+	// @1188 'A' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x55, 0x00, //  --  
+	0x00, 0xDD, 0x00, //  %%  
+	0x04, 0xAA, 0x40, // :**: 
+	0x08, 0x66, 0x80, // +==+ 
+	0x0D, 0x22, 0xD0, // %..% 
+	0x2F, 0xBB, 0xF2, //.@##@.
+	0x79, 0x11, 0x97, //=+..+=
+	0xB4, 0x00, 0x4B, //#:  :#
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @1224 'B' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x28, 0x87, 0x20, //.++=. 
+	0x4C, 0x56, 0xD2, //:#-=%.
+	0x4B, 0x00, 0xB5, //:#  #-
+	0x4D, 0x78, 0xC1, //:%=+#.
+	0x4D, 0x77, 0xC2, //:%==#.
+	0x4B, 0x00, 0x78, //:#  =+
+	0x4B, 0x00, 0x98, //:#  ++
+	0x4E, 0xCD, 0xB1, //:%#%#.
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @1260 'C' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x69, 0x81, //  =++.
+	0x0A, 0x93, 0x53, // *+:-:
+	0x2D, 0x00, 0x00, //.%    
+	0x5B, 0x00, 0x00, //-#    
+	0x6A, 0x00, 0x00, //=*    
+	0x4C, 0x00, 0x00, //:#    
+	0x1E, 0x30, 0x01, //.%:  .
+	0x04, 0xDB, 0xD4, // :%#%:
+	0x00, 0x02, 0x10, //   .. 
+	0x00, 0x00, 0x00, //      
+
+	// @1296 'D' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x38, 0x75, 0x00, //:+=-  
+	0x6B, 0x5A, 0xA0, //=#-** 
+	0x69, 0x00, 0xD3, //=+  %:
+	0x69, 0x00, 0xA6, //=+  *=
+	0x69, 0x00, 0x97, //=+  +=
+	0x69, 0x00, 0xB5, //=+  #-
+	0x69, 0x03, 0xE1, //=+ :%.
+	0x6E, 0xDC, 0x40, //=%%#: 
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @1332 'E' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x18, 0x88, 0x83, //.++++:
+	0x2E, 0x55, 0x52, //.%---.
+	0x2E, 0x00, 0x00, //.%    
+	0x2E, 0x77, 0x71, //.%===.
+	0x2E, 0x77, 0x71, //.%===.
+	0x2E, 0x00, 0x00, //.%    
+	0x2E, 0x00, 0x00, //.%    
+	0x2F, 0xDD, 0xD6, //.@%%%=
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @1368 'F' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x07, 0x88, 0x84, // =+++:
+	0x0E, 0x65, 0x52, // %=--.
+	0x0E, 0x10, 0x00, // %.   
+	0x0E, 0x77, 0x71, // %===.
+	0x0E, 0x77, 0x71, // %===.
+	0x0E, 0x10, 0x00, // %.   
+	0x0E, 0x10, 0x00, // %.   
+	0x0E, 0x10, 0x00, // %.   
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @1404 'G' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x01, 0x79, 0x70, // .=+= 
+	0x0C, 0x73, 0x73, // #=:=:
+	0x5B, 0x00, 0x00, //-#    
+	0x88, 0x00, 0x00, //++    
+	0x97, 0x08, 0xD6, //+= +%=
+	0x79, 0x00, 0x87, //=+  +=
+	0x2D, 0x10, 0x87, //.%. +=
+	0x06, 0xDB, 0xD4, // =%#%:
+	0x00, 0x12, 0x00, //  ..  
+	0x00, 0x00, 0x00, //      
+
+	// @1440 'H' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x35, 0x00, 0x53, //:-  -:
+	0x69, 0x00, 0x96, //=+  +=
+	0x69, 0x00, 0x96, //=+  +=
+	0x6C, 0x77, 0xC6, //=#==#=
+	0x6C, 0x77, 0xC6, //=#==#=
+	0x69, 0x00, 0x96, //=+  +=
+	0x69, 0x00, 0x96, //=+  +=
+	0x69, 0x00, 0x96, //=+  +=
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @1476 'I' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x18, 0x88, 0x81, //.++++.
+	0x05, 0xAA, 0x50, // -**- 
+	0x00, 0x88, 0x00, //  ++  
+	0x00, 0x88, 0x00, //  ++  
+	0x00, 0x88, 0x00, //  ++  
+	0x00, 0x88, 0x00, //  ++  
+	0x00, 0x88, 0x00, //  ++  
+	0x1D, 0xEE, 0xD1, //.%%%%.
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @1512 'J' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x02, 0x88, 0x50, // .++- 
+	0x01, 0x58, 0xB0, // .-+# 
+	0x00, 0x05, 0xB0, //   -# 
+	0x00, 0x05, 0xB0, //   -# 
+	0x00, 0x05, 0xB0, //   -# 
+	0x00, 0x05, 0xB0, //   -# 
+	0x20, 0x07, 0x90, //.  =+ 
+	0x7D, 0xBD, 0x30, //=%#%: 
+	0x01, 0x20, 0x00, // ..   
+	0x00, 0x00, 0x00, //      
+
+	// @1548 'K' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x35, 0x00, 0x45, //:-  :-
+	0x69, 0x03, 0xD2, //=+ :%.
+	0x69, 0x3D, 0x20, //=+:%. 
+	0x6B, 0xE4, 0x00, //=#%:  
+	0x6E, 0x9A, 0x00, //=%+*  
+	0x69, 0x0C, 0x60, //=+ #= 
+	0x69, 0x03, 0xE2, //=+ :%.
+	0x69, 0x00, 0x7B, //=+  =#
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @1584 'L' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x08, 0x00, 0x00, // +    
+	0x0F, 0x00, 0x00, // @    
+	0x0F, 0x00, 0x00, // @    
+	0x0F, 0x00, 0x00, // @    
+	0x0F, 0x00, 0x00, // @    
+	0x0F, 0x00, 0x00, // @    
+	0x0F, 0x00, 0x00, // @    
+	0x0F, 0xDD, 0xD8, // @%%%+
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @1620 'M' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x56, 0x00, 0x65, //-=  =-
+	0xAE, 0x11, 0xEA, //*%..%*
+	0xA9, 0x66, 0x9A, //*+==+*
+	0xA5, 0xAA, 0x5A, //*-**-*
+	0xA4, 0xAA, 0x4A, //*:**:*
+	0xA4, 0x22, 0x4A, //*:..:*
+	0xA4, 0x00, 0x4A, //*:  :*
+	0xA4, 0x00, 0x4A, //*:  :*
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @1656 'N' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x37, 0x00, 0x43, //:=  ::
+	0x6F, 0x50, 0x96, //=@- +=
+	0x6B, 0xB0, 0x96, //=## +=
+	0x69, 0xB2, 0x96, //=+#.+=
+	0x69, 0x58, 0x96, //=+-++=
+	0x69, 0x0C, 0x96, //=+ #+=
+	0x69, 0x08, 0xE6, //=+ +%=
+	0x69, 0x02, 0xF6, //=+ .@=
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @1692 'O' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x02, 0x99, 0x20, // .++. 
+	0x1D, 0x55, 0xD1, //.%--%.
+	0x5B, 0x00, 0xB5, //-#  #-
+	0x79, 0x00, 0x97, //=+  +=
+	0x88, 0x00, 0x88, //++  ++
+	0x69, 0x00, 0x96, //=+  +=
+	0x3D, 0x00, 0xD3, //:%  %:
+	0x09, 0xCC, 0x90, // +##+ 
+	0x00, 0x11, 0x00, //  ..  
+	0x00, 0x00, 0x00, //      
+
+	// @1728 'P' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x18, 0x87, 0x30, //.++=: 
+	0x2E, 0x56, 0xD5, //.%-=%-
+	0x2E, 0x00, 0x79, //.%  =+
+	0x2E, 0x00, 0xA8, //.%  *+
+	0x2F, 0xDD, 0xA1, //.@%%*.
+	0x2E, 0x00, 0x00, //.%    
+	0x2E, 0x00, 0x00, //.%    
+	0x2E, 0x00, 0x00, //.%    
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @1764 'Q' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x02, 0x99, 0x20, // .++. 
+	0x1D, 0x55, 0xD1, //.%--%.
+	0x5B, 0x00, 0xB5, //-#  #-
+	0x79, 0x00, 0x97, //=+  +=
+	0x88, 0x00, 0x88, //++  ++
+	0x69, 0x00, 0x96, //=+  +=
+	0x3D, 0x00, 0xD3, //:%  %:
+	0x09, 0xCC, 0x90, // +##+ 
+	0x00, 0x17, 0xB0, //  .=# 
+	0x00, 0x00, 0x20, //    . 
+
+	// @1800 'R' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x38, 0x86, 0x10, //:++=. 
+	0x6B, 0x58, 0xD1, //=#-+%.
+	0x6A, 0x00, 0xD4, //=*  %:
+	0x6A, 0x03, 0xE1, //=* :%.
+	0x6E, 0xCE, 0x40, //=%#%: 
+	0x6A, 0x04, 0xC0, //=* :# 
+	0x6A, 0x00, 0xA5, //=*  *-
+	0x6A, 0x00, 0x3D, //=*  :%
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @1836 'S' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x03, 0x99, 0x60, // :++= 
+	0x2D, 0x43, 0x80, //.%::+ 
+	0x69, 0x00, 0x00, //=+    
+	0x2E, 0x83, 0x00, //.%+:  
+	0x02, 0x8C, 0xC1, // .+##.
+	0x00, 0x00, 0xA5, //    *-
+	0x11, 0x00, 0xA5, //..  *-
+	0x3D, 0xBC, 0xB1, //:%###.
+	0x00, 0x21, 0x00, //  ..  
+	0x00, 0x00, 0x00, //      
+
+	// @1872 'T' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x68, 0x88, 0x86, //=++++=
+	0x45, 0xAA, 0x54, //:-**-:
+	0x00, 0x88, 0x00, //  ++  
+	0x00, 0x88, 0x00, //  ++  
+	0x00, 0x88, 0x00, //  ++  
+	0x00, 0x88, 0x00, //  ++  
+	0x00, 0x88, 0x00, //  ++  
+	0x00, 0x88, 0x00, //  ++  
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @1908 'U' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x35, 0x00, 0x53, //:-  -:
+	0x5A, 0x00, 0xA5, //-*  *-
+	0x5A, 0x00, 0xA5, //-*  *-
+	0x5A, 0x00, 0xA5, //-*  *-
+	0x5A, 0x00, 0xA5, //-*  *-
+	0x5A, 0x00, 0xA5, //-*  *-
+	0x4B, 0x00, 0xB4, //:#  #:
+	0x0A, 0xCC, 0xA0, // *##* 
+	0x00, 0x11, 0x00, //  ..  
+	0x00, 0x00, 0x00, //      
+
+	// @1944 'V' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x62, 0x00, 0x26, //=.  .=
+	0x88, 0x00, 0x88, //++  ++
+	0x3C, 0x00, 0xC3, //:#  #:
+	0x0E, 0x11, 0xE0, // %..% 
+	0x0A, 0x45, 0xA0, // *:-* 
+	0x05, 0x88, 0x50, // -++- 
+	0x01, 0xCC, 0x10, // .##. 
+	0x00, 0xBB, 0x00, //  ##  
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @1980 'W' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x70, 0x00, 0x07, //=    =
+	0xE0, 0x00, 0x0E, //%    %
+	0xC2, 0x44, 0x2C, //#.::.#
+	0xA4, 0xBB, 0x4A, //*:##:*
+	0x86, 0xBB, 0x68, //+=##=+
+	0x5A, 0x88, 0xA5, //-*++*-
+	0x3E, 0x55, 0xE3, //:%--%:
+	0x1F, 0x11, 0xF1, //.@..@.
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @2016 'X' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x44, 0x00, 0x35, //::  :-
+	0x2D, 0x10, 0xC3, //.%. #:
+	0x06, 0x97, 0x80, // =+=+ 
+	0x00, 0xCC, 0x10, //  ##. 
+	0x00, 0xCC, 0x00, //  ##  
+	0x06, 0x98, 0x70, // =++= 
+	0x2D, 0x11, 0xD2, //.%..%.
+	0xA6, 0x00, 0x6B, //*=  =#
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @2052 'Y' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x62, 0x00, 0x26, //=.  .=
+	0x5B, 0x00, 0xB5, //-#  #-
+	0x0B, 0x44, 0xB0, // #::# 
+	0x03, 0xCC, 0x30, // :##: 
+	0x00, 0x99, 0x00, //  ++  
+	0x00, 0x88, 0x00, //  ++  
+	0x00, 0x88, 0x00, //  ++  
+	0x00, 0x88, 0x00, //  ++  
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @2088 'Z' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x28, 0x88, 0x85, //.++++-
+	0x15, 0x55, 0xC7, //.---#=
+	0x00, 0x04, 0xC0, //   :# 
+	0x00, 0x1D, 0x30, //  .%: 
+	0x00, 0x88, 0x00, //  ++  
+	0x03, 0xC0, 0x00, // :#   
+	0x0C, 0x30, 0x00, // #:   
+	0x5F, 0xDD, 0xDA, //-@%%%*
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @2124 '[' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x9B, 0x40, //  +#: 
+	0x00, 0xC2, 0x00, //  #.  
+	0x00, 0xC2, 0x00, //  #.  
+	0x00, 0xC2, 0x00, //  #.  
+	0x00, 0xC2, 0x00, //  #.  
+	0x00, 0xC2, 0x00, //  #.  
+	0x00, 0xC2, 0x00, //  #.  
+	0x00, 0xC2, 0x00, //  #.  
+	0x00, 0xC7, 0x20, //  #=. 
+	0x00, 0x46, 0x20, //  :=. 
+
+	// @2160 '\' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x34, 0x00, 0x00, //::    
+	0x2C, 0x00, 0x00, //.#    
+	0x0A, 0x50, 0x00, // *-   
+	0x03, 0xC0, 0x00, // :#   
+	0x00, 0xB4, 0x00, //  #:  
+	0x00, 0x4B, 0x00, //  :#  
+	0x00, 0x0C, 0x30, //   #: 
+	0x00, 0x05, 0xA0, //   -* 
+	0x00, 0x00, 0xC2, //    #.
+	0x00, 0x00, 0x00, //      
+
+	// @2196 ']' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x04, 0xB9, 0x00, // :#+  
+	0x00, 0x2C, 0x00, //  .#  
+	0x00, 0x2C, 0x00, //  .#  
+	0x00, 0x2C, 0x00, //  .#  
+	0x00, 0x2C, 0x00, //  .#  
+	0x00, 0x2C, 0x00, //  .#  
+	0x00, 0x2C, 0x00, //  .#  
+	0x00, 0x2C, 0x00, //  .#  
+	0x02, 0x7C, 0x00, // .=#  
+	0x02, 0x64, 0x00, // .=:  
+
+	// @2232 '^' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x55, 0x00, //  --  
+	0x04, 0xBB, 0x40, // :##: 
+	0x2B, 0x11, 0xB2, //.#..#.
+	0x31, 0x00, 0x13, //:.  .:
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @2268 '_' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @2304 '`' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x02, 0x10, 0x00, // ..   
+	0x02, 0xB1, 0x00, // .#.  
+	0x00, 0x34, 0x00, //  ::  
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @2340 'a' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x08, 0xBB, 0x40, // +##: 
+	0x05, 0x12, 0xD1, // -..%.
+	0x03, 0x88, 0xD3, // :++%:
+	0x3C, 0x43, 0xC3, //:#::#:
+	0x68, 0x01, 0xE3, //=+ .%:
+	0x2D, 0xAB, 0xC3, //.%*##:
+	0x00, 0x20, 0x00, //  .   
+	0x00, 0x00, 0x00, //      
+
+	// @2376 'b' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x2A, 0x00, 0x00, //.*    
+	0x2C, 0x00, 0x00, //.#    
+	0x2C, 0x8B, 0x50, //.#+#- 
+	0x2F, 0x42, 0xD3, //.@:.%:
+	0x2D, 0x00, 0x87, //.%  +=
+	0x2C, 0x00, 0x87, //.#  +=
+	0x2E, 0x10, 0xB5, //.%. #-
+	0x2D, 0xBB, 0xB0, //.%### 
+	0x00, 0x02, 0x00, //   .  
+	0x00, 0x00, 0x00, //      
+
+	// @2412 'c' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x01, 0x8B, 0xA1, // .+#*.
+	0x0B, 0x71, 0x32, // #=.:.
+	0x1E, 0x00, 0x00, //.%    
+	0x1D, 0x00, 0x00, //.%    
+	0x0D, 0x30, 0x01, // %:  .
+	0x04, 0xDA, 0xC3, // :%*#:
+	0x00, 0x02, 0x10, //   .. 
+	0x00, 0x00, 0x00, //      
+
+	// @2448 'd' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0xA2, //    *.
+	0x00, 0x00, 0xC2, //    #.
+	0x05, 0xB8, 0xC2, // -#+#.
+	0x2D, 0x24, 0xF2, //.%.:@.
+	0x68, 0x00, 0xD2, //=+  %.
+	0x78, 0x00, 0xC2, //=+  #.
+	0x4B, 0x01, 0xE2, //:# .%.
+	0x0B, 0xBB, 0xD2, // ###%.
+	0x00, 0x20, 0x00, //  .   
+	0x00, 0x00, 0x00, //      
+
+	// @2484 'e' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x03, 0xAB, 0x50, // :*#- 
+	0x2D, 0x31, 0xC3, //.%:.#:
+	0x6B, 0x55, 0xA7, //=#--*=
+	0x7A, 0x66, 0x63, //=*===:
+	0x4B, 0x00, 0x01, //:#   .
+	0x08, 0xCA, 0xC3, // +#*#:
+	0x00, 0x12, 0x00, //  ..  
+	0x00, 0x00, 0x00, //      
+
+	// @2520 'f' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x2B, 0xB3, //  .##:
+	0x00, 0x86, 0x00, //  +=  
+	0x19, 0xDB, 0x92, //.+%#+.
+	0x01, 0xA5, 0x10, // .*-. 
+	0x00, 0x95, 0x00, //  +-  
+	0x00, 0x95, 0x00, //  +-  
+	0x00, 0x95, 0x00, //  +-  
+	0x00, 0x95, 0x00, //  +-  
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @2556 'g' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x05, 0xB8, 0x81, // -#++.
+	0x2D, 0x24, 0xF2, //.%.:@.
+	0x68, 0x00, 0xD2, //=+  %.
+	0x78, 0x00, 0xC2, //=+  #.
+	0x4C, 0x01, 0xE2, //:# .%.
+	0x09, 0xCB, 0xD2, // +##%.
+	0x00, 0x00, 0xD1, //    %.
+	0x0A, 0x9B, 0x80, // *+#+ 
+
+	// @2592 'h' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x1A, 0x00, 0x00, //.*    
+	0x2C, 0x00, 0x00, //.#    
+	0x2C, 0x7B, 0x60, //.#=#= 
+	0x2F, 0x42, 0xE1, //.@:.%.
+	0x2D, 0x00, 0xB3, //.%  #:
+	0x2C, 0x00, 0xB3, //.#  #:
+	0x2C, 0x00, 0xB3, //.#  #:
+	0x2C, 0x00, 0xB3, //.#  #:
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @2628 'i' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x57, 0x00, //  -=  
+	0x00, 0x23, 0x00, //  .:  
+	0x08, 0x95, 0x00, // ++-  
+	0x01, 0x68, 0x00, // .=+  
+	0x00, 0x68, 0x00, //  =+  
+	0x00, 0x68, 0x00, //  =+  
+	0x00, 0x68, 0x00, //  =+  
+	0x2B, 0xDD, 0xB4, //.#%%#:
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @2664 'j' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x1A, 0x00, //  .*  
+	0x00, 0x04, 0x00, //   :  
+	0x06, 0x98, 0x00, // =++  
+	0x01, 0x2D, 0x00, // ..%  
+	0x00, 0x1D, 0x00, //  .%  
+	0x00, 0x1D, 0x00, //  .%  
+	0x00, 0x1D, 0x00, //  .%  
+	0x00, 0x1D, 0x00, //  .%  
+	0x00, 0x2C, 0x00, //  .#  
+	0x29, 0xC6, 0x00, //.+#=  
+
+	// @2700 'k' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x0B, 0x10, 0x00, // #.   
+	0x0E, 0x10, 0x00, // %.   
+	0x0E, 0x10, 0x82, // %. +.
+	0x0E, 0x1A, 0x60, // %.*= 
+	0x0E, 0xB9, 0x00, // %#+  
+	0x0E, 0x6D, 0x20, // %=%. 
+	0x0E, 0x14, 0xC0, // %.:# 
+	0x0E, 0x10, 0x89, // %. ++
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @2736 'l' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x3A, 0xD1, 0x00, //:*%.  
+	0x00, 0xC2, 0x00, //  #.  
+	0x00, 0xC2, 0x00, //  #.  
+	0x00, 0xC2, 0x00, //  #.  
+	0x00, 0xC2, 0x00, //  #.  
+	0x00, 0xC2, 0x00, //  #.  
+	0x00, 0xB3, 0x00, //  #:  
+	0x00, 0x4D, 0xC1, //  :%#.
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @2772 'm' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x58, 0xB6, 0xB2, //-+#=#.
+	0x87, 0x89, 0x58, //+=++-+
+	0x84, 0x67, 0x49, //+:==:+
+	0x84, 0x67, 0x49, //+:==:+
+	0x84, 0x67, 0x49, //+:==:+
+	0x84, 0x67, 0x49, //+:==:+
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @2808 'n' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x18, 0x7B, 0x60, //.+=#= 
+	0x2F, 0x42, 0xE1, //.@:.%.
+	0x2D, 0x00, 0xB3, //.%  #:
+	0x2C, 0x00, 0xB3, //.#  #:
+	0x2C, 0x00, 0xB3, //.#  #:
+	0x2C, 0x00, 0xB3, //.#  #:
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @2844 'o' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x04, 0xBB, 0x40, // :##: 
+	0x2D, 0x33, 0xD2, //.%::%.
+	0x59, 0x00, 0x95, //-+  +-
+	0x69, 0x00, 0x96, //=+  +=
+	0x3C, 0x00, 0xC3, //:#  #:
+	0x09, 0xCC, 0x90, // +##+ 
+	0x00, 0x11, 0x00, //  ..  
+	0x00, 0x00, 0x00, //      
+
+	// @2880 'p' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x18, 0x8B, 0x50, //.++#- 
+	0x2F, 0x42, 0xD2, //.@:.%.
+	0x2D, 0x00, 0x86, //.%  +=
+	0x2C, 0x00, 0x87, //.#  +=
+	0x2E, 0x10, 0xB4, //.%. #:
+	0x2D, 0xBB, 0xA0, //.%##* 
+	0x2C, 0x02, 0x00, //.# .  
+	0x2C, 0x00, 0x00, //.#    
+
+	// @2916 'q' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x04, 0xB8, 0x72, // :#+=.
+	0x2D, 0x34, 0xF3, //.%::@:
+	0x59, 0x00, 0xC3, //-+  #:
+	0x69, 0x00, 0xB3, //=+  #:
+	0x3C, 0x00, 0xE3, //:#  %:
+	0x0A, 0xBB, 0xD3, // *##%:
+	0x00, 0x21, 0xB3, //  ..#:
+	0x00, 0x00, 0xB3, //    #:
+
+	// @2952 'r' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x03, 0x67, 0xB6, // :==#=
+	0x04, 0xE5, 0x23, // :%-.:
+	0x04, 0xB0, 0x00, // :#   
+	0x04, 0xA0, 0x00, // :*   
+	0x04, 0xA0, 0x00, // :*   
+	0x04, 0xA0, 0x00, // :*   
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @2988 's' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x04, 0xBB, 0x70, // :##= 
+	0x0E, 0x20, 0x30, // %. : 
+	0x0D, 0x73, 0x00, // %=:  
+	0x01, 0x7B, 0xB0, // .=## 
+	0x00, 0x00, 0xE1, //    %.
+	0x0D, 0xAC, 0x90, // %*#+ 
+	0x00, 0x21, 0x00, //  ..  
+	0x00, 0x00, 0x00, //      
+
+	// @3024 't' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x30, 0x00, //  :   
+	0x00, 0xE0, 0x00, //  %   
+	0x49, 0xF9, 0x91, //:+@++.
+	0x01, 0xE1, 0x10, // .%.. 
+	0x00, 0xE0, 0x00, //  %   
+	0x00, 0xE0, 0x00, //  %   
+	0x00, 0xE1, 0x00, //  %.  
+	0x00, 0x7C, 0xB1, //  =##.
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @3060 'u' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x18, 0x00, 0x72, //.+  =.
+	0x2C, 0x00, 0xB3, //.#  #:
+	0x2C, 0x00, 0xB3, //.#  #:
+	0x2C, 0x00, 0xB3, //.#  #:
+	0x1D, 0x00, 0xE3, //.%  %:
+	0x0A, 0xCB, 0xC3, // *###:
+	0x00, 0x20, 0x00, //  .   
+	0x00, 0x00, 0x00, //      
+
+	// @3096 'v' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x54, 0x00, 0x45, //-:  :-
+	0x3B, 0x00, 0xB3, //:#  #:
+	0x0C, 0x22, 0xC0, // #..# 
+	0x07, 0x77, 0x70, // ==== 
+	0x02, 0xCC, 0x20, // .##. 
+	0x00, 0xCC, 0x00, //  ##  
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @3132 'w' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x80, 0x00, 0x08, //+    +
+	0xC1, 0x00, 0x1C, //#.  .#
+	0x94, 0x88, 0x49, //+:++:+
+	0x67, 0xAA, 0x76, //==**==
+	0x2C, 0x88, 0xC2, //.#++#.
+	0x0E, 0x44, 0xE0, // %::% 
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @3168 'x' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x37, 0x00, 0x73, //:=  =:
+	0x0A, 0x55, 0xA0, // *--* 
+	0x01, 0xCC, 0x10, // .##. 
+	0x00, 0xCC, 0x00, //  ##  
+	0x09, 0x77, 0x90, // +==+ 
+	0x5B, 0x00, 0xB5, //-#  #-
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @3204 'y' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x45, 0x00, 0x45, //:-  :-
+	0x2C, 0x00, 0xB4, //.#  #:
+	0x0B, 0x31, 0xD0, // #:.% 
+	0x05, 0x97, 0x70, // -+== 
+	0x00, 0xDC, 0x20, //  %#. 
+	0x00, 0x8B, 0x00, //  +#  
+	0x00, 0xA5, 0x00, //  *-  
+	0x2A, 0xC0, 0x00, //.*#   
+
+	// @3240 'z' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x09, 0x99, 0x91, // ++++.
+	0x01, 0x14, 0xC1, // ..:#.
+	0x00, 0x1C, 0x20, //  .#. 
+	0x00, 0xB4, 0x00, //  #:  
+	0x09, 0x70, 0x00, // +=   
+	0x1F, 0xBB, 0xB1, //.@###.
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+
+	// @3276 '{' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x1A, 0xB0, //  .*# 
+	0x00, 0x69, 0x00, //  =+  
+	0x00, 0x78, 0x00, //  =+  
+	0x00, 0x77, 0x00, //  ==  
+	0x07, 0xC3, 0x00, // =#:  
+	0x04, 0xC4, 0x00, // :#:  
+	0x00, 0x77, 0x00, //  ==  
+	0x00, 0x78, 0x00, //  =+  
+	0x00, 0x5A, 0x10, //  -*. 
+	0x00, 0x18, 0xA0, //  .+* 
+
+	// @3312 '|' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x66, 0x00, //  ==  
+	0x00, 0x76, 0x00, //  ==  
+	0x00, 0x76, 0x00, //  ==  
+	0x00, 0x76, 0x00, //  ==  
+	0x00, 0x76, 0x00, //  ==  
+	0x00, 0x76, 0x00, //  ==  
+	0x00, 0x76, 0x00, //  ==  
+	0x00, 0x76, 0x00, //  ==  
+	0x00, 0x76, 0x00, //  ==  
+	0x00, 0x76, 0x00, //  ==  
+
+	// @3348 '}' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x0B, 0xA1, 0x00, // #*.  
+	0x00, 0x96, 0x00, //  +=  
+	0x00, 0x86, 0x00, //  +=  
+	0x00, 0x77, 0x00, //  ==  
+	0x00, 0x3C, 0x70, //  :#= 
+	0x00, 0x4C, 0x40, //  :#: 
+	0x00, 0x77, 0x00, //  ==  
+	0x00, 0x86, 0x00, //  +=  
+	0x01, 0xA5, 0x00, // .*-  
+	0x0A, 0x80, 0x00, // *+   
+
+	// @3384 '~' (6 pixels wide)
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x6C, 0xC7, 0x57, //=##=-=
+	0x30, 0x16, 0x72, //: .==.
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+	0x00, 0x00, 0x00, //      
+};
+
+sFONT_AA FontAA12 = {
+  FontAA12_Table,
+  6, /* Width */
+  12, /* Height */
+  NULL, /* Advance */
+  NULL, /* Kerning */
+  0, /* KerningCount */
+};
@@ -0,0 +1,1730 @@
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.h"
+
+// 
+//  Font data for DejaVuSansMono.ttf, 16 pixels high, anti-aliased
+//  Generated by tools/fontgen.py: 4 bits of coverage per pixel, two pixels
+//  per byte with the left one in the high nibble
+// 
+
+const uint8_t FontAA16_Table[] = 
+{
+	// @0 ' ' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @64 '!' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x00, 0x09, 0x90, 0x00, //   ++   
+	0x00, 0x06, 0x60, 0x00, //   ==   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x07, 0x70, 0x00, //   ==   
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @128 '"' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0xD4, 0x4D, 0x00, //  %::%  
+	0x00, 0xD4, 0x4D, 0x00, //  %::%  
+	0x00, 0xD4, 0x4D, 0x00, //  %::%  
+	0x00, 0x93, 0x39, 0x00, //  +::+  
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @192 '#' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x0A, 0x50, 0xD1, //   *- %.
+	0x00, 0x0E, 0x24, 0xC0, //   %.:# 
+	0x01, 0x4D, 0x18, 0x91, // .:%.++.
+	0x5E, 0xFF, 0xEF, 0xEE, //-%@@%@%%
+	0x00, 0xB6, 0x0E, 0x10, //  #= %. 
+	0x00, 0xE2, 0x4D, 0x00, //  %.:%  
+	0xCC, 0xFC, 0xDE, 0xC4, //##@#%%#:
+	0x49, 0xA4, 0xC7, 0x41, //:+*:#=:.
+	0x0B, 0x50, 0xE1, 0x00, // #- %.  
+	0x0E, 0x24, 0xC0, 0x00, // %.:#   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @256 '$' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x01, 0x30, 0x00, //   .:   
+	0x00, 0x02, 0x80, 0x00, //   .+   
+	0x01, 0x8D, 0xEB, 0x60, // .+%%#= 
+	0x09, 0xB4, 0x84, 0x60, // +#:+:= 
+	0x0C, 0x62, 0x80, 0x00, // #=.+   
+	0x09, 0xC6, 0x80, 0x00, // +#=+   
+	0x01, 0x9E, 0xFC, 0x40, // .+%@#: 
+	0x00, 0x02, 0x98, 0xF2, //   .++@.
+	0x00, 0x02, 0x80, 0xE5, //   .+ %-
+	0x08, 0x33, 0x85, 0xF2, // +::+-@.
+	0x07, 0xCE, 0xFC, 0x40, // =#%@#: 
+	0x00, 0x03, 0x80, 0x00, //   :+   
+	0x00, 0x02, 0x80, 0x00, //   .+   
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @320 '%' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x07, 0x93, 0x00, 0x00, // =+:    
+	0x99, 0x6D, 0x20, 0x00, //++=%.   
+	0xD1, 0x09, 0x50, 0x00, //%. +-   
+	0xA8, 0x5D, 0x20, 0x34, //*+-%. ::
+	0x18, 0xA4, 0x6B, 0x82, //.+*:=#+.
+	0x03, 0x9A, 0x64, 0x20, // :+*=:. 
+	0x58, 0x21, 0xCA, 0xD6, //-+..#*%=
+	0x00, 0x05, 0xA0, 0x2D, //   -* .%
+	0x00, 0x04, 0xB0, 0x4C, //   :# :#
+	0x00, 0x00, 0x8E, 0xD3, //    +%%:
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @384 '&' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x02, 0x20, 0x00, //   ..   
+	0x01, 0xDE, 0xDB, 0x00, // .%%%#  
+	0x07, 0xC0, 0x02, 0x00, // =#  .  
+	0x07, 0xB0, 0x00, 0x00, // =#     
+	0x02, 0xF4, 0x00, 0x00, // .@:    
+	0x09, 0xDD, 0x10, 0x02, // +%%.  .
+	0x6C, 0x0A, 0xB0, 0x2E, //=# *# .%
+	0xA7, 0x01, 0xD7, 0x4C, //*= .%=:#
+	0xB8, 0x00, 0x3E, 0xB7, //#+  :%#=
+	0x6E, 0x40, 0x0B, 0xF2, //=%:  #@.
+	0x08, 0xFD, 0xEA, 0xBA, // +@%%*#*
+	0x00, 0x13, 0x10, 0x00, //  .:.   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @448 ''' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x09, 0x90, 0x00, //   ++   
+	0x00, 0x09, 0x90, 0x00, //   ++   
+	0x00, 0x09, 0x90, 0x00, //   ++   
+	0x00, 0x06, 0x60, 0x00, //   ==   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @512 '(' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x34, 0x00, //    ::  
+	0x00, 0x00, 0xC5, 0x00, //    #-  
+	0x00, 0x05, 0xD0, 0x00, //   -%   
+	0x00, 0x0B, 0x80, 0x00, //   #+   
+	0x00, 0x1F, 0x40, 0x00, //  .@:   
+	0x00, 0x3F, 0x20, 0x00, //  :@.   
+	0x00, 0x4F, 0x10, 0x00, //  :@.   
+	0x00, 0x4F, 0x10, 0x00, //  :@.   
+	0x00, 0x1F, 0x30, 0x00, //  .@:   
+	0x00, 0x0D, 0x60, 0x00, //   %=   
+	0x00, 0x07, 0xB0, 0x00, //   =#   
+	0x00, 0x01, 0xE2, 0x00, //   .%.  
+	0x00, 0x00, 0x67, 0x00, //    ==  
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @576 ')' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x43, 0x00, 0x00, //  ::    
+	0x00, 0x5C, 0x00, 0x00, //  -#    
+	0x00, 0x0D, 0x50, 0x00, //   %-   
+	0x00, 0x08, 0xB0, 0x00, //   +#   
+	0x00, 0x04, 0xF1, 0x00, //   :@.  
+	0x00, 0x02, 0xF3, 0x00, //   .@:  
+	0x00, 0x01, 0xF4, 0x00, //   .@:  
+	0x00, 0x01, 0xF4, 0x00, //   .@:  
+	0x00, 0x03, 0xF1, 0x00, //   :@.  
+	0x00, 0x06, 0xD0, 0x00, //   =%   
+	0x00, 0x0B, 0x70, 0x00, //   #=   
+	0x00, 0x2E, 0x10, 0x00, //  .%.   
+	0x00, 0x76, 0x00, 0x00, //  ==    
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @640 '*' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x01, 0x10, 0x00, //   ..   
+	0x00, 0x06, 0x60, 0x00, //   ==   
+	0x0A, 0x56, 0x65, 0xA0, // *-==-* 
+	0x00, 0x7D, 0xD7, 0x00, //  =%%=  
+	0x01, 0x9C, 0xC9, 0x10, // .+##+. 
+	0x09, 0x36, 0x63, 0x90, // +:==:+ 
+	0x00, 0x06, 0x60, 0x00, //   ==   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @704 '+' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x07, 0x70, 0x00, //   ==   
+	0x00, 0x09, 0x80, 0x00, //   ++   
+	0x00, 0x09, 0x80, 0x00, //   ++   
+	0x7D, 0xDE, 0xED, 0xD7, //=%%%%%%=
+	0x24, 0x4A, 0xA4, 0x42, //.::**::.
+	0x00, 0x09, 0x80, 0x00, //   ++   
+	0x00, 0x09, 0x80, 0x00, //   ++   
+	0x00, 0x02, 0x20, 0x00, //   ..   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @768 ',' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x01, 0x10, 0x00, //   ..   
+	0x00, 0x0C, 0xE0, 0x00, //   #%   
+	0x00, 0x0C, 0xC0, 0x00, //   ##   
+	0x00, 0x1F, 0x50, 0x00, //  .@-   
+	0x00, 0x4C, 0x00, 0x00, //  :#    
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @832 '-' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x45, 0x54, 0x00, //  :--:  
+	0x00, 0x9C, 0xC9, 0x00, //  +##+  
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @896 '.' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x01, 0x10, 0x00, //   ..   
+	0x00, 0x0D, 0xD0, 0x00, //   %%   
+	0x00, 0x0D, 0xD0, 0x00, //   %%   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @960 '/' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x06, 0xD0, //     =% 
+	0x00, 0x00, 0x0D, 0x60, //     %= 
+	0x00, 0x00, 0x5D, 0x00, //    -%  
+	0x00, 0x00, 0xC7, 0x00, //    #=  
+	0x00, 0x04, 0xE1, 0x00, //   :%.  
+	0x00, 0x0B, 0x80, 0x00, //   #+   
+	0x00, 0x3F, 0x10, 0x00, //  :@.   
+	0x00, 0xA9, 0x00, 0x00, //  *+    
+	0x02, 0xF2, 0x00, 0x00, // .@.    
+	0x09, 0xA0, 0x00, 0x00, // +*     
+	0x2F, 0x30, 0x00, 0x00, //.@:     
+	0x13, 0x00, 0x00, 0x00, //.:      
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @1024 '0' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x02, 0x20, 0x00, //   ..   
+	0x01, 0xCE, 0xEC, 0x10, // .#%%#. 
+	0x09, 0xC1, 0x1C, 0x90, // +#..#+ 
+	0x0E, 0x60, 0x06, 0xE0, // %=  =% 
+	0x2F, 0x30, 0x03, 0xF2, //.@:  :@.
+	0x3F, 0x2A, 0xA2, 0xF3, //:@.**.@:
+	0x3F, 0x29, 0x92, 0xF3, //:@.++.@:
+	0x2F, 0x30, 0x03, 0xF2, //.@:  :@.
+	0x0E, 0x60, 0x06, 0xE0, // %=  =% 
+	0x09, 0xC1, 0x1C, 0x90, // +#..#+ 
+	0x01, 0xCE, 0xEC, 0x10, // .#%%#. 
+	0x00, 0x02, 0x20, 0x00, //   ..   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @1088 '1' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x04, 0xBE, 0xF2, 0x00, // :#%@.  
+	0x05, 0x77, 0xF2, 0x00, // -==@.  
+	0x00, 0x03, 0xF2, 0x00, //   :@.  
+	0x00, 0x03, 0xF2, 0x00, //   :@.  
+	0x00, 0x03, 0xF2, 0x00, //   :@.  
+	0x00, 0x03, 0xF2, 0x00, //   :@.  
+	0x00, 0x03, 0xF2, 0x00, //   :@.  
+	0x00, 0x03, 0xF2, 0x00, //   :@.  
+	0x01, 0x25, 0xF4, 0x20, // ..-@:. 
+	0x05, 0xFF, 0xFF, 0xF3, // -@@@@@:
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @1152 '2' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x13, 0x20, 0x00, //  .:.   
+	0x0B, 0xFE, 0xFB, 0x10, // #@%@#. 
+	0x08, 0x20, 0x2D, 0xA0, // +. .%* 
+	0x00, 0x00, 0x08, 0xD0, //     +% 
+	0x00, 0x00, 0x0A, 0xB0, //     *# 
+	0x00, 0x00, 0x3F, 0x40, //    :@: 
+	0x00, 0x02, 0xD7, 0x00, //   .%=  
+	0x00, 0x1C, 0x90, 0x00, //  .#+   
+	0x01, 0xCA, 0x00, 0x00, // .#*    
+	0x0B, 0xC2, 0x22, 0x20, // ##.... 
+	0x2F, 0xFF, 0xFF, 0xF0, //.@@@@@@ 
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @1216 '3' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x13, 0x20, 0x00, //  .:.   
+	0x0C, 0xFE, 0xFC, 0x20, // #@%@#. 
+	0x04, 0x10, 0x1C, 0xA0, // :. .#* 
+	0x00, 0x00, 0x08, 0xD0, //     +% 
+	0x00, 0x00, 0x1C, 0x90, //    .#+ 
+	0x00, 0x7E, 0xFA, 0x00, //  =%@*  
+	0x00, 0x13, 0x6E, 0x70, //  .:=%= 
+	0x00, 0x00, 0x05, 0xF0, //     -@ 
+	0x00, 0x00, 0x04, 0xF1, //     :@.
+	0x25, 0x10, 0x2C, 0xC0, //.-. .## 
+	0x2E, 0xFE, 0xFC, 0x20, //.%@%@#. 
+	0x00, 0x23, 0x20, 0x00, //  .:.   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @1280 '4' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0xBF, 0x20, //    #@. 
+	0x00, 0x06, 0xCF, 0x20, //   =#@. 
+	0x00, 0x1D, 0x4F, 0x20, //  .%:@. 
+	0x00, 0xA6, 0x3F, 0x20, //  *=:@. 
+	0x04, 0xC0, 0x3F, 0x20, // :# :@. 
+	0x1D, 0x40, 0x3F, 0x20, //.%: :@. 
+	0x6D, 0x88, 0x9F, 0x94, //=%+++@+:
+	0x49, 0x99, 0xBF, 0xA4, //:+++#@*:
+	0x00, 0x00, 0x3F, 0x20, //    :@. 
+	0x00, 0x00, 0x3F, 0x20, //    :@. 
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @1344 '5' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x0B, 0xFF, 0xFF, 0x50, // #@@@@- 
+	0x0B, 0x82, 0x22, 0x10, // #+.... 
+	0x0B, 0x70, 0x00, 0x00, // #=     
+	0x0B, 0xB9, 0x83, 0x00, // ##++:  
+	0x0A, 0x98, 0xCF, 0x40, // *++#@: 
+	0x00, 0x00, 0x0A, 0xC0, //     *# 
+	0x00, 0x00, 0x05, 0xF0, //     -@ 
+	0x00, 0x00, 0x07, 0xE0, //     =% 
+	0x25, 0x10, 0x3D, 0xA0, //.-. :%* 
+	0x2E, 0xFE, 0xFA, 0x10, //.%@%@*. 
+	0x00, 0x23, 0x10, 0x00, //  .:.   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @1408 '6' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x01, 0x31, 0x00, //   .:.  
+	0x00, 0x9F, 0xEF, 0x70, //  +@%@= 
+	0x07, 0xE3, 0x01, 0x20, // =%: .. 
+	0x0E, 0x60, 0x00, 0x00, // %=     
+	0x2F, 0x37, 0x96, 0x00, //.@:=+=  
+	0x3F, 0xC9, 0x8E, 0x90, //:@#++%+ 
+	0x3F, 0x80, 0x05, 0xF1, //:@+  -@.
+	0x2F, 0x40, 0x02, 0xF3, //.@:  .@:
+	0x0F, 0x50, 0x02, 0xF3, // @-  .@:
+	0x0A, 0xB1, 0x09, 0xD0, // *#. +% 
+	0x01, 0xCE, 0xEE, 0x40, // .#%%%: 
+	0x00, 0x02, 0x30, 0x00, //   .:   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @1472 '7' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x3F, 0xFF, 0xFF, 0xF1, //:@@@@@@.
+	0x02, 0x22, 0x29, 0xB0, // ....+# 
+	0x00, 0x00, 0x0E, 0x50, //     %- 
+	0x00, 0x00, 0x5E, 0x10, //    -%. 
+	0x00, 0x00, 0xB9, 0x00, //    #+  
+	0x00, 0x02, 0xF3, 0x00, //   .@:  
+	0x00, 0x08, 0xD0, 0x00, //   +%   
+	0x00, 0x0D, 0x70, 0x00, //   %=   
+	0x00, 0x5F, 0x20, 0x00, //  -@.   
+	0x00, 0xAB, 0x00, 0x00, //  *#    
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @1536 '8' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x02, 0x20, 0x00, //   ..   
+	0x04, 0xDE, 0xED, 0x40, // :%%%%: 
+	0x0D, 0xA0, 0x0A, 0xD0, // %*  *% 
+	0x0F, 0x50, 0x05, 0xF0, // @-  -@ 
+	0x0B, 0xA0, 0x0A, 0xB0, // #*  *# 
+	0x01, 0xBE, 0xEB, 0x10, // .#%%#. 
+	0x09, 0xC5, 0x5C, 0x90, // +#--#+ 
+	0x2F, 0x30, 0x03, 0xF2, //.@:  :@.
+	0x4F, 0x20, 0x02, 0xF4, //:@.  .@:
+	0x1E, 0x90, 0x08, 0xE1, //.%+  +%.
+	0x05, 0xEE, 0xEE, 0x50, // -%%%%- 
+	0x00, 0x02, 0x20, 0x00, //   ..   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @1600 '9' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x03, 0x20, 0x00, //   :.   
+	0x04, 0xEE, 0xEC, 0x10, // :%%%#. 
+	0x1E, 0x80, 0x1C, 0x90, //.%+ .#+ 
+	0x3F, 0x20, 0x06, 0xE0, //:@.  =% 
+	0x4F, 0x10, 0x05, 0xF2, //:@.  -@.
+	0x2F, 0x40, 0x08, 0xF3, //.@:  +@:
+	0x09, 0xE8, 0x9C, 0xF3, // +%++#@:
+	0x00, 0x69, 0x73, 0xF1, //  =+=:@.
+	0x00, 0x00, 0x06, 0xD0, //     =% 
+	0x03, 0x10, 0x4E, 0x70, // :. :%= 
+	0x07, 0xFE, 0xF8, 0x00, // =@%@+  
+	0x00, 0x13, 0x10, 0x00, //  .:.   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @1664 ':' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x02, 0x20, 0x00, //   ..   
+	0x00, 0x0D, 0xD0, 0x00, //   %%   
+	0x00, 0x0B, 0xB0, 0x00, //   ##   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x01, 0x10, 0x00, //   ..   
+	0x00, 0x0D, 0xD0, 0x00, //   %%   
+	0x00, 0x0D, 0xD0, 0x00, //   %%   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @1728 ';' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x02, 0x20, 0x00, //   ..   
+	0x00, 0x0D, 0xD0, 0x00, //   %%   
+	0x00, 0x0B, 0xB0, 0x00, //   ##   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x01, 0x10, 0x00, //   ..   
+	0x00, 0x0C, 0xE0, 0x00, //   #%   
+	0x00, 0x0C, 0xC0, 0x00, //   ##   
+	0x00, 0x1F, 0x50, 0x00, //  .@-   
+	0x00, 0x4C, 0x00, 0x00, //  :#    
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @1792 '<' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x45, //      :-
+	0x00, 0x01, 0x7D, 0xE5, //   .=%%-
+	0x04, 0xAE, 0xA5, 0x00, // :*%*-  
+	0x8F, 0x81, 0x00, 0x00, //+@+.    
+	0x3A, 0xEA, 0x50, 0x00, //:*%*-   
+	0x00, 0x17, 0xDE, 0x82, //  .=%%+.
+	0x00, 0x00, 0x04, 0xA8, //     :*+
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @1856 '=' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x24, 0x44, 0x44, 0x42, //.::::::.
+	0x7D, 0xDD, 0xDD, 0xD7, //=%%%%%%=
+	0x00, 0x00, 0x00, 0x00, //        
+	0x48, 0x88, 0x88, 0x84, //:++++++:
+	0x59, 0x99, 0x99, 0x95, //-++++++-
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @1920 '>' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x54, 0x00, 0x00, 0x00, //-:      
+	0x5E, 0xD7, 0x10, 0x00, //-%%=.   
+	0x00, 0x5A, 0xEA, 0x40, //  -*%*: 
+	0x00, 0x00, 0x18, 0xF8, //    .+@+
+	0x00, 0x05, 0xAE, 0xA3, //   -*%*:
+	0x28, 0xED, 0x71, 0x00, //.+%%=.  
+	0x8A, 0x40, 0x00, 0x00, //+*:     
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @1984 '?' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x02, 0x30, 0x00, //   .:   
+	0x04, 0xDE, 0xFD, 0x30, // :%%@%: 
+	0x05, 0x40, 0x1C, 0xB0, // -: .## 
+	0x00, 0x00, 0x09, 0xC0, //     +# 
+	0x00, 0x00, 0x4E, 0x50, //    :%- 
+	0x00, 0x03, 0xE6, 0x00, //   :%=  
+	0x00, 0x0B, 0x90, 0x00, //   #+   
+	0x00, 0x0C, 0x70, 0x00, //   #=   
+	0x00, 0x04, 0x20, 0x00, //   :.   
+	0x00, 0x09, 0x50, 0x00, //   +-   
+	0x00, 0x0D, 0x70, 0x00, //   %=   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @2048 '@' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x03, 0x54, 0x00, //   :-:  
+	0x02, 0xCC, 0x9C, 0xC1, // .##+##.
+	0x1D, 0x60, 0x00, 0x98, //.%=   ++
+	0x7A, 0x01, 0x77, 0x5B, //=* .==-#
+	0xB4, 0x0C, 0xA8, 0xDC, //#: #*+%#
+	0xE1, 0x4C, 0x00, 0x5C, //%.:#  -#
+	0xE1, 0x5A, 0x00, 0x3C, //%.-*  :#
+	0xD2, 0x3E, 0x10, 0x7C, //%.:%. =#
+	0xA6, 0x08, 0xEC, 0xCC, //*= +%###
+	0x4D, 0x10, 0x23, 0x01, //:%. .: .
+	0x09, 0xB2, 0x00, 0x00, // +#.    
+	0x00, 0x6D, 0xDD, 0xB0, //  =%%%# 
+	0x00, 0x00, 0x12, 0x00, //    ..  
+
+	// @2112 'A' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x0E, 0xE0, 0x00, //   %%   
+	0x00, 0x4E, 0xE4, 0x00, //  :%%:  
+	0x00, 0x99, 0xA9, 0x00, //  ++*+  
+	0x00, 0xD5, 0x5D, 0x00, //  %--%  
+	0x03, 0xF1, 0x1F, 0x30, // :@..@: 
+	0x08, 0xC0, 0x0C, 0x80, // +#  #+ 
+	0x0C, 0xDA, 0xAD, 0xC0, // #%**%# 
+	0x2F, 0x76, 0x67, 0xF2, //.@====@.
+	0x6E, 0x00, 0x00, 0xE6, //=%    %=
+	0xBA, 0x00, 0x00, 0xAB, //#*    *#
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @2176 'B' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x0F, 0xFF, 0xFC, 0x30, // @@@@#: 
+	0x0F, 0x62, 0x2A, 0xE0, // @=..*% 
+	0x0F, 0x50, 0x04, 0xF2, // @-  :@.
+	0x0F, 0x50, 0x08, 0xE0, // @-  +% 
+	0x0F, 0xED, 0xEE, 0x30, // @%%%%: 
+	0x0F, 0x73, 0x4A, 0xD1, // @=::*%.
+	0x0F, 0x50, 0x00, 0xE6, // @-   %=
+	0x0F, 0x50, 0x00, 0xE7, // @-   %=
+	0x0F, 0x62, 0x28, 0xF3, // @=..+@:
+	0x0F, 0xFF, 0xFC, 0x50, // @@@@#- 
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @2240 'C' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x32, 0x00, //    :.  
+	0x00, 0x6E, 0xEF, 0xD1, //  =%%@%.
+	0x05, 0xF5, 0x00, 0x61, // -@-  =.
+	0x0C, 0x90, 0x00, 0x00, // #+     
+	0x1F, 0x50, 0x00, 0x00, //.@-     
+	0x3F, 0x30, 0x00, 0x00, //:@:     
+	0x3F, 0x30, 0x00, 0x00, //:@:     
+	0x1F, 0x50, 0x00, 0x00, //.@-     
+	0x0C, 0x90, 0x00, 0x00, // #+     
+	0x05, 0xF5, 0x00, 0x61, // -@-  =.
+	0x00, 0x7E, 0xEF, 0xD1, //  =%%@%.
+	0x00, 0x00, 0x32, 0x00, //    :.  
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @2304 'D' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x3F, 0xFF, 0xC5, 0x00, //:@@@#-  
+	0x3F, 0x42, 0x7F, 0x60, //:@:.=@= 
+	0x3F, 0x20, 0x08, 0xE0, //:@.  +% 
+	0x3F, 0x20, 0x04, 0xF2, //:@.  :@.
+	0x3F, 0x20, 0x02, 0xF4, //:@.  .@:
+	0x3F, 0x20, 0x02, 0xF4, //:@.  .@:
+	0x3F, 0x20, 0x04, 0xF2, //:@.  :@.
+	0x3F, 0x20, 0x08, 0xE0, //:@.  +% 
+	0x3F, 0x43, 0x7F, 0x60, //:@::=@= 
+	0x3F, 0xFF, 0xC5, 0x00, //:@@@#-  
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @2368 'E' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x0C, 0xFF, 0xFF, 0xF2, // #@@@@@.
+	0x0C, 0x92, 0x22, 0x20, // #+.... 
+	0x0C, 0x80, 0x00, 0x00, // #+     
+	0x0C, 0x80, 0x00, 0x00, // #+     
+	0x0C, 0xFE, 0xEE, 0xD0, // #@%%%% 
+	0x0C, 0xA4, 0x44, 0x30, // #*:::: 
+	0x0C, 0x80, 0x00, 0x00, // #+     
+	0x0C, 0x80, 0x00, 0x00, // #+     
+	0x0C, 0x92, 0x22, 0x20, // #+.... 
+	0x0C, 0xFF, 0xFF, 0xF4, // #@@@@@:
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @2432 'F' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x09, 0xFF, 0xFF, 0xF5, // +@@@@@-
+	0x09, 0xC2, 0x22, 0x21, // +#.....
+	0x09, 0xC0, 0x00, 0x00, // +#     
+	0x09, 0xC0, 0x00, 0x00, // +#     
+	0x09, 0xFE, 0xEE, 0xD0, // +@%%%% 
+	0x09, 0xC3, 0x33, 0x30, // +#:::: 
+	0x09, 0xC0, 0x00, 0x00, // +#     
+	0x09, 0xC0, 0x00, 0x00, // +#     
+	0x09, 0xC0, 0x00, 0x00, // +#     
+	0x09, 0xC0, 0x00, 0x00, // +#     
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @2496 'G' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x01, 0x31, 0x00, //   .:.  
+	0x00, 0x9F, 0xEF, 0xA0, //  +@%@* 
+	0x09, 0xD3, 0x01, 0x80, // +%: .+ 
+	0x1F, 0x50, 0x00, 0x00, //.@-     
+	0x5F, 0x10, 0x00, 0x00, //-@.     
+	0x7F, 0x00, 0x12, 0x21, //=@  ....
+	0x7F, 0x00, 0x7F, 0xF4, //=@  =@@:
+	0x5F, 0x10, 0x00, 0xF4, //-@.   @:
+	0x1F, 0x50, 0x00, 0xF4, //.@-   @:
+	0x09, 0xD2, 0x02, 0xF4, // +%. .@:
+	0x00, 0x9F, 0xEF, 0xA1, //  +@%@*.
+	0x00, 0x01, 0x31, 0x00, //   .:.  
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @2560 'H' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x3F, 0x20, 0x02, 0xF3, //:@.  .@:
+	0x3F, 0x20, 0x02, 0xF3, //:@.  .@:
+	0x3F, 0x20, 0x02, 0xF3, //:@.  .@:
+	0x3F, 0x20, 0x02, 0xF3, //:@.  .@:
+	0x3F, 0xEE, 0xEE, 0xF3, //:@%%%%@:
+	0x3F, 0x54, 0x45, 0xF3, //:@-::-@:
+	0x3F, 0x20, 0x02, 0xF3, //:@.  .@:
+	0x3F, 0x20, 0x02, 0xF3, //:@.  .@:
+	0x3F, 0x20, 0x02, 0xF3, //:@.  .@:
+	0x3F, 0x20, 0x02, 0xF3, //:@.  .@:
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @2624 'I' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x0C, 0xFF, 0xFF, 0xC0, // #@@@@# 
+	0x01, 0x2B, 0xB2, 0x10, // ..##.. 
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x01, 0x2B, 0xB2, 0x10, // ..##.. 
+	0x0C, 0xFF, 0xFF, 0xC0, // #@@@@# 
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @2688 'J' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0xAF, 0xFF, 0x40, //  *@@@: 
+	0x00, 0x12, 0x3F, 0x40, //  ..:@: 
+	0x00, 0x00, 0x1F, 0x40, //    .@: 
+	0x00, 0x00, 0x1F, 0x40, //    .@: 
+	0x00, 0x00, 0x1F, 0x40, //    .@: 
+	0x00, 0x00, 0x1F, 0x40, //    .@: 
+	0x00, 0x00, 0x1F, 0x40, //    .@: 
+	0x00, 0x00, 0x2F, 0x30, //    .@: 
+	0x56, 0x00, 0x7F, 0x10, //-=  =@. 
+	0x4E, 0xFE, 0xF6, 0x00, //:%@%@=  
+	0x00, 0x23, 0x10, 0x00, //  .:.   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @2752 'K' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x3F, 0x20, 0x03, 0xE7, //:@.  :%=
+	0x3F, 0x20, 0x2E, 0x80, //:@. .%+ 
+	0x3F, 0x22, 0xD9, 0x00, //:@..%+  
+	0x3F, 0x4D, 0x90, 0x00, //:@:%+   
+	0x3F, 0xEF, 0x50, 0x00, //:@%@-   
+	0x3F, 0xA7, 0xE2, 0x00, //:@*=%.  
+	0x3F, 0x20, 0xCB, 0x00, //:@. ##  
+	0x3F, 0x20, 0x3F, 0x60, //:@. :@= 
+	0x3F, 0x20, 0x08, 0xE2, //:@.  +%.
+	0x3F, 0x20, 0x00, 0xDB, //:@.   %#
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @2816 'L' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x0A, 0xA0, 0x00, 0x00, // **     
+	0x0A, 0xA0, 0x00, 0x00, // **     
+	0x0A, 0xA0, 0x00, 0x00, // **     
+	0x0A, 0xA0, 0x00, 0x00, // **     
+	0x0A, 0xA0, 0x00, 0x00, // **     
+	0x0A, 0xA0, 0x00, 0x00, // **     
+	0x0A, 0xA0, 0x00, 0x00, // **     
+	0x0A, 0xA0, 0x00, 0x00, // **     
+	0x0A, 0xB2, 0x22, 0x21, // *#.....
+	0x0A, 0xFF, 0xFF, 0xF8, // *@@@@@+
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @2880 'M' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x8F, 0x60, 0x07, 0xF8, //+@=  =@+
+	0x8D, 0xC0, 0x0C, 0xD8, //+%#  #%+
+	0x8A, 0xD2, 0x2C, 0xB8, //+*%..##+
+	0x8A, 0x87, 0x77, 0xB8, //+*+===#+
+	0x8A, 0x3C, 0xC2, 0xB8, //+*:##.#+
+	0x8A, 0x0D, 0xC0, 0xB8, //+* %# #+
+	0x8A, 0x04, 0x40, 0xB8, //+* :: #+
+	0x8A, 0x00, 0x00, 0xB8, //+*    #+
+	0x8A, 0x00, 0x00, 0xB8, //+*    #+
+	0x8A, 0x00, 0x00, 0xB8, //+*    #+
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @2944 'N' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x3F, 0xB0, 0x02, 0xF3, //:@#  .@:
+	0x3F, 0xF2, 0x02, 0xF3, //:@@. .@:
+	0x3F, 0xA8, 0x02, 0xF3, //:@*+ .@:
+	0x3F, 0x4E, 0x02, 0xF3, //:@:% .@:
+	0x3F, 0x2C, 0x62, 0xF3, //:@.#=.@:
+	0x3F, 0x25, 0xC2, 0xF3, //:@.-#.@:
+	0x3F, 0x20, 0xE4, 0xF3, //:@. %:@:
+	0x3F, 0x20, 0x8B, 0xF3, //:@. +#@:
+	0x3F, 0x20, 0x2F, 0xF3, //:@. .@@:
+	0x3F, 0x20, 0x0B, 0xF3, //:@.  #@:
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @3008 'O' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x02, 0x20, 0x00, //   ..   
+	0x02, 0xCE, 0xEC, 0x20, // .#%%#. 
+	0x0B, 0xB1, 0x1B, 0xB0, // ##..## 
+	0x1F, 0x50, 0x05, 0xF1, //.@-  -@.
+	0x4F, 0x20, 0x02, 0xF4, //:@.  .@:
+	0x5F, 0x10, 0x01, 0xF5, //-@.  .@-
+	0x5F, 0x10, 0x01, 0xF5, //-@.  .@-
+	0x4F, 0x20, 0x02, 0xF4, //:@.  .@:
+	0x1F, 0x50, 0x05, 0xF1, //.@-  -@.
+	0x0B, 0xB1, 0x1B, 0xB0, // ##..## 
+	0x02, 0xCF, 0xFC, 0x20, // .#@@#. 
+	0x00, 0x02, 0x20, 0x00, //   ..   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @3072 'P' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x0C, 0xFF, 0xFD, 0x50, // #@@@%- 
+	0x0C, 0x92, 0x29, 0xF3, // #+..+@:
+	0x0C, 0x80, 0x00, 0xE7, // #+   %=
+	0x0C, 0x80, 0x00, 0xE7, // #+   %=
+	0x0C, 0x92, 0x39, 0xF3, // #+.:+@:
+	0x0C, 0xFF, 0xEC, 0x50, // #@@%#- 
+	0x0C, 0x80, 0x00, 0x00, // #+     
+	0x0C, 0x80, 0x00, 0x00, // #+     
+	0x0C, 0x80, 0x00, 0x00, // #+     
+	0x0C, 0x80, 0x00, 0x00, // #+     
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @3136 'Q' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x02, 0x20, 0x00, //   ..   
+	0x02, 0xCE, 0xEC, 0x20, // .#%%#. 
+	0x0B, 0xB1, 0x1B, 0xB0, // ##..## 
+	0x1F, 0x50, 0x05, 0xF1, //.@-  -@.
+	0x4F, 0x20, 0x02, 0xF4, //:@.  .@:
+	0x5F, 0x10, 0x01, 0xF5, //-@.  .@-
+	0x5F, 0x10, 0x01, 0xF5, //-@.  .@-
+	0x4F, 0x20, 0x02, 0xF4, //:@.  .@:
+	0x1F, 0x50, 0x05, 0xF1, //.@-  -@.
+	0x0B, 0xB1, 0x1B, 0xB0, // ##..## 
+	0x02, 0xCF, 0xFD, 0x20, // .#@@%. 
+	0x00, 0x02, 0x7E, 0x30, //   .=%: 
+	0x00, 0x00, 0x07, 0x50, //     =- 
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @3200 'R' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x3F, 0xFF, 0xEA, 0x10, //:@@@%*. 
+	0x3F, 0x42, 0x4D, 0xB0, //:@:.:%# 
+	0x3F, 0x30, 0x07, 0xF0, //:@:  =@ 
+	0x3F, 0x30, 0x08, 0xE0, //:@:  +% 
+	0x3F, 0x76, 0x7E, 0x60, //:@===%= 
+	0x3F, 0xCC, 0xE9, 0x00, //:@##%+  
+	0x3F, 0x30, 0x2E, 0x50, //:@: .%- 
+	0x3F, 0x30, 0x08, 0xD0, //:@:  +% 
+	0x3F, 0x30, 0x01, 0xE6, //:@:  .%=
+	0x3F, 0x30, 0x00, 0x8D, //:@:   +%
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @3264 'S' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x02, 0x31, 0x00, //   .:.  
+	0x03, 0xDF, 0xEF, 0x80, // :%@%@+ 
+	0x0E, 0x80, 0x02, 0x50, // %+  .- 
+	0x3F, 0x20, 0x00, 0x00, //:@.     
+	0x1F, 0x70, 0x00, 0x00, //.@=     
+	0x07, 0xFE, 0xA5, 0x00, // =@%*-  
+	0x00, 0x26, 0xAF, 0xA0, //  .=*@* 
+	0x00, 0x00, 0x05, 0xF2, //     -@.
+	0x00, 0x00, 0x02, 0xF3, //     .@:
+	0x18, 0x20, 0x08, 0xE1, //.+.  +%.
+	0x1C, 0xFE, 0xFD, 0x40, //.#@%@%: 
+	0x00, 0x13, 0x20, 0x00, //  .:.   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @3328 'T' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0xCF, 0xFF, 0xFF, 0xFC, //#@@@@@@#
+	0x22, 0x2B, 0xB2, 0x22, //...##...
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @3392 'U' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x2F, 0x30, 0x03, 0xF2, //.@:  :@.
+	0x2F, 0x30, 0x03, 0xF2, //.@:  :@.
+	0x2F, 0x30, 0x03, 0xF2, //.@:  :@.
+	0x2F, 0x30, 0x03, 0xF2, //.@:  :@.
+	0x2F, 0x30, 0x03, 0xF2, //.@:  :@.
+	0x2F, 0x30, 0x03, 0xF2, //.@:  :@.
+	0x2F, 0x30, 0x03, 0xF2, //.@:  :@.
+	0x1F, 0x40, 0x04, 0xF1, //.@:  :@.
+	0x0D, 0x90, 0x09, 0xD0, // %+  +% 
+	0x03, 0xDE, 0xED, 0x30, // :%%%%: 
+	0x00, 0x02, 0x20, 0x00, //   ..   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @3456 'V' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x9C, 0x00, 0x00, 0xC9, //+#    #+
+	0x5F, 0x10, 0x01, 0xF5, //-@.  .@-
+	0x1F, 0x50, 0x05, 0xF1, //.@-  -@.
+	0x0B, 0x90, 0x09, 0xB0, // #+  +# 
+	0x06, 0xD0, 0x0D, 0x60, // =%  %= 
+	0x02, 0xF2, 0x2F, 0x20, // .@..@. 
+	0x00, 0xD6, 0x6D, 0x00, //  %==%  
+	0x00, 0x8A, 0xA8, 0x00, //  +**+  
+	0x00, 0x4D, 0xE4, 0x00, //  :%%:  
+	0x00, 0x0E, 0xE0, 0x00, //   %%   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @3520 'W' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0xF4, 0x00, 0x00, 0x4F, //@:    :@
+	0xE5, 0x00, 0x00, 0x5E, //%-    -%
+	0xB7, 0x03, 0x30, 0x7B, //#= :: =#
+	0x99, 0x0D, 0xD0, 0x99, //++ %% ++
+	0x7B, 0x1D, 0xD1, 0xB7, //=#.%%.#=
+	0x5D, 0x5A, 0xA4, 0xD5, //-%-**:%-
+	0x2E, 0x87, 0x78, 0xE2, //.%+==+%.
+	0x0F, 0xC3, 0x3C, 0xF0, // @#::#@ 
+	0x0D, 0xE0, 0x0E, 0xD0, // %%  %% 
+	0x0B, 0xB0, 0x0B, 0xB0, // ##  ## 
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @3584 'X' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x4F, 0x30, 0x01, 0xE7, //:@:  .%=
+	0x09, 0xC0, 0x08, 0xC0, // +#  +# 
+	0x01, 0xE5, 0x3F, 0x30, // .%-:@: 
+	0x00, 0x6D, 0xB8, 0x00, //  =%#+  
+	0x00, 0x0C, 0xE1, 0x00, //   #%.  
+	0x00, 0x3F, 0xE4, 0x00, //  :@%:  
+	0x00, 0xC9, 0x7D, 0x00, //  #+=%  
+	0x07, 0xE1, 0x0D, 0x70, // =%. %= 
+	0x2E, 0x60, 0x05, 0xF2, //.%=  -@.
+	0xBB, 0x00, 0x00, 0xBB, //##    ##
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @3648 'Y' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x9C, 0x00, 0x00, 0xD9, //+#    %+
+	0x1E, 0x60, 0x06, 0xE1, //.%=  =%.
+	0x06, 0xE1, 0x1E, 0x60, // =%..%= 
+	0x00, 0xC7, 0x8C, 0x00, //  #=+#  
+	0x00, 0x4E, 0xE4, 0x00, //  :%%:  
+	0x00, 0x0B, 0xB0, 0x00, //   ##   
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x00, 0x0A, 0xA0, 0x00, //   **   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @3712 'Z' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x0E, 0xFF, 0xFF, 0xF8, // %@@@@@+
+	0x02, 0x22, 0x26, 0xF4, // ....=@:
+	0x00, 0x00, 0x1D, 0x90, //    .%+ 
+	0x00, 0x00, 0x8D, 0x10, //    +%. 
+	0x00, 0x03, 0xF4, 0x00, //   :@:  
+	0x00, 0x0C, 0x90, 0x00, //   #+   
+	0x00, 0x7D, 0x10, 0x00, //  =%.   
+	0x02, 0xE4, 0x00, 0x00, // .%:    
+	0x0C, 0xA2, 0x22, 0x21, // #*.....
+	0x1F, 0xFF, 0xFF, 0xFB, //.@@@@@@#
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @3776 '[' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x07, 0x75, 0x00, //   ==-  
+	0x00, 0x0F, 0x96, 0x00, //   @+=  
+	0x00, 0x0F, 0x30, 0x00, //   @:   
+	0x00, 0x0F, 0x30, 0x00, //   @:   
+	0x00, 0x0F, 0x30, 0x00, //   @:   
+	0x00, 0x0F, 0x30, 0x00, //   @:   
+	0x00, 0x0F, 0x30, 0x00, //   @:   
+	0x00, 0x0F, 0x30, 0x00, //   @:   
+	0x00, 0x0F, 0x30, 0x00, //   @:   
+	0x00, 0x0F, 0x30, 0x00, //   @:   
+	0x00, 0x0F, 0x30, 0x00, //   @:   
+	0x00, 0x0F, 0x52, 0x00, //   @-.  
+	0x00, 0x0C, 0xCA, 0x00, //   ##*  
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @3840 '\' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x3F, 0x10, 0x00, 0x00, //:@.     
+	0x0B, 0x80, 0x00, 0x00, // #+     
+	0x04, 0xE1, 0x00, 0x00, // :%.    
+	0x00, 0xC7, 0x00, 0x00, //  #=    
+	0x00, 0x5E, 0x00, 0x00, //  -%    
+	0x00, 0x0D, 0x60, 0x00, //   %=   
+	0x00, 0x06, 0xD0, 0x00, //   =%   
+	0x00, 0x00, 0xE5, 0x00, //    %-  
+	0x00, 0x00, 0x7C, 0x00, //    =#  
+	0x00, 0x00, 0x1E, 0x40, //    .%: 
+	0x00, 0x00, 0x08, 0xB0, //     +# 
+	0x00, 0x00, 0x01, 0x40, //     .: 
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @3904 ']' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x57, 0x70, 0x00, //  -==   
+	0x00, 0x69, 0xF0, 0x00, //  =+@   
+	0x00, 0x03, 0xF0, 0x00, //   :@   
+	0x00, 0x03, 0xF0, 0x00, //   :@   
+	0x00, 0x03, 0xF0, 0x00, //   :@   
+	0x00, 0x03, 0xF0, 0x00, //   :@   
+	0x00, 0x03, 0xF0, 0x00, //   :@   
+	0x00, 0x03, 0xF0, 0x00, //   :@   
+	0x00, 0x03, 0xF0, 0x00, //   :@   
+	0x00, 0x03, 0xF0, 0x00, //   :@   
+	0x00, 0x03, 0xF0, 0x00, //   :@   
+	0x00, 0x25, 0xF0, 0x00, //  .-@   
+	0x00, 0xAC, 0xC0, 0x00, //  *##   
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @3968 '^' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x2E, 0xE2, 0x00, //  .%%.  
+	0x01, 0xC9, 0x9C, 0x10, // .#++#. 
+	0x0A, 0xA0, 0x0A, 0xA0, // **  ** 
+	0x49, 0x00, 0x00, 0x94, //:+    +:
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @4032 '_' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x55, 0x55, 0x55, 0x55, //--------
+
+	// @4096 '`' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x01, 0xC6, 0x00, 0x00, // .#=    
+	0x00, 0x1D, 0x30, 0x00, //  .%:   
+	0x00, 0x02, 0x60, 0x00, //   .=   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @4160 'a' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x03, 0x8A, 0xA5, 0x00, // :+**-  
+	0x09, 0x86, 0x6D, 0x80, // ++==%+ 
+	0x00, 0x00, 0x05, 0xD0, //     -% 
+	0x01, 0x8B, 0xBC, 0xE0, // .+###% 
+	0x0D, 0xA4, 0x47, 0xF0, // %*::=@ 
+	0x3F, 0x10, 0x06, 0xF0, //:@.  =@ 
+	0x2F, 0x40, 0x2D, 0xF0, //.@: .%@ 
+	0x08, 0xFD, 0xD8, 0xF0, // +@%%+@ 
+	0x00, 0x13, 0x00, 0x00, //  .:    
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @4224 'b' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x06, 0x30, 0x00, 0x00, // =:     
+	0x0D, 0x60, 0x00, 0x00, // %=     
+	0x0D, 0x60, 0x00, 0x00, // %=     
+	0x0D, 0x67, 0xA7, 0x00, // %==*=  
+	0x0D, 0xE8, 0x6D, 0x90, // %%+=%+ 
+	0x0D, 0xA0, 0x04, 0xF1, // %*  :@.
+	0x0D, 0x70, 0x00, 0xF4, // %=   @:
+	0x0D, 0x60, 0x00, 0xF5, // %=   @-
+	0x0D, 0x80, 0x02, 0xF3, // %+  .@:
+	0x0D, 0xD1, 0x08, 0xD0, // %%. +% 
+	0x0D, 0xAE, 0xEE, 0x40, // %*%%%: 
+	0x00, 0x01, 0x30, 0x00, //   .:   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @4288 'c' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x17, 0xAA, 0x50, //  .=**- 
+	0x01, 0xDB, 0x66, 0xC0, // .%#==# 
+	0x08, 0xD0, 0x00, 0x00, // +%     
+	0x0C, 0x80, 0x00, 0x00, // #+     
+	0x0C, 0x70, 0x00, 0x00, // #=     
+	0x0A, 0xA0, 0x00, 0x00, // **     
+	0x04, 0xF4, 0x00, 0x50, // :@:  - 
+	0x00, 0x6E, 0xEE, 0xC0, //  =%%%# 
+	0x00, 0x00, 0x32, 0x00, //    :.  
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @4352 'd' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x02, 0x60, //     .= 
+	0x00, 0x00, 0x06, 0xD0, //     =% 
+	0x00, 0x00, 0x06, 0xD0, //     =% 
+	0x00, 0x7A, 0x86, 0xD0, //  =*+=% 
+	0x09, 0xD6, 0x8E, 0xD0, // +%=+%% 
+	0x1F, 0x40, 0x0A, 0xD0, //.@:  *% 
+	0x4F, 0x10, 0x06, 0xD0, //:@.  =% 
+	0x4F, 0x00, 0x06, 0xD0, //:@   =% 
+	0x3F, 0x20, 0x08, 0xD0, //:@.  +% 
+	0x0D, 0x80, 0x1D, 0xD0, // %+ .%% 
+	0x03, 0xEE, 0xEA, 0xD0, // :%%%*% 
+	0x00, 0x03, 0x10, 0x00, //   :.   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @4416 'e' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x49, 0xA6, 0x00, //  :+*=  
+	0x06, 0xE7, 0x6C, 0xA0, // =%==#* 
+	0x1E, 0x50, 0x02, 0xF2, //.%-  .@.
+	0x4F, 0x77, 0x77, 0xE4, //:@====%:
+	0x4F, 0x88, 0x88, 0x83, //:@+++++:
+	0x2F, 0x20, 0x00, 0x00, //.@.     
+	0x0C, 0xA1, 0x01, 0x50, // #*. .- 
+	0x02, 0xBE, 0xDF, 0xC0, // .#%%@# 
+	0x00, 0x02, 0x31, 0x00, //   .:.  
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @4480 'f' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x47, 0x70, //    :== 
+	0x00, 0x07, 0xE9, 0x80, //   =%++ 
+	0x00, 0x0C, 0x70, 0x00, //   #=   
+	0x06, 0x8E, 0xB8, 0x70, // =+%#+= 
+	0x05, 0x7D, 0xA7, 0x70, // -=%*== 
+	0x00, 0x0C, 0x60, 0x00, //   #=   
+	0x00, 0x0C, 0x60, 0x00, //   #=   
+	0x00, 0x0C, 0x60, 0x00, //   #=   
+	0x00, 0x0C, 0x60, 0x00, //   #=   
+	0x00, 0x0C, 0x60, 0x00, //   #=   
+	0x00, 0x0C, 0x60, 0x00, //   #=   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @4544 'g' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x7A, 0x83, 0x60, //  =*+:= 
+	0x09, 0xD6, 0x8E, 0xD0, // +%=+%% 
+	0x1F, 0x40, 0x0A, 0xD0, //.@:  *% 
+	0x4F, 0x10, 0x06, 0xD0, //:@.  =% 
+	0x4F, 0x00, 0x06, 0xD0, //:@   =% 
+	0x3F, 0x20, 0x08, 0xD0, //:@.  +% 
+	0x0C, 0xA1, 0x2E, 0xD0, // #*..%% 
+	0x02, 0xCF, 0xD8, 0xD0, // .#@%+% 
+	0x00, 0x00, 0x07, 0xB0, //     =# 
+	0x04, 0x41, 0x3D, 0x60, // ::.:%= 
+	0x05, 0xCE, 0xD7, 0x00, // -#%%=  
+
+	// @4608 'h' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x05, 0x30, 0x00, 0x00, // -:     
+	0x0C, 0x60, 0x00, 0x00, // #=     
+	0x0C, 0x60, 0x00, 0x00, // #=     
+	0x0C, 0x66, 0xA8, 0x10, // #==*+. 
+	0x0C, 0xD8, 0x7E, 0x90, // #%+=%+ 
+	0x0C, 0x90, 0x06, 0xD0, // #+  =% 
+	0x0C, 0x60, 0x05, 0xE0, // #=  -% 
+	0x0C, 0x60, 0x05, 0xE0, // #=  -% 
+	0x0C, 0x60, 0x05, 0xE0, // #=  -% 
+	0x0C, 0x60, 0x05, 0xE0, // #=  -% 
+	0x0C, 0x60, 0x05, 0xE0, // #=  -% 
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @4672 'i' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x03, 0x50, 0x00, //   :-   
+	0x00, 0x07, 0xB0, 0x00, //   =#   
+	0x00, 0x01, 0x10, 0x00, //   ..   
+	0x03, 0x88, 0x60, 0x00, // :++=   
+	0x03, 0x7B, 0xB0, 0x00, // :=##   
+	0x00, 0x07, 0xB0, 0x00, //   =#   
+	0x00, 0x07, 0xB0, 0x00, //   =#   
+	0x00, 0x07, 0xB0, 0x00, //   =#   
+	0x00, 0x07, 0xB0, 0x00, //   =#   
+	0x00, 0x07, 0xB0, 0x00, //   =#   
+	0x0D, 0xEF, 0xFE, 0xE3, // %%@@%%:
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @4736 'j' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x01, 0x71, 0x00, //   .=.  
+	0x00, 0x02, 0xF2, 0x00, //   .@.  
+	0x00, 0x00, 0x20, 0x00, //    .   
+	0x02, 0x88, 0x81, 0x00, // .+++.  
+	0x02, 0x77, 0xF2, 0x00, // .==@.  
+	0x00, 0x02, 0xF2, 0x00, //   .@.  
+	0x00, 0x02, 0xF2, 0x00, //   .@.  
+	0x00, 0x02, 0xF2, 0x00, //   .@.  
+	0x00, 0x02, 0xF2, 0x00, //   .@.  
+	0x00, 0x02, 0xF2, 0x00, //   .@.  
+	0x00, 0x02, 0xF2, 0x00, //   .@.  
+	0x00, 0x02, 0xF1, 0x00, //   .@.  
+	0x03, 0x39, 0xD0, 0x00, // ::+%   
+	0x0C, 0xDB, 0x30, 0x00, // #%#:   
+
+	// @4800 'k' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x04, 0x50, 0x00, 0x00, // :-     
+	0x08, 0xB0, 0x00, 0x00, // +#     
+	0x08, 0xB0, 0x00, 0x00, // +#     
+	0x08, 0xB0, 0x02, 0x71, // +#  .=.
+	0x08, 0xB0, 0x3E, 0x60, // +# :%= 
+	0x08, 0xB3, 0xE6, 0x00, // +#:%=  
+	0x08, 0xDE, 0xB0, 0x00, // +%%#   
+	0x08, 0xE6, 0xE6, 0x00, // +%=%=  
+	0x08, 0xB0, 0x6E, 0x20, // +# =%. 
+	0x08, 0xB0, 0x0A, 0xC0, // +#  *# 
+	0x08, 0xB0, 0x01, 0xD8, // +#  .%+
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @4864 'l' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x08, 0x88, 0x10, 0x00, // +++.   
+	0x07, 0x7F, 0x20, 0x00, // ==@.   
+	0x00, 0x1F, 0x20, 0x00, //  .@.   
+	0x00, 0x1F, 0x20, 0x00, //  .@.   
+	0x00, 0x1F, 0x20, 0x00, //  .@.   
+	0x00, 0x1F, 0x20, 0x00, //  .@.   
+	0x00, 0x1F, 0x20, 0x00, //  .@.   
+	0x00, 0x1F, 0x20, 0x00, //  .@.   
+	0x00, 0x1F, 0x30, 0x00, //  .@:   
+	0x00, 0x0D, 0x81, 0x10, //   %+.. 
+	0x00, 0x04, 0xDF, 0xC0, //   :%@# 
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @4928 'm' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x36, 0x89, 0x39, 0x80, //:=++:++ 
+	0x6E, 0x6D, 0xD6, 0xE4, //=%=%%=%:
+	0x6C, 0x09, 0xA0, 0xA6, //=# +* *=
+	0x6B, 0x08, 0x90, 0xA7, //=# ++ *=
+	0x6B, 0x08, 0x90, 0xA7, //=# ++ *=
+	0x6B, 0x08, 0x90, 0xA7, //=# ++ *=
+	0x6B, 0x08, 0x90, 0xA7, //=# ++ *=
+	0x6B, 0x08, 0x90, 0xA7, //=# ++ *=
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @4992 'n' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x06, 0x36, 0xA8, 0x10, // =:=*+. 
+	0x0C, 0xD8, 0x7E, 0x90, // #%+=%+ 
+	0x0C, 0x90, 0x06, 0xD0, // #+  =% 
+	0x0C, 0x60, 0x05, 0xE0, // #=  -% 
+	0x0C, 0x60, 0x05, 0xE0, // #=  -% 
+	0x0C, 0x60, 0x05, 0xE0, // #=  -% 
+	0x0C, 0x60, 0x05, 0xE0, // #=  -% 
+	0x0C, 0x60, 0x05, 0xE0, // #=  -% 
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @5056 'o' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x5A, 0xA5, 0x00, //  -**-  
+	0x07, 0xE7, 0x7E, 0x70, // =%==%= 
+	0x0E, 0x60, 0x06, 0xE0, // %=  =% 
+	0x3F, 0x20, 0x02, 0xF3, //:@.  .@:
+	0x3F, 0x20, 0x02, 0xF3, //:@.  .@:
+	0x2F, 0x30, 0x03, 0xF2, //.@:  :@.
+	0x0C, 0xA0, 0x0A, 0xC0, // #*  *# 
+	0x02, 0xDE, 0xED, 0x20, // .%%%%. 
+	0x00, 0x02, 0x20, 0x00, //   ..   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @5120 'p' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x06, 0x38, 0xA7, 0x00, // =:+*=  
+	0x0D, 0xE8, 0x6D, 0x90, // %%+=%+ 
+	0x0D, 0xA0, 0x04, 0xF1, // %*  :@.
+	0x0D, 0x60, 0x01, 0xF4, // %=  .@:
+	0x0D, 0x60, 0x00, 0xF4, // %=   @:
+	0x0D, 0x80, 0x02, 0xF3, // %+  .@:
+	0x0D, 0xD1, 0x08, 0xD0, // %%. +% 
+	0x0D, 0xAE, 0xEE, 0x30, // %*%%%: 
+	0x0D, 0x61, 0x30, 0x00, // %=.:   
+	0x0D, 0x60, 0x00, 0x00, // %=     
+	0x0B, 0x50, 0x00, 0x00, // #-     
+
+	// @5184 'q' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x6A, 0x83, 0x70, //  =*+:= 
+	0x07, 0xE7, 0x8E, 0xE0, // =%=+%% 
+	0x0E, 0x60, 0x09, 0xE0, // %=  +% 
+	0x3F, 0x20, 0x05, 0xE0, //:@.  -% 
+	0x3F, 0x20, 0x05, 0xE0, //:@.  -% 
+	0x2F, 0x30, 0x06, 0xE0, //.@:  =% 
+	0x0C, 0xA0, 0x1C, 0xE0, // #* .#% 
+	0x03, 0xED, 0xEA, 0xE0, // :%%%*% 
+	0x00, 0x03, 0x14, 0xE0, //   :.:% 
+	0x00, 0x00, 0x04, 0xE0, //     :% 
+	0x00, 0x00, 0x04, 0xC0, //     :# 
+
+	// @5248 'r' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x54, 0x4A, 0xA4, //  -::**:
+	0x00, 0xBB, 0xC7, 0x88, //  ###=++
+	0x00, 0xBD, 0x10, 0x00, //  #%.   
+	0x00, 0xB9, 0x00, 0x00, //  #+    
+	0x00, 0xB8, 0x00, 0x00, //  #+    
+	0x00, 0xB8, 0x00, 0x00, //  #+    
+	0x00, 0xB8, 0x00, 0x00, //  #+    
+	0x00, 0xB8, 0x00, 0x00, //  #+    
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @5312 's' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x5A, 0xA8, 0x20, //  -**+. 
+	0x06, 0xE7, 0x58, 0x50, // =%=-+- 
+	0x0A, 0x90, 0x00, 0x00, // *+     
+	0x06, 0xE8, 0x51, 0x00, // =%+-.  
+	0x00, 0x59, 0xDE, 0x40, //  -+%%: 
+	0x00, 0x00, 0x0A, 0xB0, //     *# 
+	0x04, 0x10, 0x0B, 0xA0, // :.  #* 
+	0x09, 0xFD, 0xEC, 0x20, // +@%%#. 
+	0x00, 0x13, 0x20, 0x00, //  .:.   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @5376 't' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x29, 0x00, 0x00, //  .+    
+	0x00, 0x4F, 0x00, 0x00, //  :@    
+	0x28, 0x9F, 0x88, 0x60, //.++@++= 
+	0x27, 0x9F, 0x77, 0x50, //.=+@==- 
+	0x00, 0x4F, 0x00, 0x00, //  :@    
+	0x00, 0x4F, 0x00, 0x00, //  :@    
+	0x00, 0x4F, 0x00, 0x00, //  :@    
+	0x00, 0x4F, 0x00, 0x00, //  :@    
+	0x00, 0x2F, 0x40, 0x00, //  .@:   
+	0x00, 0x08, 0xEF, 0xC0, //   +%@# 
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @5440 'u' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x06, 0x30, 0x02, 0x70, // =:  .= 
+	0x0C, 0x60, 0x05, 0xE0, // #=  -% 
+	0x0C, 0x60, 0x05, 0xE0, // #=  -% 
+	0x0C, 0x60, 0x05, 0xE0, // #=  -% 
+	0x0C, 0x60, 0x05, 0xE0, // #=  -% 
+	0x0C, 0x70, 0x06, 0xE0, // #=  =% 
+	0x0A, 0xB0, 0x1C, 0xE0, // *# .#% 
+	0x03, 0xEE, 0xD8, 0xE0, // :%%%+% 
+	0x00, 0x13, 0x10, 0x00, //  .:.   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @5504 'v' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x37, 0x00, 0x00, 0x73, //:=    =:
+	0x2F, 0x30, 0x03, 0xF2, //.@:  :@.
+	0x0B, 0x80, 0x08, 0xB0, // #+  +# 
+	0x06, 0xD0, 0x0D, 0x60, // =%  %= 
+	0x01, 0xF3, 0x3F, 0x10, // .@::@. 
+	0x00, 0xA8, 0x8A, 0x00, //  *++*  
+	0x00, 0x5D, 0xD5, 0x00, //  -%%-  
+	0x00, 0x0E, 0xE0, 0x00, //   %%   
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @5568 'w' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x81, 0x00, 0x00, 0x18, //+.    .+
+	0xD5, 0x00, 0x00, 0x5D, //%-    -%
+	0xA8, 0x03, 0x30, 0x8A, //*+ :: +*
+	0x6B, 0x0B, 0xB0, 0xB6, //=# ## #=
+	0x3E, 0x1C, 0xC1, 0xE3, //:%.##.%:
+	0x0E, 0x78, 0x87, 0xE0, // %=++=% 
+	0x0B, 0xE4, 0x4E, 0xB0, // #%::%# 
+	0x07, 0xE0, 0x0E, 0x70, // =%  %= 
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @5632 'x' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x18, 0x10, 0x02, 0x81, //.+.  .+.
+	0x09, 0xB0, 0x0B, 0x90, // +#  #+ 
+	0x01, 0xC7, 0x7C, 0x10, // .#==#. 
+	0x00, 0x2E, 0xE2, 0x00, //  .%%.  
+	0x00, 0x1E, 0xE1, 0x00, //  .%%.  
+	0x00, 0xB9, 0x9B, 0x00, //  #++#  
+	0x07, 0xD1, 0x1D, 0x70, // =%..%= 
+	0x4E, 0x30, 0x03, 0xE4, //:%:  :%:
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @5696 'y' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x37, 0x00, 0x00, 0x64, //:=    =:
+	0x1F, 0x40, 0x02, 0xF3, //.@:  .@:
+	0x0A, 0xA0, 0x07, 0xC0, // **  =# 
+	0x04, 0xE1, 0x0D, 0x60, // :%. %= 
+	0x00, 0xD6, 0x3F, 0x10, //  %=:@. 
+	0x00, 0x7C, 0x9A, 0x00, //  =#+*  
+	0x00, 0x1F, 0xE4, 0x00, //  .@%:  
+	0x00, 0x0A, 0xD0, 0x00, //   *%   
+	0x00, 0x0C, 0x80, 0x00, //   #+   
+	0x03, 0x7F, 0x20, 0x00, // :=@.   
+	0x0C, 0xC5, 0x00, 0x00, // ##-    
+
+	// @5760 'z' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x05, 0x88, 0x88, 0x60, // -++++= 
+	0x04, 0x77, 0x7C, 0xC0, // :===## 
+	0x00, 0x00, 0x5E, 0x30, //    -%: 
+	0x00, 0x02, 0xE5, 0x00, //   .%-  
+	0x00, 0x1D, 0x80, 0x00, //  .%+   
+	0x00, 0xAB, 0x00, 0x00, //  *#    
+	0x07, 0xD1, 0x00, 0x00, // =%.    
+	0x0C, 0xFF, 0xFF, 0xD0, // #@@@@% 
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+
+	// @5824 '{' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x36, 0x40, //    :=: 
+	0x00, 0x04, 0xF9, 0x50, //   :@+- 
+	0x00, 0x08, 0xB0, 0x00, //   +#   
+	0x00, 0x09, 0xA0, 0x00, //   +*   
+	0x00, 0x09, 0xA0, 0x00, //   +*   
+	0x00, 0x0B, 0x90, 0x00, //   #+   
+	0x06, 0xBD, 0x30, 0x00, // =#%:   
+	0x04, 0x8E, 0x40, 0x00, // :+%:   
+	0x00, 0x0A, 0x90, 0x00, //   *+   
+	0x00, 0x09, 0xA0, 0x00, //   +*   
+	0x00, 0x09, 0xA0, 0x00, //   +*   
+	0x00, 0x08, 0xC0, 0x00, //   +#   
+	0x00, 0x03, 0xEC, 0x70, //   :%#= 
+	0x00, 0x00, 0x13, 0x20, //    .:. 
+
+	// @5888 '|' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x04, 0x40, 0x00, //   ::   
+	0x00, 0x09, 0x90, 0x00, //   ++   
+	0x00, 0x09, 0x90, 0x00, //   ++   
+	0x00, 0x09, 0x90, 0x00, //   ++   
+	0x00, 0x09, 0x90, 0x00, //   ++   
+	0x00, 0x09, 0x90, 0x00, //   ++   
+	0x00, 0x09, 0x90, 0x00, //   ++   
+	0x00, 0x09, 0x90, 0x00, //   ++   
+	0x00, 0x09, 0x90, 0x00, //   ++   
+	0x00, 0x09, 0x90, 0x00, //   ++   
+	0x00, 0x09, 0x90, 0x00, //   ++   
+	0x00, 0x09, 0x90, 0x00, //   ++   
+	0x00, 0x09, 0x90, 0x00, //   ++   
+	0x00, 0x09, 0x90, 0x00, //   ++   
+
+	// @5952 '}' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x04, 0x63, 0x00, 0x00, // :=:    
+	0x05, 0x9F, 0x40, 0x00, // -+@:   
+	0x00, 0x0B, 0x80, 0x00, //   #+   
+	0x00, 0x0A, 0x80, 0x00, //   *+   
+	0x00, 0x0A, 0x80, 0x00, //   *+   
+	0x00, 0x09, 0xA0, 0x00, //   +*   
+	0x00, 0x03, 0xDB, 0x60, //   :%#= 
+	0x00, 0x04, 0xE7, 0x40, //   :%=: 
+	0x00, 0x09, 0xA0, 0x00, //   +*   
+	0x00, 0x0A, 0x80, 0x00, //   *+   
+	0x00, 0x0A, 0x80, 0x00, //   *+   
+	0x00, 0x0C, 0x80, 0x00, //   #+   
+	0x07, 0xCE, 0x30, 0x00, // =#%:   
+	0x02, 0x31, 0x00, 0x00, // .:.    
+
+	// @6016 '~' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x01, 0x31, 0x00, 0x01, // .:.   .
+	0x5E, 0xDF, 0xA7, 0x98, //-%%@*=++
+	0x41, 0x01, 0x7A, 0x81, //:. .=*+.
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+	0x00, 0x00, 0x00, 0x00, //        
+};
+
+sFONT_AA FontAA16 = {
+  FontAA16_Table,
+  8, /* Width */
+  16, /* Height */
+  NULL, /* Advance */
+  NULL, /* Kerning */
+  0, /* KerningCount */
+};
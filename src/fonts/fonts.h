@@ -19,6 +19,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include <stdint.h>
+#include <stddef.h>
 
 //ASCII
 typedef struct _tFont
@@ -29,6 +30,29 @@ typedef struct _tFont
   
 } sFONT;
 
+//Kerning pair of a proportional font
+typedef struct _tFontKern
+{
+  uint16_t Pair;      // left char << 8 | right char
+  int8_t Offset;      // added to the left char's advance
+
+} sFONT_KERN;
+
+//ASCII, anti-aliased: 4 bits of coverage per pixel, two pixels per byte
+//(left one in the high nibble), each row padded to a whole byte.
+//Monospaced fonts leave Advance NULL and step by Width; proportional ones
+//draw each glyph at its pen position, Width being the widest glyph.
+typedef struct _tFontAA
+{
+  const uint8_t *table;
+  uint16_t Width;
+  uint16_t Height;
+  const uint8_t *Advance;       // per char from ' ', or NULL
+  const sFONT_KERN *Kerning;    // sorted by Pair, or NULL
+  uint16_t KerningCount;
+
+} sFONT_AA;
+
 // External font declarations
 extern sFONT Font8;
 extern sFONT Font12;
@@ -36,6 +60,11 @@ extern sFONT Font16;
 extern sFONT Font20;
 extern sFONT Font24;
 
+extern sFONT_AA FontAA12;
+extern sFONT_AA FontAA16;
+extern sFONT_AA FontSans12;
+extern sFONT_AA FontSans16;
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,1462 @@
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.h"
+
+// 
+//  Font data for DejaVuSans.ttf, 12 pixels high, anti-aliased
+//  Generated by tools/fontgen.py: 4 bits of coverage per pixel, two pixels
+//  per byte with the left one in the high nibble
+// 
+
+const uint8_t FontSans12_Table[] = 
+{
+	// @0 ' ' (3 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @60 '!' (4 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x03, 0x40, 0x00, 0x00, 0x00, // ::       
+	0x07, 0x90, 0x00, 0x00, 0x00, // =+       
+	0x07, 0x90, 0x00, 0x00, 0x00, // =+       
+	0x07, 0x90, 0x00, 0x00, 0x00, // =+       
+	0x06, 0x80, 0x00, 0x00, 0x00, // =+       
+	0x03, 0x40, 0x00, 0x00, 0x00, // ::       
+	0x02, 0x20, 0x00, 0x00, 0x00, // ..       
+	0x07, 0x90, 0x00, 0x00, 0x00, // =+       
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @120 '"' (5 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x06, 0x16, 0x00, 0x00, 0x00, // =.=      
+	0x0D, 0x2B, 0x00, 0x00, 0x00, // %.#      
+	0x0D, 0x2B, 0x00, 0x00, 0x00, // %.#      
+	0x03, 0x03, 0x00, 0x00, 0x00, // : :      
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @180 '#' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x02, 0x30, 0x40, 0x00, //   .: :   
+	0x00, 0x08, 0x44, 0x90, 0x00, //   +::+   
+	0x03, 0x5C, 0x59, 0x84, 0x00, // :-#-++:  
+	0x04, 0x7D, 0x7D, 0x76, 0x00, // :=%=%==  
+	0x00, 0x48, 0x0C, 0x00, 0x00, //  :+ #    
+	0x2C, 0xED, 0xDE, 0xC3, 0x00, //.#%%%%#:  
+	0x00, 0xB1, 0x75, 0x00, 0x00, //  #.=-    
+	0x01, 0xC0, 0xB1, 0x00, 0x00, // .# #.    
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @240 '$' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x06, 0x00, 0x00, 0x00, //   =      
+	0x03, 0x9C, 0x81, 0x00, 0x00, // :+#+.    
+	0x1D, 0x38, 0x42, 0x00, 0x00, //.%:+:.    
+	0x1D, 0x17, 0x00, 0x00, 0x00, //.%.=      
+	0x06, 0xDD, 0x81, 0x00, 0x00, // =%%+.    
+	0x00, 0x09, 0x98, 0x00, 0x00, //   +++    
+	0x11, 0x07, 0x59, 0x00, 0x00, //.. =-+    
+	0x1B, 0xBD, 0xB2, 0x00, 0x00, //.##%#.    
+	0x00, 0x07, 0x00, 0x00, 0x00, //   =      
+	0x00, 0x04, 0x00, 0x00, 0x00, //   :      
+
+	// @300 '%' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x06, 0x93, 0x00, 0x34, 0x00, // =+:  ::  
+	0x49, 0x1C, 0x00, 0xB1, 0x00, //:+.#  #.  
+	0x66, 0x0C, 0x07, 0x50, 0x00, //== # =-   
+	0x3B, 0x4B, 0x2A, 0x00, 0x00, //:#:#.*    
+	0x03, 0x61, 0xA3, 0x9A, 0x80, // :=.*:+*+ 
+	0x00, 0x04, 0x82, 0xA0, 0xA2, //   :+.* *.
+	0x00, 0x0B, 0x13, 0x90, 0xA3, //   #.:+ *:
+	0x00, 0x75, 0x00, 0xB8, 0xB0, //  =-  #+# 
+	0x00, 0x10, 0x00, 0x02, 0x00, //  .    .  
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @360 '&' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x69, 0x81, 0x00, 0x00, //  =++.    
+	0x05, 0xB3, 0x52, 0x00, 0x00, // -#:-.    
+	0x06, 0x90, 0x00, 0x00, 0x00, // =+       
+	0x04, 0xF5, 0x00, 0x10, 0x00, // :@-  .   
+	0x1D, 0x3D, 0x50, 0xA4, 0x00, //.%:%- *:  
+	0x5A, 0x02, 0xD5, 0xC0, 0x00, //-* .%-#   
+	0x3D, 0x10, 0x2F, 0x80, 0x00, //:%. .@+   
+	0x07, 0xDA, 0xC7, 0xD4, 0x00, // =%*#=%:  
+	0x00, 0x12, 0x00, 0x00, 0x00, //  ..      
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @420 ''' (3 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x06, 0x00, 0x00, 0x00, 0x00, // =        
+	0x0D, 0x00, 0x00, 0x00, 0x00, // %        
+	0x0D, 0x00, 0x00, 0x00, 0x00, // %        
+	0x03, 0x00, 0x00, 0x00, 0x00, // :        
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @480 '(' (4 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0xA0, 0x00, 0x00, 0x00, //  *       
+	0x05, 0x80, 0x00, 0x00, 0x00, // -+       
+	0x0B, 0x30, 0x00, 0x00, 0x00, // #:       
+	0x0E, 0x00, 0x00, 0x00, 0x00, // %        
+	0x1D, 0x00, 0x00, 0x00, 0x00, //.%        
+	0x1E, 0x00, 0x00, 0x00, 0x00, //.%        
+	0x0D, 0x10, 0x00, 0x00, 0x00, // %.       
+	0x08, 0x50, 0x00, 0x00, 0x00, // +-       
+	0x02, 0xB0, 0x00, 0x00, 0x00, // .#       
+	0x00, 0x41, 0x00, 0x00, 0x00, //  :.      
+
+	// @540 ')' (4 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x0A, 0x00, 0x00, 0x00, 0x00, // *        
+	0x08, 0x50, 0x00, 0x00, 0x00, // +-       
+	0x03, 0xB0, 0x00, 0x00, 0x00, // :#       
+	0x00, 0xE0, 0x00, 0x00, 0x00, //  %       
+	0x00, 0xD2, 0x00, 0x00, 0x00, //  %.      
+	0x00, 0xD1, 0x00, 0x00, 0x00, //  %.      
+	0x01, 0xD0, 0x00, 0x00, 0x00, // .%       
+	0x05, 0x90, 0x00, 0x00, 0x00, // -+       
+	0x0B, 0x20, 0x00, 0x00, 0x00, // #.       
+	0x04, 0x00, 0x00, 0x00, 0x00, // :        
+
+	// @600 '*' (5 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x50, 0x00, 0x00, 0x00, //  -       
+	0x54, 0x92, 0x60, 0x00, 0x00, //-:+.=     
+	0x06, 0xE8, 0x00, 0x00, 0x00, // =%+      
+	0x58, 0xA7, 0x60, 0x00, 0x00, //-+*==     
+	0x10, 0x90, 0x10, 0x00, 0x00, //. + .     
+	0x00, 0x10, 0x00, 0x00, 0x00, //  .       
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @660 '+' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x01, 0x50, 0x00, 0x00, //   .-     
+	0x00, 0x02, 0xB0, 0x00, 0x00, //   .#     
+	0x00, 0x02, 0xB0, 0x00, 0x00, //   .#     
+	0x09, 0xAB, 0xEA, 0xA6, 0x00, // +*#%**=  
+	0x03, 0x34, 0xC3, 0x32, 0x00, // :::#::.  
+	0x00, 0x02, 0xB0, 0x00, 0x00, //   .#     
+	0x00, 0x02, 0xB0, 0x00, 0x00, //   .#     
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @720 ',' (3 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x03, 0x10, 0x00, 0x00, 0x00, // :.       
+	0x0C, 0x30, 0x00, 0x00, 0x00, // #:       
+	0x1C, 0x00, 0x00, 0x00, 0x00, //.#        
+	0x11, 0x00, 0x00, 0x00, 0x00, //..        
+
+	// @780 '-' (4 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x24, 0x41, 0x00, 0x00, 0x00, //.::.      
+	0x48, 0x82, 0x00, 0x00, 0x00, //:++.      
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @840 '.' (3 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x03, 0x10, 0x00, 0x00, 0x00, // :.       
+	0x0D, 0x20, 0x00, 0x00, 0x00, // %.       
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @900 '/' (3 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x33, 0x00, 0x00, 0x00, //  ::      
+	0x00, 0xA2, 0x00, 0x00, 0x00, //  *.      
+	0x01, 0xC0, 0x00, 0x00, 0x00, // .#       
+	0x05, 0x80, 0x00, 0x00, 0x00, // -+       
+	0x09, 0x30, 0x00, 0x00, 0x00, // +:       
+	0x0D, 0x00, 0x00, 0x00, 0x00, // %        
+	0x49, 0x00, 0x00, 0x00, 0x00, //:+        
+	0x85, 0x00, 0x00, 0x00, 0x00, //+-        
+	0xB1, 0x00, 0x00, 0x00, 0x00, //#.        
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @960 '0' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x01, 0x89, 0x40, 0x00, 0x00, // .++:     
+	0x0B, 0x83, 0xC4, 0x00, 0x00, // #+:#:    
+	0x2D, 0x00, 0x5A, 0x00, 0x00, //.%  -*    
+	0x4B, 0x00, 0x3D, 0x00, 0x00, //:#  :%    
+	0x5B, 0x00, 0x2D, 0x00, 0x00, //-#  .%    
+	0x3C, 0x00, 0x4C, 0x00, 0x00, //:#  :#    
+	0x0E, 0x20, 0x88, 0x00, 0x00, // %. ++    
+	0x05, 0xDB, 0xC1, 0x00, 0x00, // -%##.    
+	0x00, 0x12, 0x00, 0x00, 0x00, //  ..      
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @1020 '1' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x03, 0x67, 0x00, 0x00, 0x00, // :==      
+	0x09, 0x8E, 0x00, 0x00, 0x00, // ++%      
+	0x00, 0x1E, 0x00, 0x00, 0x00, //  .%      
+	0x00, 0x1E, 0x00, 0x00, 0x00, //  .%      
+	0x00, 0x1E, 0x00, 0x00, 0x00, //  .%      
+	0x00, 0x1E, 0x00, 0x00, 0x00, //  .%      
+	0x00, 0x1E, 0x00, 0x00, 0x00, //  .%      
+	0x09, 0xDF, 0xD8, 0x00, 0x00, // +%@%+    
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @1080 '2' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x16, 0x99, 0x40, 0x00, 0x00, //.=++:     
+	0x28, 0x45, 0xE3, 0x00, 0x00, //.+:-%:    
+	0x00, 0x00, 0x97, 0x00, 0x00, //    +=    
+	0x00, 0x00, 0xD3, 0x00, 0x00, //    %:    
+	0x00, 0x0A, 0x80, 0x00, 0x00, //   *+     
+	0x00, 0x99, 0x00, 0x00, 0x00, //  ++      
+	0x09, 0x90, 0x00, 0x00, 0x00, // ++       
+	0x4F, 0xDD, 0xD7, 0x00, 0x00, //:@%%%=    
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @1140 '3' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x07, 0x99, 0x50, 0x00, 0x00, // =++-     
+	0x06, 0x44, 0xD5, 0x00, 0x00, // =::%-    
+	0x00, 0x00, 0x88, 0x00, 0x00, //    ++    
+	0x00, 0x68, 0xB2, 0x00, 0x00, //  =+#.    
+	0x00, 0x57, 0xC3, 0x00, 0x00, //  -=#:    
+	0x00, 0x00, 0x5A, 0x00, 0x00, //    -*    
+	0x10, 0x00, 0x89, 0x00, 0x00, //.   ++    
+	0x3D, 0xBC, 0xC2, 0x00, 0x00, //:%###.    
+	0x00, 0x21, 0x00, 0x00, 0x00, //  ..      
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @1200 '4' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x04, 0x70, 0x00, 0x00, //   :=     
+	0x00, 0x2C, 0xE0, 0x00, 0x00, //  .#%     
+	0x00, 0xA4, 0xE0, 0x00, 0x00, //  *:%     
+	0x05, 0x82, 0xE0, 0x00, 0x00, // -+.%     
+	0x1C, 0x12, 0xE0, 0x00, 0x00, //.#..%     
+	0x7C, 0x9A, 0xE9, 0x00, 0x00, //=#+*%+    
+	0x24, 0x45, 0xE4, 0x00, 0x00, //.::-%:    
+	0x00, 0x02, 0xE0, 0x00, 0x00, //   .%     
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @1260 '5' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x07, 0x88, 0x81, 0x00, 0x00, // =+++.    
+	0x0D, 0x55, 0x50, 0x00, 0x00, // %---     
+	0x0D, 0x10, 0x00, 0x00, 0x00, // %.       
+	0x0D, 0xCD, 0x80, 0x00, 0x00, // %#%+     
+	0x01, 0x01, 0xB6, 0x00, 0x00, // . .#=    
+	0x00, 0x00, 0x6A, 0x00, 0x00, //    =*    
+	0x00, 0x00, 0xA7, 0x00, 0x00, //    *=    
+	0x3D, 0xBD, 0xB1, 0x00, 0x00, //:%#%#.    
+	0x00, 0x21, 0x00, 0x00, 0x00, //  ..      
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @1320 '6' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x59, 0x93, 0x00, 0x00, //  -++:    
+	0x07, 0xB4, 0x43, 0x00, 0x00, // =#:::    
+	0x1E, 0x10, 0x00, 0x00, 0x00, //.%.       
+	0x3D, 0xAC, 0xB2, 0x00, 0x00, //:%*##.    
+	0x4F, 0x40, 0x7B, 0x00, 0x00, //:@: =#    
+	0x3E, 0x00, 0x2D, 0x00, 0x00, //:%  .%    
+	0x0D, 0x20, 0x5B, 0x00, 0x00, // %. -#    
+	0x04, 0xDB, 0xD3, 0x00, 0x00, // :%#%:    
+	0x00, 0x02, 0x00, 0x00, 0x00, //   .      
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @1380 '7' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x18, 0x88, 0x85, 0x00, 0x00, //.++++-    
+	0x15, 0x55, 0xC7, 0x00, 0x00, //.---#=    
+	0x00, 0x01, 0xE1, 0x00, 0x00, //   .%.    
+	0x00, 0x06, 0xA0, 0x00, 0x00, //   =*     
+	0x00, 0x0B, 0x40, 0x00, 0x00, //   #:     
+	0x00, 0x2D, 0x00, 0x00, 0x00, //  .%      
+	0x00, 0x88, 0x00, 0x00, 0x00, //  ++      
+	0x00, 0xE2, 0x00, 0x00, 0x00, //  %.      
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @1440 '8' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x02, 0x89, 0x60, 0x00, 0x00, // .++=     
+	0x0D, 0x63, 0xB7, 0x00, 0x00, // %=:#=    
+	0x1E, 0x00, 0x69, 0x00, 0x00, //.%  =+    
+	0x08, 0x96, 0xB3, 0x00, 0x00, // ++=#:    
+	0x09, 0x97, 0xB4, 0x00, 0x00, // ++=#:    
+	0x3C, 0x00, 0x4C, 0x00, 0x00, //:#  :#    
+	0x3D, 0x00, 0x5B, 0x00, 0x00, //:%  -#    
+	0x09, 0xDB, 0xD4, 0x00, 0x00, // +%#%:    
+	0x00, 0x12, 0x00, 0x00, 0x00, //  ..      
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @1500 '9' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x02, 0x89, 0x40, 0x00, 0x00, // .++:     
+	0x1D, 0x54, 0xD3, 0x00, 0x00, //.%-:%:    
+	0x5B, 0x00, 0x69, 0x00, 0x00, //-#  =+    
+	0x4C, 0x00, 0x7C, 0x00, 0x00, //:#  =#    
+	0x0D, 0x86, 0xDC, 0x00, 0x00, // %+=%#    
+	0x01, 0x66, 0x6A, 0x00, 0x00, // .===*    
+	0x00, 0x00, 0xB5, 0x00, 0x00, //    #-    
+	0x0B, 0xBD, 0x80, 0x00, 0x00, // ##%+     
+	0x00, 0x21, 0x00, 0x00, 0x00, //  ..      
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @1560 ':' (3 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x04, 0x10, 0x00, 0x00, 0x00, // :.       
+	0x0B, 0x40, 0x00, 0x00, 0x00, // #:       
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x03, 0x10, 0x00, 0x00, 0x00, // :.       
+	0x0C, 0x40, 0x00, 0x00, 0x00, // #:       
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @1620 ';' (3 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x04, 0x10, 0x00, 0x00, 0x00, // :.       
+	0x0B, 0x40, 0x00, 0x00, 0x00, // #:       
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x03, 0x10, 0x00, 0x00, 0x00, // :.       
+	0x0C, 0x30, 0x00, 0x00, 0x00, // #:       
+	0x1C, 0x00, 0x00, 0x00, 0x00, //.#        
+	0x11, 0x00, 0x00, 0x00, 0x00, //..        
+
+	// @1680 '<' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x04, 0x97, 0x00, //     :+=  
+	0x00, 0x28, 0xDA, 0x40, 0x00, //  .+%*:   
+	0x0B, 0xD5, 0x10, 0x00, 0x00, // #%-.     
+	0x05, 0xAC, 0x72, 0x00, 0x00, // -*#=.    
+	0x00, 0x01, 0x6C, 0xB4, 0x00, //   .=##:  
+	0x00, 0x00, 0x00, 0x23, 0x00, //      .:  
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @1740 '=' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x09, 0xAA, 0xAA, 0xA6, 0x00, // +*****=  
+	0x03, 0x33, 0x33, 0x32, 0x00, // ::::::.  
+	0x09, 0x99, 0x99, 0x95, 0x00, // ++++++-  
+	0x03, 0x44, 0x44, 0x42, 0x00, // ::::::.  
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @1800 '>' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x0B, 0x72, 0x00, 0x00, 0x00, // #=.      
+	0x01, 0x6C, 0xB6, 0x10, 0x00, // .=##=.   
+	0x00, 0x00, 0x28, 0xE6, 0x00, //    .+%=  
+	0x00, 0x04, 0x9D, 0x82, 0x00, //   :+%+.  
+	0x07, 0xDA, 0x40, 0x00, 0x00, // =%*:     
+	0x05, 0x10, 0x00, 0x00, 0x00, // -.       
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @1860 '?' (5 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x16, 0x98, 0x10, 0x00, 0x00, //.=++.     
+	0x37, 0x3A, 0x90, 0x00, 0x00, //:=:*+     
+	0x00, 0x06, 0xA0, 0x00, 0x00, //   =*     
+	0x00, 0x3D, 0x20, 0x00, 0x00, //  :%.     
+	0x00, 0xD3, 0x00, 0x00, 0x00, //  %:      
+	0x00, 0xE0, 0x00, 0x00, 0x00, //  %       
+	0x00, 0x40, 0x00, 0x00, 0x00, //  :       
+	0x00, 0xF0, 0x00, 0x00, 0x00, //  @       
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @1920 '@' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x34, 0x10, 0x00, //    ::.   
+	0x00, 0x5B, 0x87, 0xAA, 0x10, //  -#+=**. 
+	0x05, 0x90, 0x00, 0x03, 0xB0, // -+    :# 
+	0x0B, 0x04, 0xCB, 0xA4, 0x66, // # :##*:==
+	0x47, 0x0C, 0x10, 0xB4, 0x28, //:= #. #:.+
+	0x56, 0x0C, 0x00, 0x84, 0x47, //-= #  +::=
+	0x29, 0x0A, 0x64, 0xD7, 0xB1, //.+ *=:%=#.
+	0x0B, 0x21, 0x77, 0x57, 0x10, // #..==-=. 
+	0x02, 0xB5, 0x00, 0x38, 0x00, // .#-  :+  
+	0x00, 0x17, 0xAB, 0x93, 0x00, //  .=*#+:  
+
+	// @1980 'A' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x18, 0x20, 0x00, 0x00, //  .+.     
+	0x00, 0x7E, 0x70, 0x00, 0x00, //  =%=     
+	0x00, 0xC4, 0xD0, 0x00, 0x00, //  #:%     
+	0x03, 0xC0, 0xB4, 0x00, 0x00, // :# #:    
+	0x09, 0x60, 0x59, 0x00, 0x00, // += -+    
+	0x0E, 0xCB, 0xCE, 0x10, 0x00, // %###%.   
+	0x5A, 0x11, 0x1A, 0x60, 0x00, //-*...*=   
+	0xB5, 0x00, 0x04, 0xC0, 0x00, //#-   :#   
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @2040 'B' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x07, 0x88, 0x61, 0x00, 0x00, // =++=.    
+	0x0F, 0x55, 0x9C, 0x00, 0x00, // @--+#    
+	0x0F, 0x00, 0x1F, 0x00, 0x00, // @  .@    
+	0x0F, 0x77, 0xA8, 0x00, 0x00, // @==*+    
+	0x0F, 0x77, 0x9A, 0x00, 0x00, // @==+*    
+	0x0F, 0x00, 0x0C, 0x40, 0x00, // @   #:   
+	0x0F, 0x00, 0x1D, 0x30, 0x00, // @  .%:   
+	0x0F, 0xCC, 0xD8, 0x00, 0x00, // @##%+    
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @2100 'C' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x49, 0x97, 0x10, 0x00, //  :++=.   
+	0x07, 0xC5, 0x36, 0x80, 0x00, // =#-:=+   
+	0x2E, 0x10, 0x00, 0x00, 0x00, //.%.       
+	0x5B, 0x00, 0x00, 0x00, 0x00, //-#        
+	0x6A, 0x00, 0x00, 0x00, 0x00, //=*        
+	0x4C, 0x00, 0x00, 0x00, 0x00, //:#        
+	0x0D, 0x60, 0x00, 0x40, 0x00, // %=   :   
+	0x02, 0xBC, 0xBD, 0x60, 0x00, // .###%=   
+	0x00, 0x01, 0x20, 0x00, 0x00, //   ..     
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @2160 'D' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x07, 0x87, 0x62, 0x00, 0x00, // =+==.    
+	0x0F, 0x55, 0x7D, 0x60, 0x00, // @--=%=   
+	0x0F, 0x00, 0x02, 0xE1, 0x00, // @   .%.  
+	0x0F, 0x00, 0x00, 0xC4, 0x00, // @    #:  
+	0x0F, 0x00, 0x00, 0xB5, 0x00, // @    #-  
+	0x0F, 0x00, 0x00, 0xE3, 0x00, // @    %:  
+	0x0F, 0x00, 0x18, 0xB0, 0x00, // @  .+#   
+	0x0F, 0xCD, 0xD9, 0x10, 0x00, // @#%%+.   
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @2220 'E' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x07, 0x88, 0x86, 0x00, 0x00, // =+++=    
+	0x0F, 0x55, 0x54, 0x00, 0x00, // @---:    
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x77, 0x74, 0x00, 0x00, // @===:    
+	0x0F, 0x77, 0x74, 0x00, 0x00, // @===:    
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0xDD, 0xDB, 0x00, 0x00, // @%%%#    
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @2280 'F' (6 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x07, 0x88, 0x82, 0x00, 0x00, // =+++.    
+	0x0F, 0x55, 0x52, 0x00, 0x00, // @---.    
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x77, 0x70, 0x00, 0x00, // @===     
+	0x0F, 0x77, 0x70, 0x00, 0x00, // @===     
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @2340 'G' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x49, 0x98, 0x30, 0x00, //  :+++:   
+	0x07, 0xC5, 0x35, 0xB0, 0x00, // =#-:-#   
+	0x2E, 0x10, 0x00, 0x00, 0x00, //.%.       
+	0x5B, 0x00, 0x00, 0x00, 0x00, //-#        
+	0x6A, 0x00, 0x7D, 0xE2, 0x00, //=*  =%%.  
+	0x4C, 0x00, 0x00, 0xD2, 0x00, //:#    %.  
+	0x0D, 0x60, 0x00, 0xD2, 0x00, // %=   %.  
+	0x02, 0xBC, 0xAC, 0xA1, 0x00, // .##*#*.  
+	0x00, 0x01, 0x20, 0x00, 0x00, //   ..     
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @2400 'H' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x07, 0x00, 0x02, 0x60, 0x00, // =   .=   
+	0x0F, 0x00, 0x04, 0xB0, 0x00, // @   :#   
+	0x0F, 0x00, 0x04, 0xB0, 0x00, // @   :#   
+	0x0F, 0x77, 0x79, 0xB0, 0x00, // @===+#   
+	0x0F, 0x77, 0x79, 0xB0, 0x00, // @===+#   
+	0x0F, 0x00, 0x04, 0xB0, 0x00, // @   :#   
+	0x0F, 0x00, 0x04, 0xB0, 0x00, // @   :#   
+	0x0F, 0x00, 0x04, 0xB0, 0x00, // @   :#   
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @2460 'I' (3 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x07, 0x00, 0x00, 0x00, 0x00, // =        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @2520 'J' (3 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x07, 0x00, 0x00, 0x00, 0x00, // =        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x2E, 0x00, 0x00, 0x00, 0x00, //.%        
+	0xE6, 0x00, 0x00, 0x00, 0x00, //%=        
+
+	// @2580 'K' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x07, 0x00, 0x06, 0x30, 0x00, // =   =:   
+	0x0F, 0x00, 0xA9, 0x00, 0x00, // @  *+    
+	0x0F, 0x1B, 0x80, 0x00, 0x00, // @.#+     
+	0x0F, 0xC7, 0x00, 0x00, 0x00, // @#=      
+	0x0F, 0xC7, 0x00, 0x00, 0x00, // @#=      
+	0x0F, 0x1C, 0x70, 0x00, 0x00, // @.#=     
+	0x0F, 0x01, 0xC7, 0x00, 0x00, // @ .#=    
+	0x0F, 0x00, 0x1C, 0x70, 0x00, // @  .#=   
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @2640 'L' (6 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x07, 0x00, 0x00, 0x00, 0x00, // =        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0xDD, 0xD9, 0x00, 0x00, // @%%%+    
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @2700 'M' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x07, 0x50, 0x00, 0x57, 0x00, // =-   -=  
+	0x0F, 0xC0, 0x01, 0xDD, 0x00, // @#  .%%  
+	0x0F, 0x94, 0x06, 0x9D, 0x00, // @+: =+%  
+	0x0F, 0x3A, 0x0B, 0x3D, 0x00, // @:* #:%  
+	0x0F, 0x0C, 0x3B, 0x2D, 0x00, // @ #:#.%  
+	0x0F, 0x07, 0xD5, 0x2D, 0x00, // @ =%-.%  
+	0x0F, 0x01, 0x81, 0x2D, 0x00, // @ .+..%  
+	0x0F, 0x00, 0x00, 0x2D, 0x00, // @    .%  
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @2760 'N' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x07, 0x40, 0x02, 0x50, 0x00, // =:  .-   
+	0x0F, 0xD0, 0x04, 0xA0, 0x00, // @%  :*   
+	0x0F, 0x97, 0x04, 0xA0, 0x00, // @+= :*   
+	0x0F, 0x1D, 0x14, 0xA0, 0x00, // @.%.:*   
+	0x0F, 0x08, 0x84, 0xA0, 0x00, // @ ++:*   
+	0x0F, 0x01, 0xD6, 0xA0, 0x00, // @ .%=*   
+	0x0F, 0x00, 0x7D, 0xA0, 0x00, // @  =%*   
+	0x0F, 0x00, 0x1D, 0xA0, 0x00, // @  .%*   
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @2820 'O' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x59, 0x95, 0x00, 0x00, //  -++-    
+	0x08, 0xC4, 0x4B, 0x90, 0x00, // +#::#+   
+	0x2E, 0x10, 0x00, 0xD3, 0x00, //.%.   %:  
+	0x5B, 0x00, 0x00, 0x97, 0x00, //-#    +=  
+	0x6A, 0x00, 0x00, 0x88, 0x00, //=*    ++  
+	0x4C, 0x00, 0x00, 0xB6, 0x00, //:#    #=  
+	0x0D, 0x50, 0x04, 0xE1, 0x00, // %-  :%.  
+	0x02, 0xCC, 0xBC, 0x30, 0x00, // .####:   
+	0x00, 0x01, 0x20, 0x00, 0x00, //   ..     
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @2880 'P' (6 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x07, 0x87, 0x50, 0x00, 0x00, // =+=-     
+	0x0F, 0x55, 0xC8, 0x00, 0x00, // @--#+    
+	0x0F, 0x00, 0x4C, 0x00, 0x00, // @  :#    
+	0x0F, 0x00, 0x7B, 0x00, 0x00, // @  =#    
+	0x0F, 0xDD, 0xC3, 0x00, 0x00, // @%%#:    
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x0F, 0x00, 0x00, 0x00, 0x00, // @        
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @2940 'Q' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x59, 0x95, 0x00, 0x00, //  -++-    
+	0x08, 0xC4, 0x4B, 0x90, 0x00, // +#::#+   
+	0x2E, 0x10, 0x00, 0xD3, 0x00, //.%.   %:  
+	0x5B, 0x00, 0x00, 0x97, 0x00, //-#    +=  
+	0x6A, 0x00, 0x00, 0x88, 0x00, //=*    ++  
+	0x4C, 0x00, 0x00, 0xB6, 0x00, //:#    #=  
+	0x0D, 0x50, 0x04, 0xE1, 0x00, // %-  :%.  
+	0x02, 0xCC, 0xBD, 0x30, 0x00, // .###%:   
+	0x00, 0x01, 0x4D, 0x20, 0x00, //   .:%.   
+	0x00, 0x00, 0x03, 0x30, 0x00, //     ::   
+
+	// @3000 'R' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x07, 0x87, 0x50, 0x00, 0x00, // =+=-     
+	0x0F, 0x55, 0xC8, 0x00, 0x00, // @--#+    
+	0x0F, 0x00, 0x4D, 0x00, 0x00, // @  :%    
+	0x0F, 0x01, 0x8A, 0x00, 0x00, // @ .+*    
+	0x0F, 0xCD, 0xE1, 0x00, 0x00, // @#%%.    
+	0x0F, 0x00, 0x89, 0x00, 0x00, // @  ++    
+	0x0F, 0x00, 0x1E, 0x20, 0x00, // @  .%.   
+	0x0F, 0x00, 0x07, 0x90, 0x00, // @   =+   
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @3060 'S' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x03, 0x89, 0x83, 0x00, 0x00, // :+++:    
+	0x1E, 0x63, 0x55, 0x00, 0x00, //.%=:--    
+	0x4B, 0x00, 0x00, 0x00, 0x00, //:#        
+	0x1E, 0x95, 0x10, 0x00, 0x00, //.%+-.     
+	0x01, 0x7A, 0xE6, 0x00, 0x00, // .=*%=    
+	0x00, 0x00, 0x4E, 0x00, 0x00, //    :%    
+	0x11, 0x00, 0x4D, 0x00, 0x00, //..  :%    
+	0x3D, 0xBB, 0xD5, 0x00, 0x00, //:%##%-    
+	0x00, 0x22, 0x00, 0x00, 0x00, //  ..      
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @3120 'T' (6 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x88, 0x88, 0x88, 0x20, 0x00, //++++++.   
+	0x55, 0x8B, 0x55, 0x20, 0x00, //--+#--.   
+	0x00, 0x5A, 0x00, 0x00, 0x00, //  -*      
+	0x00, 0x5A, 0x00, 0x00, 0x00, //  -*      
+	0x00, 0x5A, 0x00, 0x00, 0x00, //  -*      
+	0x00, 0x5A, 0x00, 0x00, 0x00, //  -*      
+	0x00, 0x5A, 0x00, 0x00, 0x00, //  -*      
+	0x00, 0x5A, 0x00, 0x00, 0x00, //  -*      
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @3180 'U' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x17, 0x00, 0x03, 0x50, 0x00, //.=   :-   
+	0x2E, 0x00, 0x06, 0xA0, 0x00, //.%   =*   
+	0x2E, 0x00, 0x06, 0xA0, 0x00, //.%   =*   
+	0x2E, 0x00, 0x06, 0xA0, 0x00, //.%   =*   
+	0x2E, 0x00, 0x06, 0xA0, 0x00, //.%   =*   
+	0x1E, 0x00, 0x06, 0x90, 0x00, //.%   =+   
+	0x0D, 0x30, 0x0A, 0x60, 0x00, // %:  *=   
+	0x04, 0xDB, 0xCA, 0x10, 0x00, // :%##*.   
+	0x00, 0x02, 0x10, 0x00, 0x00, //   ..     
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @3240 'V' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x62, 0x00, 0x01, 0x60, 0x00, //=.   .=   
+	0x88, 0x00, 0x07, 0x90, 0x00, //++   =+   
+	0x2D, 0x00, 0x0D, 0x30, 0x00, //.%   %:   
+	0x0C, 0x40, 0x3C, 0x00, 0x00, // #: :#    
+	0x06, 0xA0, 0x97, 0x00, 0x00, // =* +=    
+	0x01, 0xE2, 0xE1, 0x00, 0x00, // .%.%.    
+	0x00, 0x9B, 0xA0, 0x00, 0x00, //  +#*     
+	0x00, 0x4F, 0x40, 0x00, 0x00, //  :@:     
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @3300 'W' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x43, 0x00, 0x46, 0x00, 0x26, //::  :=  .=
+	0x69, 0x00, 0xBD, 0x00, 0x69, //=+  #%  =+
+	0x2D, 0x00, 0xCA, 0x30, 0xA5, //.%  #*: *-
+	0x0E, 0x23, 0x96, 0x60, 0xE1, // %.:+== %.
+	0x0A, 0x67, 0x52, 0xA3, 0xD0, // *==-.*:% 
+	0x06, 0x9B, 0x20, 0xC6, 0x90, // =+#. #=+ 
+	0x02, 0xDC, 0x00, 0xAC, 0x50, // .%#  *#- 
+	0x00, 0xD9, 0x00, 0x6F, 0x10, //  %+  =@. 
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @3360 'X' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x17, 0x00, 0x05, 0x30, 0x00, //.=   -:   
+	0x0A, 0x60, 0x3D, 0x10, 0x00, // *= :%.   
+	0x01, 0xD2, 0xC4, 0x00, 0x00, // .%.#:    
+	0x00, 0x5E, 0x80, 0x00, 0x00, //  -%+     
+	0x00, 0x5F, 0x70, 0x00, 0x00, //  -@=     
+	0x01, 0xD3, 0xD2, 0x00, 0x00, // .%:%.    
+	0x0A, 0x60, 0x5B, 0x00, 0x00, // *= -#    
+	0x5B, 0x00, 0x0A, 0x60, 0x00, //-#   *=   
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @3420 'Y' (6 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x62, 0x00, 0x07, 0x10, 0x00, //=.   =.   
+	0x5B, 0x00, 0x79, 0x00, 0x00, //-#  =+    
+	0x0A, 0x62, 0xD1, 0x00, 0x00, // *=.%.    
+	0x01, 0xDC, 0x40, 0x00, 0x00, // .%#:     
+	0x00, 0x6B, 0x00, 0x00, 0x00, //  =#      
+	0x00, 0x5A, 0x00, 0x00, 0x00, //  -*      
+	0x00, 0x5A, 0x00, 0x00, 0x00, //  -*      
+	0x00, 0x5A, 0x00, 0x00, 0x00, //  -*      
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @3480 'Z' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x38, 0x88, 0x88, 0x40, 0x00, //:+++++:   
+	0x25, 0x55, 0x6E, 0x40, 0x00, //.---=%:   
+	0x00, 0x00, 0xB7, 0x00, 0x00, //    #=    
+	0x00, 0x08, 0xA0, 0x00, 0x00, //   +*     
+	0x00, 0x5C, 0x10, 0x00, 0x00, //  -#.     
+	0x03, 0xD2, 0x00, 0x00, 0x00, // :%.      
+	0x1D, 0x40, 0x00, 0x00, 0x00, //.%:       
+	0x8F, 0xDD, 0xDD, 0x80, 0x00, //+@%%%%+   
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @3540 '[' (4 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x1C, 0xA0, 0x00, 0x00, 0x00, //.#*       
+	0x2C, 0x00, 0x00, 0x00, 0x00, //.#        
+	0x2C, 0x00, 0x00, 0x00, 0x00, //.#        
+	0x2C, 0x00, 0x00, 0x00, 0x00, //.#        
+	0x2C, 0x00, 0x00, 0x00, 0x00, //.#        
+	0x2C, 0x00, 0x00, 0x00, 0x00, //.#        
+	0x2C, 0x00, 0x00, 0x00, 0x00, //.#        
+	0x2C, 0x00, 0x00, 0x00, 0x00, //.#        
+	0x2D, 0x60, 0x00, 0x00, 0x00, //.%=       
+	0x16, 0x60, 0x00, 0x00, 0x00, //.==       
+
+	// @3600 '\' (3 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x60, 0x00, 0x00, 0x00, 0x00, //=         
+	0xA3, 0x00, 0x00, 0x00, 0x00, //*:        
+	0x67, 0x00, 0x00, 0x00, 0x00, //==        
+	0x1C, 0x00, 0x00, 0x00, 0x00, //.#        
+	0x0B, 0x20, 0x00, 0x00, 0x00, // #.       
+	0x07, 0x60, 0x00, 0x00, 0x00, // ==       
+	0x02, 0xB0, 0x00, 0x00, 0x00, // .#       
+	0x00, 0xC1, 0x00, 0x00, 0x00, //  #.      
+	0x00, 0x75, 0x00, 0x00, 0x00, //  =-      
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @3660 ']' (4 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x0A, 0xC2, 0x00, 0x00, 0x00, // *#.      
+	0x00, 0xC2, 0x00, 0x00, 0x00, //  #.      
+	0x00, 0xC2, 0x00, 0x00, 0x00, //  #.      
+	0x00, 0xC2, 0x00, 0x00, 0x00, //  #.      
+	0x00, 0xC2, 0x00, 0x00, 0x00, //  #.      
+	0x00, 0xC2, 0x00, 0x00, 0x00, //  #.      
+	0x00, 0xC2, 0x00, 0x00, 0x00, //  #.      
+	0x00, 0xC2, 0x00, 0x00, 0x00, //  #.      
+	0x06, 0xD2, 0x00, 0x00, 0x00, // =%.      
+	0x06, 0x61, 0x00, 0x00, 0x00, // ==.      
+
+	// @3720 '^' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x03, 0x71, 0x00, 0x00, //   :=.    
+	0x00, 0x3D, 0x8B, 0x10, 0x00, //  :%+#.   
+	0x03, 0xC2, 0x05, 0xB1, 0x00, // :#. -#.  
+	0x04, 0x10, 0x00, 0x32, 0x00, // :.   :.  
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @3780 '_' (5 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x55, 0x55, 0x51, 0x00, 0x00, //-----.    
+
+	// @3840 '`' (5 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x03, 0x00, 0x00, 0x00, 0x00, // :        
+	0x07, 0x60, 0x00, 0x00, 0x00, // ==       
+	0x00, 0x71, 0x00, 0x00, 0x00, //  =.      
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @3900 'a' (6 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x08, 0xBB, 0x50, 0x00, 0x00, // +##-     
+	0x04, 0x12, 0xC2, 0x00, 0x00, // :..#.    
+	0x03, 0x88, 0xC5, 0x00, 0x00, // :++#-    
+	0x3C, 0x43, 0xA6, 0x00, 0x00, //:#::*=    
+	0x59, 0x00, 0xC6, 0x00, 0x00, //-+  #=    
+	0x1D, 0xAB, 0xB6, 0x00, 0x00, //.%*##=    
+	0x00, 0x20, 0x00, 0x00, 0x00, //  .       
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @3960 'b' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x1B, 0x00, 0x00, 0x00, 0x00, //.#        
+	0x1D, 0x00, 0x00, 0x00, 0x00, //.%        
+	0x1D, 0x6B, 0x91, 0x00, 0x00, //.%=#+.    
+	0x1F, 0x71, 0x89, 0x00, 0x00, //.@=.++    
+	0x1E, 0x00, 0x1E, 0x00, 0x00, //.%  .%    
+	0x1D, 0x00, 0x0E, 0x00, 0x00, //.%   %    
+	0x1F, 0x20, 0x4B, 0x00, 0x00, //.@. :#    
+	0x1D, 0xAA, 0xD3, 0x00, 0x00, //.%**%:    
+	0x00, 0x02, 0x00, 0x00, 0x00, //   .      
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @4020 'c' (6 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x03, 0xAB, 0x90, 0x00, 0x00, // :*#+     
+	0x1D, 0x41, 0x30, 0x00, 0x00, //.%:.:     
+	0x5A, 0x00, 0x00, 0x00, 0x00, //-*        
+	0x69, 0x00, 0x00, 0x00, 0x00, //=+        
+	0x3D, 0x10, 0x00, 0x00, 0x00, //:%.       
+	0x07, 0xDA, 0xC0, 0x00, 0x00, // =%*#     
+	0x00, 0x12, 0x00, 0x00, 0x00, //  ..      
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @4080 'd' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x47, 0x00, 0x00, //    :=    
+	0x00, 0x00, 0x59, 0x00, 0x00, //    -+    
+	0x04, 0xBA, 0x79, 0x00, 0x00, // :#*=+    
+	0x1D, 0x32, 0xC9, 0x00, 0x00, //.%:.#+    
+	0x59, 0x00, 0x69, 0x00, 0x00, //-+  =+    
+	0x68, 0x00, 0x59, 0x00, 0x00, //=+  -+    
+	0x3C, 0x00, 0x99, 0x00, 0x00, //:#  ++    
+	0x09, 0xCB, 0xA9, 0x00, 0x00, // +##*+    
+	0x00, 0x11, 0x00, 0x00, 0x00, //  ..      
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @4140 'e' (6 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x02, 0xAB, 0x70, 0x00, 0x00, // .*#=     
+	0x1D, 0x41, 0x97, 0x00, 0x00, //.%:.+=    
+	0x5B, 0x55, 0x7B, 0x00, 0x00, //-#--=#    
+	0x6B, 0x66, 0x64, 0x00, 0x00, //=#===:    
+	0x3D, 0x10, 0x00, 0x00, 0x00, //:%.       
+	0x07, 0xDA, 0xB7, 0x00, 0x00, // =%*#=    
+	0x00, 0x12, 0x10, 0x00, 0x00, //  ...     
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @4200 'f' (4 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x04, 0xB9, 0x00, 0x00, 0x00, // :#+      
+	0x0C, 0x20, 0x00, 0x00, 0x00, // #.       
+	0x7E, 0xA5, 0x00, 0x00, 0x00, //=%*-      
+	0x1D, 0x21, 0x00, 0x00, 0x00, //.%..      
+	0x0D, 0x10, 0x00, 0x00, 0x00, // %.       
+	0x0D, 0x10, 0x00, 0x00, 0x00, // %.       
+	0x0D, 0x10, 0x00, 0x00, 0x00, // %.       
+	0x0D, 0x10, 0x00, 0x00, 0x00, // %.       
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @4260 'g' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x04, 0xBA, 0x56, 0x00, 0x00, // :#*-=    
+	0x2D, 0x32, 0xC9, 0x00, 0x00, //.%:.#+    
+	0x69, 0x00, 0x69, 0x00, 0x00, //=+  =+    
+	0x68, 0x00, 0x59, 0x00, 0x00, //=+  -+    
+	0x3D, 0x10, 0xA9, 0x00, 0x00, //:%. *+    
+	0x07, 0xDB, 0x99, 0x00, 0x00, // =%#++    
+	0x00, 0x00, 0x87, 0x00, 0x00, //    +=    
+	0x09, 0xAB, 0xC1, 0x00, 0x00, // +*##.    
+
+	// @4320 'h' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x1B, 0x00, 0x00, 0x00, 0x00, //.#        
+	0x1D, 0x00, 0x00, 0x00, 0x00, //.%        
+	0x1D, 0x6B, 0x91, 0x00, 0x00, //.%=#+.    
+	0x1F, 0x61, 0x97, 0x00, 0x00, //.@=.+=    
+	0x1E, 0x00, 0x4A, 0x00, 0x00, //.%  :*    
+	0x1D, 0x00, 0x4A, 0x00, 0x00, //.%  :*    
+	0x1D, 0x00, 0x4A, 0x00, 0x00, //.%  :*    
+	0x1D, 0x00, 0x4A, 0x00, 0x00, //.%  :*    
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @4380 'i' (3 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x0B, 0x00, 0x00, 0x00, 0x00, // #        
+	0x04, 0x00, 0x00, 0x00, 0x00, // :        
+	0x08, 0x00, 0x00, 0x00, 0x00, // +        
+	0x0D, 0x00, 0x00, 0x00, 0x00, // %        
+	0x0D, 0x00, 0x00, 0x00, 0x00, // %        
+	0x0D, 0x00, 0x00, 0x00, 0x00, // %        
+	0x0D, 0x00, 0x00, 0x00, 0x00, // %        
+	0x0D, 0x00, 0x00, 0x00, 0x00, // %        
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @4440 'j' (3 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x0B, 0x00, 0x00, 0x00, 0x00, // #        
+	0x04, 0x00, 0x00, 0x00, 0x00, // :        
+	0x08, 0x00, 0x00, 0x00, 0x00, // +        
+	0x0D, 0x00, 0x00, 0x00, 0x00, // %        
+	0x0D, 0x00, 0x00, 0x00, 0x00, // %        
+	0x0D, 0x00, 0x00, 0x00, 0x00, // %        
+	0x0D, 0x00, 0x00, 0x00, 0x00, // %        
+	0x0D, 0x00, 0x00, 0x00, 0x00, // %        
+	0x1D, 0x00, 0x00, 0x00, 0x00, //.%        
+	0xC8, 0x00, 0x00, 0x00, 0x00, //#+        
+
+	// @4500 'k' (6 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x1B, 0x00, 0x00, 0x00, 0x00, //.#        
+	0x1D, 0x00, 0x00, 0x00, 0x00, //.%        
+	0x1D, 0x00, 0x74, 0x00, 0x00, //.%  =:    
+	0x1D, 0x0A, 0x80, 0x00, 0x00, //.% *+     
+	0x1E, 0xB6, 0x00, 0x00, 0x00, //.%#=      
+	0x1E, 0xC5, 0x00, 0x00, 0x00, //.%#-      
+	0x1D, 0x1B, 0x60, 0x00, 0x00, //.%.#=     
+	0x1D, 0x01, 0xB6, 0x00, 0x00, //.% .#=    
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @4560 'l' (3 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x0B, 0x00, 0x00, 0x00, 0x00, // #        
+	0x0D, 0x00, 0x00, 0x00, 0x00, // %        
+	0x0D, 0x00, 0x00, 0x00, 0x00, // %        
+	0x0D, 0x00, 0x00, 0x00, 0x00, // %        
+	0x0D, 0x00, 0x00, 0x00, 0x00, // %        
+	0x0D, 0x00, 0x00, 0x00, 0x00, // %        
+	0x0D, 0x00, 0x00, 0x00, 0x00, // %        
+	0x0D, 0x00, 0x00, 0x00, 0x00, // %        
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @4620 'm' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x18, 0x6B, 0x81, 0x9B, 0x50, //.+=#+.+#- 
+	0x1F, 0x61, 0xBC, 0x33, 0xE1, //.@=.##::%.
+	0x1E, 0x00, 0x78, 0x00, 0xC2, //.%  =+  #.
+	0x1D, 0x00, 0x68, 0x00, 0xB2, //.%  =+  #.
+	0x1D, 0x00, 0x68, 0x00, 0xB2, //.%  =+  #.
+	0x1D, 0x00, 0x68, 0x00, 0xB2, //.%  =+  #.
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @4680 'n' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x18, 0x6B, 0x91, 0x00, 0x00, //.+=#+.    
+	0x1F, 0x61, 0x97, 0x00, 0x00, //.@=.+=    
+	0x1E, 0x00, 0x4A, 0x00, 0x00, //.%  :*    
+	0x1D, 0x00, 0x4A, 0x00, 0x00, //.%  :*    
+	0x1D, 0x00, 0x4A, 0x00, 0x00, //.%  :*    
+	0x1D, 0x00, 0x4A, 0x00, 0x00, //.%  :*    
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @4740 'o' (6 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x03, 0xAB, 0x60, 0x00, 0x00, // :*#=     
+	0x1D, 0x32, 0xC5, 0x00, 0x00, //.%:.#-    
+	0x59, 0x00, 0x5A, 0x00, 0x00, //-+  -*    
+	0x69, 0x00, 0x4B, 0x00, 0x00, //=+  :#    
+	0x3C, 0x00, 0x88, 0x00, 0x00, //:#  ++    
+	0x08, 0xCB, 0xC1, 0x00, 0x00, // +###.    
+	0x00, 0x12, 0x00, 0x00, 0x00, //  ..      
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @4800 'p' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x18, 0x6B, 0x91, 0x00, 0x00, //.+=#+.    
+	0x1F, 0x71, 0x89, 0x00, 0x00, //.@=.++    
+	0x1E, 0x00, 0x1E, 0x00, 0x00, //.%  .%    
+	0x1D, 0x00, 0x0E, 0x00, 0x00, //.%   %    
+	0x1F, 0x20, 0x4B, 0x00, 0x00, //.@. :#    
+	0x1D, 0xAA, 0xD3, 0x00, 0x00, //.%**%:    
+	0x1D, 0x02, 0x00, 0x00, 0x00, //.% .      
+	0x1D, 0x00, 0x00, 0x00, 0x00, //.%        
+
+	// @4860 'q' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x04, 0xBA, 0x56, 0x00, 0x00, // :#*-=    
+	0x1D, 0x32, 0xC9, 0x00, 0x00, //.%:.#+    
+	0x59, 0x00, 0x69, 0x00, 0x00, //-+  =+    
+	0x68, 0x00, 0x59, 0x00, 0x00, //=+  -+    
+	0x3C, 0x00, 0x99, 0x00, 0x00, //:#  ++    
+	0x09, 0xCB, 0xA9, 0x00, 0x00, // +##*+    
+	0x00, 0x11, 0x59, 0x00, 0x00, //  ..-+    
+	0x00, 0x00, 0x59, 0x00, 0x00, //    -+    
+
+	// @4920 'r' (4 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x18, 0x6B, 0x30, 0x00, 0x00, //.+=#:     
+	0x1F, 0x71, 0x10, 0x00, 0x00, //.@=..     
+	0x1E, 0x00, 0x00, 0x00, 0x00, //.%        
+	0x1D, 0x00, 0x00, 0x00, 0x00, //.%        
+	0x1D, 0x00, 0x00, 0x00, 0x00, //.%        
+	0x1D, 0x00, 0x00, 0x00, 0x00, //.%        
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @4980 's' (5 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x07, 0xBB, 0x50, 0x00, 0x00, // =##-     
+	0x5A, 0x11, 0x20, 0x00, 0x00, //-*...     
+	0x4D, 0x52, 0x00, 0x00, 0x00, //:%-.      
+	0x03, 0x8D, 0x70, 0x00, 0x00, // :+%=     
+	0x00, 0x02, 0xC0, 0x00, 0x00, //   .#     
+	0x6C, 0xAC, 0x60, 0x00, 0x00, //=#*#=     
+	0x01, 0x21, 0x00, 0x00, 0x00, // ...      
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @5040 't' (4 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x03, 0x00, 0x00, 0x00, 0x00, // :        
+	0x1D, 0x00, 0x00, 0x00, 0x00, //.%        
+	0x7E, 0x97, 0x00, 0x00, 0x00, //=%+=      
+	0x1D, 0x11, 0x00, 0x00, 0x00, //.%..      
+	0x1D, 0x00, 0x00, 0x00, 0x00, //.%        
+	0x1D, 0x00, 0x00, 0x00, 0x00, //.%        
+	0x0E, 0x00, 0x00, 0x00, 0x00, // %        
+	0x09, 0xC9, 0x00, 0x00, 0x00, // +#+      
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @5100 'u' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x18, 0x00, 0x36, 0x00, 0x00, //.+  :=    
+	0x2C, 0x00, 0x59, 0x00, 0x00, //.#  -+    
+	0x2C, 0x00, 0x59, 0x00, 0x00, //.#  -+    
+	0x2C, 0x00, 0x59, 0x00, 0x00, //.#  -+    
+	0x1E, 0x00, 0x99, 0x00, 0x00, //.%  ++    
+	0x09, 0xCB, 0xA9, 0x00, 0x00, // +##*+    
+	0x00, 0x11, 0x00, 0x00, 0x00, //  ..      
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @5160 'v' (6 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x54, 0x00, 0x36, 0x00, 0x00, //-:  :=    
+	0x4B, 0x00, 0x96, 0x00, 0x00, //:#  +=    
+	0x0D, 0x11, 0xD1, 0x00, 0x00, // %..%.    
+	0x08, 0x75, 0x90, 0x00, 0x00, // +=-+     
+	0x02, 0xCB, 0x40, 0x00, 0x00, // .##:     
+	0x00, 0xBD, 0x00, 0x00, 0x00, //  #%      
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @5220 'w' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x54, 0x04, 0x80, 0x08, 0x00, //-: :+  +  
+	0x4A, 0x09, 0xD1, 0x3B, 0x00, //:* +%.:#  
+	0x1D, 0x0C, 0x75, 0x77, 0x00, //.% #=-==  
+	0x0B, 0x5A, 0x39, 0xB3, 0x00, // #-*:+#:  
+	0x07, 0xD6, 0x0C, 0xD0, 0x00, // =%= #%   
+	0x03, 0xF2, 0x0B, 0xA0, 0x00, // :@. #*   
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @5280 'x' (6 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x38, 0x00, 0x64, 0x00, 0x00, //:+  =:    
+	0x0A, 0x64, 0xC0, 0x00, 0x00, // *=:#     
+	0x01, 0xDD, 0x20, 0x00, 0x00, // .%%.     
+	0x00, 0xCD, 0x10, 0x00, 0x00, //  #%.     
+	0x09, 0x87, 0xA0, 0x00, 0x00, // ++=*     
+	0x5B, 0x00, 0xA6, 0x00, 0x00, //-#  *=    
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @5340 'y' (6 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x54, 0x00, 0x36, 0x00, 0x00, //-:  :=    
+	0x3B, 0x00, 0xA5, 0x00, 0x00, //:#  *-    
+	0x0C, 0x21, 0xD0, 0x00, 0x00, // #..%     
+	0x06, 0x87, 0x80, 0x00, 0x00, // =+=+     
+	0x01, 0xDD, 0x20, 0x00, 0x00, // .%%.     
+	0x00, 0x9B, 0x00, 0x00, 0x00, //  +#      
+	0x00, 0xA5, 0x00, 0x00, 0x00, //  *-      
+	0x2A, 0xC0, 0x00, 0x00, 0x00, //.*#       
+
+	// @5400 'z' (5 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x49, 0x99, 0x90, 0x00, 0x00, //:++++     
+	0x12, 0x28, 0xA0, 0x00, 0x00, //...+*     
+	0x00, 0x4C, 0x10, 0x00, 0x00, //  :#.     
+	0x03, 0xD2, 0x00, 0x00, 0x00, // :%.      
+	0x2D, 0x30, 0x00, 0x00, 0x00, //.%:       
+	0x8E, 0xBB, 0xB0, 0x00, 0x00, //+%###     
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+
+	// @5460 '{' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x08, 0xB3, 0x00, 0x00, //   +#:    
+	0x00, 0x1D, 0x00, 0x00, 0x00, //  .%      
+	0x00, 0x2C, 0x00, 0x00, 0x00, //  .#      
+	0x00, 0x3B, 0x00, 0x00, 0x00, //  :#      
+	0x05, 0xB6, 0x00, 0x00, 0x00, // -#=      
+	0x03, 0x98, 0x00, 0x00, 0x00, // :++      
+	0x00, 0x2C, 0x00, 0x00, 0x00, //  .#      
+	0x00, 0x2C, 0x00, 0x00, 0x00, //  .#      
+	0x00, 0x1D, 0x20, 0x00, 0x00, //  .%.     
+	0x00, 0x06, 0xA3, 0x00, 0x00, //   =*:    
+
+	// @5520 '|' (3 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x09, 0x20, 0x00, 0x00, 0x00, // +.       
+	0x0A, 0x20, 0x00, 0x00, 0x00, // *.       
+	0x0A, 0x20, 0x00, 0x00, 0x00, // *.       
+	0x0A, 0x20, 0x00, 0x00, 0x00, // *.       
+	0x0A, 0x20, 0x00, 0x00, 0x00, // *.       
+	0x0A, 0x20, 0x00, 0x00, 0x00, // *.       
+	0x0A, 0x20, 0x00, 0x00, 0x00, // *.       
+	0x0A, 0x20, 0x00, 0x00, 0x00, // *.       
+	0x0A, 0x20, 0x00, 0x00, 0x00, // *.       
+	0x0A, 0x20, 0x00, 0x00, 0x00, // *.       
+
+	// @5580 '}' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x07, 0xB3, 0x00, 0x00, 0x00, // =#:      
+	0x00, 0x5A, 0x00, 0x00, 0x00, //  -*      
+	0x00, 0x3A, 0x00, 0x00, 0x00, //  :*      
+	0x00, 0x3B, 0x00, 0x00, 0x00, //  :#      
+	0x00, 0x1C, 0x82, 0x00, 0x00, //  .#+.    
+	0x00, 0x1D, 0x51, 0x00, 0x00, //  .%-.    
+	0x00, 0x3B, 0x00, 0x00, 0x00, //  :#      
+	0x00, 0x3A, 0x00, 0x00, 0x00, //  :*      
+	0x01, 0x69, 0x00, 0x00, 0x00, // .=+      
+	0x07, 0x92, 0x00, 0x00, 0x00, // =+.      
+
+	// @5640 '~' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x07, 0xDD, 0x95, 0x77, 0x00, // =%%+-==  
+	0x04, 0x00, 0x47, 0x50, 0x00, // :  :=-   
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+	0x00, 0x00, 0x00, 0x00, 0x00, //          
+};
+
+static const uint8_t FontSans12_Advance[] = 
+{
+	3, 4, 5, 9, 7, 10, 8, 3, 4, 4, 5, 9, 3, 4, 3, 3,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 3, 3, 9, 9, 9, 5,
+	10, 7, 7, 7, 8, 7, 6, 8, 8, 3, 3, 7, 6, 9, 8, 8,
+	6, 8, 7, 7, 6, 8, 7, 10, 7, 6, 7, 4, 3, 4, 9, 5,
+	5, 6, 7, 6, 7, 6, 4, 7, 7, 3, 3, 6, 3, 10, 7, 6,
+	7, 7, 4, 5, 4, 7, 6, 8, 6, 6, 5, 7, 3, 7, 9,
+};
+
+// Sorted by pair, for a binary search
+static const sFONT_KERN FontSans12_Kerning[] = 
+{
+	{0x2D4A, 1}, // '-J'
+	{0x2D54, -1}, // '-T'
+	{0x2D56, -1}, // '-V'
+	{0x2D58, -1}, // '-X'
+	{0x2D59, -1}, // '-Y'
+	{0x4154, -1}, // 'AT'
+	{0x4156, -1}, // 'AV'
+	{0x4157, -1}, // 'AW'
+	{0x4159, -1}, // 'AY'
+	{0x4176, -1}, // 'Av'
+	{0x4179, -1}, // 'Ay'
+	{0x4259, -1}, // 'BY'
+	{0x4459, -1}, // 'DY'
+	{0x462E, -2}, // 'F.'
+	{0x463A, -1}, // 'F:'
+	{0x4641, -1}, // 'FA'
+	{0x4661, -1}, // 'Fa'
+	{0x4665, -1}, // 'Fe'
+	{0x4669, -1}, // 'Fi'
+	{0x4672, -1}, // 'Fr'
+	{0x4675, -1}, // 'Fu'
+	{0x4679, -1}, // 'Fy'
+	{0x4759, -1}, // 'GY'
+	{0x4B2D, -1}, // 'K-'
+	{0x4B43, -1}, // 'KC'
+	{0x4B4F, -1}, // 'KO'
+	{0x4B54, -1}, // 'KT'
+	{0x4B65, -1}, // 'Ke'
+	{0x4B6F, -1}, // 'Ko'
+	{0x4B75, -1}, // 'Ku'
+	{0x4B79, -1}, // 'Ky'
+	{0x4C54, -1}, // 'LT'
+	{0x4C55, -1}, // 'LU'
+	{0x4C56, -1}, // 'LV'
+	{0x4C57, -1}, // 'LW'
+	{0x4C59, -1}, // 'LY'
+	{0x4C79, -1}, // 'Ly'
+	{0x4F58, -1}, // 'OX'
+	{0x4F59, -1}, // 'OY'
+	{0x502E, -2}, // 'P.'
+	{0x5041, -1}, // 'PA'
+	{0x5243, -1}, // 'RC'
+	{0x5254, -1}, // 'RT'
+	{0x5256, -1}, // 'RV'
+	{0x5259, -1}, // 'RY'
+	{0x5279, -1}, // 'Ry'
+	{0x542D, -1}, // 'T-'
+	{0x542E, -1}, // 'T.'
+	{0x543A, -1}, // 'T:'
+	{0x5441, -1}, // 'TA'
+	{0x5443, -1}, // 'TC'
+	{0x5461, -2}, // 'Ta'
+	{0x5463, -2}, // 'Tc'
+	{0x5465, -2}, // 'Te'
+	{0x546F, -2}, // 'To'
+	{0x5472, -2}, // 'Tr'
+	{0x5473, -2}, // 'Ts'
+	{0x5475, -2}, // 'Tu'
+	{0x5477, -2}, // 'Tw'
+	{0x5479, -2}, // 'Ty'
+	{0x562D, -1}, // 'V-'
+	{0x562E, -1}, // 'V.'
+	{0x563A, -1}, // 'V:'
+	{0x5641, -1}, // 'VA'
+	{0x5661, -1}, // 'Va'
+	{0x5665, -1}, // 'Ve'
+	{0x566F, -1}, // 'Vo'
+	{0x5675, -1}, // 'Vu'
+	{0x572E, -1}, // 'W.'
+	{0x573A, -1}, // 'W:'
+	{0x5741, -1}, // 'WA'
+	{0x5761, -1}, // 'Wa'
+	{0x5765, -1}, // 'We'
+	{0x576F, -1}, // 'Wo'
+	{0x582D, -1}, // 'X-'
+	{0x5843, -1}, // 'XC'
+	{0x584F, -1}, // 'XO'
+	{0x592D, -1}, // 'Y-'
+	{0x592E, -2}, // 'Y.'
+	{0x593A, -1}, // 'Y:'
+	{0x5941, -1}, // 'YA'
+	{0x5943, -1}, // 'YC'
+	{0x594F, -1}, // 'YO'
+	{0x5961, -1}, // 'Ya'
+	{0x5965, -1}, // 'Ye'
+	{0x596F, -1}, // 'Yo'
+	{0x5975, -1}, // 'Yu'
+	{0x662D, -1}, // 'f-'
+	{0x662E, -1}, // 'f.'
+	{0x722D, -1}, // 'r-'
+	{0x722E, -1}, // 'r.'
+	{0x762E, -1}, // 'v.'
+	{0x763A, -1}, // 'v:'
+	{0x772E, -1}, // 'w.'
+	{0x773A, -1}, // 'w:'
+	{0x792E, -1}, // 'y.'
+	{0x793A, -1}, // 'y:'
+};
+
+sFONT_AA FontSans12 = {
+  FontSans12_Table,
+  10, /* Width */
+  12, /* Height */
+  FontSans12_Advance, /* Advance */
+  FontSans12_Kerning, /* Kerning */
+  97, /* KerningCount */
+};
@@ -0,0 +1,1857 @@
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.h"
+
+// 
+//  Font data for DejaVuSans.ttf, 16 pixels high, anti-aliased
+//  Generated by tools/fontgen.py: 4 bits of coverage per pixel, two pixels
+//  per byte with the left one in the high nibble
+// 
+
+const uint8_t FontSans16_Table[] = 
+{
+	// @0 ' ' (4 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @112 '!' (6 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, //  %=          
+	0x00, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, //  %=          
+	0x00, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, //  %=          
+	0x00, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, //  %=          
+	0x00, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, //  %=          
+	0x00, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, //  %=          
+	0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, //  +:          
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, //  *:          
+	0x00, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, //  %=          
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @224 '"' (6 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x0A, 0x72, 0xF0, 0x00, 0x00, 0x00, 0x00, // *=.@         
+	0x0A, 0x72, 0xF0, 0x00, 0x00, 0x00, 0x00, // *=.@         
+	0x0A, 0x72, 0xF0, 0x00, 0x00, 0x00, 0x00, // *=.@         
+	0x07, 0x51, 0xA0, 0x00, 0x00, 0x00, 0x00, // =-.*         
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @336 '#' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x2C, 0x02, 0xC0, 0x00, 0x00, //    .# .#     
+	0x00, 0x00, 0x6A, 0x05, 0xB0, 0x00, 0x00, //    =* -#     
+	0x00, 0x11, 0xA7, 0x19, 0x81, 0x00, 0x00, //  ..*=.++.    
+	0x02, 0xEE, 0xFE, 0xEF, 0xEE, 0x70, 0x00, // .%%@%%@%%=   
+	0x00, 0x02, 0xE0, 0x2E, 0x00, 0x00, 0x00, //   .% .%      
+	0x00, 0x06, 0xA0, 0x5B, 0x00, 0x00, 0x00, //   =* -#      
+	0x0B, 0xCE, 0xEC, 0xEE, 0xC8, 0x00, 0x00, // ##%%#%%#+    
+	0x04, 0x4E, 0x54, 0xE6, 0x43, 0x00, 0x00, // ::%-:%=::    
+	0x00, 0x2E, 0x02, 0xE0, 0x00, 0x00, 0x00, //  .% .%       
+	0x00, 0x6A, 0x05, 0xB0, 0x00, 0x00, 0x00, //  =* -#       
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @448 '$' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, //    :         
+	0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, //    *         
+	0x00, 0x8C, 0xEC, 0x90, 0x00, 0x00, 0x00, //  +#%#+       
+	0x09, 0xC3, 0xA3, 0x70, 0x00, 0x00, 0x00, // +#:*:=       
+	0x0C, 0x60, 0xA0, 0x00, 0x00, 0x00, 0x00, // #= *         
+	0x0A, 0xD5, 0xA0, 0x00, 0x00, 0x00, 0x00, // *%-*         
+	0x01, 0x8D, 0xFD, 0x70, 0x00, 0x00, 0x00, // .+%@%=       
+	0x00, 0x00, 0xB6, 0xE6, 0x00, 0x00, 0x00, //    #=%=      
+	0x00, 0x00, 0xA0, 0xA9, 0x00, 0x00, 0x00, //    * *+      
+	0x08, 0x31, 0xA4, 0xE5, 0x00, 0x00, 0x00, // +:.*:%-      
+	0x07, 0xCE, 0xFD, 0x70, 0x00, 0x00, 0x00, // =#%@%=       
+	0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, //    *         
+	0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, //    *         
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @560 '%' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x22, 0x00, 0x00, 0x03, 0x00, 0x00, //  ..     :    
+	0x08, 0xDC, 0xA0, 0x00, 0x4C, 0x00, 0x00, // +%#*   :#    
+	0x1E, 0x10, 0xD4, 0x00, 0xD3, 0x00, 0x00, //.%. %:  %:    
+	0x3D, 0x00, 0xB6, 0x08, 0x90, 0x00, 0x00, //:%  #= ++     
+	0x2E, 0x10, 0xD4, 0x2D, 0x10, 0x00, 0x00, //.%. %:.%.     
+	0x09, 0xCB, 0xB0, 0xB5, 0x03, 0x30, 0x00, // +### #- ::   
+	0x00, 0x33, 0x05, 0xB0, 0xAC, 0xCA, 0x00, //  :: -# *##*  
+	0x00, 0x00, 0x1D, 0x33, 0xE0, 0x0E, 0x30, //    .%::%  %: 
+	0x00, 0x00, 0x88, 0x05, 0xC0, 0x0C, 0x40, //    ++ -#  #: 
+	0x00, 0x02, 0xD1, 0x03, 0xE0, 0x1E, 0x20, //   .%. :% .%. 
+	0x00, 0x0B, 0x50, 0x00, 0x9C, 0xD9, 0x00, //   #-   +#%+  
+	0x00, 0x03, 0x00, 0x00, 0x02, 0x20, 0x00, //   :     ..   
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @672 '&' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, //    :.        
+	0x00, 0x4E, 0xEE, 0xD0, 0x00, 0x00, 0x00, //  :%%%%       
+	0x00, 0xD9, 0x00, 0x40, 0x00, 0x00, 0x00, //  %+  :       
+	0x00, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, //  %-          
+	0x00, 0x9D, 0x10, 0x00, 0x00, 0x00, 0x00, //  +%.         
+	0x02, 0xDD, 0xC1, 0x00, 0x34, 0x00, 0x00, // .%%#.  ::    
+	0x0C, 0x91, 0xBC, 0x10, 0x8A, 0x00, 0x00, // #+.##. +*    
+	0x1F, 0x30, 0x1C, 0xC1, 0xD5, 0x00, 0x00, //.@: .##.%-    
+	0x1F, 0x40, 0x01, 0xCE, 0xC0, 0x00, 0x00, //.@:  .#%#     
+	0x0B, 0xD2, 0x01, 0x8F, 0xC1, 0x00, 0x00, // #%. .+@#.    
+	0x01, 0xAF, 0xEF, 0xB4, 0xCB, 0x10, 0x00, // .*@%@#:##.   
+	0x00, 0x01, 0x31, 0x00, 0x00, 0x00, 0x00, //   .:.        
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @784 ''' (4 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x0A, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, // *=           
+	0x0A, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, // *=           
+	0x0A, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, // *=           
+	0x07, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, // =-           
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @896 '(' (5 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x06, 0x10, 0x00, 0x00, 0x00, 0x00, //   =.         
+	0x00, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, //  -#          
+	0x00, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, //  %-          
+	0x04, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // :%           
+	0x08, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // +#           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0C, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, // #=           
+	0x0C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x09, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, // +*           
+	0x06, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, // =%           
+	0x01, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, // .%:          
+	0x00, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, //  ++          
+	0x00, 0x1B, 0x10, 0x00, 0x00, 0x00, 0x00, //  .#.         
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @1008 ')' (5 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, // -.           
+	0x06, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // =#           
+	0x00, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, //  %:          
+	0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, //  ++          
+	0x00, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, //  -%          
+	0x00, 0x3F, 0x10, 0x00, 0x00, 0x00, 0x00, //  :@.         
+	0x00, 0x2F, 0x30, 0x00, 0x00, 0x00, 0x00, //  .@:         
+	0x00, 0x2F, 0x20, 0x00, 0x00, 0x00, 0x00, //  .@.         
+	0x00, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, //  :@          
+	0x00, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00, //  +#          
+	0x00, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, //  #=          
+	0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, // :%           
+	0x08, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, // +-           
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @1120 '*' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, //   .          
+	0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, //   #          
+	0x59, 0x1B, 0x2A, 0x40, 0x00, 0x00, 0x00, //-+.#.*:       
+	0x03, 0xAE, 0xA2, 0x00, 0x00, 0x00, 0x00, // :*%*.        
+	0x05, 0xBE, 0xB4, 0x00, 0x00, 0x00, 0x00, // -#%#:        
+	0x57, 0x0B, 0x18, 0x30, 0x00, 0x00, 0x00, //-= #.+:       
+	0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, //   #          
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, //   .          
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @1232 '+' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x08, 0x30, 0x00, 0x00, 0x00, //     +:       
+	0x00, 0x00, 0x0C, 0x50, 0x00, 0x00, 0x00, //     #-       
+	0x00, 0x00, 0x0C, 0x50, 0x00, 0x00, 0x00, //     #-       
+	0x00, 0x00, 0x0C, 0x50, 0x00, 0x00, 0x00, //     #-       
+	0x07, 0xDD, 0xDF, 0xED, 0xDD, 0x10, 0x00, // =%%%@%%%%.   
+	0x02, 0x44, 0x4D, 0x74, 0x44, 0x00, 0x00, // .:::%=:::    
+	0x00, 0x00, 0x0C, 0x50, 0x00, 0x00, 0x00, //     #-       
+	0x00, 0x00, 0x0C, 0x50, 0x00, 0x00, 0x00, //     #-       
+	0x00, 0x00, 0x0C, 0x50, 0x00, 0x00, 0x00, //     #-       
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @1344 ',' (4 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x04, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, // :*           
+	0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // =%           
+	0x0A, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, // *=           
+	0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, // +.           
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @1456 '-' (5 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x25, 0x55, 0x10, 0x00, 0x00, 0x00, 0x00, //.---.         
+	0x4C, 0xCC, 0x40, 0x00, 0x00, 0x00, 0x00, //:###:         
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @1568 '.' (4 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x05, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, // -+           
+	0x08, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, // +%           
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @1680 '/' (5 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x0A, 0x70, 0x00, 0x00, 0x00, 0x00, //   *=         
+	0x00, 0x0E, 0x20, 0x00, 0x00, 0x00, 0x00, //   %.         
+	0x00, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, //  :%          
+	0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, //  ++          
+	0x00, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, //  %:          
+	0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // :%           
+	0x08, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, // ++           
+	0x0D, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, // %-           
+	0x2E, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, //.%.           
+	0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //=*            
+	0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //#=            
+	0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //:.            
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @1792 '0' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x01, 0x31, 0x00, 0x00, 0x00, 0x00, //   .:.        
+	0x00, 0x9F, 0xEE, 0x60, 0x00, 0x00, 0x00, //  +@%%=       
+	0x06, 0xE3, 0x06, 0xF2, 0x00, 0x00, 0x00, // =%: =@.      
+	0x0C, 0x90, 0x00, 0xC8, 0x00, 0x00, 0x00, // #+   #+      
+	0x0F, 0x50, 0x00, 0x9B, 0x00, 0x00, 0x00, // @-   +#      
+	0x1F, 0x40, 0x00, 0x8C, 0x00, 0x00, 0x00, //.@:   +#      
+	0x1F, 0x40, 0x00, 0x8C, 0x00, 0x00, 0x00, //.@:   +#      
+	0x0F, 0x50, 0x00, 0x9B, 0x00, 0x00, 0x00, // @-   +#      
+	0x0C, 0x90, 0x00, 0xC8, 0x00, 0x00, 0x00, // #+   #+      
+	0x06, 0xE3, 0x06, 0xF2, 0x00, 0x00, 0x00, // =%: =@.      
+	0x00, 0x9F, 0xEE, 0x50, 0x00, 0x00, 0x00, //  +@%%-       
+	0x00, 0x01, 0x31, 0x00, 0x00, 0x00, 0x00, //   .:.        
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @1904 '1' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x04, 0xBE, 0xF4, 0x00, 0x00, 0x00, 0x00, // :#%@:        
+	0x05, 0x75, 0xF4, 0x00, 0x00, 0x00, 0x00, // -=-@:        
+	0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, //   .@:        
+	0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, //   .@:        
+	0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, //   .@:        
+	0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, //   .@:        
+	0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, //   .@:        
+	0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, //   .@:        
+	0x01, 0x23, 0xF5, 0x21, 0x00, 0x00, 0x00, // ..:@-..      
+	0x04, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, // :@@@@@=      
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @2016 '2' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x03, 0x20, 0x00, 0x00, 0x00, 0x00, //   :.         
+	0x0A, 0xFF, 0xFE, 0x50, 0x00, 0x00, 0x00, // *@@@%-       
+	0x08, 0x30, 0x19, 0xF1, 0x00, 0x00, 0x00, // +: .+@.      
+	0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, //     .@:      
+	0x00, 0x00, 0x03, 0xF3, 0x00, 0x00, 0x00, //     :@:      
+	0x00, 0x00, 0x0C, 0xA0, 0x00, 0x00, 0x00, //     #*       
+	0x00, 0x00, 0xAC, 0x10, 0x00, 0x00, 0x00, //    *#.       
+	0x00, 0x0A, 0xD1, 0x00, 0x00, 0x00, 0x00, //   *%.        
+	0x00, 0xAD, 0x20, 0x00, 0x00, 0x00, 0x00, //  *%.         
+	0x0A, 0xE4, 0x22, 0x21, 0x00, 0x00, 0x00, // *%:....      
+	0x0F, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, // @@@@@@=      
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @2128 '3' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x13, 0x31, 0x00, 0x00, 0x00, 0x00, //  .::.        
+	0x08, 0xFE, 0xFE, 0x70, 0x00, 0x00, 0x00, // +@%@%=       
+	0x03, 0x20, 0x06, 0xF3, 0x00, 0x00, 0x00, // :.  =@:      
+	0x00, 0x00, 0x00, 0xF6, 0x00, 0x00, 0x00, //      @=      
+	0x00, 0x00, 0x06, 0xE2, 0x00, 0x00, 0x00, //     =%.      
+	0x00, 0x3E, 0xEE, 0x40, 0x00, 0x00, 0x00, //  :%%%:       
+	0x00, 0x13, 0x49, 0xE2, 0x00, 0x00, 0x00, //  .::+%.      
+	0x00, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x00, //      #+      
+	0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, //      #+      
+	0x06, 0x10, 0x16, 0xF5, 0x00, 0x00, 0x00, // =. .=@-      
+	0x0C, 0xFE, 0xFE, 0x70, 0x00, 0x00, 0x00, // #@%@%=       
+	0x00, 0x13, 0x20, 0x00, 0x00, 0x00, 0x00, //  .:.         
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @2240 '4' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, //    +@+       
+	0x00, 0x03, 0xDD, 0x80, 0x00, 0x00, 0x00, //   :%%+       
+	0x00, 0x0C, 0x5C, 0x80, 0x00, 0x00, 0x00, //   #-#+       
+	0x00, 0x7A, 0x0C, 0x80, 0x00, 0x00, 0x00, //  =* #+       
+	0x02, 0xE2, 0x0C, 0x80, 0x00, 0x00, 0x00, // .%. #+       
+	0x0C, 0x60, 0x0C, 0x80, 0x00, 0x00, 0x00, // #=  #+       
+	0x4E, 0x88, 0x8E, 0xC7, 0x00, 0x00, 0x00, //:%+++%#=      
+	0x39, 0x99, 0x9E, 0xC9, 0x00, 0x00, 0x00, //:++++%#+      
+	0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, 0x00, //     #+       
+	0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, 0x00, //     #+       
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @2352 '5' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x08, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, // +@@@@#       
+	0x08, 0xB2, 0x22, 0x20, 0x00, 0x00, 0x00, // +#....       
+	0x08, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // +#           
+	0x08, 0xD9, 0x95, 0x00, 0x00, 0x00, 0x00, // +%++-        
+	0x07, 0xA8, 0xAE, 0xB0, 0x00, 0x00, 0x00, // =*+*%#       
+	0x00, 0x00, 0x03, 0xF5, 0x00, 0x00, 0x00, //     :@-      
+	0x00, 0x00, 0x00, 0xD8, 0x00, 0x00, 0x00, //      %+      
+	0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, //      %=      
+	0x05, 0x10, 0x19, 0xF2, 0x00, 0x00, 0x00, // -. .+@.      
+	0x0D, 0xFE, 0xFD, 0x50, 0x00, 0x00, 0x00, // %@%@%-       
+	0x00, 0x13, 0x20, 0x00, 0x00, 0x00, 0x00, //  .:.         
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @2464 '6' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x23, 0x10, 0x00, 0x00, 0x00, //    .:.       
+	0x00, 0x4D, 0xFE, 0xF3, 0x00, 0x00, 0x00, //  :%@%@:      
+	0x02, 0xE8, 0x10, 0x21, 0x00, 0x00, 0x00, // .%+. ..      
+	0x09, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // +#           
+	0x0E, 0x76, 0x98, 0x20, 0x00, 0x00, 0x00, // %==++.       
+	0x0F, 0xDB, 0x7B, 0xE3, 0x00, 0x00, 0x00, // @%#=#%:      
+	0x0F, 0xD0, 0x00, 0xCA, 0x00, 0x00, 0x00, // @%   #*      
+	0x0E, 0x90, 0x00, 0x8D, 0x00, 0x00, 0x00, // %+   +%      
+	0x0B, 0xA0, 0x00, 0x9C, 0x00, 0x00, 0x00, // #*   +#      
+	0x05, 0xE3, 0x03, 0xE7, 0x00, 0x00, 0x00, // -%: :%=      
+	0x00, 0x7F, 0xEF, 0x90, 0x00, 0x00, 0x00, //  =@%@+       
+	0x00, 0x01, 0x31, 0x00, 0x00, 0x00, 0x00, //   .:.        
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @2576 '7' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x0D, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, // %@@@@@+      
+	0x02, 0x22, 0x25, 0xF3, 0x00, 0x00, 0x00, // ....-@:      
+	0x00, 0x00, 0x09, 0xC0, 0x00, 0x00, 0x00, //     +#       
+	0x00, 0x00, 0x1E, 0x70, 0x00, 0x00, 0x00, //    .%=       
+	0x00, 0x00, 0x5F, 0x10, 0x00, 0x00, 0x00, //    -@.       
+	0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, //    #*        
+	0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, //   .@:        
+	0x00, 0x08, 0xD0, 0x00, 0x00, 0x00, 0x00, //   +%         
+	0x00, 0x0D, 0x80, 0x00, 0x00, 0x00, 0x00, //   %+         
+	0x00, 0x4F, 0x20, 0x00, 0x00, 0x00, 0x00, //  :@.         
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @2688 '8' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x02, 0x31, 0x00, 0x00, 0x00, 0x00, //   .:.        
+	0x02, 0xCF, 0xDF, 0x90, 0x00, 0x00, 0x00, // .#@%@+       
+	0x0A, 0xD1, 0x03, 0xF6, 0x00, 0x00, 0x00, // *%. :@=      
+	0x0C, 0x80, 0x00, 0xC8, 0x00, 0x00, 0x00, // #+   #+      
+	0x08, 0xC1, 0x03, 0xE4, 0x00, 0x00, 0x00, // +#. :%:      
+	0x00, 0x9E, 0xDE, 0x60, 0x00, 0x00, 0x00, //  +%%%=       
+	0x06, 0xE6, 0x48, 0xE3, 0x00, 0x00, 0x00, // =%=:+%:      
+	0x0E, 0x60, 0x00, 0xAA, 0x00, 0x00, 0x00, // %=   **      
+	0x1F, 0x50, 0x00, 0x9C, 0x00, 0x00, 0x00, //.@-   +#      
+	0x0C, 0xB1, 0x03, 0xE8, 0x00, 0x00, 0x00, // ##. :%+      
+	0x02, 0xCF, 0xEF, 0xA1, 0x00, 0x00, 0x00, // .#@%@*.      
+	0x00, 0x02, 0x31, 0x00, 0x00, 0x00, 0x00, //   .:.        
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @2800 '9' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x02, 0x30, 0x00, 0x00, 0x00, 0x00, //   .:         
+	0x02, 0xCF, 0xEE, 0x50, 0x00, 0x00, 0x00, // .#@%%-       
+	0x0B, 0xC1, 0x06, 0xE2, 0x00, 0x00, 0x00, // ##. =%.      
+	0x1F, 0x50, 0x00, 0xE7, 0x00, 0x00, 0x00, //.@-   %=      
+	0x2F, 0x40, 0x00, 0xDA, 0x00, 0x00, 0x00, //.@:   %*      
+	0x0E, 0x80, 0x02, 0xFB, 0x00, 0x00, 0x00, // %+  .@#      
+	0x06, 0xF9, 0x8D, 0xDB, 0x00, 0x00, 0x00, // =@++%%#      
+	0x00, 0x38, 0x83, 0xBA, 0x00, 0x00, 0x00, //  :++:#*      
+	0x00, 0x00, 0x01, 0xE5, 0x00, 0x00, 0x00, //     .%-      
+	0x03, 0x10, 0x2B, 0xC0, 0x00, 0x00, 0x00, // :. .##       
+	0x06, 0xFE, 0xFB, 0x20, 0x00, 0x00, 0x00, // =@%@#.       
+	0x00, 0x13, 0x10, 0x00, 0x00, 0x00, 0x00, //  .:.         
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @2912 ':' (5 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, // ..           
+	0x06, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, // =@           
+	0x04, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, // :+           
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x04, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, // :*           
+	0x06, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, // =@           
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @3024 ';' (5 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, // ..           
+	0x06, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, // =@           
+	0x04, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, // :+           
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x04, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, // :*           
+	0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, // =%           
+	0x0A, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, // *=           
+	0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, // +.           
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @3136 '<' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x01, 0x6C, 0x10, 0x00, //       .=#.   
+	0x00, 0x00, 0x05, 0xAF, 0xC7, 0x00, 0x00, //     -*@#=    
+	0x00, 0x49, 0xED, 0x82, 0x00, 0x00, 0x00, //  :+%%+.      
+	0x08, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, // +@#:         
+	0x03, 0x9E, 0xC7, 0x20, 0x00, 0x00, 0x00, // :+%#=.       
+	0x00, 0x01, 0x5B, 0xFB, 0x61, 0x00, 0x00, //   .-#@#=.    
+	0x00, 0x00, 0x00, 0x17, 0xCF, 0x10, 0x00, //      .=#@.   
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, //         .    
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @3248 '=' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x02, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, // .::::::::    
+	0x07, 0xDD, 0xDD, 0xDD, 0xDD, 0x10, 0x00, // =%%%%%%%%.   
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x04, 0x88, 0x88, 0x88, 0x88, 0x00, 0x00, // :++++++++    
+	0x05, 0x99, 0x99, 0x99, 0x99, 0x10, 0x00, // -++++++++.   
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @3360 '>' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x07, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, // =+:          
+	0x03, 0x9E, 0xD8, 0x20, 0x00, 0x00, 0x00, // :+%%+.       
+	0x00, 0x00, 0x5A, 0xFC, 0x61, 0x00, 0x00, //    -*@#=.    
+	0x00, 0x00, 0x00, 0x16, 0xEF, 0x10, 0x00, //      .=%@.   
+	0x00, 0x00, 0x04, 0xAE, 0xC7, 0x00, 0x00, //     :*%#=    
+	0x00, 0x39, 0xED, 0x83, 0x00, 0x00, 0x00, //  :+%%+:      
+	0x08, 0xE9, 0x40, 0x00, 0x00, 0x00, 0x00, // +%+:         
+	0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, // ..           
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @3472 '?' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x13, 0x10, 0x00, 0x00, 0x00, 0x00, //  .:.         
+	0x0B, 0xFE, 0xF9, 0x00, 0x00, 0x00, 0x00, // #@%@+        
+	0x08, 0x10, 0x5F, 0x30, 0x00, 0x00, 0x00, // +. -@:       
+	0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, //    .@:       
+	0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x00, //    *#        
+	0x00, 0x0A, 0xC1, 0x00, 0x00, 0x00, 0x00, //   *#.        
+	0x00, 0x3F, 0x20, 0x00, 0x00, 0x00, 0x00, //  :@.         
+	0x00, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, //  -%          
+	0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, //  .:          
+	0x00, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, //  :*          
+	0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, //  =@          
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @3584 '@' (14 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x27, 0xAA, 0x83, 0x00, 0x00, //    .=**+:    
+	0x00, 0x09, 0xD8, 0x55, 0x7D, 0x90, 0x00, //   +%+--=%+   
+	0x00, 0xA9, 0x10, 0x00, 0x00, 0x9A, 0x00, //  *+.     +*  
+	0x06, 0xB0, 0x05, 0x97, 0x35, 0x0C, 0x50, // =#  -+=:- #- 
+	0x0C, 0x30, 0x6D, 0x67, 0xDB, 0x05, 0xA0, // #: =%==%# -* 
+	0x0E, 0x00, 0xD4, 0x00, 0x8B, 0x03, 0xC0, // %  %:  +# :# 
+	0x1D, 0x00, 0xE2, 0x00, 0x5B, 0x04, 0xA0, //.%  %.  -# :* 
+	0x0E, 0x00, 0xC6, 0x00, 0x9B, 0x0B, 0x50, // %  #=  +# #- 
+	0x0B, 0x50, 0x4E, 0x9A, 0xCD, 0xC8, 0x00, // #- :%+*#%#+  
+	0x04, 0xD1, 0x02, 0x64, 0x26, 0x20, 0x00, // :%. .=:.=.   
+	0x00, 0x7C, 0x30, 0x00, 0x04, 0x50, 0x00, //  =#:    :-   
+	0x00, 0x05, 0xDC, 0x99, 0xCC, 0x40, 0x00, //   -%#++##:   
+	0x00, 0x00, 0x03, 0x55, 0x30, 0x00, 0x00, //     :--:     
+
+	// @3696 'A' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x00, //   :@*        
+	0x00, 0x0A, 0xCF, 0x10, 0x00, 0x00, 0x00, //   *#@.       
+	0x00, 0x1E, 0x4D, 0x60, 0x00, 0x00, 0x00, //  .%:%=       
+	0x00, 0x6D, 0x07, 0xC0, 0x00, 0x00, 0x00, //  =% =#       
+	0x00, 0xC8, 0x02, 0xF3, 0x00, 0x00, 0x00, //  #+ .@:      
+	0x03, 0xF2, 0x00, 0xB9, 0x00, 0x00, 0x00, // :@.  #+      
+	0x08, 0xFA, 0xAA, 0xDE, 0x00, 0x00, 0x00, // +@***%%      
+	0x0E, 0x97, 0x77, 0x7E, 0x50, 0x00, 0x00, // %+====%-     
+	0x5F, 0x10, 0x00, 0x0A, 0xB0, 0x00, 0x00, //-@.    *#     
+	0xBB, 0x00, 0x00, 0x04, 0xF2, 0x00, 0x00, //##     :@.    
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @3808 'B' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x0A, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x00, // *@@@@#.      
+	0x0A, 0xB2, 0x23, 0xCD, 0x00, 0x00, 0x00, // *#..:#%      
+	0x0A, 0xB0, 0x00, 0x6F, 0x00, 0x00, 0x00, // *#   =@      
+	0x0A, 0xB0, 0x00, 0xAC, 0x00, 0x00, 0x00, // *#   *#      
+	0x0A, 0xED, 0xDF, 0xD2, 0x00, 0x00, 0x00, // *%%%@%.      
+	0x0A, 0xB3, 0x34, 0xBC, 0x10, 0x00, 0x00, // *#:::##.     
+	0x0A, 0xB0, 0x00, 0x1F, 0x50, 0x00, 0x00, // *#   .@-     
+	0x0A, 0xB0, 0x00, 0x1F, 0x60, 0x00, 0x00, // *#   .@=     
+	0x0A, 0xB2, 0x23, 0xAF, 0x20, 0x00, 0x00, // *#..:*@.     
+	0x0A, 0xFF, 0xFF, 0xC4, 0x00, 0x00, 0x00, // *@@@@#:      
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @3920 'C' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x13, 0x20, 0x00, 0x00, 0x00, //    .:.       
+	0x00, 0x3C, 0xFE, 0xFE, 0x60, 0x00, 0x00, //  :#@%@%=     
+	0x03, 0xE9, 0x20, 0x04, 0xA0, 0x00, 0x00, // :%+.  :*     
+	0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // ##           
+	0x1F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, //.@=           
+	0x3F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, //:@:           
+	0x3F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, //:@:           
+	0x1F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, //.@=           
+	0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // ##           
+	0x03, 0xEA, 0x20, 0x04, 0xB0, 0x00, 0x00, // :%*.  :#     
+	0x00, 0x3C, 0xFE, 0xFD, 0x60, 0x00, 0x00, //  :#@%@%=     
+	0x00, 0x00, 0x13, 0x20, 0x00, 0x00, 0x00, //    .:.       
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @4032 'D' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x0A, 0xFF, 0xFE, 0xB6, 0x00, 0x00, 0x00, // *@@@%#=      
+	0x0A, 0xB2, 0x23, 0x7E, 0xA0, 0x00, 0x00, // *#..:=%*     
+	0x0A, 0xB0, 0x00, 0x04, 0xF5, 0x00, 0x00, // *#    :@-    
+	0x0A, 0xB0, 0x00, 0x00, 0xD9, 0x00, 0x00, // *#     %+    
+	0x0A, 0xB0, 0x00, 0x00, 0xAB, 0x00, 0x00, // *#     *#    
+	0x0A, 0xB0, 0x00, 0x00, 0xAB, 0x00, 0x00, // *#     *#    
+	0x0A, 0xB0, 0x00, 0x00, 0xD9, 0x00, 0x00, // *#     %+    
+	0x0A, 0xB0, 0x00, 0x04, 0xF5, 0x00, 0x00, // *#    :@-    
+	0x0A, 0xB2, 0x23, 0x8E, 0xA0, 0x00, 0x00, // *#..:+%*     
+	0x0A, 0xFF, 0xFE, 0xB5, 0x00, 0x00, 0x00, // *@@@%#-      
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @4144 'E' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x0A, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, // *@@@@@*      
+	0x0A, 0xB2, 0x22, 0x21, 0x00, 0x00, 0x00, // *#.....      
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xFE, 0xEE, 0xE7, 0x00, 0x00, 0x00, // *@%%%%=      
+	0x0A, 0xC4, 0x44, 0x42, 0x00, 0x00, 0x00, // *#::::.      
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB2, 0x22, 0x22, 0x00, 0x00, 0x00, // *#.....      
+	0x0A, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, // *@@@@@#      
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @4256 'F' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x0A, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, // *@@@@@.      
+	0x0A, 0xB2, 0x22, 0x20, 0x00, 0x00, 0x00, // *#....       
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xFE, 0xEE, 0xA0, 0x00, 0x00, 0x00, // *@%%%*       
+	0x0A, 0xB3, 0x33, 0x20, 0x00, 0x00, 0x00, // *#:::.       
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @4368 'G' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x13, 0x20, 0x00, 0x00, 0x00, //    .:.       
+	0x00, 0x3C, 0xFE, 0xEE, 0xA1, 0x00, 0x00, //  :#@%%%*.    
+	0x03, 0xE9, 0x20, 0x03, 0xA4, 0x00, 0x00, // :%+.  :*:    
+	0x0B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // ##           
+	0x1F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, //.@=           
+	0x3F, 0x30, 0x00, 0x44, 0x42, 0x00, 0x00, //:@:   :::.    
+	0x3F, 0x30, 0x00, 0xDD, 0xF8, 0x00, 0x00, //:@:   %%@+    
+	0x1F, 0x60, 0x00, 0x00, 0xC8, 0x00, 0x00, //.@=     #+    
+	0x0B, 0xB0, 0x00, 0x00, 0xC8, 0x00, 0x00, // ##     #+    
+	0x03, 0xEA, 0x20, 0x02, 0xD8, 0x00, 0x00, // :%*.  .%+    
+	0x00, 0x3B, 0xFE, 0xEE, 0x92, 0x00, 0x00, //  :#@%%%+.    
+	0x00, 0x00, 0x13, 0x20, 0x00, 0x00, 0x00, //    .:.       
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @4480 'H' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x0A, 0xB0, 0x00, 0x06, 0xF0, 0x00, 0x00, // *#    =@     
+	0x0A, 0xB0, 0x00, 0x06, 0xF0, 0x00, 0x00, // *#    =@     
+	0x0A, 0xB0, 0x00, 0x06, 0xF0, 0x00, 0x00, // *#    =@     
+	0x0A, 0xB0, 0x00, 0x06, 0xF0, 0x00, 0x00, // *#    =@     
+	0x0A, 0xFE, 0xEE, 0xEE, 0xF0, 0x00, 0x00, // *@%%%%%@     
+	0x0A, 0xC4, 0x44, 0x48, 0xF0, 0x00, 0x00, // *#::::+@     
+	0x0A, 0xB0, 0x00, 0x06, 0xF0, 0x00, 0x00, // *#    =@     
+	0x0A, 0xB0, 0x00, 0x06, 0xF0, 0x00, 0x00, // *#    =@     
+	0x0A, 0xB0, 0x00, 0x06, 0xF0, 0x00, 0x00, // *#    =@     
+	0x0A, 0xB0, 0x00, 0x06, 0xF0, 0x00, 0x00, // *#    =@     
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @4592 'I' (4 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @4704 'J' (4 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, // **           
+	0x0C, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x9F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, //+@:           
+	0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //*-            
+
+	// @4816 'K' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x0A, 0xB0, 0x00, 0x5F, 0x60, 0x00, 0x00, // *#   -@=     
+	0x0A, 0xB0, 0x06, 0xF5, 0x00, 0x00, 0x00, // *#  =@-      
+	0x0A, 0xB0, 0x7E, 0x40, 0x00, 0x00, 0x00, // *# =%:       
+	0x0A, 0xB8, 0xE4, 0x00, 0x00, 0x00, 0x00, // *#+%:        
+	0x0A, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, // *@@:         
+	0x0A, 0xCD, 0xC1, 0x00, 0x00, 0x00, 0x00, // *#%#.        
+	0x0A, 0xB2, 0xDB, 0x10, 0x00, 0x00, 0x00, // *#.%#.       
+	0x0A, 0xB0, 0x2D, 0xB1, 0x00, 0x00, 0x00, // *# .%#.      
+	0x0A, 0xB0, 0x02, 0xDB, 0x10, 0x00, 0x00, // *#  .%#.     
+	0x0A, 0xB0, 0x00, 0x2D, 0xB1, 0x00, 0x00, // *#   .%#.    
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @4928 'L' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB2, 0x22, 0x21, 0x00, 0x00, 0x00, // *#.....      
+	0x0A, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, // *@@@@@+      
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @5040 'M' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x0A, 0xF8, 0x00, 0x00, 0xAF, 0x80, 0x00, // *@+    *@+   
+	0x0A, 0xDE, 0x00, 0x01, 0xFD, 0x80, 0x00, // *%%   .@%+   
+	0x0A, 0xAD, 0x50, 0x07, 0xBC, 0x80, 0x00, // **%-  =##+   
+	0x0A, 0xA7, 0xA0, 0x0C, 0x5C, 0x80, 0x00, // **=*  #-#+   
+	0x0A, 0xA2, 0xF1, 0x3E, 0x0C, 0x80, 0x00, // **.@.:% #+   
+	0x0A, 0xA0, 0xB7, 0x99, 0x0C, 0x80, 0x00, // ** #=++ #+   
+	0x0A, 0xA0, 0x5C, 0xE3, 0x0C, 0x80, 0x00, // ** -#%: #+   
+	0x0A, 0xA0, 0x0E, 0xC0, 0x0C, 0x80, 0x00, // **  %#  #+   
+	0x0A, 0xA0, 0x01, 0x10, 0x0C, 0x80, 0x00, // **  ..  #+   
+	0x0A, 0xA0, 0x00, 0x00, 0x0C, 0x80, 0x00, // **      #+   
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @5152 'N' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x0A, 0xF7, 0x00, 0x06, 0xE0, 0x00, 0x00, // *@=   =%     
+	0x0A, 0xEE, 0x10, 0x06, 0xE0, 0x00, 0x00, // *%%.  =%     
+	0x0A, 0xAD, 0x80, 0x06, 0xE0, 0x00, 0x00, // **%+  =%     
+	0x0A, 0xA5, 0xE1, 0x06, 0xE0, 0x00, 0x00, // **-%. =%     
+	0x0A, 0xA0, 0xC9, 0x06, 0xE0, 0x00, 0x00, // ** #+ =%     
+	0x0A, 0xA0, 0x4F, 0x26, 0xE0, 0x00, 0x00, // ** :@.=%     
+	0x0A, 0xA0, 0x0B, 0x96, 0xE0, 0x00, 0x00, // **  #+=%     
+	0x0A, 0xA0, 0x03, 0xF8, 0xE0, 0x00, 0x00, // **  :@+%     
+	0x0A, 0xA0, 0x00, 0xAE, 0xE0, 0x00, 0x00, // **   *%%     
+	0x0A, 0xA0, 0x00, 0x3F, 0xE0, 0x00, 0x00, // **   :@%     
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @5264 'O' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x23, 0x10, 0x00, 0x00, 0x00, //    .:.       
+	0x00, 0x4C, 0xFE, 0xFB, 0x20, 0x00, 0x00, //  :#@%@#.     
+	0x03, 0xF9, 0x10, 0x2B, 0xE1, 0x00, 0x00, // :@+. .#%.    
+	0x0B, 0xB0, 0x00, 0x01, 0xD9, 0x00, 0x00, // ##    .%+    
+	0x1F, 0x60, 0x00, 0x00, 0x8D, 0x00, 0x00, //.@=     +%    
+	0x3F, 0x30, 0x00, 0x00, 0x6F, 0x00, 0x00, //:@:     =@    
+	0x3F, 0x30, 0x00, 0x00, 0x6F, 0x00, 0x00, //:@:     =@    
+	0x1F, 0x60, 0x00, 0x00, 0x8D, 0x00, 0x00, //.@=     +%    
+	0x0B, 0xB0, 0x00, 0x01, 0xD9, 0x00, 0x00, // ##    .%+    
+	0x03, 0xF9, 0x10, 0x2B, 0xE1, 0x00, 0x00, // :@+. .#%.    
+	0x00, 0x4C, 0xFE, 0xFB, 0x20, 0x00, 0x00, //  :#@%@#.     
+	0x00, 0x00, 0x23, 0x10, 0x00, 0x00, 0x00, //    .:.       
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @5376 'P' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x0A, 0xFF, 0xFE, 0x80, 0x00, 0x00, 0x00, // *@@@%+       
+	0x0A, 0xB2, 0x26, 0xF7, 0x00, 0x00, 0x00, // *#..=@=      
+	0x0A, 0xB0, 0x00, 0xAC, 0x00, 0x00, 0x00, // *#   *#      
+	0x0A, 0xB0, 0x00, 0xAC, 0x00, 0x00, 0x00, // *#   *#      
+	0x0A, 0xB2, 0x26, 0xF7, 0x00, 0x00, 0x00, // *#..=@=      
+	0x0A, 0xFF, 0xFD, 0x80, 0x00, 0x00, 0x00, // *@@@%+       
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // *#           
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @5488 'Q' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x23, 0x10, 0x00, 0x00, 0x00, //    .:.       
+	0x00, 0x4C, 0xFE, 0xFB, 0x20, 0x00, 0x00, //  :#@%@#.     
+	0x03, 0xF9, 0x10, 0x2B, 0xE1, 0x00, 0x00, // :@+. .#%.    
+	0x0B, 0xB0, 0x00, 0x01, 0xD9, 0x00, 0x00, // ##    .%+    
+	0x1F, 0x60, 0x00, 0x00, 0x8D, 0x00, 0x00, //.@=     +%    
+	0x3F, 0x30, 0x00, 0x00, 0x6F, 0x00, 0x00, //:@:     =@    
+	0x3F, 0x30, 0x00, 0x00, 0x6F, 0x00, 0x00, //:@:     =@    
+	0x1F, 0x60, 0x00, 0x00, 0x8D, 0x00, 0x00, //.@=     +%    
+	0x0B, 0xB0, 0x00, 0x01, 0xD9, 0x00, 0x00, // ##    .%+    
+	0x03, 0xF9, 0x10, 0x2B, 0xD1, 0x00, 0x00, // :@+. .#%.    
+	0x00, 0x3C, 0xFE, 0xFC, 0x20, 0x00, 0x00, //  :#@%@#.     
+	0x00, 0x00, 0x23, 0xAD, 0x10, 0x00, 0x00, //    .:*%.     
+	0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, //      .*+     
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @5600 'R' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x0A, 0xFF, 0xFE, 0x91, 0x00, 0x00, 0x00, // *@@@%+.      
+	0x0A, 0xB2, 0x25, 0xE8, 0x00, 0x00, 0x00, // *#..-%+      
+	0x0A, 0xB0, 0x00, 0xAC, 0x00, 0x00, 0x00, // *#   *#      
+	0x0A, 0xB0, 0x00, 0xBB, 0x00, 0x00, 0x00, // *#   ##      
+	0x0A, 0xC6, 0x69, 0xF4, 0x00, 0x00, 0x00, // *#==+@:      
+	0x0A, 0xEB, 0xCF, 0x90, 0x00, 0x00, 0x00, // *%##@+       
+	0x0A, 0xB0, 0x03, 0xF5, 0x00, 0x00, 0x00, // *#  :@-      
+	0x0A, 0xB0, 0x00, 0x8D, 0x00, 0x00, 0x00, // *#   +%      
+	0x0A, 0xB0, 0x00, 0x1E, 0x60, 0x00, 0x00, // *#   .%=     
+	0x0A, 0xB0, 0x00, 0x08, 0xD0, 0x00, 0x00, // *#    +%     
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @5712 'S' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x02, 0x32, 0x00, 0x00, 0x00, 0x00, //   .:.        
+	0x03, 0xCF, 0xEF, 0xE4, 0x00, 0x00, 0x00, // :#@%@%:      
+	0x0D, 0xB1, 0x00, 0x43, 0x00, 0x00, 0x00, // %#.  ::      
+	0x1F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, //.@-           
+	0x0E, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, // %*.          
+	0x05, 0xEF, 0xD9, 0x30, 0x00, 0x00, 0x00, // -%@%+:       
+	0x00, 0x15, 0x8D, 0xF6, 0x00, 0x00, 0x00, //  .-+%@=      
+	0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, //      #%      
+	0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, //      =%      
+	0x18, 0x30, 0x03, 0xDA, 0x00, 0x00, 0x00, //.+:  :%*      
+	0x0B, 0xFE, 0xEF, 0xB1, 0x00, 0x00, 0x00, // #@%%@#.      
+	0x00, 0x02, 0x31, 0x00, 0x00, 0x00, 0x00, //   .:.        
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @5824 'T' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, //@@@@@@@@=     
+	0x22, 0x28, 0xD2, 0x22, 0x10, 0x00, 0x00, //...+%....     
+	0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, //   =%         
+	0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, //   =%         
+	0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, //   =%         
+	0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, //   =%         
+	0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, //   =%         
+	0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, //   =%         
+	0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, //   =%         
+	0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, //   =%         
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @5936 'U' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x0C, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x00, // #+    =%     
+	0x0C, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x00, // #+    =%     
+	0x0C, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x00, // #+    =%     
+	0x0C, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x00, // #+    =%     
+	0x0C, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x00, // #+    =%     
+	0x0C, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x00, // #+    =%     
+	0x0C, 0x90, 0x00, 0x08, 0xD0, 0x00, 0x00, // #+    +%     
+	0x0A, 0xB0, 0x00, 0x0A, 0xB0, 0x00, 0x00, // *#    *#     
+	0x05, 0xF5, 0x00, 0x5F, 0x60, 0x00, 0x00, // -@-  -@=     
+	0x00, 0x7E, 0xEE, 0xE7, 0x00, 0x00, 0x00, //  =%%%%=      
+	0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, //    .:        
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @6048 'V' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0xAB, 0x00, 0x00, 0x05, 0xF2, 0x00, 0x00, //*#     -@.    
+	0x5F, 0x20, 0x00, 0x0A, 0xB0, 0x00, 0x00, //-@.    *#     
+	0x0E, 0x70, 0x00, 0x1F, 0x50, 0x00, 0x00, // %=   .@-     
+	0x08, 0xD0, 0x00, 0x7E, 0x00, 0x00, 0x00, // +%   =%      
+	0x03, 0xF3, 0x00, 0xC8, 0x00, 0x00, 0x00, // :@:  #+      
+	0x00, 0xC9, 0x03, 0xF3, 0x00, 0x00, 0x00, //  #+ :@:      
+	0x00, 0x6E, 0x19, 0xC0, 0x00, 0x00, 0x00, //  =%.+#       
+	0x00, 0x1E, 0x6E, 0x60, 0x00, 0x00, 0x00, //  .%=%=       
+	0x00, 0x0A, 0xEF, 0x10, 0x00, 0x00, 0x00, //   *%@.       
+	0x00, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x00, //   :@*        
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @6160 'W' (14 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x6E, 0x00, 0x01, 0xFA, 0x00, 0x05, 0xF1, //=%   .@*   -@.
+	0x2F, 0x30, 0x05, 0xDE, 0x00, 0x09, 0xB0, //.@:  -%%   +# 
+	0x0E, 0x70, 0x09, 0x8E, 0x30, 0x0D, 0x80, // %=  ++%:  %+ 
+	0x0A, 0xB0, 0x0D, 0x4A, 0x60, 0x2F, 0x40, // *#  %:*= .@: 
+	0x06, 0xE0, 0x1F, 0x16, 0xA0, 0x5F, 0x10, // =% .@.=* -@. 
+	0x02, 0xF3, 0x5C, 0x03, 0xE0, 0x9B, 0x00, // .@:-# :% +#  
+	0x00, 0xE7, 0x98, 0x00, 0xE3, 0xD8, 0x00, //  %=++  %:%+  
+	0x00, 0xAA, 0xC4, 0x00, 0xA8, 0xF4, 0x00, //  **#:  *+@:  
+	0x00, 0x6E, 0xF1, 0x00, 0x7E, 0xF0, 0x00, //  =%@.  =%@   
+	0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xB0, 0x00, //  .@#   :@#   
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @6272 'X' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x0C, 0xA0, 0x00, 0x2E, 0x60, 0x00, 0x00, // #*   .%=     
+	0x02, 0xE5, 0x00, 0xBB, 0x00, 0x00, 0x00, // .%-  ##      
+	0x00, 0x7E, 0x16, 0xE2, 0x00, 0x00, 0x00, //  =%.=%.      
+	0x00, 0x0C, 0xBE, 0x60, 0x00, 0x00, 0x00, //   ##%=       
+	0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, //   :@#        
+	0x00, 0x09, 0xEE, 0x10, 0x00, 0x00, 0x00, //   +%%.       
+	0x00, 0x4F, 0x3C, 0xA0, 0x00, 0x00, 0x00, //  :@:#*       
+	0x01, 0xD8, 0x02, 0xF5, 0x00, 0x00, 0x00, // .%+ .@-      
+	0x09, 0xD0, 0x00, 0x7E, 0x10, 0x00, 0x00, // +%   =%.     
+	0x4F, 0x30, 0x00, 0x0C, 0xA0, 0x00, 0x00, //:@:    #*     
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @6384 'Y' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0xAC, 0x00, 0x00, 0x6E, 0x20, 0x00, 0x00, //*#    =%.     
+	0x1E, 0x70, 0x02, 0xE6, 0x00, 0x00, 0x00, //.%=  .%=      
+	0x05, 0xF2, 0x0B, 0xB0, 0x00, 0x00, 0x00, // -@. ##       
+	0x00, 0xAC, 0x6E, 0x20, 0x00, 0x00, 0x00, //  *#=%.       
+	0x00, 0x1E, 0xF6, 0x00, 0x00, 0x00, 0x00, //  .%@=        
+	0x00, 0x08, 0xD0, 0x00, 0x00, 0x00, 0x00, //   +%         
+	0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, //   =%         
+	0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, //   =%         
+	0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, //   =%         
+	0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, //   =%         
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @6496 'Z' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x3F, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, //:@@@@@@@*     
+	0x02, 0x22, 0x22, 0x7F, 0x40, 0x00, 0x00, // .....=@:     
+	0x00, 0x00, 0x03, 0xE7, 0x00, 0x00, 0x00, //     :%=      
+	0x00, 0x00, 0x1D, 0xA0, 0x00, 0x00, 0x00, //    .%*       
+	0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, //    ##        
+	0x00, 0x09, 0xE2, 0x00, 0x00, 0x00, 0x00, //   +%.        
+	0x00, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x00, //  =@:         
+	0x03, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, // :@=          
+	0x2E, 0xA2, 0x22, 0x22, 0x10, 0x00, 0x00, //.%*......     
+	0x6F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, //=@@@@@@@#     
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @6608 '[' (5 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x05, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, // -==          
+	0x0C, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, // ##+          
+	0x0C, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, // #=           
+	0x0C, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, // #=           
+	0x0C, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, // #=           
+	0x0C, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, // #=           
+	0x0C, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, // #=           
+	0x0C, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, // #=           
+	0x0C, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, // #=           
+	0x0C, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, // #=           
+	0x0C, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, // #=           
+	0x0C, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, // #=.          
+	0x0A, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, // *##          
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @6720 '\' (5 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //%-            
+	0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //++            
+	0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //:%            
+	0x0E, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, // %:           
+	0x09, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // ++           
+	0x04, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, // :%           
+	0x00, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, //  %.          
+	0x00, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, //  *=          
+	0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, //  =#          
+	0x00, 0x1F, 0x10, 0x00, 0x00, 0x00, 0x00, //  .@.         
+	0x00, 0x0B, 0x60, 0x00, 0x00, 0x00, 0x00, //   #=         
+	0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, //   ..         
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @6832 ']' (5 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x04, 0x77, 0x10, 0x00, 0x00, 0x00, 0x00, // :==.         
+	0x05, 0x8F, 0x30, 0x00, 0x00, 0x00, 0x00, // -+@:         
+	0x00, 0x1F, 0x30, 0x00, 0x00, 0x00, 0x00, //  .@:         
+	0x00, 0x1F, 0x30, 0x00, 0x00, 0x00, 0x00, //  .@:         
+	0x00, 0x1F, 0x30, 0x00, 0x00, 0x00, 0x00, //  .@:         
+	0x00, 0x1F, 0x30, 0x00, 0x00, 0x00, 0x00, //  .@:         
+	0x00, 0x1F, 0x30, 0x00, 0x00, 0x00, 0x00, //  .@:         
+	0x00, 0x1F, 0x30, 0x00, 0x00, 0x00, 0x00, //  .@:         
+	0x00, 0x1F, 0x30, 0x00, 0x00, 0x00, 0x00, //  .@:         
+	0x00, 0x1F, 0x30, 0x00, 0x00, 0x00, 0x00, //  .@:         
+	0x00, 0x1F, 0x30, 0x00, 0x00, 0x00, 0x00, //  .@:         
+	0x01, 0x3F, 0x30, 0x00, 0x00, 0x00, 0x00, // .:@:         
+	0x08, 0xCC, 0x20, 0x00, 0x00, 0x00, 0x00, // +##.         
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @6944 '^' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x6F, 0xD1, 0x00, 0x00, 0x00, //    =@%.      
+	0x00, 0x06, 0xE5, 0xBC, 0x10, 0x00, 0x00, //   =%-##.     
+	0x00, 0x5E, 0x30, 0x09, 0xC1, 0x00, 0x00, //  -%:  +#.    
+	0x02, 0xA2, 0x00, 0x00, 0x77, 0x00, 0x00, // .*.    ==    
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @7056 '_' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, //*******       
+
+	// @7168 '`' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x06, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, // =#           
+	0x00, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, //  ++          
+	0x00, 0x07, 0x10, 0x00, 0x00, 0x00, 0x00, //   =.         
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @7280 'a' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x03, 0x8A, 0xA6, 0x00, 0x00, 0x00, 0x00, // :+**=        
+	0x08, 0x86, 0x7D, 0x90, 0x00, 0x00, 0x00, // ++==%+       
+	0x00, 0x00, 0x03, 0xF1, 0x00, 0x00, 0x00, //     :@.      
+	0x01, 0x7B, 0xBB, 0xF2, 0x00, 0x00, 0x00, // .=###@.      
+	0x0C, 0xB5, 0x45, 0xF3, 0x00, 0x00, 0x00, // ##-:-@:      
+	0x2F, 0x20, 0x03, 0xF3, 0x00, 0x00, 0x00, //.@.  :@:      
+	0x1F, 0x50, 0x1B, 0xF3, 0x00, 0x00, 0x00, //.@- .#@:      
+	0x07, 0xFD, 0xE7, 0xF3, 0x00, 0x00, 0x00, // =@%%=@:      
+	0x00, 0x13, 0x10, 0x00, 0x00, 0x00, 0x00, //  .:.         
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @7392 'b' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, // -:           
+	0x0B, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, // #=           
+	0x0B, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, // #=           
+	0x0B, 0x75, 0xA9, 0x30, 0x00, 0x00, 0x00, // #=-*+:       
+	0x0B, 0xDB, 0x69, 0xF3, 0x00, 0x00, 0x00, // #%#=+@:      
+	0x0B, 0xD0, 0x00, 0xAA, 0x00, 0x00, 0x00, // #%   **      
+	0x0B, 0x80, 0x00, 0x6E, 0x00, 0x00, 0x00, // #+   =%      
+	0x0B, 0x80, 0x00, 0x5E, 0x00, 0x00, 0x00, // #+   -%      
+	0x0B, 0xA0, 0x00, 0x7D, 0x00, 0x00, 0x00, // #*   =%      
+	0x0B, 0xF4, 0x02, 0xD7, 0x00, 0x00, 0x00, // #@: .%=      
+	0x0B, 0x9C, 0xDF, 0xA0, 0x00, 0x00, 0x00, // #+#%@*       
+	0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, //    ..        
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @7504 'c' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x39, 0xA9, 0x40, 0x00, 0x00, 0x00, //  :+*+:       
+	0x05, 0xF9, 0x67, 0x80, 0x00, 0x00, 0x00, // -@+==+       
+	0x0E, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, // %=           
+	0x3F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, //:@.           
+	0x3F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, //:@.           
+	0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, //.@:           
+	0x0A, 0xC2, 0x00, 0x30, 0x00, 0x00, 0x00, // *#.  :       
+	0x01, 0xAF, 0xDE, 0x90, 0x00, 0x00, 0x00, // .*@%%+       
+	0x00, 0x01, 0x31, 0x00, 0x00, 0x00, 0x00, //   .:.        
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @7616 'd' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, //      -:      
+	0x00, 0x00, 0x00, 0xB7, 0x00, 0x00, 0x00, //      #=      
+	0x00, 0x00, 0x00, 0xB7, 0x00, 0x00, 0x00, //      #=      
+	0x00, 0x5A, 0x93, 0xB7, 0x00, 0x00, 0x00, //  -*+:#=      
+	0x07, 0xE7, 0x6C, 0xD7, 0x00, 0x00, 0x00, // =%==#%=      
+	0x0E, 0x60, 0x02, 0xF7, 0x00, 0x00, 0x00, // %=  .@=      
+	0x3F, 0x10, 0x00, 0xC7, 0x00, 0x00, 0x00, //:@.   #=      
+	0x3F, 0x10, 0x00, 0xC7, 0x00, 0x00, 0x00, //:@.   #=      
+	0x2F, 0x30, 0x00, 0xE7, 0x00, 0x00, 0x00, //.@:   %=      
+	0x0B, 0xB1, 0x07, 0xF7, 0x00, 0x00, 0x00, // ##. =@=      
+	0x02, 0xCE, 0xEA, 0xC7, 0x00, 0x00, 0x00, // .#%%*#=      
+	0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, //   ..         
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @7728 'e' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x39, 0xA8, 0x20, 0x00, 0x00, 0x00, //  :+*+.       
+	0x05, 0xE8, 0x6A, 0xD1, 0x00, 0x00, 0x00, // -%+=*%.      
+	0x0E, 0x60, 0x00, 0xB8, 0x00, 0x00, 0x00, // %=   #+      
+	0x3F, 0x87, 0x77, 0xBA, 0x00, 0x00, 0x00, //:@+===#*      
+	0x3F, 0x98, 0x88, 0x86, 0x00, 0x00, 0x00, //:@+++++=      
+	0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, //.@:           
+	0x0A, 0xC2, 0x00, 0x23, 0x00, 0x00, 0x00, // *#.  .:      
+	0x01, 0xAF, 0xDE, 0xE5, 0x00, 0x00, 0x00, // .*@%%%-      
+	0x00, 0x01, 0x32, 0x00, 0x00, 0x00, 0x00, //   .:.        
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @7840 'f' (5 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x26, 0x71, 0x00, 0x00, 0x00, 0x00, //  .==.        
+	0x03, 0xFA, 0x81, 0x00, 0x00, 0x00, 0x00, // :@*+.        
+	0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, // =#           
+	0x5B, 0xD8, 0x60, 0x00, 0x00, 0x00, 0x00, //-#%+=         
+	0x4B, 0xD7, 0x50, 0x00, 0x00, 0x00, 0x00, //:#%=-         
+	0x08, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // +#           
+	0x08, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // +#           
+	0x08, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // +#           
+	0x08, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // +#           
+	0x08, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // +#           
+	0x08, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, // +#           
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @7952 'g' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x5A, 0x93, 0x64, 0x00, 0x00, 0x00, //  -*+:=:      
+	0x07, 0xE7, 0x6C, 0xD7, 0x00, 0x00, 0x00, // =%==#%=      
+	0x1E, 0x50, 0x02, 0xF7, 0x00, 0x00, 0x00, //.%-  .@=      
+	0x3F, 0x10, 0x00, 0xC7, 0x00, 0x00, 0x00, //:@.   #=      
+	0x3F, 0x10, 0x00, 0xC7, 0x00, 0x00, 0x00, //:@.   #=      
+	0x1F, 0x40, 0x00, 0xE7, 0x00, 0x00, 0x00, //.@:   %=      
+	0x0A, 0xC2, 0x29, 0xE7, 0x00, 0x00, 0x00, // *#..+%=      
+	0x01, 0xAE, 0xE7, 0xC7, 0x00, 0x00, 0x00, // .*%%=#=      
+	0x00, 0x00, 0x01, 0xE5, 0x00, 0x00, 0x00, //     .%-      
+	0x03, 0x63, 0x4B, 0xD1, 0x00, 0x00, 0x00, // :=::#%.      
+	0x03, 0xAD, 0xC9, 0x20, 0x00, 0x00, 0x00, // :*%#+.       
+
+	// @8064 'h' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, // -:           
+	0x0B, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, // #=           
+	0x0B, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, // #=           
+	0x0B, 0x74, 0xA9, 0x30, 0x00, 0x00, 0x00, // #=:*+:       
+	0x0B, 0xCB, 0x6A, 0xF2, 0x00, 0x00, 0x00, // ###=*@.      
+	0x0B, 0xC0, 0x00, 0xD7, 0x00, 0x00, 0x00, // ##   %=      
+	0x0B, 0x80, 0x00, 0xB8, 0x00, 0x00, 0x00, // #+   #+      
+	0x0B, 0x70, 0x00, 0xA8, 0x00, 0x00, 0x00, // #=   *+      
+	0x0B, 0x70, 0x00, 0xA8, 0x00, 0x00, 0x00, // #=   *+      
+	0x0B, 0x70, 0x00, 0xA8, 0x00, 0x00, 0x00, // #=   *+      
+	0x0B, 0x70, 0x00, 0xA8, 0x00, 0x00, 0x00, // #=   *+      
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @8176 'i' (4 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, // -:           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, // ..           
+	0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, // -:           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @8288 'j' (4 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, // -:           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, // ..           
+	0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, // -:           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x4E, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, //:%-           
+	0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //%+            
+
+	// @8400 'k' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, // -:           
+	0x0B, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, // #=           
+	0x0B, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, // #=           
+	0x0B, 0x70, 0x01, 0x73, 0x00, 0x00, 0x00, // #=  .=:      
+	0x0B, 0x70, 0x2D, 0x90, 0x00, 0x00, 0x00, // #= .%+       
+	0x0B, 0x73, 0xE7, 0x00, 0x00, 0x00, 0x00, // #=:%=        
+	0x0B, 0xBE, 0x50, 0x00, 0x00, 0x00, 0x00, // ##%-         
+	0x0B, 0xCE, 0x50, 0x00, 0x00, 0x00, 0x00, // ##%-         
+	0x0B, 0x75, 0xE5, 0x00, 0x00, 0x00, 0x00, // #=-%-        
+	0x0B, 0x70, 0x4E, 0x60, 0x00, 0x00, 0x00, // #= :%=       
+	0x0B, 0x70, 0x04, 0xE6, 0x00, 0x00, 0x00, // #=  :%=      
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @8512 'l' (4 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, // -:           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @8624 'm' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x06, 0x45, 0xA9, 0x20, 0x6A, 0x91, 0x00, // =:-*+. =*+.  
+	0x0B, 0xDA, 0x6B, 0xD9, 0x96, 0xCC, 0x00, // #%*=#%++=##  
+	0x0B, 0xC0, 0x01, 0xFA, 0x00, 0x2F, 0x20, // ##  .@*  .@. 
+	0x0B, 0x80, 0x00, 0xD6, 0x00, 0x0F, 0x30, // #+   %=   @: 
+	0x0B, 0x70, 0x00, 0xD5, 0x00, 0x0F, 0x30, // #=   %-   @: 
+	0x0B, 0x70, 0x00, 0xD5, 0x00, 0x0F, 0x30, // #=   %-   @: 
+	0x0B, 0x70, 0x00, 0xD5, 0x00, 0x0F, 0x30, // #=   %-   @: 
+	0x0B, 0x70, 0x00, 0xD5, 0x00, 0x0F, 0x30, // #=   %-   @: 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @8736 'n' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x06, 0x44, 0xA9, 0x30, 0x00, 0x00, 0x00, // =::*+:       
+	0x0B, 0xCB, 0x6A, 0xF2, 0x00, 0x00, 0x00, // ###=*@.      
+	0x0B, 0xC0, 0x00, 0xD7, 0x00, 0x00, 0x00, // ##   %=      
+	0x0B, 0x80, 0x00, 0xB8, 0x00, 0x00, 0x00, // #+   #+      
+	0x0B, 0x70, 0x00, 0xA8, 0x00, 0x00, 0x00, // #=   *+      
+	0x0B, 0x70, 0x00, 0xA8, 0x00, 0x00, 0x00, // #=   *+      
+	0x0B, 0x70, 0x00, 0xA8, 0x00, 0x00, 0x00, // #=   *+      
+	0x0B, 0x70, 0x00, 0xA8, 0x00, 0x00, 0x00, // #=   *+      
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @8848 'o' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x49, 0xA7, 0x10, 0x00, 0x00, 0x00, //  :+*=.       
+	0x06, 0xF8, 0x6C, 0xC0, 0x00, 0x00, 0x00, // =@+=##       
+	0x0E, 0x70, 0x01, 0xE6, 0x00, 0x00, 0x00, // %=  .%=      
+	0x3F, 0x20, 0x00, 0xB9, 0x00, 0x00, 0x00, //:@.   #+      
+	0x3F, 0x10, 0x00, 0xAA, 0x00, 0x00, 0x00, //:@.   **      
+	0x2F, 0x40, 0x00, 0xC8, 0x00, 0x00, 0x00, //.@:   #+      
+	0x0B, 0xB1, 0x06, 0xF3, 0x00, 0x00, 0x00, // ##. =@:      
+	0x02, 0xCE, 0xEE, 0x50, 0x00, 0x00, 0x00, // .#%%%-       
+	0x00, 0x02, 0x30, 0x00, 0x00, 0x00, 0x00, //   .:         
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @8960 'p' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x06, 0x45, 0xA9, 0x30, 0x00, 0x00, 0x00, // =:-*+:       
+	0x0B, 0xDB, 0x69, 0xF3, 0x00, 0x00, 0x00, // #%#=+@:      
+	0x0B, 0xD0, 0x00, 0xAA, 0x00, 0x00, 0x00, // #%   **      
+	0x0B, 0x80, 0x00, 0x6E, 0x00, 0x00, 0x00, // #+   =%      
+	0x0B, 0x80, 0x00, 0x5E, 0x00, 0x00, 0x00, // #+   -%      
+	0x0B, 0xA0, 0x00, 0x7D, 0x00, 0x00, 0x00, // #*   =%      
+	0x0B, 0xF4, 0x02, 0xD7, 0x00, 0x00, 0x00, // #@: .%=      
+	0x0B, 0x9C, 0xDF, 0xA0, 0x00, 0x00, 0x00, // #+#%@*       
+	0x0B, 0x70, 0x22, 0x00, 0x00, 0x00, 0x00, // #= ..        
+	0x0B, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, // #=           
+	0x0A, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, // *=           
+
+	// @9072 'q' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x5A, 0x93, 0x64, 0x00, 0x00, 0x00, //  -*+:=:      
+	0x07, 0xE7, 0x6C, 0xD7, 0x00, 0x00, 0x00, // =%==#%=      
+	0x0E, 0x60, 0x02, 0xF7, 0x00, 0x00, 0x00, // %=  .@=      
+	0x3F, 0x10, 0x00, 0xC7, 0x00, 0x00, 0x00, //:@.   #=      
+	0x3F, 0x10, 0x00, 0xC7, 0x00, 0x00, 0x00, //:@.   #=      
+	0x2F, 0x30, 0x00, 0xE7, 0x00, 0x00, 0x00, //.@:   %=      
+	0x0B, 0xB1, 0x07, 0xF7, 0x00, 0x00, 0x00, // ##. =@=      
+	0x02, 0xCE, 0xEA, 0xC7, 0x00, 0x00, 0x00, // .#%%*#=      
+	0x00, 0x02, 0x20, 0xB7, 0x00, 0x00, 0x00, //   .. #=      
+	0x00, 0x00, 0x00, 0xB7, 0x00, 0x00, 0x00, //      #=      
+	0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, //      *=      
+
+	// @9184 'r' (6 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x06, 0x45, 0xA7, 0x00, 0x00, 0x00, 0x00, // =:-*=        
+	0x0B, 0xDB, 0x75, 0x00, 0x00, 0x00, 0x00, // #%#=-        
+	0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, // ##           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, // #=           
+	0x0B, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, // #=           
+	0x0B, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, // #=           
+	0x0B, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, // #=           
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @9296 's' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x02, 0x8A, 0xA7, 0x00, 0x00, 0x00, 0x00, // .+**=        
+	0x1D, 0xA5, 0x6A, 0x10, 0x00, 0x00, 0x00, //.%*-=*.       
+	0x3F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, //:@.           
+	0x1D, 0xC7, 0x30, 0x00, 0x00, 0x00, 0x00, //.%#=:         
+	0x01, 0x7B, 0xFC, 0x10, 0x00, 0x00, 0x00, // .=#@#.       
+	0x00, 0x00, 0x1E, 0x60, 0x00, 0x00, 0x00, //    .%=       
+	0x23, 0x00, 0x1E, 0x60, 0x00, 0x00, 0x00, //.:  .%=       
+	0x3E, 0xED, 0xEA, 0x00, 0x00, 0x00, 0x00, //:%%%%*        
+	0x00, 0x23, 0x10, 0x00, 0x00, 0x00, 0x00, //  .:.         
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @9408 't' (5 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x07, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, // =-           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x5D, 0xB8, 0x80, 0x00, 0x00, 0x00, 0x00, //-%#++         
+	0x4D, 0xB7, 0x70, 0x00, 0x00, 0x00, 0x00, //:%#==         
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // #+           
+	0x09, 0xB1, 0x10, 0x00, 0x00, 0x00, 0x00, // +#..         
+	0x03, 0xCF, 0xF1, 0x00, 0x00, 0x00, 0x00, // :#@@.        
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @9520 'u' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x06, 0x30, 0x00, 0x63, 0x00, 0x00, 0x00, // =:   =:      
+	0x0C, 0x60, 0x00, 0xC7, 0x00, 0x00, 0x00, // #=   #=      
+	0x0C, 0x60, 0x00, 0xC7, 0x00, 0x00, 0x00, // #=   #=      
+	0x0C, 0x60, 0x00, 0xC7, 0x00, 0x00, 0x00, // #=   #=      
+	0x0C, 0x60, 0x00, 0xC7, 0x00, 0x00, 0x00, // #=   #=      
+	0x0C, 0x70, 0x00, 0xD7, 0x00, 0x00, 0x00, // #=   %=      
+	0x09, 0xC1, 0x07, 0xF7, 0x00, 0x00, 0x00, // +#. =@=      
+	0x02, 0xDE, 0xE9, 0xC7, 0x00, 0x00, 0x00, // .%%%+#=      
+	0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, //   ..         
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @9632 'v' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x46, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, //:=    --      
+	0x3F, 0x20, 0x00, 0xE5, 0x00, 0x00, 0x00, //:@.   %-      
+	0x0D, 0x70, 0x05, 0xE0, 0x00, 0x00, 0x00, // %=  -%       
+	0x07, 0xD0, 0x0B, 0x90, 0x00, 0x00, 0x00, // =%  #+       
+	0x01, 0xF3, 0x1F, 0x30, 0x00, 0x00, 0x00, // .@:.@:       
+	0x00, 0xB9, 0x7D, 0x00, 0x00, 0x00, 0x00, //  #+=%        
+	0x00, 0x5E, 0xD7, 0x00, 0x00, 0x00, 0x00, //  -%%=        
+	0x00, 0x0E, 0xF2, 0x00, 0x00, 0x00, 0x00, //   %@.        
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @9744 'w' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x37, 0x00, 0x18, 0x30, 0x05, 0x40, 0x00, //:=  .+:  -:   
+	0x2F, 0x10, 0x6F, 0x90, 0x0D, 0x60, 0x00, //.@. =@+  %=   
+	0x0D, 0x50, 0xAA, 0xD0, 0x2F, 0x20, 0x00, // %- **% .@.   
+	0x0A, 0x90, 0xD3, 0xE2, 0x5D, 0x00, 0x00, // *+ %:%.-%    
+	0x06, 0xD2, 0xE0, 0xA6, 0x99, 0x00, 0x00, // =%.% *=++    
+	0x02, 0xF8, 0xA0, 0x6A, 0xD5, 0x00, 0x00, // .@+* =*%-    
+	0x00, 0xDF, 0x60, 0x2F, 0xF1, 0x00, 0x00, //  %@= .@@.    
+	0x00, 0x9F, 0x20, 0x0D, 0xC0, 0x00, 0x00, //  +@.  %#     
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @9856 'x' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x17, 0x20, 0x01, 0x73, 0x00, 0x00, 0x00, //.=.  .=:      
+	0x09, 0xC1, 0x0A, 0xC0, 0x00, 0x00, 0x00, // +#. *#       
+	0x01, 0xC9, 0x6E, 0x20, 0x00, 0x00, 0x00, // .#+=%.       
+	0x00, 0x2E, 0xF5, 0x00, 0x00, 0x00, 0x00, //  .%@-        
+	0x00, 0x1E, 0xE2, 0x00, 0x00, 0x00, 0x00, //  .%%.        
+	0x00, 0xBB, 0x9C, 0x00, 0x00, 0x00, 0x00, //  ##+#        
+	0x07, 0xD1, 0x1D, 0x90, 0x00, 0x00, 0x00, // =%..%+       
+	0x4F, 0x40, 0x03, 0xE5, 0x00, 0x00, 0x00, //:@:  :%-      
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @9968 'y' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x46, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, //:=    --      
+	0x3F, 0x20, 0x01, 0xE5, 0x00, 0x00, 0x00, //:@.  .%-      
+	0x0B, 0x80, 0x06, 0xD0, 0x00, 0x00, 0x00, // #+  =%       
+	0x05, 0xE0, 0x0C, 0x80, 0x00, 0x00, 0x00, // -%  #+       
+	0x00, 0xE5, 0x3F, 0x20, 0x00, 0x00, 0x00, //  %-:@.       
+	0x00, 0x8B, 0x9B, 0x00, 0x00, 0x00, 0x00, //  +#+#        
+	0x00, 0x2F, 0xE5, 0x00, 0x00, 0x00, 0x00, //  .@%-        
+	0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, //   #%         
+	0x00, 0x0C, 0x80, 0x00, 0x00, 0x00, 0x00, //   #+         
+	0x03, 0x7E, 0x10, 0x00, 0x00, 0x00, 0x00, // :=%.         
+	0x0C, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, // ##-          
+
+	// @10080 'z' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x28, 0x88, 0x88, 0x50, 0x00, 0x00, 0x00, //.+++++-       
+	0x28, 0x88, 0x8F, 0x80, 0x00, 0x00, 0x00, //.++++@+       
+	0x00, 0x00, 0xAC, 0x10, 0x00, 0x00, 0x00, //    *#.       
+	0x00, 0x08, 0xD2, 0x00, 0x00, 0x00, 0x00, //   +%.        
+	0x00, 0x6E, 0x30, 0x00, 0x00, 0x00, 0x00, //  =%:         
+	0x04, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, // :%:          
+	0x2E, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, //.%=           
+	0x6F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, //=@@@@@+       
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+
+	// @10192 '{' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x15, 0x70, 0x00, 0x00, 0x00, //    .-=       
+	0x00, 0x00, 0xDB, 0x80, 0x00, 0x00, 0x00, //    %#+       
+	0x00, 0x02, 0xF2, 0x00, 0x00, 0x00, 0x00, //   .@.        
+	0x00, 0x03, 0xF1, 0x00, 0x00, 0x00, 0x00, //   :@.        
+	0x00, 0x03, 0xF1, 0x00, 0x00, 0x00, 0x00, //   :@.        
+	0x00, 0x05, 0xE0, 0x00, 0x00, 0x00, 0x00, //   -%         
+	0x02, 0xAD, 0x60, 0x00, 0x00, 0x00, 0x00, // .*%=         
+	0x02, 0x6C, 0x90, 0x00, 0x00, 0x00, 0x00, // .=#+         
+	0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x00, //   :@         
+	0x00, 0x03, 0xF1, 0x00, 0x00, 0x00, 0x00, //   :@.        
+	0x00, 0x03, 0xF1, 0x00, 0x00, 0x00, 0x00, //   :@.        
+	0x00, 0x02, 0xF2, 0x00, 0x00, 0x00, 0x00, //   .@.        
+	0x00, 0x00, 0xBE, 0xB0, 0x00, 0x00, 0x00, //    #%#       
+	0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, //     .:       
+
+	// @10304 '|' (5 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x02, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, // .=           
+	0x04, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, // :%           
+	0x04, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, // :%           
+	0x04, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, // :%           
+	0x04, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, // :%           
+	0x04, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, // :%           
+	0x04, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, // :%           
+	0x04, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, // :%           
+	0x04, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, // :%           
+	0x04, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, // :%           
+	0x04, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, // :%           
+	0x04, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, // :%           
+	0x04, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, // :%           
+	0x04, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, // :%           
+
+	// @10416 '}' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x02, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, // .=-          
+	0x02, 0x8D, 0xA0, 0x00, 0x00, 0x00, 0x00, // .+%*         
+	0x00, 0x05, 0xD0, 0x00, 0x00, 0x00, 0x00, //   -%         
+	0x00, 0x05, 0xE0, 0x00, 0x00, 0x00, 0x00, //   -%         
+	0x00, 0x04, 0xE0, 0x00, 0x00, 0x00, 0x00, //   :%         
+	0x00, 0x03, 0xF1, 0x00, 0x00, 0x00, 0x00, //   :@.        
+	0x00, 0x00, 0xAD, 0x90, 0x00, 0x00, 0x00, //    *%+       
+	0x00, 0x01, 0xCA, 0x60, 0x00, 0x00, 0x00, //   .#*=       
+	0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x00, //   :@         
+	0x00, 0x05, 0xE0, 0x00, 0x00, 0x00, 0x00, //   -%         
+	0x00, 0x05, 0xE0, 0x00, 0x00, 0x00, 0x00, //   -%         
+	0x00, 0x06, 0xD0, 0x00, 0x00, 0x00, 0x00, //   =%         
+	0x03, 0xBE, 0x80, 0x00, 0x00, 0x00, 0x00, // :#%+         
+	0x01, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, // .:.          
+
+	// @10528 '~' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x14, 0x41, 0x00, 0x02, 0x00, 0x00, //  .::.   .    
+	0x04, 0xED, 0xDE, 0xA7, 0x9E, 0x10, 0x00, // :%%%%*=+%.   
+	0x05, 0x30, 0x03, 0x8A, 0x82, 0x00, 0x00, // -:  :+*+.    
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //              
+};
+
+static const uint8_t FontSans16_Advance[] = 
+{
+	4, 6, 6, 12, 9, 13, 11, 4, 5, 5, 7, 12, 4, 5, 4, 5,
+	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 5, 5, 12, 12, 12, 7,
+	14, 9, 9, 10, 11, 9, 8, 11, 10, 4, 4, 9, 8, 12, 10, 11,
+	8, 11, 10, 9, 8, 10, 9, 14, 9, 8, 9, 5, 5, 5, 12, 7,
+	7, 8, 9, 8, 9, 8, 5, 9, 9, 4, 4, 8, 4, 13, 9, 8,
+	9, 9, 6, 7, 5, 9, 8, 11, 8, 8, 7, 9, 5, 9, 12,
+};
+
+// Sorted by pair, for a binary search
+static const sFONT_KERN FontSans16_Kerning[] = 
+{
+	{0x2D47, 1}, // '-G'
+	{0x2D4A, 1}, // '-J'
+	{0x2D51, 1}, // '-Q'
+	{0x2D54, -1}, // '-T'
+	{0x2D56, -1}, // '-V'
+	{0x2D57, -1}, // '-W'
+	{0x2D58, -1}, // '-X'
+	{0x2D59, -2}, // '-Y'
+	{0x4154, -1}, // 'AT'
+	{0x4156, -1}, // 'AV'
+	{0x4157, -1}, // 'AW'
+	{0x4159, -1}, // 'AY'
+	{0x4176, -1}, // 'Av'
+	{0x4177, -1}, // 'Aw'
+	{0x4179, -1}, // 'Ay'
+	{0x4259, -1}, // 'BY'
+	{0x4459, -1}, // 'DY'
+	{0x462E, -2}, // 'F.'
+	{0x463A, -1}, // 'F:'
+	{0x4641, -1}, // 'FA'
+	{0x4661, -1}, // 'Fa'
+	{0x4665, -1}, // 'Fe'
+	{0x4669, -1}, // 'Fi'
+	{0x4672, -1}, // 'Fr'
+	{0x4675, -1}, // 'Fu'
+	{0x4679, -1}, // 'Fy'
+	{0x4759, -1}, // 'GY'
+	{0x4B2D, -1}, // 'K-'
+	{0x4B43, -1}, // 'KC'
+	{0x4B4F, -1}, // 'KO'
+	{0x4B54, -1}, // 'KT'
+	{0x4B65, -1}, // 'Ke'
+	{0x4B6F, -1}, // 'Ko'
+	{0x4B75, -1}, // 'Ku'
+	{0x4B79, -1}, // 'Ky'
+	{0x4C54, -2}, // 'LT'
+	{0x4C55, -1}, // 'LU'
+	{0x4C56, -2}, // 'LV'
+	{0x4C57, -1}, // 'LW'
+	{0x4C59, -2}, // 'LY'
+	{0x4C79, -1}, // 'Ly'
+	{0x4F2E, -1}, // 'O.'
+	{0x4F58, -1}, // 'OX'
+	{0x4F59, -1}, // 'OY'
+	{0x502E, -2}, // 'P.'
+	{0x5041, -1}, // 'PA'
+	{0x5061, -1}, // 'Pa'
+	{0x522D, -1}, // 'R-'
+	{0x5241, -1}, // 'RA'
+	{0x5243, -1}, // 'RC'
+	{0x5254, -1}, // 'RT'
+	{0x5256, -1}, // 'RV'
+	{0x5257, -1}, // 'RW'
+	{0x5259, -1}, // 'RY'
+	{0x5265, -1}, // 'Re'
+	{0x526F, -1}, // 'Ro'
+	{0x5275, -1}, // 'Ru'
+	{0x5279, -1}, // 'Ry'
+	{0x542D, -1}, // 'T-'
+	{0x542E, -2}, // 'T.'
+	{0x543A, -2}, // 'T:'
+	{0x5441, -1}, // 'TA'
+	{0x5443, -1}, // 'TC'
+	{0x5461, -2}, // 'Ta'
+	{0x5463, -2}, // 'Tc'
+	{0x5465, -2}, // 'Te'
+	{0x546F, -2}, // 'To'
+	{0x5472, -2}, // 'Tr'
+	{0x5473, -2}, // 'Ts'
+	{0x5475, -2}, // 'Tu'
+	{0x5477, -2}, // 'Tw'
+	{0x5479, -2}, // 'Ty'
+	{0x562D, -1}, // 'V-'
+	{0x562E, -2}, // 'V.'
+	{0x563A, -1}, // 'V:'
+	{0x5641, -1}, // 'VA'
+	{0x5661, -1}, // 'Va'
+	{0x5665, -1}, // 'Ve'
+	{0x566F, -1}, // 'Vo'
+	{0x5675, -1}, // 'Vu'
+	{0x572D, -1}, // 'W-'
+	{0x572E, -2}, // 'W.'
+	{0x573A, -1}, // 'W:'
+	{0x5741, -1}, // 'WA'
+	{0x5761, -1}, // 'Wa'
+	{0x5765, -1}, // 'We'
+	{0x576F, -1}, // 'Wo'
+	{0x5772, -1}, // 'Wr'
+	{0x582D, -1}, // 'X-'
+	{0x5843, -1}, // 'XC'
+	{0x584F, -1}, // 'XO'
+	{0x5865, -1}, // 'Xe'
+	{0x592D, -2}, // 'Y-'
+	{0x592E, -3}, // 'Y.'
+	{0x593A, -2}, // 'Y:'
+	{0x5941, -1}, // 'YA'
+	{0x5943, -1}, // 'YC'
+	{0x594F, -1}, // 'YO'
+	{0x5961, -2}, // 'Ya'
+	{0x5965, -2}, // 'Ye'
+	{0x596F, -2}, // 'Yo'
+	{0x5975, -2}, // 'Yu'
+	{0x662D, -1}, // 'f-'
+	{0x662E, -1}, // 'f.'
+	{0x722D, -1}, // 'r-'
+	{0x722E, -1}, // 'r.'
+	{0x762E, -1}, // 'v.'
+	{0x763A, -1}, // 'v:'
+	{0x772E, -1}, // 'w.'
+	{0x773A, -1}, // 'w:'
+	{0x792E, -2}, // 'y.'
+	{0x793A, -1}, // 'y:'
+};
+
+sFONT_AA FontSans16 = {
+  FontSans16_Table,
+  14, /* Width */
+  16, /* Height */
+  FontSans16_Advance, /* Advance */
+  FontSans16_Kerning, /* Kerning */
+  112, /* KerningCount */
+};
@@ -0,0 +1,368 @@
+#include "I2CBus.h"
+#include <freertos/semphr.h>
+#include "src/profiler/Profiler.h"
+#include "src/logging/Log.h"
+
+static const char* const PRIORITY_NAMES[I2C_PRIORITY_COUNT] = {"high", "normal", "low"};
+static const uint32_t CLOCK_RATES[] = {1000000, 400000, 100000};   // Fm+, Fm, Sm
+static const uint8_t CLOCK_RATE_COUNT = sizeof(CLOCK_RATES) / sizeof(CLOCK_RATES[0]);
+static const uint8_t SUBMIT_RETRIES = 10;   // 1 ms each while the queue is full
+
+I2CBus::I2CBus(TwoWire& wire, const char* name) : bus(wire), busName(name) {
+    devices[MAX_DEVICES].name = "other";
+    devices[MAX_DEVICES].priority = I2C_PRIORITY_NORMAL;
+}
+
+void I2CBus::begin(UBaseType_t taskPriority) {
+    if (task) return;
+    xTaskCreatePinnedToCore(taskEntry, busName, 3072, this, taskPriority, &task, tskNO_AFFINITY);
+}
+
+bool I2CBus::addDevice(const char* name, uint8_t addr, I2CPriority priority) {
+    uint8_t existing = deviceFor(addr);
+    if (existing < MAX_DEVICES) {
+        devices[existing].name = name;
+        devices[existing].priority = priority;
+        return true;
+    }
+    if (deviceCount >= MAX_DEVICES) return false;
+    I2CDeviceStats& d = devices[deviceCount++];
+    d.name = name;
+    d.addr = addr;
+    d.priority = priority;
+    return true;
+}
+
+uint32_t I2CBus::negotiateClock(const I2CProbe* probes, uint8_t count) {
+    // A device may ACK and even return its ID above its rated clock, only to
+    // fail later under load, so never probe faster than the slowest rating
+    uint32_t cap = CLOCK_RATES[0];
+    for (uint8_t i = 0; i < count; i++) {
+        uint32_t rated = probes[i].maxHz ? probes[i].maxHz : CLOCK_RATES[CLOCK_RATE_COUNT - 1];
+        if (rated < cap) cap = rated;
+    }
+
+    for (uint8_t r = 0; r < CLOCK_RATE_COUNT; r++) {
+        uint32_t rate = CLOCK_RATES[r];
+        if (rate > cap && r + 1 < CLOCK_RATE_COUNT) continue;
+        bus.setClock(rate);
+
+        const I2CProbe* failed = nullptr;
+        I2CStatus status = I2C_OK;
+        uint8_t value = 0;
+        for (uint8_t i = 0; i < count && !failed; i++) {
+            const I2CProbe& p = probes[i];
+            for (uint8_t n = 0; n < PROBE_READS; n++) {
+                status = read(p.addr, p.reg, &value, 1);
+                if (status != I2C_OK || (value & p.mask) != (p.expected & p.mask)) {
+                    failed = &p;
+                    break;
+                }
+            }
+        }
+
+        if (!failed) {
+            clock = rate;
+            LOG_I("I2C %s: %lu kHz", busName, rate / 1000);
+            return rate;
+        }
+        clockFallbacks++;
+        LOG_W("I2C %s: %s failed at %lu kHz (status %d, id 0x%02X)",
+              busName, failed->name, rate / 1000, status, value);
+    }
+
+    // Nothing answered reliably; stay at the slowest rate
+    clock = CLOCK_RATES[CLOCK_RATE_COUNT - 1];
+    LOG_E("I2C %s: no reliable clock, using %lu kHz", busName, clock / 1000);
+    return clock;
+}
+
+const I2CDeviceStats& I2CBus::stats(uint8_t addr) const {
+    return devices[deviceFor(addr)];
+}
+
+uint8_t I2CBus::pending() const {
+    uint8_t n = 0;
+    portENTER_CRITICAL(&lock);
+    for (uint8_t i = 0; i < QUEUE_DEPTH; i++) {
+        if (slots[i].state != SLOT_FREE) n++;
+    }
+    portEXIT_CRITICAL(&lock);
+    return n;
+}
+
+uint8_t I2CBus::deviceFor(uint8_t addr) const {
+    for (uint8_t i = 0; i < deviceCount; i++) {
+        if (devices[i].addr == addr) return i;
+    }
+    return MAX_DEVICES;
+}
+
+I2CStatus I2CBus::read(uint8_t addr, uint8_t reg, uint8_t* buf, uint16_t len) {
+    Transaction t = {};
+    t.isRead = true;
+    t.hasReg = true;
+    t.addr = addr;
+    t.reg = reg;
+    t.rx = buf;
+    t.len = len;
+    return submitAndWait(t);
+}
+
+I2CStatus I2CBus::write(uint8_t addr, uint8_t reg, const uint8_t* data, uint16_t len) {
+    Transaction t = {};
+    t.hasReg = true;
+    t.addr = addr;
+    t.reg = reg;
+    t.tx = data;
+    t.len = len;
+    return submitAndWait(t);
+}
+
+I2CStatus I2CBus::writeRaw(uint8_t addr, const uint8_t* data, uint16_t len) {
+    Transaction t = {};
+    t.addr = addr;
+    t.tx = data;
+    t.len = len;
+    return submitAndWait(t);
+}
+
+bool I2CBus::readAsync(uint8_t addr, uint8_t reg, uint8_t* buf, uint16_t len,
+                       I2CCallback cb, void* ctx) {
+    Transaction t = {};
+    t.isRead = true;
+    t.hasReg = true;
+    t.addr = addr;
+    t.reg = reg;
+    t.rx = buf;
+    t.len = len;
+    t.cb = cb;
+    t.ctx = ctx;
+    t.device = deviceFor(addr);
+    t.queuedUs = micros();
+    if (!task) {
+        I2CStatus status = execute(t, reg, buf, len);
+        record(t, status, micros() - t.queuedUs, false);
+        if (cb) cb(ctx, status);
+        return true;
+    }
+    return enqueue(t);
+}
+
+I2CStatus I2CBus::submitAndWait(Transaction& t) {
+    t.device = deviceFor(t.addr);
+    t.queuedUs = micros();
+
+    // Before begin() and on the bus task itself there is nobody to hand off to
+    if (!task || xTaskGetCurrentTaskHandle() == task) {
+        I2CStatus status = execute(t, t.reg, t.rx, t.len);
+        record(t, status, micros() - t.queuedUs, false);
+        return status;
+    }
+
+    StaticSemaphore_t doneBuf;
+    SemaphoreHandle_t done = xSemaphoreCreateBinaryStatic(&doneBuf);
+    I2CStatus result = I2C_ERR_QUEUE_FULL;
+    t.done = done;
+    t.result = &result;
+
+    bool queued = enqueue(t);
+    for (uint8_t i = 0; !queued && i < SUBMIT_RETRIES; i++) {
+        vTaskDelay(1);
+        queued = enqueue(t);
+    }
+    if (queued) xSemaphoreTake(done, portMAX_DELAY);
+    vSemaphoreDelete(done);
+    return result;
+}
+
+bool I2CBus::enqueue(const Transaction& t) {
+    uint8_t queued = 0;
+    bool ok = false;
+    portENTER_CRITICAL(&lock);
+    for (uint8_t i = 0; i < QUEUE_DEPTH; i++) {
+        if (slots[i].state != SLOT_FREE) {
+            queued++;
+        } else if (!ok) {
+            slots[i] = t;
+            slots[i].state = SLOT_QUEUED;
+            slots[i].seq = nextSeq++;
+            ok = true;
+        }
+    }
+    if (ok && ++queued > maxQueued) maxQueued = queued;
+    if (!ok) queueFull++;
+    portEXIT_CRITICAL(&lock);
+
+    if (ok) xTaskNotifyGive(task);
+    return ok;
+}
+
+void I2CBus::taskEntry(void* arg) {
+    static_cast<I2CBus*>(arg)->run();
+}
+
+void I2CBus::run() {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        Transaction* t;
+        while ((t = takeNext()) != nullptr) {
+            Transaction* group[MAX_MERGE];
+            uint16_t start, end;
+            uint8_t n = collectMerge(t, group, start, end);
+
+            uint32_t busStart = micros();
+            I2CStatus status;
+            if (n == 1) {
+                status = execute(*t, t->reg, t->rx, t->len);
+            } else {
+                status = execute(*t, start, scratch, end - start);
+                for (uint8_t i = 0; status == I2C_OK && i < n; i++) {
+                    memcpy(group[i]->rx, scratch + (group[i]->reg - start), group[i]->len);
+                }
+            }
+            uint32_t busUs = micros() - busStart;
+
+            for (uint8_t i = 0; i < n; i++) {
+                complete(*group[i], status, busUs, i > 0);
+            }
+        }
+    }
+}
+
+// Highest priority first, then submission order
+I2CBus::Transaction* I2CBus::takeNext() {
+    Transaction* best = nullptr;
+    portENTER_CRITICAL(&lock);
+    for (uint8_t i = 0; i < QUEUE_DEPTH; i++) {
+        Transaction& t = slots[i];
+        if (t.state != SLOT_QUEUED) continue;
+        if (!best) { best = &t; continue; }
+        I2CPriority p = devices[t.device].priority;
+        I2CPriority bp = devices[best->device].priority;
+        if (p < bp || (p == bp && (int32_t)(t.seq - best->seq) < 0)) best = &t;
+    }
+    if (best) best->state = SLOT_ACTIVE;
+    portEXIT_CRITICAL(&lock);
+    return best;
+}
+
+// Pulls queued reads of the same device whose register ranges overlap or
+// abut the first one into a single burst. Relies on the device
+// auto-incrementing its register address, which all of ours do.
+uint8_t I2CBus::collectMerge(Transaction* first, Transaction** group, uint16_t& start, uint16_t& end) {
+    group[0] = first;
+    start = first->reg;
+    end = first->reg + first->len;
+    if (!first->isRead || !first->hasReg) return 1;
+
+    uint8_t n = 1;
+    portENTER_CRITICAL(&lock);
+    // A read queued after a write to the same device must see that write
+    bool hasBarrier = false;
+    uint32_t barrier = 0;
+    for (uint8_t i = 0; i < QUEUE_DEPTH; i++) {
+        const Transaction& t = slots[i];
+        if (t.state != SLOT_QUEUED || t.isRead || t.addr != first->addr) continue;
+        if (!hasBarrier || (int32_t)(t.seq - barrier) < 0) barrier = t.seq;
+        hasBarrier = true;
+    }
+    bool grew = true;
+    while (grew && n < MAX_MERGE) {
+        grew = false;
+        for (uint8_t i = 0; i < QUEUE_DEPTH && n < MAX_MERGE; i++) {
+            Transaction& t = slots[i];
+            if (t.state != SLOT_QUEUED || !t.isRead || !t.hasReg || t.addr != first->addr) continue;
+            if (hasBarrier && (int32_t)(t.seq - barrier) > 0) continue;
+            uint16_t tEnd = t.reg + t.len;
+            if (t.reg > end || tEnd < start) continue;
+            uint16_t s = min<uint16_t>(start, t.reg);
+            uint16_t e = max<uint16_t>(end, tEnd);
+            if (e - s > MAX_BURST) continue;
+            t.state = SLOT_ACTIVE;
+            group[n++] = &t;
+            start = s;
+            end = e;
+            grew = true;
+        }
+    }
+    portEXIT_CRITICAL(&lock);
+    return n;
+}
+
+static I2CStatus statusFor(uint8_t err) {
+    if (err == 0) return I2C_OK;
+    return err == 5 ? I2C_ERR_TIMEOUT : I2C_ERR_NACK;   // 5: I2C_ERROR_TIMEOUT
+}
+
+I2CStatus I2CBus::execute(const Transaction& t, uint8_t reg, uint8_t* rx, uint16_t len) {
+    if (t.isRead) {
+        bus.beginTransmission(t.addr);
+        bus.write(reg);
+        I2CStatus status = statusFor(bus.endTransmission(false));  // repeated start
+        if (status != I2C_OK) return status;
+        if (bus.requestFrom(t.addr, len) != len) return I2C_ERR_SHORT_READ;
+        for (uint16_t i = 0; i < len; i++) {
+            rx[i] = bus.read();
+        }
+        PROFILE_COUNT_I2C(len + 1);
+        return I2C_OK;
+    }
+
+    bus.beginTransmission(t.addr);
+    if (t.hasReg) bus.write(reg);
+    if (len) bus.write(t.tx, len);
+    PROFILE_COUNT_I2C(len + (t.hasReg ? 1 : 0));
+    return statusFor(bus.endTransmission());
+}
+
+void I2CBus::record(const Transaction& t, I2CStatus status, uint32_t busUs, bool merged) {
+    I2CDeviceStats& d = devices[t.device];
+    uint32_t totalUs = micros() - t.queuedUs;
+    d.transactions++;
+    if (merged) d.merged++;
+    else d.busUs += busUs;
+    if (status != I2C_OK) d.errors++;
+    d.bytes += t.len;
+    d.totalUs += totalUs;
+    if (totalUs > d.maxUs) d.maxUs = totalUs;
+}
+
+void I2CBus::complete(Transaction& t, I2CStatus status, uint32_t busUs, bool merged) {
+    record(t, status, busUs, merged);
+
+    I2CCallback cb = t.cb;
+    void* ctx = t.ctx;
+    SemaphoreHandle_t done = (SemaphoreHandle_t)t.done;
+    I2CStatus* result = t.result;
+
+    portENTER_CRITICAL(&lock);
+    t.state = SLOT_FREE;
+    portEXIT_CRITICAL(&lock);
+
+    if (cb) cb(ctx, status);
+    if (done) {
+        *result = status;
+        xSemaphoreGive(done);
+    }
+}
+
+void I2CBus::printStats(Print& out) const {
+    out.printf("I2C %s: %lu kHz (%u fallbacks), queue max %u/%u, %lu full\n", busName,
+               (unsigned long)(clock / 1000), clockFallbacks, maxQueued, QUEUE_DEPTH,
+               (unsigned long)queueFull);
+    out.printf("  %-8s %4s %-6s %7s %6s %5s %8s %8s %7s\n",
+               "device", "addr", "prio", "txns", "merged", "errs", "bytes", "avg_us", "max_us");
+    for (uint8_t i = 0; i <= MAX_DEVICES; i++) {
+        const I2CDeviceStats& d = devices[i];
+        if (i >= deviceCount && i != MAX_DEVICES) continue;
+        if (!d.transactions && i == MAX_DEVICES) continue;
+        out.printf("  %-8s 0x%02X %-6s %7lu %6lu %5lu %8lu %8lu %7lu\n",
+                   d.name, d.addr, PRIORITY_NAMES[d.priority],
+                   (unsigned long)d.transactions, (unsigned long)d.merged,
+                   (unsigned long)d.errors, (unsigned long)d.bytes,
+                   (unsigned long)(d.transactions ? d.totalUs / d.transactions : 0),
+                   (unsigned long)d.maxUs);
+    }
+}
@@ -0,0 +1,147 @@
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include <Arduino.h>
+#include <Wire.h>
+
+enum I2CPriority : uint8_t {
+    I2C_PRIORITY_HIGH,     // user-facing, e.g. touch reports
+    I2C_PRIORITY_NORMAL,
+    I2C_PRIORITY_LOW,      // bulk, e.g. IMU FIFO drains
+    I2C_PRIORITY_COUNT
+};
+
+enum I2CStatus : int8_t {
+    I2C_OK = 0,
+    I2C_ERR_NACK = -1,
+    I2C_ERR_TIMEOUT = -2,
+    I2C_ERR_SHORT_READ = -3,
+    I2C_ERR_QUEUE_FULL = -4
+};
+
+// A register that identifies a device, read while negotiating the clock.
+struct I2CProbe {
+    const char* name;
+    uint8_t addr;
+    uint8_t reg;
+    uint8_t expected;
+    uint8_t mask;          // 0: any value, the ACK is enough
+    uint32_t maxHz;        // rated maximum SCL; 0: standard mode only
+};
+
+// Runs on the bus task once an async transaction has finished.
+typedef void (*I2CCallback)(void* ctx, I2CStatus status);
+
+struct I2CDeviceStats {
+    const char* name;
+    uint8_t addr;
+    I2CPriority priority;
+    uint32_t transactions;
+    uint32_t merged;       // served by another transaction's burst
+    uint32_t errors;
+    uint32_t bytes;
+    uint32_t totalUs;      // queued to completed
+    uint32_t maxUs;
+    uint32_t busUs;        // time on the wire
+};
+
+// One owner task per TwoWire. Drivers queue register transactions instead
+// of driving the bus themselves, so a touch read on the UI core and an IMU
+// FIFO drain on the sensor core never interleave, and the higher-priority
+// device goes first. Queued reads of the same device whose register ranges
+// touch are merged into a single burst.
+// The blocking calls suspend only the calling task on a semaphore; the
+// async read returns at once and completes through a callback.
+class I2CBus {
+public:
+    static const uint8_t MAX_DEVICES = 6;
+    static const uint8_t QUEUE_DEPTH = 12;
+    static const uint16_t MAX_BURST = 32;     // bytes per merged read
+    static const uint8_t MAX_MERGE = 4;
+    static const uint8_t PROBE_READS = 8;     // per device and rate
+
+    I2CBus(TwoWire& wire, const char* name);
+
+    // Starts the bus task. Before that, transactions run inline.
+    void begin(UBaseType_t taskPriority = 3);
+    // Registers a device for per-device priority and statistics; traffic to
+    // unregistered addresses runs at normal priority and is counted as "other".
+    bool addDevice(const char* name, uint8_t addr, I2CPriority priority);
+
+    I2CStatus read(uint8_t addr, uint8_t reg, uint8_t* buf, uint16_t len);
+    I2CStatus write(uint8_t addr, uint8_t reg, const uint8_t* data, uint16_t len);
+    I2CStatus writeByte(uint8_t addr, uint8_t reg, uint8_t value) { return write(addr, reg, &value, 1); }
+    // Raw write without a register byte, e.g. a command sequence.
+    I2CStatus writeRaw(uint8_t addr, const uint8_t* data, uint16_t len);
+    // buf must stay valid until cb has run.
+    bool readAsync(uint8_t addr, uint8_t reg, uint8_t* buf, uint16_t len,
+                   I2CCallback cb, void* ctx);
+
+    // Starts at the fastest rate every probed device is rated for and steps
+    // down until each probe reads back its ID PROBE_READS times without a
+    // NACK or timeout, and keeps that rate.
+    // Call from setup() while nothing else is using the bus.
+    uint32_t negotiateClock(const I2CProbe* probes, uint8_t count);
+    uint32_t clockHz() const { return clock; }
+
+    // Transactions queued or on the wire. A queued async read completes on
+    // the bus task, so nothing may sleep the chip while this is non-zero.
+    uint8_t pending() const;
+    bool busy() const { return pending() != 0; }
+
+    TwoWire& wire() { return bus; }
+    const char* name() const { return busName; }
+    // Counters of a registered device, or of "other" for any other address.
+    const I2CDeviceStats& stats(uint8_t addr) const;
+    uint32_t queueFullCount() const { return queueFull; }
+    void printStats(Print& out) const;
+
+private:
+    enum SlotState : uint8_t { SLOT_FREE, SLOT_QUEUED, SLOT_ACTIVE };
+
+    struct Transaction {
+        SlotState state;
+        bool isRead;
+        bool hasReg;
+        uint8_t addr;
+        uint8_t reg;
+        uint8_t device;
+        uint16_t len;
+        uint8_t* rx;
+        const uint8_t* tx;
+        uint32_t seq;
+        uint32_t queuedUs;
+        I2CCallback cb;
+        void* ctx;
+        void* done;             // SemaphoreHandle_t of a blocking caller
+        I2CStatus* result;
+    };
+
+    TwoWire& bus;
+    const char* busName;
+    TaskHandle_t task = nullptr;
+    mutable portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    Transaction slots[QUEUE_DEPTH] = {};
+    uint32_t nextSeq = 0;
+    uint8_t scratch[MAX_BURST];
+
+    I2CDeviceStats devices[MAX_DEVICES + 1] = {};  // last entry is "other"
+    uint8_t deviceCount = 0;
+    uint32_t queueFull = 0;
+    uint8_t maxQueued = 0;
+    uint32_t clock = 0;          // 0 until negotiated
+    uint8_t clockFallbacks = 0;
+
+    static void taskEntry(void* arg);
+    void run();
+    uint8_t deviceFor(uint8_t addr) const;
+    I2CStatus submitAndWait(Transaction& t);
+    bool enqueue(const Transaction& t);
+    Transaction* takeNext();
+    uint8_t collectMerge(Transaction* first, Transaction** group, uint16_t& start, uint16_t& end);
+    I2CStatus execute(const Transaction& t, uint8_t reg, uint8_t* rx, uint16_t len);
+    void complete(Transaction& t, I2CStatus status, uint32_t busUs, bool merged);
+    void record(const Transaction& t, I2CStatus status, uint32_t busUs, bool merged);
+};
+
+#endif // I2C_BUS_H
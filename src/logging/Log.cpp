@@ -0,0 +1,109 @@
+#include "Log.h"
+
+LogRecord Log::ring[LOG_RING_SIZE];
+uint16_t Log::head = 0;
+uint16_t Log::tail = 0;
+uint32_t Log::droppedCount = 0;
+
+static portMUX_TYPE logMux = portMUX_INITIALIZER_UNLOCKED;
+
+static const char LEVEL_TAGS[] = {'-', 'E', 'W', 'I', 'D'};
+
+void Log::push(const LogRecord& r) {
+    portENTER_CRITICAL(&logMux);
+    uint16_t next = (head + 1) % LOG_RING_SIZE;
+    if (next == tail) {
+        droppedCount++;
+    } else {
+        ring[head] = r;
+        head = next;
+    }
+    portEXIT_CRITICAL(&logMux);
+}
+
+bool Log::pop(LogRecord& r) {
+    bool got = false;
+    portENTER_CRITICAL(&logMux);
+    if (tail != head) {
+        r = ring[tail];
+        tail = (tail + 1) % LOG_RING_SIZE;
+        got = true;
+    }
+    portEXIT_CRITICAL(&logMux);
+    return got;
+}
+
+// printf-style expansion one conversion at a time, since the arguments are
+// only known as tagged 32-bit words here.
+void Log::format(Print& out, const LogRecord& r) {
+    char line[160];
+    size_t n = snprintf(line, sizeof(line), "[%lu] %c ", (unsigned long)r.t,
+                        LEVEL_TAGS[r.level < sizeof(LEVEL_TAGS) ? r.level : 0]);
+    uint8_t arg = 0;
+    const char* p = r.fmt;
+
+    while (*p && n < sizeof(line) - 1) {
+        if (*p != '%') {
+            line[n++] = *p++;
+            continue;
+        }
+        if (p[1] == '%') {
+            line[n++] = '%';
+            p += 2;
+            continue;
+        }
+
+        // Copy one conversion spec: flags, width, precision, length, type
+        char spec[16];
+        uint8_t k = 0;
+        spec[k++] = *p++;
+        while (*p && strchr("-+ #0123456789.lhz", *p) && k < sizeof(spec) - 2) {
+            spec[k++] = *p++;
+        }
+        char conv = *p ? *p++ : 'd';
+        spec[k++] = conv;
+        spec[k] = '\0';
+
+        size_t room = sizeof(line) - n;
+        if (arg >= r.argc) break;
+        uintptr_t v = r.args[arg];
+        LogArgType type = (LogArgType)((r.types >> (2 * arg)) & 0x3);
+        arg++;
+
+        int w;
+        if (type == LOG_ARG_FLOAT) {
+            uint32_t bits = (uint32_t)v;
+            float f;
+            memcpy(&f, &bits, sizeof(f));
+            w = snprintf(line + n, room, spec, (double)f);
+        } else if (type == LOG_ARG_STR) {
+            w = snprintf(line + n, room, spec, (const char*)v);
+        } else if (strchr(spec, 'l')) {
+            w = snprintf(line + n, room, spec, (unsigned long)v);
+        } else {
+            w = snprintf(line + n, room, spec, (unsigned int)v);
+        }
+        if (w < 0) break;
+        n += (size_t)w < room ? (size_t)w : room - 1;
+    }
+
+    // Callers may or may not end their format with a newline
+    while (n > 0 && (line[n - 1] == '\n' || line[n - 1] == '\r')) n--;
+    line[n] = '\0';
+    out.println(line);
+}
+
+uint16_t Log::drain(Print& out, uint16_t maxRecords) {
+    static uint32_t reportedDrops = 0;
+    uint16_t count = 0;
+    LogRecord r;
+    while (count < maxRecords && pop(r)) {
+        format(out, r);
+        count++;
+    }
+    if (droppedCount != reportedDrops) {
+        out.printf("[log] %lu records dropped\n", (unsigned long)(droppedCount - reportedDrops));
+        reportedDrops = droppedCount;
+    }
+    return count;
+}
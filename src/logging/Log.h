@@ -0,0 +1,121 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <Arduino.h>
+#include <string.h>
+
+// Compile-time level filter: calls above LOG_LEVEL compile to nothing.
+#define LOG_LEVEL_NONE  0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN  2
+#define LOG_LEVEL_INFO  3
+#define LOG_LEVEL_DEBUG 4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+#define LOG_MAX_ARGS 6
+#define LOG_RING_SIZE 64
+
+enum LogArgType : uint8_t {
+    LOG_ARG_INT = 0,
+    LOG_ARG_FLOAT = 1,
+    LOG_ARG_STR = 2
+};
+
+// One binary record: the format string pointer (literals stay in flash),
+// a timestamp and up to six 32-bit arguments. Formatting happens later in
+// drain(), off the caller's path.
+struct LogRecord {
+    const char* fmt;
+    uint32_t t;
+    uint8_t level;
+    uint8_t argc;
+    uint16_t types;  // 2 bits per argument, LogArgType
+    uintptr_t args[LOG_MAX_ARGS];  // 32-bit on the ESP32
+};
+
+class Log {
+public:
+    // %s arguments are stored as pointers and must outlive the drain
+    // (string literals or other static storage). Not for use in ISRs.
+    template<typename... Args>
+    static void write(uint8_t level, const char* fmt, Args... args) {
+        static_assert(sizeof...(Args) <= LOG_MAX_ARGS, "too many log arguments");
+        LogRecord r;
+        r.fmt = fmt;
+        r.t = millis();
+        r.level = level;
+        r.argc = sizeof...(Args);
+        r.types = 0;
+        pack(r, 0, args...);
+        push(r);
+    }
+
+    // Format up to maxRecords queued records to out. Returns how many.
+    static uint16_t drain(Print& out, uint16_t maxRecords = LOG_RING_SIZE);
+    static uint32_t dropped() { return droppedCount; }
+
+private:
+    static LogRecord ring[LOG_RING_SIZE];
+    static uint16_t head;
+    static uint16_t tail;
+    static uint32_t droppedCount;
+
+    static void push(const LogRecord& r);
+    static bool pop(LogRecord& r);
+    static void format(Print& out, const LogRecord& r);
+
+    static void pack(LogRecord&, uint8_t) {}
+    template<typename T, typename... Rest>
+    static void pack(LogRecord& r, uint8_t i, T v, Rest... rest) {
+        LogArgType type;
+        r.args[i] = encode(v, type);
+        r.types |= (uint16_t)type << (2 * i);
+        pack(r, i + 1, rest...);
+    }
+
+    template<typename T>
+    static uintptr_t encode(T v, LogArgType& type) {
+        static_assert(sizeof(T) <= sizeof(long), "64-bit log arguments are not supported");
+        type = LOG_ARG_INT;
+        return (uintptr_t)v;
+    }
+    static uintptr_t encode(double v, LogArgType& type) {
+        type = LOG_ARG_FLOAT;
+        float f = (float)v;
+        uint32_t bits;
+        memcpy(&bits, &f, sizeof(bits));
+        return bits;
+    }
+    static uintptr_t encode(float v, LogArgType& type) { return encode((double)v, type); }
+    static uintptr_t encode(const char* s, LogArgType& type) {
+        type = LOG_ARG_STR;
+        return (uintptr_t)s;
+    }
+    static uintptr_t encode(char* s, LogArgType& type) { return encode((const char*)s, type); }
+};
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_E(fmt, ...) Log::write(LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)
+#else
+#define LOG_E(fmt, ...) do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_W(fmt, ...) Log::write(LOG_LEVEL_WARN, fmt, ##__VA_ARGS__)
+#else
+#define LOG_W(fmt, ...) do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_I(fmt, ...) Log::write(LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)
+#else
+#define LOG_I(fmt, ...) do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_D(fmt, ...) Log::write(LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
+#else
+#define LOG_D(fmt, ...) do {} while (0)
+#endif
+
+#endif // LOG_H
@@ -0,0 +1,87 @@
+#include "BatteryMonitor.h"
+#include "DEV_Config.h"
+
+static const char* const LEVEL_NAMES[] = {"ok", "low", "critical"};
+
+// Resting voltage of a single LiPo cell at 100%, 95%, ... 0%
+static const uint16_t DISCHARGE_MV[] = {
+    4200, 4150, 4110, 4080, 4020, 3980, 3950, 3910, 3870, 3850, 3840,
+    3820, 3800, 3790, 3770, 3750, 3730, 3710, 3690, 3610, 3270
+};
+static const uint8_t DISCHARGE_POINTS = sizeof(DISCHARGE_MV) / sizeof(DISCHARGE_MV[0]);
+static const uint8_t DISCHARGE_STEP = 100 / (DISCHARGE_POINTS - 1);
+
+const char* BatteryMonitor::levelName(BatteryLevel l) {
+    return LEVEL_NAMES[l];
+}
+
+uint8_t BatteryMonitor::percentFor(uint16_t mv) {
+    if (mv >= DISCHARGE_MV[0]) return 100;
+    if (mv <= DISCHARGE_MV[DISCHARGE_POINTS - 1]) return 0;
+    uint8_t i = 1;
+    while (mv < DISCHARGE_MV[i]) i++;
+    // Linear between the two surrounding points, rounded
+    uint16_t hi = DISCHARGE_MV[i - 1], lo = DISCHARGE_MV[i];
+    uint8_t pctLo = 100 - i * DISCHARGE_STEP;
+    return pctLo + ((mv - lo) * DISCHARGE_STEP + (hi - lo) / 2) / (hi - lo);
+}
+
+uint16_t BatteryMonitor::readMillivolts() {
+    uint32_t sum = 0;
+    uint16_t lo = UINT16_MAX, hi = 0;
+    for (uint8_t i = 0; i < OVERSAMPLE; i++) {
+        uint16_t mv = DEC_ADC_Read();
+        sum += mv;
+        if (mv < lo) lo = mv;
+        if (mv > hi) hi = mv;
+    }
+    // Trimmed mean: a single spike from the radio or the backlight PWM is dropped
+    sum -= lo + hi;
+    return sum * DIVIDER / (OVERSAMPLE - 2);
+}
+
+BatteryLevel BatteryMonitor::levelFor(uint8_t pct) const {
+    // Thresholds only apply going down; coming back up needs LEVEL_HYSTERESIS more
+    uint8_t margin = 0;
+    if (currentLevel == BATTERY_CRITICAL) {
+        if (pct <= CRITICAL_PERCENT + LEVEL_HYSTERESIS) return BATTERY_CRITICAL;
+        margin = LEVEL_HYSTERESIS;
+    } else if (currentLevel == BATTERY_LOW) {
+        margin = LEVEL_HYSTERESIS;
+    }
+    if (pct <= CRITICAL_PERCENT) return BATTERY_CRITICAL;
+    if (pct <= LOW_PERCENT + margin) return BATTERY_LOW;
+    return BATTERY_OK;
+}
+
+bool BatteryMonitor::update() {
+    lastRawMv = readMillivolts();
+    samples++;
+    if (!seeded) {
+        filterAcc = (uint32_t)lastRawMv << FILTER_SHIFT;
+        seeded = true;
+    } else {
+        filterAcc += lastRawMv - (filterAcc >> FILTER_SHIFT);
+    }
+    filteredMv = filterAcc >> FILTER_SHIFT;
+
+    uint8_t pct = percentFor(filteredMv);
+    bool changed = false;
+    if (samples == 1 || abs((int)pct - (int)publishedPercent) >= PERCENT_HYSTERESIS ||
+        pct == 0 || pct == 100) {
+        changed = pct != publishedPercent || samples == 1;
+        publishedPercent = pct;
+    }
+    BatteryLevel next = levelFor(publishedPercent);
+    if (next != currentLevel) {
+        currentLevel = next;
+        changed = true;
+    }
+    return changed;
+}
+
+void BatteryMonitor::printStats(Print& out) const {
+    out.printf("Battery: %u%% (%s), %u mV filtered, %u mV last, %lu samples\n",
+               publishedPercent, LEVEL_NAMES[currentLevel], filteredMv, lastRawMv,
+               (unsigned long)samples);
+}
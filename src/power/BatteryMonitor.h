@@ -0,0 +1,50 @@
+#ifndef BATTERY_MONITOR_H
+#define BATTERY_MONITOR_H
+
+#include <Arduino.h>
+
+enum BatteryLevel : uint8_t {
+    BATTERY_OK,
+    BATTERY_LOW,        // power saving
+    BATTERY_CRITICAL    // minimal display, shut down soon
+};
+
+// LiPo state of charge from the BAT_ADC divider. Each update() oversamples
+// DEC_ADC_Read(), drops the extremes, filters the result and maps the
+// voltage to a percentage with a typical single-cell discharge curve.
+// The published percentage and level only move with hysteresis, so load
+// steps (backlight, LED) don't make them flicker.
+class BatteryMonitor {
+public:
+    // Returns true when the published percentage or level changed.
+    bool update();
+
+    uint16_t millivolts() const { return filteredMv; }
+    uint8_t percent() const { return publishedPercent; }
+    BatteryLevel level() const { return currentLevel; }
+    static const char* levelName(BatteryLevel l);
+    static uint8_t percentFor(uint16_t mv);
+    void printStats(Print& out) const;
+
+private:
+    static const uint8_t DIVIDER = 3;            // on-board divider, 1/3 of VBAT at the pin
+    static const uint8_t OVERSAMPLE = 16;
+    static const uint8_t FILTER_SHIFT = 2;       // EMA weight 1/4 per update
+    static const uint8_t PERCENT_HYSTERESIS = 2;
+    static const uint8_t LOW_PERCENT = 20;
+    static const uint8_t CRITICAL_PERCENT = 5;
+    static const uint8_t LEVEL_HYSTERESIS = 3;   // % above a threshold to leave it
+
+    bool seeded = false;
+    uint32_t filterAcc = 0;                      // mV << FILTER_SHIFT
+    uint16_t filteredMv = 0;
+    uint16_t lastRawMv = 0;
+    uint8_t publishedPercent = 0;
+    BatteryLevel currentLevel = BATTERY_OK;
+    uint32_t samples = 0;
+
+    uint16_t readMillivolts();
+    BatteryLevel levelFor(uint8_t pct) const;
+};
+
+#endif // BATTERY_MONITOR_H
@@ -0,0 +1,112 @@
+#include "DisplayPower.h"
+#include "src/screen/LCD_1in28.h"
+#include "src/screen/FrameBuffer.h"
+#include "src/logging/Log.h"
+
+static const char* const STATE_NAMES[DISPLAY_STATE_COUNT] = {"active", "dimmed", "off"};
+
+void DisplayPower::begin(uint8_t brightness) {
+    uint32_t now = millis();
+    activeLevel = brightness;
+    level = target = brightness;
+    DEV_SET_PWM(level);
+    lastActivityMs = stateSinceMs = lastAccountMs = now;
+}
+
+void DisplayPower::activity() {
+    lastActivityMs = millis();
+    if (current == DISPLAY_OFF) {
+        // Backlight stays dark until the panel shows the current frame
+        LCD_1IN28_SleepOut();
+        waking = true;
+        wakeAtMs = lastActivityMs + LCD_1IN28_SLEEP_OUT_MS;
+    }
+    if (current != DISPLAY_ACTIVE) enter(DISPLAY_ACTIVE);
+}
+
+void DisplayPower::setAmbient(uint16_t clear) {
+    uint32_t c = clear > AMBIENT_FULL ? AMBIENT_FULL : clear;
+    activeLevel = MIN_BRIGHTNESS + (MAX_BRIGHTNESS - MIN_BRIGHTNESS) * c / AMBIENT_FULL;
+    if (current != DISPLAY_OFF) target = levelFor(current);
+}
+
+void DisplayPower::setLimits(uint8_t maxBrightness, uint32_t dimAfter, uint32_t offAfter) {
+    brightnessCap = maxBrightness && maxBrightness < MAX_BRIGHTNESS ? maxBrightness : MAX_BRIGHTNESS;
+    dimAfterMs = dimAfter ? dimAfter : DIM_AFTER_MS;
+    offAfterMs = offAfter ? offAfter : OFF_AFTER_MS;
+    if (current != DISPLAY_OFF) target = levelFor(current);
+}
+
+uint8_t DisplayPower::levelFor(DisplayPowerState s) const {
+    uint8_t active = activeLevel < brightnessCap ? activeLevel : brightnessCap;
+    if (s == DISPLAY_ACTIVE) return active;
+    if (s == DISPLAY_DIMMED) return active / 4 > 5 ? active / 4 : 5;
+    return 0;
+}
+
+void DisplayPower::enter(DisplayPowerState next) {
+    uint32_t now = millis();
+    account(now);
+    timeInState[current] += now - stateSinceMs;
+    stateSinceMs = now;
+
+    LOG_I("Display: %s -> %s", STATE_NAMES[current], STATE_NAMES[next]);
+    current = next;
+    target = levelFor(next);
+}
+
+void DisplayPower::account(uint32_t now) {
+    uint32_t ua = (current == DISPLAY_OFF && !waking) ? PANEL_SLEEP_UA : PANEL_ON_UA;
+    ua += BACKLIGHT_FULL_UA / 100 * level;
+    energyUAms += (uint64_t)ua * (now - lastAccountMs);
+    lastAccountMs = now;
+}
+
+uint32_t DisplayPower::update() {
+    uint32_t now = millis();
+    account(now);
+
+    if (waking) {
+        if ((int32_t)(now - wakeAtMs) < 0) return wakeAtMs - now;
+        LCD_1IN28_DisplayOn();
+        FrameBuffers.refresh();  // catch up on frames skipped while asleep
+        waking = false;
+    }
+
+    uint32_t idle = now - lastActivityMs;
+    if (current == DISPLAY_ACTIVE && idle >= dimAfterMs) {
+        enter(DISPLAY_DIMMED);
+    } else if (current == DISPLAY_DIMMED && idle >= offAfterMs) {
+        enter(DISPLAY_OFF);
+    }
+
+    if (level != target) {
+        if (level < target) level = target - level > RAMP_STEP ? level + RAMP_STEP : target;
+        else level = level - target > RAMP_STEP ? level - RAMP_STEP : target;
+        DEV_SET_PWM(level);
+        if (level != target) return RAMP_STEP_MS;
+    }
+
+    // Sleep the controller only once the backlight has faded out
+    if (current == DISPLAY_OFF && level == 0 && LCD_1IN28_IsOn()) {
+        LCD_1IN28_Sleep();
+    }
+    return IDLE_CHECK_MS;
+}
+
+float DisplayPower::energyUsed() {
+    account(millis());
+    return energyUAms / 1e6f;
+}
+
+void DisplayPower::printStats(Print& out) {
+    uint32_t now = millis();
+    account(now);
+    out.printf("Display: %s, backlight %u%% (target %u%%)\n", STATE_NAMES[current], level, target);
+    for (uint8_t s = 0; s < DISPLAY_STATE_COUNT; s++) {
+        uint32_t t = timeInState[s] + (s == current ? now - stateSinceMs : 0);
+        out.printf("  %-7s %10lu ms\n", STATE_NAMES[s], (unsigned long)t);
+    }
+    float mas = energyUAms / 1e6f;
+    out.printf("  est. energy %.1f mAs (%.2f mA avg)\n", mas, now ? mas * 1000.0f / now : 0.0f);
+}
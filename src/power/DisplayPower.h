@@ -0,0 +1,74 @@
+#ifndef DISPLAY_POWER_H
+#define DISPLAY_POWER_H
+
+#include <Arduino.h>
+#include "DEV_Config.h"
+
+enum DisplayPowerState : uint8_t {
+    DISPLAY_ACTIVE,
+    DISPLAY_DIMMED,
+    DISPLAY_OFF,      // backlight off, controller in sleep mode
+    DISPLAY_STATE_COUNT
+};
+
+// Backlight and panel power. Brightness follows the ambient light level
+// and ramps in small PWM steps; after an idle period the backlight dims,
+// later the LCD controller is put to sleep and flushes are skipped. Any
+// activity() wakes it again without blocking: sleep-out is sent at once
+// and display-on (plus a full flush) follows after the required 120 ms.
+class DisplayPower {
+public:
+    void begin(uint8_t brightness);
+    void activity();                  // touch, motion, ...
+    void setAmbient(uint16_t clear);  // TCS clear count with the LED off
+    // Power saving: caps the backlight and shortens the idle timeouts.
+    // 0 restores the defaults.
+    void setLimits(uint8_t maxBrightness, uint32_t dimAfterMs = 0, uint32_t offAfterMs = 0);
+
+    // Returns the ms until update() wants to run again.
+    uint32_t update();
+
+    DisplayPowerState state() const { return current; }
+    bool isOn() const { return current != DISPLAY_OFF && !waking; }
+    uint8_t brightness() const { return level; }   // applied PWM %
+    // Estimated charge drawn by panel and backlight since begin(), mA*s
+    float energyUsed();
+    void printStats(Print& out);
+
+private:
+    static const uint32_t DIM_AFTER_MS = 60000;
+    static const uint32_t OFF_AFTER_MS = 300000;
+    static const uint32_t RAMP_STEP_MS = 20;
+    static const uint32_t IDLE_CHECK_MS = 1000;
+    static const uint8_t RAMP_STEP = 2;          // % per step
+    static const uint8_t MIN_BRIGHTNESS = 15;
+    static const uint8_t MAX_BRIGHTNESS = 100;
+    static const uint16_t AMBIENT_FULL = 1500;   // clear count for full brightness
+
+    // Energy model, uA at 3.3 V
+    static const uint32_t PANEL_ON_UA = 6000;
+    static const uint32_t PANEL_SLEEP_UA = 20;
+    static const uint32_t BACKLIGHT_FULL_UA = 25000;
+
+    DisplayPowerState current = DISPLAY_ACTIVE;
+    uint8_t level = 0;          // applied PWM %
+    uint8_t target = 0;
+    uint8_t activeLevel = MAX_BRIGHTNESS;
+    uint8_t brightnessCap = MAX_BRIGHTNESS;
+    uint32_t dimAfterMs = DIM_AFTER_MS;
+    uint32_t offAfterMs = OFF_AFTER_MS;
+    bool waking = false;
+    uint32_t lastActivityMs = 0;
+    uint32_t wakeAtMs = 0;
+
+    uint32_t stateSinceMs = 0;
+    uint32_t timeInState[DISPLAY_STATE_COUNT] = {0};
+    uint32_t lastAccountMs = 0;
+    uint64_t energyUAms = 0;    // uA*ms; a float total would round the sleep current away
+
+    void enter(DisplayPowerState next);
+    void account(uint32_t now);
+    uint8_t levelFor(DisplayPowerState s) const;
+};
+
+#endif // DISPLAY_POWER_H
@@ -0,0 +1,180 @@
+#include "PowerScheduler.h"
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include "src/logging/Log.h"
+
+static const char* const STATE_NAMES[POWER_STATE_COUNT] = {"active", "idle", "sleep"};
+
+static gpio_int_type_t intrTypeFor(int mode) {
+    switch (mode) {
+        case RISING:  return GPIO_INTR_POSEDGE;
+        case FALLING: return GPIO_INTR_NEGEDGE;
+        case CHANGE:  return GPIO_INTR_ANYEDGE;
+        default:      return GPIO_INTR_DISABLE;
+    }
+}
+
+void PowerScheduler::begin() {
+    stateSinceUs = esp_timer_get_time();
+    current = POWER_ACTIVE;
+}
+
+bool PowerScheduler::addWakePin(const char* name, uint8_t pin, uint8_t activeLevel, int mode,
+                                void (*onWake)()) {
+    if (pinCount >= MAX_WAKE_PINS) return false;
+    pins[pinCount++] = {name, pin, activeLevel, intrTypeFor(mode), onWake, LOW, false, 0};
+    return true;
+}
+
+bool PowerScheduler::addBus(I2CBus& bus) {
+    if (busCount >= MAX_BUSES) return false;
+    buses[busCount++] = &bus;
+    return true;
+}
+
+bool PowerScheduler::busBusy() const {
+    for (uint8_t i = 0; i < busCount; i++) {
+        if (buses[i]->busy()) return true;
+    }
+    return false;
+}
+
+void PowerScheduler::enter(PowerState next) {
+    int64_t now = esp_timer_get_time();
+    timeInState[current] += now - stateSinceUs;
+    stateSinceUs = now;
+    current = next;
+}
+
+void PowerScheduler::idle(uint32_t maxSleepMs) {
+    uint32_t wait = ui.msUntilNextDeadline(maxSleepMs);
+    if (wait == 0) return;
+
+#if POWER_LIGHT_SLEEP
+    // The sensor task must be parked too; if it is inside a blocking read its
+    // deadline is unknown, so only the regular wait is safe. Likewise a
+    // transaction on either I2C bus would stall until the next wake
+    uint32_t sensorWait = sensors.msUntilNextDeadline(wait);
+    bool allowed = sensors.isIdle() && !busBusy() && sensorWait >= MIN_SLEEP_MS && wait >= MIN_SLEEP_MS &&
+                   (int32_t)(millis() - rejectUntilMs) >= 0 &&
+                   (!sleepAllowed || sleepAllowed());
+    if (allowed && trySleep(min(wait, sensorWait))) return;
+#endif
+
+    enter(POWER_IDLE);
+    ui.sleepUntilNextDeadline(maxSleepMs);
+    enter(POWER_ACTIVE);
+}
+
+bool PowerScheduler::trySleep(uint32_t waitMs) {
+    uint64_t requestUs = (uint64_t)waitMs * 1000;
+    esp_sleep_enable_timer_wakeup(requestUs);
+    armPins();
+
+    // The sensor core may have been triggered since idle() found it parked,
+    // e.g. by the TCS INT; that pin is then still asserted and was skipped
+    // above, so nothing would wake us for the work. Checking after arming
+    // closes the window: a trigger from a later edge leaves its pin at the
+    // armed level, which aborts the sleep by itself.
+    if (!sensors.isIdle() || sensors.msUntilNextDeadline(1) == 0 || busBusy()) {
+        disarmPins(false);
+        return false;
+    }
+    esp_sleep_enable_gpio_wakeup();
+#if SOC_PM_SUPPORT_BT_WAKEUP
+    esp_sleep_enable_bt_wakeup();
+#endif
+
+    enter(POWER_SLEEP);
+    int64_t start = esp_timer_get_time();
+    esp_err_t err = esp_light_sleep_start();
+    int64_t woke = esp_timer_get_time();
+
+    if (err != ESP_OK) {
+        // Typically a wake source already pending or a peripheral holding a
+        // lock; back off instead of retrying on every idle
+        disarmPins(false);
+        enter(POWER_ACTIVE);
+        rejects++;
+        rejectUntilMs = millis() + REJECT_BACKOFF_MS;
+        LOG_D("Power: light-sleep rejected (%d)", err);
+        return false;
+    }
+    sleeps++;
+
+    esp_sleep_wakeup_cause_t cause = esp_sleep_get_wakeup_cause();
+    if (cause == ESP_SLEEP_WAKEUP_TIMER) {
+        timerWakes++;
+        uint32_t over = woke - start > (int64_t)requestUs ? (uint32_t)(woke - start - requestUs) : 0;
+        overshootTotalUs += over;
+        if (over > overshootMaxUs) overshootMaxUs = over;
+    } else if (cause == ESP_SLEEP_WAKEUP_BT) {
+        btWakes++;
+    } else if (cause != ESP_SLEEP_WAKEUP_GPIO) {
+        otherWakes++;
+    }
+    disarmPins(cause == ESP_SLEEP_WAKEUP_GPIO);
+    enter(POWER_ACTIVE);
+
+    uint32_t resumeUs = esp_timer_get_time() - woke;
+    if (resumeUs > resumeMaxUs) resumeMaxUs = resumeUs;
+    return true;
+}
+
+void PowerScheduler::armPins() {
+    for (uint8_t i = 0; i < pinCount; i++) {
+        WakePin& p = pins[i];
+        uint8_t level = digitalRead(p.pin);
+        if (p.activeLevel == WAKE_ON_CHANGE) {
+            p.wakeLevel = !level;
+        } else if (level == p.activeLevel) {
+            // Still asserted (e.g. a latched INT that nobody cleared yet);
+            // arming it would wake us straight away
+            p.armed = false;
+            continue;
+        } else {
+            p.wakeLevel = p.activeLevel;
+        }
+        gpio_wakeup_enable((gpio_num_t)p.pin, p.wakeLevel ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL);
+        p.armed = true;
+    }
+}
+
+void PowerScheduler::disarmPins(bool dispatch) {
+    for (uint8_t i = 0; i < pinCount; i++) {
+        WakePin& p = pins[i];
+        if (!p.armed) continue;
+        p.armed = false;
+        gpio_wakeup_disable((gpio_num_t)p.pin);
+        gpio_set_intr_type((gpio_num_t)p.pin, p.restoreType);
+        if (dispatch && digitalRead(p.pin) == p.wakeLevel) {
+            p.wakes++;
+            if (p.onWake) p.onWake();
+        }
+    }
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+}
+
+void PowerScheduler::printStats(Print& out) {
+    enter(current);
+    uint64_t total = 0;
+    for (uint8_t s = 0; s < POWER_STATE_COUNT; s++) total += timeInState[s];
+
+    out.printf("Power: %lu sleeps, %lu rejected, light-sleep %s\n",
+               (unsigned long)sleeps, (unsigned long)rejects,
+               POWER_LIGHT_SLEEP ? "on" : "off");
+    for (uint8_t s = 0; s < POWER_STATE_COUNT; s++) {
+        out.printf("  %-7s %10lu ms %5.1f%%\n", STATE_NAMES[s],
+                   (unsigned long)(timeInState[s] / 1000),
+                   total ? timeInState[s] * 100.0f / total : 0.0f);
+    }
+    out.printf("  wakes: timer %lu, bt %lu, other %lu",
+               (unsigned long)timerWakes, (unsigned long)btWakes, (unsigned long)otherWakes);
+    for (uint8_t i = 0; i < pinCount; i++) {
+        out.printf(", %s %lu", pins[i].name, (unsigned long)pins[i].wakes);
+    }
+    out.printf("\n  timer overshoot avg %lu us max %lu us, resume max %lu us\n",
+               (unsigned long)(timerWakes ? overshootTotalUs / timerWakes : 0),
+               (unsigned long)overshootMaxUs, (unsigned long)resumeMaxUs);
+}
@@ -0,0 +1,92 @@
+#ifndef POWER_SCHEDULER_H
+#define POWER_SCHEDULER_H
+
+#include <Arduino.h>
+#include <driver/gpio.h>
+#include "src/scheduler/TaskScheduler.h"
+#include "src/i2c/I2CBus.h"
+
+// Set to 0 to keep the plain notification wait, e.g. while debugging over
+// the USB-CDC console, which drops off the bus during light-sleep.
+#ifndef POWER_LIGHT_SLEEP
+#define POWER_LIGHT_SLEEP 1
+#endif
+
+enum PowerState : uint8_t {
+    POWER_ACTIVE,      // running tasks
+    POWER_IDLE,        // blocked on a notification, clocks running
+    POWER_SLEEP,       // CPUs halted in light-sleep, woken by timer, GPIO or BT
+    POWER_STATE_COUNT
+};
+
+// Replaces sleepUntilNextDeadline() in loop(). When neither the UI nor the
+// sensor scheduler has anything due for a while, the chip enters
+// light-sleep with a timer at the earliest deadline and level wakeups on
+// the interrupt lines. Edges are not latched while asleep, so each wake
+// pin has a callback that re-raises its event after waking.
+class PowerScheduler {
+public:
+    static const uint8_t MAX_WAKE_PINS = 6;
+    static const uint8_t MAX_BUSES = 2;
+    static const uint8_t WAKE_ON_CHANGE = 2;       // for lines that toggle, e.g. WoM
+
+    PowerScheduler(TaskScheduler& ui, TaskScheduler& sensors) : ui(ui), sensors(sensors) {}
+
+    void begin();
+    // activeLevel is LOW, HIGH or WAKE_ON_CHANGE; mode is the attachInterrupt()
+    // mode to restore after waking. onWake runs on the UI core.
+    bool addWakePin(const char* name, uint8_t pin, uint8_t activeLevel, int mode,
+                    void (*onWake)() = nullptr);
+    // Sleep is vetoed while the bus has transactions in flight, e.g. a touch
+    // read queued from the UI core that completes on the bus task.
+    bool addBus(I2CBus& bus);
+    // Sleep is vetoed while this returns false (e.g. a BLE connection).
+    void setSleepAllowed(bool (*allowed)()) { sleepAllowed = allowed; }
+
+    void idle(uint32_t maxSleepMs = 1000);
+    void printStats(Print& out);
+
+private:
+    static const uint32_t MIN_SLEEP_MS = 3;        // below this the wait is cheaper
+    static const uint32_t REJECT_BACKOFF_MS = 1000;
+
+    struct WakePin {
+        const char* name;
+        uint8_t pin;
+        uint8_t activeLevel;
+        gpio_int_type_t restoreType;
+        void (*onWake)();
+        uint8_t wakeLevel;   // level armed for the current sleep
+        bool armed;
+        uint32_t wakes;
+    };
+
+    TaskScheduler& ui;
+    TaskScheduler& sensors;
+    bool (*sleepAllowed)() = nullptr;
+    WakePin pins[MAX_WAKE_PINS];
+    uint8_t pinCount = 0;
+    I2CBus* buses[MAX_BUSES] = {};
+    uint8_t busCount = 0;
+
+    PowerState current = POWER_ACTIVE;
+    int64_t stateSinceUs = 0;
+    uint64_t timeInState[POWER_STATE_COUNT] = {0};
+    uint32_t sleeps = 0;
+    uint32_t rejects = 0;
+    uint32_t rejectUntilMs = 0;
+    uint32_t timerWakes = 0;
+    uint32_t btWakes = 0;
+    uint32_t otherWakes = 0;
+    uint64_t overshootTotalUs = 0;
+    uint32_t overshootMaxUs = 0;
+    uint32_t resumeMaxUs = 0;
+
+    void enter(PowerState next);
+    bool busBusy() const;
+    bool trySleep(uint32_t waitMs);
+    void armPins();
+    void disarmPins(bool dispatch);
+};
+
+#endif // POWER_SCHEDULER_H
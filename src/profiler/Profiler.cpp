@@ -0,0 +1,113 @@
+#include "Profiler.h"
+#include <string.h>
+
+ProfileZone Profiler::zones[PROFILER_MAX_ZONES];
+uint8_t Profiler::zoneCount = 0;
+uint32_t Profiler::spiBytes = 0;
+uint32_t Profiler::i2cBytes = 0;
+uint32_t Profiler::sinceMs = 0;
+
+static portMUX_TYPE profilerMux = portMUX_INITIALIZER_UNLOCKED;
+
+static void clearZone(ProfileZone& z) {
+    z.count = 0;
+    z.minUs = UINT32_MAX;
+    z.maxUs = 0;
+    z.totalUs = 0;
+    memset(z.histogram, 0, sizeof(z.histogram));
+}
+
+uint8_t Profiler::registerZone(const char* name) {
+    uint8_t id;
+    portENTER_CRITICAL(&profilerMux);
+    for (id = 0; id < zoneCount; id++) {
+        if (strcmp(zones[id].name, name) == 0) break;
+    }
+    if (id == zoneCount && zoneCount < PROFILER_MAX_ZONES) {
+        zones[id].name = name;
+        clearZone(zones[id]);
+        zoneCount++;
+    }
+    portEXIT_CRITICAL(&profilerMux);
+    // Out of slots: everything lands in the last zone rather than failing
+    return id < PROFILER_MAX_ZONES ? id : PROFILER_MAX_ZONES - 1;
+}
+
+void Profiler::record(uint8_t zone, uint32_t us) {
+    uint8_t bucket = us < 2 ? 0 : 31 - __builtin_clz(us);
+    if (bucket >= PROFILER_BUCKETS) bucket = PROFILER_BUCKETS - 1;
+
+    portENTER_CRITICAL(&profilerMux);
+    ProfileZone& z = zones[zone];
+    z.count++;
+    z.totalUs += us;
+    if (us < z.minUs) z.minUs = us;
+    if (us > z.maxUs) z.maxUs = us;
+    z.histogram[bucket]++;
+    portEXIT_CRITICAL(&profilerMux);
+}
+
+uint32_t Profiler::percentileUs(const ProfileZone& z, uint8_t pct) {
+    if (z.count == 0) return 0;
+    uint32_t target = ((uint64_t)z.count * pct + 99) / 100;
+    uint32_t seen = 0;
+    for (uint8_t b = 0; b < PROFILER_BUCKETS; b++) {
+        seen += z.histogram[b];
+        if (seen >= target) {
+            // The last bucket is open-ended; only max bounds it
+            if (b == PROFILER_BUCKETS - 1) return z.maxUs;
+            uint32_t upper = (2u << b) - 1;
+            return upper < z.maxUs ? upper : z.maxUs;
+        }
+    }
+    return z.maxUs;
+}
+
+void Profiler::dump(Print& out) {
+    uint32_t elapsed = millis() - sinceMs;
+    out.printf("Profile over %lu ms\n", (unsigned long)elapsed);
+    out.printf("  %-14s %8s %8s %8s %8s %8s\n", "zone", "count", "min", "avg", "p99", "max");
+    for (uint8_t i = 0; i < zoneCount; i++) {
+        ProfileZone z;
+        portENTER_CRITICAL(&profilerMux);
+        z = zones[i];
+        portEXIT_CRITICAL(&profilerMux);
+        if (z.count == 0) continue;
+        out.printf("  %-14s %8lu %8lu %8lu %8lu %8lu\n", z.name,
+                   (unsigned long)z.count, (unsigned long)z.minUs,
+                   (unsigned long)(z.totalUs / z.count),
+                   (unsigned long)percentileUs(z, 99), (unsigned long)z.maxUs);
+    }
+    out.printf("  SPI %lu bytes, I2C %lu bytes\n",
+               (unsigned long)spiBytes, (unsigned long)i2cBytes);
+}
+
+void Profiler::dumpJSON(void (*emit)(const char* line)) {
+    char buf[128];
+    for (uint8_t i = 0; i < zoneCount; i++) {
+        ProfileZone z;
+        portENTER_CRITICAL(&profilerMux);
+        z = zones[i];
+        portEXIT_CRITICAL(&profilerMux);
+        if (z.count == 0) continue;
+        snprintf(buf, sizeof(buf),
+                 "{\"zone\":\"%s\",\"n\":%lu,\"min\":%lu,\"avg\":%lu,\"p99\":%lu,\"max\":%lu}",
+                 z.name, (unsigned long)z.count, (unsigned long)z.minUs,
+                 (unsigned long)(z.totalUs / z.count),
+                 (unsigned long)percentileUs(z, 99), (unsigned long)z.maxUs);
+        emit(buf);
+    }
+    snprintf(buf, sizeof(buf), "{\"spi\":%lu,\"i2c\":%lu,\"ms\":%lu}",
+             (unsigned long)spiBytes, (unsigned long)i2cBytes,
+             (unsigned long)(millis() - sinceMs));
+    emit(buf);
+}
+
+void Profiler::reset() {
+    portENTER_CRITICAL(&profilerMux);
+    for (uint8_t i = 0; i < zoneCount; i++) clearZone(zones[i]);
+    spiBytes = 0;
+    i2cBytes = 0;
+    sinceMs = millis();
+    portEXIT_CRITICAL(&profilerMux);
+}
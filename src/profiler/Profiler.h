@@ -0,0 +1,74 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+
+// Set to 0 to compile every PROFILE_* macro out to nothing.
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1
+#endif
+
+#define PROFILER_MAX_ZONES 16
+#define PROFILER_BUCKETS 20  // log2(us) buckets: [0,2), [2,4) ... [2^19, inf)
+
+struct ProfileZone {
+    const char* name;
+    uint32_t count;
+    uint32_t minUs;
+    uint32_t maxUs;
+    uint64_t totalUs;
+    uint32_t histogram[PROFILER_BUCKETS];
+};
+
+// Fixed-memory timing zones and bus byte counters. Zones are registered on
+// first use and shared between both cores.
+class Profiler {
+public:
+    static uint8_t registerZone(const char* name);
+    static void record(uint8_t zone, uint32_t us);
+
+    static void addSpiBytes(uint32_t n) { __atomic_fetch_add(&spiBytes, n, __ATOMIC_RELAXED); }
+    static void addI2cBytes(uint32_t n) { __atomic_fetch_add(&i2cBytes, n, __ATOMIC_RELAXED); }
+
+    // Upper bound of the bucket holding the 99th percentile, capped at max.
+    static uint32_t percentileUs(const ProfileZone& z, uint8_t pct);
+
+    static void dump(Print& out);
+    // One compact JSON object per line, e.g. for BLE notifications.
+    static void dumpJSON(void (*emit)(const char* line));
+    static void reset();
+
+private:
+    static ProfileZone zones[PROFILER_MAX_ZONES];
+    static uint8_t zoneCount;
+    static uint32_t spiBytes;
+    static uint32_t i2cBytes;
+    static uint32_t sinceMs;
+};
+
+class ProfileScope {
+public:
+    explicit ProfileScope(uint8_t zone) : zone(zone), start(micros()) {}
+    ~ProfileScope() { Profiler::record(zone, micros() - start); }
+
+private:
+    uint8_t zone;
+    uint32_t start;
+};
+
+#define PROFILER_CAT2(a, b) a##b
+#define PROFILER_CAT(a, b) PROFILER_CAT2(a, b)
+
+#if PROFILER_ENABLED
+#define PROFILE_ZONE(name) \
+    static const uint8_t PROFILER_CAT(_profZone, __LINE__) = Profiler::registerZone(name); \
+    ProfileScope PROFILER_CAT(_profScope, __LINE__)(PROFILER_CAT(_profZone, __LINE__))
+#define PROFILE_COUNT_SPI(n) Profiler::addSpiBytes(n)
+#define PROFILE_COUNT_I2C(n) Profiler::addI2cBytes(n)
+#else
+#define PROFILE_ZONE(name)
+#define PROFILE_COUNT_SPI(n) ((void)0)
+#define PROFILE_COUNT_I2C(n) ((void)0)
+#endif
+
+#endif // PROFILER_H
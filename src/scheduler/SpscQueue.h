@@ -0,0 +1,56 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <stdint.h>
+#include <atomic>
+
+// Lock-free single-producer/single-consumer ring. Exactly one task may push
+// and exactly one (other) task may pop; no ISR or mutex involvement. Only
+// depends on <atomic>, so it builds unchanged on the host.
+template <typename T, uint32_t N>
+class SpscQueue {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+public:
+    bool push(const T& item) {
+        uint32_t head = writeIdx.load(std::memory_order_relaxed);
+        uint32_t tail = readIdx.load(std::memory_order_acquire);
+        if (head - tail == N) {
+            droppedCount++;
+            return false;
+        }
+        items[head & (N - 1)] = item;
+        writeIdx.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T& item) {
+        uint32_t tail = readIdx.load(std::memory_order_relaxed);
+        uint32_t head = writeIdx.load(std::memory_order_acquire);
+        if (head == tail) return false;
+        item = items[tail & (N - 1)];
+        readIdx.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const {
+        return writeIdx.load(std::memory_order_acquire) == readIdx.load(std::memory_order_acquire);
+    }
+
+    uint32_t size() const {
+        return writeIdx.load(std::memory_order_acquire) - readIdx.load(std::memory_order_acquire);
+    }
+
+    static constexpr uint32_t capacity() { return N; }
+
+    // Pushes rejected because the consumer fell behind (producer side count).
+    uint32_t dropped() const { return droppedCount; }
+
+private:
+    T items[N];
+    std::atomic<uint32_t> writeIdx{0};
+    std::atomic<uint32_t> readIdx{0};
+    uint32_t droppedCount = 0;
+};
+
+#endif // SPSC_QUEUE_H
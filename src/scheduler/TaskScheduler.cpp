@@ -0,0 +1,130 @@
+#include "TaskScheduler.h"
+
+void TaskScheduler::begin() {
+    owner = xTaskGetCurrentTaskHandle();
+}
+
+uint8_t TaskScheduler::addTask(const char* name, TaskCallback cb, uint32_t periodMs) {
+    if (count >= MAX_TASKS || !cb) return INVALID_TASK;
+    Task& t = tasks[count];
+    t.cb = cb;
+    t.periodMs = periodMs;
+    t.nextRunMs = millis() + periodMs;
+    t.pending = false;
+    t.triggeredUs = 0;
+    t.enabled = true;
+    t.stats = {name, 0, 0, 0, 0};
+    return count++;
+}
+
+void TaskScheduler::setPeriod(uint8_t id, uint32_t periodMs) {
+    if (id >= count) return;
+    tasks[id].periodMs = periodMs;
+    tasks[id].nextRunMs = millis() + periodMs;
+}
+
+void TaskScheduler::setEnabled(uint8_t id, bool enabled) {
+    if (id >= count || tasks[id].enabled == enabled) return;
+    tasks[id].enabled = enabled;
+    tasks[id].pending = false;
+    // A re-enabled periodic task starts a fresh period rather than catching up
+    tasks[id].nextRunMs = millis() + tasks[id].periodMs;
+}
+
+void TaskScheduler::trigger(uint8_t id) {
+    if (id >= count) return;
+    tasks[id].triggeredUs = micros();
+    tasks[id].pending = true;
+    if (owner && owner != xTaskGetCurrentTaskHandle()) xTaskNotifyGive(owner);
+}
+
+void IRAM_ATTR TaskScheduler::triggerFromISR(uint8_t id) {
+    if (id >= count) return;
+    tasks[id].triggeredUs = micros();
+    tasks[id].pending = true;
+    if (owner) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(owner, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+}
+
+void TaskScheduler::runTask(Task& t, uint32_t latencyUs) {
+    uint32_t start = micros();
+    t.cb();
+    uint32_t elapsed = micros() - start;
+
+    t.stats.runs++;
+    t.stats.totalUs += elapsed;
+    if (elapsed > t.stats.maxUs) t.stats.maxUs = elapsed;
+    if (latencyUs > t.stats.maxLatencyUs) t.stats.maxLatencyUs = latencyUs;
+}
+
+uint32_t TaskScheduler::runDue() {
+    for (uint8_t i = 0; i < count; i++) {
+        Task& t = tasks[i];
+        if (!t.enabled) continue;
+
+        if (t.pending) {
+            t.pending = false;
+            runTask(t, micros() - t.triggeredUs);
+            continue;
+        }
+
+        uint32_t now = millis();
+        if (t.periodMs && (int32_t)(now - t.nextRunMs) >= 0) {
+            uint32_t lateMs = now - t.nextRunMs;
+            // Keep a fixed cadence, but resync if we fell a whole period behind
+            t.nextRunMs += t.periodMs;
+            if ((int32_t)(now - t.nextRunMs) >= 0) t.nextRunMs = now + t.periodMs;
+            runTask(t, lateMs * 1000);
+        }
+    }
+
+    return msUntilNextDeadline(UINT32_MAX);
+}
+
+uint32_t TaskScheduler::msUntilNextDeadline(uint32_t cap) const {
+    uint32_t now = millis();
+    uint32_t wait = cap;
+    for (uint8_t i = 0; i < count; i++) {
+        const Task& t = tasks[i];
+        if (!t.enabled) continue;
+        if (t.pending) return 0;
+        if (!t.periodMs) continue;
+        int32_t remaining = (int32_t)(t.nextRunMs - now);
+        if (remaining <= 0) return 0;
+        if ((uint32_t)remaining < wait) wait = remaining;
+    }
+    return wait;
+}
+
+void TaskScheduler::sleepUntilNextDeadline(uint32_t maxSleepMs) {
+    uint32_t wait = msUntilNextDeadline(maxSleepMs);
+    if (wait == 0) return;
+    idle = true;
+    if (owner) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait));
+    } else {
+        delay(wait);
+    }
+    idle = false;
+}
+
+void TaskScheduler::printStats(Print& out) const {
+    out.printf("%-10s %8s %10s %8s %8s %10s\n", "task", "runs", "total_us", "avg_us", "max_us", "max_lat_us");
+    for (uint8_t i = 0; i < count; i++) {
+        const TaskStats& s = tasks[i].stats;
+        out.printf("%-10s %8u %10u %8u %8u %10u\n",
+                   s.name, s.runs, s.totalUs,
+                   s.runs ? s.totalUs / s.runs : 0,
+                   s.maxUs, s.maxLatencyUs);
+    }
+}
+
+void TaskScheduler::resetStats() {
+    for (uint8_t i = 0; i < count; i++) {
+        const char* name = tasks[i].stats.name;
+        tasks[i].stats = {name, 0, 0, 0, 0};
+    }
+}
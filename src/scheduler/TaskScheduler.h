@@ -0,0 +1,68 @@
+#ifndef TASK_SCHEDULER_H
+#define TASK_SCHEDULER_H
+
+#include <Arduino.h>
+
+typedef void (*TaskCallback)();
+
+struct TaskStats {
+    const char* name;
+    uint32_t runs;
+    uint32_t totalUs;      // time spent inside the callback
+    uint32_t maxUs;
+    uint32_t maxLatencyUs; // deadline/trigger to start of callback
+};
+
+// Cooperative deadline scheduler for the main loop. A task runs when its
+// period elapses, when it is triggered (from code or an ISR), or both.
+// Between deadlines the owning FreeRTOS task blocks on a notification, so
+// a trigger wakes it immediately instead of waiting out a fixed delay().
+class TaskScheduler {
+public:
+    static const uint8_t MAX_TASKS = 12;
+    static const uint8_t INVALID_TASK = 0xFF;
+
+    // Binds the scheduler to the calling FreeRTOS task (the one that sleeps).
+    void begin();
+
+    // periodMs == 0 registers an event-only task.
+    uint8_t addTask(const char* name, TaskCallback cb, uint32_t periodMs = 0);
+    void setPeriod(uint8_t id, uint32_t periodMs);
+    void setEnabled(uint8_t id, bool enabled);
+
+    void trigger(uint8_t id);
+    void IRAM_ATTR triggerFromISR(uint8_t id);
+
+    // Runs every task that is due and returns ms until the next deadline.
+    uint32_t runDue();
+    // Blocks until the next deadline, a trigger, or maxSleepMs.
+    void sleepUntilNextDeadline(uint32_t maxSleepMs = 1000);
+    uint32_t msUntilNextDeadline(uint32_t cap) const;
+    // True while the owning task is blocked in sleepUntilNextDeadline().
+    bool isIdle() const { return idle; }
+
+    uint8_t taskCount() const { return count; }
+    const TaskStats& stats(uint8_t id) const { return tasks[id].stats; }
+    void printStats(Print& out) const;
+    void resetStats();
+
+private:
+    struct Task {
+        TaskCallback cb;
+        uint32_t periodMs;
+        uint32_t nextRunMs;
+        volatile bool pending;
+        volatile uint32_t triggeredUs;
+        bool enabled;
+        TaskStats stats;
+    };
+
+    Task tasks[MAX_TASKS];
+    uint8_t count = 0;
+    TaskHandle_t owner = nullptr;
+    volatile bool idle = false;
+
+    void runTask(Task& t, uint32_t latencyUs);
+};
+
+#endif // TASK_SCHEDULER_H
@@ -0,0 +1,175 @@
+#include "Blit.h"
+#include "FrameBuffer.h"
+#include <string.h>
+#if BLIT_USE_PIE
+#include <soc/soc.h>
+#endif
+
+// Two pixels at a time through a 32-bit word
+typedef UDOUBLE __attribute__((__may_alias__)) BLIT_WORD;
+
+#define BLIT_SWAP_PAIR(W) ((((W) & 0x00FF00FFu) << 8) | (((W) >> 8) & 0x00FF00FFu))
+
+#if BLIT_USE_PIE
+// Below this the alignment head and tail cost more than the vector loop saves
+#define BLIT_PIE_MIN_BYTES 64
+
+// The vector loads and stores are only used on internal RAM; PSRAM and
+// flash go through the cache and take the portable path
+static inline bool Blit_Internal(const void *P)
+{
+    return (uintptr_t)P >= SOC_DRAM_LOW && (uintptr_t)P < SOC_DRAM_HIGH;
+}
+
+// In BlitPie.S. Blocks of 16 bytes, all pointers 16-byte aligned.
+extern "C" void Blit_CopyPie(void *Dst, const void *Src, UDOUBLE Blocks);
+extern "C" void Blit_FillPie(void *Dst, const UDOUBLE *Pattern, UDOUBLE Blocks);
+#endif
+
+void Blit_Copy565(UWORD *Dst, const UWORD *Src, UDOUBLE Count)
+{
+    UDOUBLE Bytes = Count * sizeof(UWORD);
+#if BLIT_USE_PIE
+    if (Bytes >= BLIT_PIE_MIN_BYTES && (((uintptr_t)Dst ^ (uintptr_t)Src) & 15) == 0 &&
+        Blit_Internal(Dst) && Blit_Internal(Src)) {
+        UDOUBLE Head = (16 - ((uintptr_t)Dst & 15)) & 15;
+        memcpy(Dst, Src, Head);
+        UBYTE *D = (UBYTE *)Dst + Head;
+        const UBYTE *S = (const UBYTE *)Src + Head;
+        Bytes -= Head;
+        Blit_CopyPie(D, S, Bytes / 16);
+        UDOUBLE Done = Bytes & ~15u;
+        memcpy(D + Done, S + Done, Bytes - Done);
+        return;
+    }
+#endif
+    // Already word-wise and unrolled in the ROM/libc implementation
+    memcpy(Dst, Src, Bytes);
+}
+
+void Blit_Fill565(UWORD *Dst, UWORD Pixel, UDOUBLE Count)
+{
+    if (Count && ((uintptr_t)Dst & 2)) {
+        *Dst++ = Pixel;
+        Count--;
+    }
+    UDOUBLE Pair = Pixel | ((UDOUBLE)Pixel << 16);
+    UDOUBLE i = 0;
+#if BLIT_USE_PIE
+    if (Count * sizeof(UWORD) >= BLIT_PIE_MIN_BYTES && Blit_Internal(Dst)) {
+        for (; ((uintptr_t)&Dst[i] & 15) != 0; i += 2) {
+            *(BLIT_WORD *)&Dst[i] = Pair;
+        }
+        UDOUBLE Pattern[4] __attribute__((aligned(16))) = {Pair, Pair, Pair, Pair};
+        UDOUBLE Blocks = (Count - i) / 8;
+        Blit_FillPie(&Dst[i], Pattern, Blocks);
+        i += Blocks * 8;
+    }
+#endif
+    BLIT_WORD *Words = (BLIT_WORD *)Dst;
+    for (; i + 8 <= Count; i += 8) {
+        Words[i / 2] = Pair;
+        Words[i / 2 + 1] = Pair;
+        Words[i / 2 + 2] = Pair;
+        Words[i / 2 + 3] = Pair;
+    }
+    for (; i + 2 <= Count; i += 2) {
+        Words[i / 2] = Pair;
+    }
+    if (i < Count) Dst[i] = Pixel;
+}
+
+void Blit_Swap565(UWORD *Dst, const UWORD *Src, UDOUBLE Count)
+{
+    UDOUBLE i = 0;
+    if ((((uintptr_t)Dst | (uintptr_t)Src) & 2) == 0) {
+        BLIT_WORD *D = (BLIT_WORD *)Dst;
+        const BLIT_WORD *S = (const BLIT_WORD *)Src;
+        for (; i + 2 <= Count; i += 2) {
+            UDOUBLE W = S[i / 2];
+            D[i / 2] = BLIT_SWAP_PAIR(W);
+        }
+    }
+    for (; i < Count; i++) {
+        Dst[i] = FB_PIXEL(Src[i]);
+    }
+}
+
+void Blit_Blend565(UWORD *Dst, const UWORD *Src, UBYTE Alpha, UDOUBLE Count)
+{
+    // Green moves to the upper half so all three channels get headroom
+    // for one multiply: 00000gggggg00000rrrrr000000bbbbb
+    const UDOUBLE Mask = 0x07E0F81F;
+    UDOUBLE A = (Alpha + 4) >> 3;       // 0..32
+    for (UDOUBLE i = 0; i < Count; i++) {
+        UWORD D16 = FB_PIXEL(Dst[i]), S16 = FB_PIXEL(Src[i]);
+        UDOUBLE D = (D16 | ((UDOUBLE)D16 << 16)) & Mask;
+        UDOUBLE S = (S16 | ((UDOUBLE)S16 << 16)) & Mask;
+        UDOUBLE R = ((((S - D) * A) >> 5) + D) & Mask;
+        Dst[i] = FB_PIXEL((UWORD)(R | (R >> 16)));
+    }
+}
+
+void Blit_MaskedCopy565(UWORD *Dst, const UWORD *Src, UWORD Key, UDOUBLE Count)
+{
+    UDOUBLE i = 0;
+    if ((((uintptr_t)Dst | (uintptr_t)Src) & 2) == 0) {
+        const UDOUBLE KeyPair = Key | ((UDOUBLE)Key << 16);
+        BLIT_WORD *D = (BLIT_WORD *)Dst;
+        const BLIT_WORD *S = (const BLIT_WORD *)Src;
+        for (; i + 2 <= Count; i += 2) {
+            UDOUBLE W = S[i / 2];
+            UDOUBLE X = W ^ KeyPair;            // a zero half is a keyed pixel
+            if ((X & 0xFFFF) && (X >> 16)) {
+                D[i / 2] = W;
+            } else if (X) {
+                if (X & 0xFFFF) Dst[i] = Src[i];
+                if (X >> 16) Dst[i + 1] = Src[i + 1];
+            }
+        }
+    }
+    for (; i < Count; i++) {
+        if (Src[i] != Key) Dst[i] = Src[i];
+    }
+}
+
+// Pixels per test buffer: every head and tail length on both sides of
+// BLIT_PIE_MIN_BYTES, from 8 different 2-byte offsets
+#define BLIT_TEST_PIXELS 176
+#define BLIT_TEST_GUARD 0xDEAD
+
+// Dst must hold Expect in [Off, Off + Count) and the guard everywhere else
+static bool Blit_TestRun(const UWORD *Dst, UDOUBLE Off, UDOUBLE Count, const UWORD *Expect, UWORD Fill)
+{
+    for (UDOUBLE i = 0; i < BLIT_TEST_PIXELS; i++) {
+        UWORD Want = BLIT_TEST_GUARD;
+        if (i >= Off && i < Off + Count) Want = Expect ? Expect[i - Off] : Fill;
+        if (Dst[i] != Want) return false;
+    }
+    return true;
+}
+
+UDOUBLE Blit_SelfTest(void)
+{
+    // On the stack, so in internal RAM where the vector path applies
+    UWORD Src[BLIT_TEST_PIXELS] __attribute__((aligned(16)));
+    UWORD Dst[BLIT_TEST_PIXELS] __attribute__((aligned(16)));
+    UDOUBLE Failures = 0;
+
+    for (UDOUBLE i = 0; i < BLIT_TEST_PIXELS; i++) {
+        Src[i] = (UWORD)(0x1234 + i * 0x0101);
+    }
+    for (UDOUBLE DstOff = 0; DstOff < 8; DstOff++) {
+        for (UDOUBLE Count = 0; DstOff + Count + 8 <= BLIT_TEST_PIXELS; Count++) {
+            for (UDOUBLE SrcOff = 0; SrcOff < 8; SrcOff++) {
+                for (UDOUBLE i = 0; i < BLIT_TEST_PIXELS; i++) Dst[i] = BLIT_TEST_GUARD;
+                Blit_Copy565(Dst + DstOff, Src + SrcOff, Count);
+                if (!Blit_TestRun(Dst, DstOff, Count, Src + SrcOff, 0)) Failures++;
+            }
+            for (UDOUBLE i = 0; i < BLIT_TEST_PIXELS; i++) Dst[i] = BLIT_TEST_GUARD;
+            Blit_Fill565(Dst + DstOff, 0x5AA5, Count);
+            if (!Blit_TestRun(Dst, DstOff, Count, NULL, 0x5AA5)) Failures++;
+        }
+    }
+    return Failures;
+}
@@ -0,0 +1,37 @@
+#ifndef BLIT_H
+#define BLIT_H
+
+#include "DEV_Config.h"
+
+/**
+ * Row kernels over RGB565 pixels in panel byte order (see FrameBuffer.h).
+ * The portable versions work on two pixels per 32-bit word. On the
+ * ESP32-S3, copy and fill move 16 bytes per instruction through the PIE
+ * vector unit when both sides are 16-byte aligned alike and in internal
+ * RAM; everything else takes the portable path, which gives the same
+ * result.
+**/
+#ifndef BLIT_USE_PIE
+#if defined(CONFIG_IDF_TARGET_ESP32S3)
+#define BLIT_USE_PIE 1
+#else
+#define BLIT_USE_PIE 0
+#endif
+#endif
+
+void Blit_Copy565(UWORD *Dst, const UWORD *Src, UDOUBLE Count);
+// Pixel is already in panel byte order.
+void Blit_Fill565(UWORD *Dst, UWORD Pixel, UDOUBLE Count);
+// Between plain RGB565 and panel byte order; Dst may equal Src.
+void Blit_Swap565(UWORD *Dst, const UWORD *Src, UDOUBLE Count);
+// Dst = Src * Alpha + Dst * (255 - Alpha), in 32 steps.
+void Blit_Blend565(UWORD *Dst, const UWORD *Src, UBYTE Alpha, UDOUBLE Count);
+// Copies every pixel except those equal to Key (panel byte order).
+void Blit_MaskedCopy565(UWORD *Dst, const UWORD *Src, UWORD Key, UDOUBLE Count);
+
+// Checks Copy and Fill against a plain loop over every alignment and
+// length around the vector threshold, so the PIE path can be verified on
+// the device. Returns the number of failing cases.
+UDOUBLE Blit_SelfTest(void);
+
+#endif // BLIT_H
@@ -0,0 +1,265 @@
+#include "FrameBuffer.h"
+#include <esp_heap_caps.h>
+#include "LCD_1in28.h"
+#include "GUI_Paint.h"
+#include "RoundMask.h"
+#include "Palette.h"
+#include "Blit.h"
+#include "src/logging/Log.h"
+
+FrameBufferManager FrameBuffers;
+
+static const char* const STATE_NAMES[] = {"idle", "rendering", "flushing"};
+
+static void* allocate(size_t bytes, bool& psram) {
+#if FB_STRIP_RENDER
+    // Small enough for internal SRAM, which is also DMA-capable
+    psram = false;
+    return heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+#else
+    void* p = ps_malloc(bytes);
+    psram = p != nullptr;
+    return p ? p : malloc(bytes);
+#endif
+}
+
+uint8_t FrameBufferManager::begin(uint16_t w, uint16_t h, uint8_t count) {
+    width = w;
+    height = h;
+    if (count > MAX_BUFFERS) count = MAX_BUFFERS;
+    size_t bytes = (size_t)w * (FB_STRIP_RENDER ? FB_STRIP_ROWS : h) * sizeof(FbPixel);
+
+    for (uint8_t i = 0; i < count; i++) {
+        FbPixel* fb = (FbPixel*)allocate(bytes, inPsram[i]);
+        if (!fb) {
+            // One buffer still works, the second only saves a redraw
+            LOG_W("FrameBuffer: buffer %u of %u not allocated", i + 1, count);
+            break;
+        }
+        memset(fb, 0, bytes);
+        buffers[i] = fb;
+        states[i] = FB_IDLE;
+        bufferCount++;
+    }
+    frontIndex = 0;
+#if FB_PALETTE
+    Palette_Init((UDOUBLE)w * h * bufferCount);
+#endif
+#if FB_STRIP_RENDER
+    // Drawing outside render() has no strip to land in and is dropped
+    Paint_SelectStrip(NULL, 0, 0);
+#endif
+    return bufferCount;
+}
+
+int8_t FrameBufferManager::indexOf(const FbPixel* fb) const {
+    if (!fb) return -1;
+    for (uint8_t i = 0; i < bufferCount; i++) {
+        if (buffers[i] == fb) return i;
+    }
+    return -1;
+}
+
+FrameBufferState FrameBufferManager::state(const FbPixel* fb) const {
+    int8_t i = indexOf(fb);
+    return i < 0 ? FB_IDLE : states[i];
+}
+
+bool FrameBufferManager::acquire(FbPixel* fb) {
+    int8_t i = indexOf(fb);
+    if (i < 0 || states[i] != FB_IDLE) {
+        refused++;
+        LOG_W("FrameBuffer: acquire of %s buffer refused", i < 0 ? "unknown" : STATE_NAMES[states[i]]);
+        return false;
+    }
+    states[i] = FB_RENDERING;
+    return true;
+}
+
+void FrameBufferManager::release(FbPixel* fb) {
+    int8_t i = indexOf(fb);
+    if (i < 0 || states[i] != FB_RENDERING) {
+        refused++;
+        LOG_W("FrameBuffer: release of %s buffer", i < 0 ? "unknown" : STATE_NAMES[states[i]]);
+        return;
+    }
+    states[i] = FB_IDLE;
+}
+
+bool FrameBufferManager::beginFlush(FbPixel* fb, const char* what, int8_t& index) {
+    index = indexOf(fb);
+    if (index < 0 || states[index] != FB_IDLE) {
+        refused++;
+        LOG_W("FrameBuffer: %s of %s buffer refused", what,
+              index < 0 ? "unknown" : STATE_NAMES[states[index]]);
+        return false;
+    }
+    states[index] = FB_FLUSHING;
+    return true;
+}
+
+bool FrameBufferManager::present(FbPixel* fb) {
+    int8_t i;
+    if (!beginFlush(fb, "present", i)) return false;
+    // The SPI transfer is blocking today, so the buffer comes back as soon
+    // as this returns
+#if FB_PALETTE
+    for (UWORD b = 0; b < RoundMask_BandCount(); b++) {
+        const ROUND_MASK_BAND* band = RoundMask_Band(b);
+        send(&fb[(UDOUBLE)band->Ystart * width + band->Xstart],
+             band->Xstart, band->Ystart, band->Xend, band->Yend, width);
+    }
+#else
+    LCD_1IN28_Display(fb);
+#endif
+    states[i] = FB_IDLE;
+    if (i != frontIndex) {
+        frontIndex = i;
+        swaps++;
+    }
+    presents++;
+    return true;
+}
+
+bool FrameBufferManager::flushWindow(FbPixel* fb, UWORD x0, UWORD y0, UWORD x1, UWORD y1) {
+    int8_t i;
+    if (!beginFlush(fb, "flush", i)) return false;
+    send(&fb[(UDOUBLE)y0 * width + x0], x0, y0, x1, y1, width);
+    states[i] = FB_IDLE;
+    windows++;
+    return true;
+}
+
+// origin is pixel (x0, y0) of the window inside a frame or strip
+void FrameBufferManager::send(const FbPixel* origin, UWORD x0, UWORD y0, UWORD x1, UWORD y1,
+                              UWORD stride) {
+#if FB_PALETTE
+    static UWORD line[LCD_1IN28_WIDTH];     // internal RAM, so DMA-capable
+    if (!LCD_1IN28_StartWindow(x0, y0, x1, y1)) return;
+    for (UWORD j = 0; j < y1 - y0; j++) {
+        Palette_ExpandRow(line, &origin[(UDOUBLE)j * stride], x1 - x0);
+        LCD_1IN28_WritePixels(line, x1 - x0);
+    }
+#else
+    LCD_1IN28_DisplayRows(x0, y0, x1, y1, origin, stride);
+#endif
+}
+
+bool FrameBufferManager::renderStrips(UWORD x0, UWORD y0, UWORD x1, UWORD y1, bool roundClip,
+                                      FrameDrawFn draw, void* ctx) {
+    for (UWORD y = y0; y < y1; y += FB_STRIP_ROWS) {
+        UWORD yEnd = min<UWORD>(y + FB_STRIP_ROWS, y1);
+        // Alternate strips so the next one can be drawn while the previous
+        // is still on the bus
+        FbPixel* strip = buffers[nextStrip];
+        nextStrip = (nextStrip + 1) % bufferCount;
+        if (!acquire(strip)) return false;
+        Paint_SelectStrip((UBYTE*)strip, y, yEnd);
+        draw(ctx);
+        Paint_SelectStrip(NULL, 0, 0);
+        release(strip);
+
+        UWORD xs = x0, xe = x1;
+        if (roundClip) {
+            // Widest visible span among the strip's rows
+            xs = x1;
+            xe = x0;
+            for (UWORD r = y; r < yEnd; r++) {
+                xs = min(xs, RoundMask_SpanStart(r));
+                xe = max(xe, RoundMask_SpanEnd(r));
+            }
+            if (xs >= xe) continue;
+        }
+        int8_t i;
+        if (!beginFlush(strip, "strip flush", i)) return false;
+        send(&strip[xs], xs, y, xe, yEnd, width);
+        states[i] = FB_IDLE;
+        strips++;
+    }
+    return true;
+}
+
+bool FrameBufferManager::render(UWORD x0, UWORD y0, UWORD x1, UWORD y1, FrameDrawFn draw, void* ctx) {
+#if FB_STRIP_RENDER
+    return renderStrips(x0, y0, x1, y1, false, draw, ctx);
+#else
+    FbPixel* fb = front();
+    if (!acquire(fb)) return false;
+    Paint_SelectImage((UBYTE*)fb);
+    draw(ctx);
+    release(fb);
+    return flushWindow(fb, x0, y0, x1, y1);
+#endif
+}
+
+bool FrameBufferManager::renderFrame(FrameDrawFn draw, void* ctx) {
+    uint32_t start = micros();
+#if FB_STRIP_RENDER
+    bool ok = renderStrips(0, 0, width, height, RoundMask_Applies(width, height), draw, ctx);
+#else
+    FbPixel* fb = back();
+    if (!acquire(fb)) return false;
+    Paint_SelectImage((UBYTE*)fb);
+    draw(ctx);
+    release(fb);
+    bool ok = present(fb);
+    // Partial renders keep going to whichever frame is on the panel
+    Paint_SelectImage((UBYTE*)front());
+#endif
+    frameUs = micros() - start;
+    if (frameUs > frameMaxUs) frameMaxUs = frameUs;
+    frames++;
+    return ok;
+}
+
+bool FrameBufferManager::blit(UWORD x, UWORD y, UWORD w, UWORD h, const UWORD* src, UWORD stride) {
+#if FB_STRIP_RENDER
+    // The pixels are already in panel order; send them from where they are.
+    // Only safe because the SPI write is write-only: a full-duplex transfer
+    // would overwrite the sprite's frames with MISO. src stays const all the
+    // way to DEV_SPI_Write_nByte so that cannot come back unnoticed.
+    LCD_1IN28_DisplayRows(x, y, x + w, y + h, src, stride);
+    windows++;
+    return true;
+#else
+    FbPixel* fb = front();
+    if (!acquire(fb)) return false;
+    for (UWORD row = 0; row < h; row++) {
+        FbPixel* dst = &fb[(UDOUBLE)(y + row) * width + x];
+        const UWORD* from = &src[(UDOUBLE)row * stride];
+#if FB_PALETTE
+        for (UWORD col = 0; col < w; col++) Palette_Store(&dst[col], FB_PIXEL(from[col]));
+#else
+        Blit_Copy565(dst, from, w);
+#endif
+    }
+    release(fb);
+    return flushWindow(fb, x, y, x + w, y + h);
+#endif
+}
+
+void FrameBufferManager::refresh() {
+#if FB_STRIP_RENDER
+    if (repaintHook) repaintHook();
+#else
+    present(front());
+#endif
+}
+
+void FrameBufferManager::printStats(Print& out) const {
+    out.printf("FrameBuffer: %u x %ux%u %s (", bufferCount, width,
+               FB_STRIP_RENDER ? FB_STRIP_ROWS : height, FB_STRIP_RENDER ? "strips" : "frames");
+    for (uint8_t i = 0; i < bufferCount; i++) {
+        out.printf("%s%s %s", i ? ", " : "", inPsram[i] ? "psram" : "internal", STATE_NAMES[states[i]]);
+    }
+    out.printf("), front %u\n", frontIndex);
+    out.printf("  %lu presents, %lu windows, %lu strips, %lu swaps, %lu refused\n",
+               (unsigned long)presents, (unsigned long)windows, (unsigned long)strips,
+               (unsigned long)swaps, (unsigned long)refused);
+    out.printf("  %lu full frames, last %lu us, max %lu us (draw + flush)\n",
+               (unsigned long)frames, (unsigned long)frameUs, (unsigned long)frameMaxUs);
+#if FB_PALETTE
+    out.printf("  8-bit indexed, %u exact colors in use, %lu cube fallbacks\n",
+               Palette_Used(), (unsigned long)Palette_Fallbacks());
+#endif
+}
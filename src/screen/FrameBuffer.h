@@ -0,0 +1,133 @@
+#ifndef FRAME_BUFFER_H
+#define FRAME_BUFFER_H
+
+#include "DEV_Config.h"
+
+/**
+ * Pixel layout: RGB565 stored high byte first, the order the GC9A01 takes
+ * it over SPI (COLMOD 0x05, no byte swap in the panel). A flush then writes
+ * each row to the bus as it is, with no per-pixel conversion, and leaves the
+ * buffer untouched (write-only SPI, see DEV_SPI_Write_nByte). On the
+ * little-endian ESP32 a UWORD read from the buffer therefore holds the color
+ * byte-swapped; FB_PIXEL converts a plain RGB565 value and folds to a
+ * constant for literal colors.
+**/
+#define FB_PIXEL(c) ((UWORD)((((c) & 0xFF) << 8) | (((c) >> 8) & 0xFF)))
+
+// Set to 1 to render the UI in strips of FB_STRIP_ROWS full-width rows in
+// internal SRAM instead of keeping whole frames in PSRAM. Each strip is
+// sent as soon as it is drawn; nothing of the frame is retained.
+#ifndef FB_STRIP_RENDER
+#define FB_STRIP_RENDER 0
+#endif
+#define FB_STRIP_ROWS 16
+
+// Set to 1 for an 8-bit indexed frame (GUI_Paint scale 256, see Palette.h):
+// half the memory and render bandwidth of RGB565, with each row expanded
+// through the palette into a line buffer as it is flushed. Needs a full
+// frame; strips are small enough as RGB565.
+#ifndef FB_PALETTE
+#define FB_PALETTE 0
+#endif
+#if FB_PALETTE && FB_STRIP_RENDER
+#error "FB_PALETTE needs full frames, disable FB_STRIP_RENDER"
+#endif
+
+#if FB_PALETTE
+typedef UBYTE FbPixel;     // palette index
+#else
+typedef UWORD FbPixel;     // RGB565, panel byte order
+#endif
+
+enum FrameBufferState : uint8_t {
+    FB_IDLE,          // nobody holds it
+    FB_RENDERING,     // owned by a renderer between acquire() and release()
+    FB_FLUSHING       // owned by the display transfer
+};
+
+// Paints through GUI_Paint in screen coordinates. In strip mode it runs once
+// per strip with Paint clipped to the strip's rows, so it must draw the same
+// thing every time and cover everything it wants on screen.
+typedef void (*FrameDrawFn)(void* ctx);
+
+// Owns the display buffers and hands each one either to a renderer or
+// to the display transfer, never both. A renderer that draws while a flush
+// reads the same buffer tears the frame; once flushes run asynchronously
+// this is the only thing keeping them apart, so violations are refused and
+// counted rather than allowed through.
+// Renderers go through render(), renderFrame() and blit(), which work the
+// same in both modes. With two full buffers, renderFrame() draws into
+// back() while front() is on the panel and then swaps them; partial
+// renders always go to front(). In strip mode the buffers are strips and
+// front()/back() are null.
+class FrameBufferManager {
+public:
+    static const uint8_t MAX_BUFFERS = 2;
+
+    // Allocates up to count frames, PSRAM first, then internal RAM, or in
+    // strip mode up to count strips in internal RAM. Returns how many were
+    // allocated.
+    uint8_t begin(uint16_t width, uint16_t height, uint8_t count = 1);
+
+    bool stripMode() const { return FB_STRIP_RENDER; }
+    FbPixel* front() const { return FB_STRIP_RENDER ? nullptr : buffers[frontIndex]; }
+    FbPixel* back() const {
+        return FB_STRIP_RENDER ? nullptr : buffers[bufferCount > 1 ? 1 - frontIndex : frontIndex];
+    }
+    uint8_t count() const { return bufferCount; }
+    FrameBufferState state(const FbPixel* fb) const;
+
+    bool acquire(FbPixel* fb);
+    void release(FbPixel* fb);
+
+    // Hands an idle frame to the display. present() sends the whole
+    // (round-masked) frame and makes fb the front buffer.
+    bool present(FbPixel* fb);
+    bool flushWindow(FbPixel* fb, UWORD x0, UWORD y0, UWORD x1, UWORD y1);
+
+    // Draws the window [x0, x1) x [y0, y1) and sends it to the panel.
+    bool render(UWORD x0, UWORD y0, UWORD x1, UWORD y1, FrameDrawFn draw, void* ctx);
+    // Draws and sends the whole frame.
+    bool renderFrame(FrameDrawFn draw, void* ctx);
+    // Sends w x h pixels in panel order (stride in pixels) to (x, y),
+    // copying them into the frame first when there is one.
+    bool blit(UWORD x, UWORD y, UWORD w, UWORD h, const UWORD* src, UWORD stride);
+
+    // Puts the current screen back on the panel, e.g. after it slept. Strip
+    // mode has nothing to resend and redraws through the repaint hook.
+    void refresh();
+    void onRepaint(void (*repaint)()) { repaintHook = repaint; }
+
+    uint32_t violations() const { return refused; }
+    void printStats(Print& out) const;
+
+private:
+    FbPixel* buffers[MAX_BUFFERS] = {};
+    FrameBufferState states[MAX_BUFFERS] = {};
+    bool inPsram[MAX_BUFFERS] = {};
+    uint8_t bufferCount = 0;
+    uint8_t frontIndex = 0;
+    uint8_t nextStrip = 0;
+    uint16_t width = 0;
+    uint16_t height = 0;
+    void (*repaintHook)() = nullptr;
+
+    uint32_t presents = 0;
+    uint32_t windows = 0;
+    uint32_t swaps = 0;
+    uint32_t strips = 0;
+    uint32_t refused = 0;
+    uint32_t frames = 0;
+    uint32_t frameUs = 0;        // last renderFrame(), draw + flush
+    uint32_t frameMaxUs = 0;
+
+    int8_t indexOf(const FbPixel* fb) const;
+    bool beginFlush(FbPixel* fb, const char* what, int8_t& index);
+    void send(const FbPixel* origin, UWORD x0, UWORD y0, UWORD x1, UWORD y1, UWORD stride);
+    bool renderStrips(UWORD x0, UWORD y0, UWORD x1, UWORD y1, bool roundClip,
+                      FrameDrawFn draw, void* ctx);
+};
+
+extern FrameBufferManager FrameBuffers;
+
+#endif // FRAME_BUFFER_H
@@ -1,4 +1,8 @@
 #include "GUI_Paint.h"
+#include "RoundMask.h"
+#include "FrameBuffer.h"
+#include "Palette.h"
+#include "Blit.h"
 #include "DEV_Config.h"
 #include "Debug.h"
 #include <stdint.h>
@@ -28,6 +32,8 @@ void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD
 		
     Paint.WidthByte = (Width % 8 == 0)? (Width / 8 ): (Width / 8 + 1);
     Paint.HeightByte = Height;    
+    Paint.StripStart = 0;
+    Paint.StripEnd = image ? Height : 0;
 //    printf("WidthByte = %d, HeightByte = %d\r\n", Paint.WidthByte, Paint.HeightByte);
 //    printf(" LCD_WIDTH / 8 = %d\r\n",  122 / 8);
    
@@ -51,6 +57,25 @@ parameter:
 void Paint_SelectImage(UBYTE *image)
 {
     Paint.Image = image;
+    Paint.StripStart = 0;
+    Paint.StripEnd = Paint.HeightMemory;
+}
+
+/******************************************************************************
+function: Select a strip of the image
+parameter:
+    image  : Buffer holding memory rows Ystart..Yend-1 only
+    Ystart : First row held
+    Yend   : One past the last row held
+info:
+    Drawing keeps using full-image coordinates; pixels on other rows are
+    clipped. Selecting an empty strip drops all drawing.
+******************************************************************************/
+void Paint_SelectStrip(UBYTE *image, UWORD Ystart, UWORD Yend)
+{
+    Paint.Image = image;
+    Paint.StripStart = Ystart;
+    Paint.StripEnd = Yend;
 }
 
 /******************************************************************************
@@ -68,7 +93,7 @@ void Paint_SetRotate(UWORD Rotate)
     }
 }
 
-void Paint_SetScale(UBYTE scale)
+void Paint_SetScale(UWORD scale)
 {
     if(scale == 2){
         Paint.Scale = scale;
@@ -82,9 +107,13 @@ void Paint_SetScale(UBYTE scale)
     }else if(scale ==65) {
         Paint.Scale = scale;
         Paint.WidthByte = Paint.WidthMemory*2; 
+    }else if(scale == 256) {
+        //One palette index per pixel, see Palette.h
+        Paint.Scale = scale;
+        Paint.WidthByte = Paint.WidthMemory;
     }else{
         Debug("Set Scale Input parameter error\r\n");
-        Debug("Scale Only support: 2 4 16 65\r\n");
+        Debug("Scale Only support: 2 4 16 65 256\r\n");
     }
 }
 /******************************************************************************
@@ -161,6 +190,9 @@ void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
         Debug("Exceeding display boundaries\r\n");
         return;
     }
+    if(Y < Paint.StripStart || Y >= Paint.StripEnd)
+        return;
+    Y -= Paint.StripStart;
     
     if(Paint.Scale == 2){
         UDOUBLE Addr = X / 8 + Y * Paint.WidthByte;
@@ -184,8 +216,9 @@ void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
         Paint.Image[Addr] = Rdata | ((Color << 4) >> ((X % 2)*4));
     }else if(Paint.Scale == 65) {
         UDOUBLE Addr = X*2 + Y*Paint.WidthByte;
-        Paint.Image[Addr] = 0xff & (Color>>8);
-        Paint.Image[Addr+1] = 0xff & Color;
+        *(UWORD *)&Paint.Image[Addr] = FB_PIXEL(Color);
+    }else if(Paint.Scale == 256) {
+        Palette_Store(&Paint.Image[X + Y*Paint.WidthByte], Color);
     }
 
 }
@@ -197,15 +230,16 @@ parameter:
 ******************************************************************************/
 void Paint_Clear(UWORD Color)
 {
+    UWORD Rows = Paint.StripEnd - Paint.StripStart;
     if(Paint.Scale == 2 || Paint.Scale == 4) {
-        for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
+        for (UWORD Y = 0; Y < Rows; Y++) {
             for (UWORD X = 0; X < Paint.WidthByte; X++ ) {//8 pixel =  1 byte
                 UDOUBLE Addr = X + Y*Paint.WidthByte;
                 Paint.Image[Addr] = Color;
             }
         }
     }else if(Paint.Scale == 16) {
-        for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
+        for (UWORD Y = 0; Y < Rows; Y++) {
             for (UWORD X = 0; X < Paint.WidthByte; X++ ) {//8 pixel =  1 byte
                 UDOUBLE Addr = X + Y*Paint.WidthByte;
                 Color = Color & 0x0f;
@@ -213,12 +247,21 @@ void Paint_Clear(UWORD Color)
             }
         }
     }else if(Paint.Scale == 65) {
-        for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-            for (UWORD X = 0; X < Paint.WidthByte; X++ ) {//8 pixel =  1 byte
-                UDOUBLE Addr = X*2 + Y*Paint.WidthByte;
-                Paint.Image[Addr] = 0xff & (Color>>8);
-                Paint.Image[Addr+1] = 0xff & Color;
-            }
+        //On the round panel only the visible span of each row is cleared
+        UBYTE Round = RoundMask_Applies(Paint.WidthMemory, Paint.HeightMemory);
+        UWORD Pixel = FB_PIXEL(Color);
+        for (UWORD Y = Paint.StripStart; Y < Paint.StripEnd; Y++) {
+            UWORD Xstart = Round ? RoundMask_SpanStart(Y) : 0;
+            UWORD Xend = Round ? RoundMask_SpanEnd(Y) : Paint.WidthMemory;
+            UWORD *Row = (UWORD *)&Paint.Image[(Y - Paint.StripStart)*Paint.WidthByte];
+            Blit_Fill565(&Row[Xstart], Pixel, Xend - Xstart);
+        }
+    }else if(Paint.Scale == 256) {
+        UBYTE Round = RoundMask_Applies(Paint.WidthMemory, Paint.HeightMemory);
+        for (UWORD Y = Paint.StripStart; Y < Paint.StripEnd; Y++) {
+            UWORD Xstart = Round ? RoundMask_SpanStart(Y) : 0;
+            UWORD Xend = Round ? RoundMask_SpanEnd(Y) : Paint.WidthMemory;
+            Palette_Fill(&Paint.Image[(Y - Paint.StripStart)*Paint.WidthByte + Xstart], Xend - Xstart, Color);
         }
     }
 }
@@ -235,6 +278,19 @@ parameter:
 void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
 {
     UWORD X, Y;
+    if (Paint.Scale == 65 && Paint.Rotate == ROTATE_0 && Paint.Mirror == MIRROR_NONE) {
+        //Unrotated RGB565: rows map straight to memory, fill them whole
+        if (Xend > Paint.WidthMemory) Xend = Paint.WidthMemory;
+        if (Ystart < Paint.StripStart) Ystart = Paint.StripStart;
+        if (Yend > Paint.StripEnd) Yend = Paint.StripEnd;
+        if (Xstart >= Xend) return;
+        UWORD Pixel = FB_PIXEL(Color);
+        for (Y = Ystart; Y < Yend; Y++) {
+            UWORD *Row = (UWORD *)&Paint.Image[(Y - Paint.StripStart)*Paint.WidthByte];
+            Blit_Fill565(&Row[Xstart], Pixel, Xend - Xstart);
+        }
+        return;
+    }
     for (Y = Ystart; Y < Yend; Y++) {
         for (X = Xstart; X < Xend; X++) {//8 pixel =  1 byte
             Paint_SetPixel(X, Y, Color);
@@ -256,8 +312,8 @@ void Paint_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color,
 {
     if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
         Debug("Paint_DrawPoint Input exceeds the normal display range\r\n");
-        printf("Xpoint = %d , Paint.Width = %d  \r\n ",Xpoint,Paint.Width);
-        printf("Ypoint = %d , Paint.Height = %d  \r\n ",Ypoint,Paint.Height);
+        Debug("Xpoint = %d , Paint.Width = %d  \r\n",Xpoint,Paint.Width);
+        Debug("Ypoint = %d , Paint.Height = %d  \r\n",Ypoint,Paint.Height);
         return;
     }
 
@@ -536,6 +592,486 @@ void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString,
     }
 }
 
+/******************************************************************************
+function:	Blend table for anti-aliased text
+parameter:
+    Color_Foreground : Color at full glyph coverage
+    Color_Background : Color at zero coverage
+info:
+    Entry n is the foreground blended over the background at n/15 coverage,
+    in panel byte order, so drawing a glyph pixel is one table lookup. Text
+    uses few color pairs; the last AA_TABLE_CACHE of them are kept.
+******************************************************************************/
+#define AA_LEVELS       16
+#define AA_TABLE_CACHE  4
+
+typedef struct {
+    UWORD Foreground;
+    UWORD Background;
+    UWORD Shade[AA_LEVELS];
+} AA_TABLE;
+
+static AA_TABLE AaTables[AA_TABLE_CACHE];
+static UBYTE AaTablesUsed = 0;
+static UBYTE AaTableNext = 0;
+
+static const UWORD *Paint_BlendTable(UWORD Color_Foreground, UWORD Color_Background)
+{
+    UBYTE i;
+    for (i = 0; i < AaTablesUsed; i++) {
+        if (AaTables[i].Foreground == Color_Foreground && AaTables[i].Background == Color_Background)
+            return AaTables[i].Shade;
+    }
+
+    AA_TABLE *Table = &AaTables[AaTableNext];
+    AaTableNext = (AaTableNext + 1) % AA_TABLE_CACHE;
+    if (AaTablesUsed < AA_TABLE_CACHE)
+        AaTablesUsed++;
+    Table->Foreground = Color_Foreground;
+    Table->Background = Color_Background;
+
+    UWORD Rf = Color_Foreground >> 11, Gf = (Color_Foreground >> 5) & 0x3F, Bf = Color_Foreground & 0x1F;
+    UWORD Rb = Color_Background >> 11, Gb = (Color_Background >> 5) & 0x3F, Bb = Color_Background & 0x1F;
+    for (i = 0; i < AA_LEVELS; i++) {
+        UWORD Inv = AA_LEVELS - 1 - i;
+        UWORD R = (Rf * i + Rb * Inv + 7) / 15;
+        UWORD G = (Gf * i + Gb * Inv + 7) / 15;
+        UWORD B = (Bf * i + Bb * Inv + 7) / 15;
+        Table->Shade[i] = FB_PIXEL((R << 11) | (G << 5) | B);
+    }
+    return Table->Shade;
+}
+
+/******************************************************************************
+function: Pen advance of one character
+******************************************************************************/
+static UWORD Paint_CharAdvance(const sFONT_AA* Font, const char Acsii_Char)
+{
+    if (Font->Advance == NULL)
+        return Font->Width;
+    if (Acsii_Char < ' ' || Acsii_Char > '~')
+        return 0;
+    return Font->Advance[Acsii_Char - ' '];
+}
+
+/******************************************************************************
+function: Kerning between two characters, 0 for most pairs
+******************************************************************************/
+static int8_t Paint_Kerning(const sFONT_AA* Font, const char Left, const char Right)
+{
+    UWORD Pair = ((UBYTE)Left << 8) | (UBYTE)Right;
+    int16_t Low = 0, High = (int16_t)Font->KerningCount - 1;
+    while (Low <= High) {
+        int16_t Mid = (Low + High) / 2;
+        if (Font->Kerning[Mid].Pair == Pair)
+            return Font->Kerning[Mid].Offset;
+        if (Font->Kerning[Mid].Pair < Pair)
+            Low = Mid + 1;
+        else
+            High = Mid - 1;
+    }
+    return 0;
+}
+
+/******************************************************************************
+function: Show an anti-aliased English character
+parameter:
+    Xpoint           ：X coordinate
+    Ypoint           ：Y coordinate
+    Acsii_Char       ：To display the English characters
+    Font             ：4-bpp font, see fonts.h
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    Monospaced fonts paint the whole cell, edge pixels as a mix of the two
+    colors. Proportional glyphs overlap their neighbours' cells, so pixels
+    they do not cover are left alone; draw them over Color_Background.
+******************************************************************************/
+void Paint_DrawCharAA(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
+                      const sFONT_AA* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD Page, Column;
+
+    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
+        Debug("Paint_DrawCharAA Input exceeds the normal display range\r\n");
+        return;
+    }
+    if (Acsii_Char < ' ' || Acsii_Char > '~')
+        return;
+
+    UWORD Row_Bytes = (Font->Width + 1) / 2;
+    const unsigned char *ptr = &Font->table[(Acsii_Char - ' ') * Font->Height * Row_Bytes];
+    const UWORD *Shade = Paint_BlendTable(Color_Foreground, Color_Background);
+    UBYTE Opaque = Font->Advance == NULL;
+
+    if (Paint.Scale == 65 && Paint.Rotate == ROTATE_0 && Paint.Mirror == MIRROR_NONE) {
+        //Unrotated RGB565: one lookup and one store per pixel, straight into the row
+        UWORD Width = Font->Width;
+        if (Xpoint + Width > Paint.WidthMemory)
+            Width = Paint.WidthMemory - Xpoint;
+        for (Page = 0; Page < Font->Height; Page++, ptr += Row_Bytes) {
+            UWORD Y = Ypoint + Page;
+            if (Y < Paint.StripStart || Y >= Paint.StripEnd)
+                continue;
+            UWORD *Dst = (UWORD *)&Paint.Image[(Y - Paint.StripStart)*Paint.WidthByte] + Xpoint;
+            if (!Opaque) {
+                for (Column = 0; Column < Width; Column++) {
+                    UBYTE Level = Column % 2 ? ptr[Column / 2] & 0x0F : ptr[Column / 2] >> 4;
+                    if (Level)
+                        Dst[Column] = Shade[Level];
+                }
+                continue;
+            }
+            for (Column = 0; Column + 1 < Width; Column += 2) {
+                UBYTE Pair = ptr[Column / 2];
+                Dst[Column] = Shade[Pair >> 4];
+                Dst[Column + 1] = Shade[Pair & 0x0F];
+            }
+            if (Column < Width)
+                Dst[Column] = Shade[ptr[Column / 2] >> 4];
+        }
+        return;
+    }
+
+    for (Page = 0; Page < Font->Height; Page++, ptr += Row_Bytes) {
+        for (Column = 0; Column < Font->Width; Column++) {
+            UBYTE Level = Column % 2 ? ptr[Column / 2] & 0x0F : ptr[Column / 2] >> 4;
+            if (Level || Opaque)
+                Paint_SetPixel(Xpoint + Column, Ypoint + Page, FB_PIXEL(Shade[Level]));
+        }
+    }
+}
+
+/******************************************************************************
+function:	Display an anti-aliased string
+parameter:
+    Xstart           ：X coordinate
+    Ystart           ：Y coordinate
+    pString          ：The first address of the English string to be displayed
+    Font             ：4-bpp font, see fonts.h
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    Unlike Paint_DrawString_EN the colors are passed on in the order given.
+    Proportional fonts step by each glyph's advance plus kerning.
+******************************************************************************/
+void Paint_DrawStringAA(UWORD Xstart, UWORD Ystart, const char * pString,
+                        const sFONT_AA* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD Xpoint = Xstart;
+    UWORD Ypoint = Ystart;
+
+    if (Xstart > Paint.Width || Ystart > Paint.Height) {
+        Debug("Paint_DrawStringAA Input exceeds the normal display range\r\n");
+        return;
+    }
+
+    while (* pString != '\0') {
+        UWORD Advance = Paint_CharAdvance(Font, * pString);
+
+        //Wrap and restart exactly as Paint_DrawString_EN does
+        if ((Xpoint + Advance ) > Paint.Width ) {
+            Xpoint = Xstart;
+            Ypoint += Font->Height;
+        }
+        if ((Ypoint  + Font->Height ) > Paint.Height ) {
+            Xpoint = Xstart;
+            Ypoint = Ystart;
+        }
+        Paint_DrawCharAA(Xpoint, Ypoint, * pString, Font, Color_Foreground, Color_Background);
+
+        Xpoint += Advance + Paint_Kerning(Font, pString[0], pString[1]);
+        pString ++;
+    }
+}
+
+/******************************************************************************
+function:	Width of a string in pixels, without drawing it
+parameter:
+    pString          ：The string to measure
+    Font             ：A structure pointer that displays a character size
+info:
+    The sum of the advances (and kerning), so the ink of the last glyph may
+    stop a pixel or two short of it. Wrapping is not taken into account.
+******************************************************************************/
+UWORD Paint_MeasureString(const char * pString, sFONT* Font)
+{
+    return strlen(pString) * Font->Width;
+}
+
+UWORD Paint_MeasureStringAA(const char * pString, const sFONT_AA* Font)
+{
+    int32_t Width = 0;
+    for (; * pString != '\0'; pString++) {
+        Width += Paint_CharAdvance(Font, pString[0]) + Paint_Kerning(Font, pString[0], pString[1]);
+    }
+    return Width > 0 ? Width : 0;
+}
+
+/******************************************************************************
+function:	Left edge of a string aligned between Xstart and Xend
+parameter:
+    Text_Width : From Paint_MeasureString or Paint_MeasureStringAA
+    Align      : TEXT_ALIGN_LEFT, TEXT_ALIGN_CENTER or TEXT_ALIGN_RIGHT
+info:
+    Text wider than the span starts at Xstart.
+******************************************************************************/
+UWORD Paint_AlignString(UWORD Xstart, UWORD Xend, UWORD Text_Width, TEXT_ALIGN Align)
+{
+    if (Xend <= Xstart || Text_Width >= Xend - Xstart || Align == TEXT_ALIGN_LEFT)
+        return Xstart;
+    if (Align == TEXT_ALIGN_RIGHT)
+        return Xend - Text_Width;
+    return Xstart + (Xend - Xstart - Text_Width) / 2;
+}
+
+/******************************************************************************
+function:	Display an anti-aliased string aligned between Xstart and Xend
+parameter:
+    Xstart           ：Left end of the span
+    Xend             ：Right end of the span, exclusive
+    Ystart           ：Y coordinate
+    pString          ：The first address of the English string to be displayed
+    Font             ：4-bpp font, see fonts.h
+    Align            ：TEXT_ALIGN_LEFT, TEXT_ALIGN_CENTER or TEXT_ALIGN_RIGHT
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+******************************************************************************/
+void Paint_DrawStringAlignedAA(UWORD Xstart, UWORD Xend, UWORD Ystart, const char * pString,
+                               const sFONT_AA* Font, TEXT_ALIGN Align,
+                               UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD Xpoint = Paint_AlignString(Xstart, Xend, Paint_MeasureStringAA(pString, Font), Align);
+    Paint_DrawStringAA(Xpoint, Ystart, pString, Font, Color_Foreground, Color_Background);
+}
+
+/******************************************************************************
+function:	Format a fixed-point number as glyph codes
+parameter:
+    Number    : The value times 10^Decimals
+    Decimals  : Digits after the point, 0 for an integer
+    Min_Width : Pad on the left with spaces to this many glyphs
+    Glyphs    : NUM_MAX_GLYPHS codes, 0..9 for the digits then NUM_GLYPH_*
+info:
+    Returns the number of glyphs. Integer math only, one division by ten
+    per digit; the codes index the digit atlases directly.
+******************************************************************************/
+#define NUM_GLYPH_MINUS 10
+#define NUM_GLYPH_POINT 11
+#define NUM_GLYPH_SPACE 12
+#define NUM_GLYPHS      13
+#define NUM_MAX_GLYPHS  16
+
+static const char NumGlyphChars[NUM_GLYPHS] = {
+    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '-', '.', ' '
+};
+
+static UBYTE Paint_FormatNumber(int32_t Number, UBYTE Decimals, UBYTE Min_Width, UBYTE *Glyphs)
+{
+    UBYTE Reversed[NUM_MAX_GLYPHS];
+    UBYTE Count = 0, i;
+    uint32_t Magnitude = Number < 0 ? 0u - (uint32_t)Number : (uint32_t)Number;
+
+    if (Decimals > 9)
+        Decimals = 9;
+    //At least one digit before the point
+    do {
+        Reversed[Count++] = Magnitude % 10;
+        Magnitude /= 10;
+        if (Decimals && Count == Decimals)
+            Reversed[Count++] = NUM_GLYPH_POINT;
+    } while (Magnitude || Count < Decimals + (Decimals ? 2 : 1));
+    if (Number < 0)
+        Reversed[Count++] = NUM_GLYPH_MINUS;
+
+    UBYTE Pad = 0;
+    if (Min_Width > NUM_MAX_GLYPHS)
+        Min_Width = NUM_MAX_GLYPHS;
+    if (Min_Width > Count)
+        Pad = Min_Width - Count;
+    for (i = 0; i < Pad; i++)
+        Glyphs[i] = NUM_GLYPH_SPACE;
+    for (i = 0; i < Count; i++)
+        Glyphs[Pad + i] = Reversed[Count - 1 - i];
+    return Pad + Count;
+}
+
+/******************************************************************************
+function:	Display a fixed-point number
+parameter:
+    Xpoint           ：X coordinate
+    Ypoint           : Y coordinate
+    Number           : The value times 10^Decimals, e.g. 1234 with 2 is 12.34
+    Decimals         : Digits after the point, 0 for an integer
+    Min_Width        : Right-align in this many characters, like "%4d"
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    Returns the width drawn in pixels.
+******************************************************************************/
+UWORD Paint_DrawFixed(UWORD Xpoint, UWORD Ypoint, int32_t Number, UBYTE Decimals, UBYTE Min_Width,
+                      sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UBYTE Glyphs[NUM_MAX_GLYPHS];
+
+    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
+        Debug("Paint_DrawFixed Input exceeds the normal display range\r\n");
+        return 0;
+    }
+
+    UBYTE Count = Paint_FormatNumber(Number, Decimals, Min_Width, Glyphs);
+    for (UBYTE i = 0; i < Count; i++) {
+        Paint_DrawChar(Xpoint + i * Font->Width, Ypoint, NumGlyphChars[Glyphs[i]], Font,
+                       Color_Foreground, Color_Background);
+    }
+    return Count * Font->Width;
+}
+
+/******************************************************************************
+function:	Digit atlas for fast anti-aliased numbers
+parameter:
+    Font             ：4-bpp font, see fonts.h
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    The NUM_GLYPHS number glyphs pre-blended into RGB565 cells (panel byte
+    order) one digit advance wide, so a value update copies rows instead of
+    looking up every pixel. Built on first use, the last DIGIT_ATLAS_CACHE
+    font/color combinations are kept; NULL when out of memory.
+******************************************************************************/
+#define DIGIT_ATLAS_CACHE 4
+
+typedef struct {
+    const sFONT_AA *Font;
+    UWORD Foreground;
+    UWORD Background;
+    UWORD *Pixels;          // NUM_GLYPHS cells of DigitWidth x Height
+} DIGIT_ATLAS;
+
+static DIGIT_ATLAS DigitAtlases[DIGIT_ATLAS_CACHE];
+static UBYTE DigitAtlasNext = 0;
+
+UWORD Paint_DigitWidthAA(const sFONT_AA* Font)
+{
+    return Paint_CharAdvance(Font, '0');
+}
+
+static const UWORD *Paint_DigitAtlas(const sFONT_AA* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UBYTE i;
+    for (i = 0; i < DIGIT_ATLAS_CACHE; i++) {
+        DIGIT_ATLAS *Atlas = &DigitAtlases[i];
+        if (Atlas->Pixels && Atlas->Font == Font &&
+            Atlas->Foreground == Color_Foreground && Atlas->Background == Color_Background)
+            return Atlas->Pixels;
+    }
+
+    UWORD Width = Paint_DigitWidthAA(Font);
+    UDOUBLE Cell = (UDOUBLE)Width * Font->Height;
+    DIGIT_ATLAS *Atlas = &DigitAtlases[DigitAtlasNext];
+    free(Atlas->Pixels);
+    Atlas->Pixels = (UWORD *)malloc(NUM_GLYPHS * Cell * sizeof(UWORD));
+    if (Atlas->Pixels == NULL) {
+        Debug("Paint_DigitAtlas out of memory\r\n");
+        return NULL;
+    }
+    DigitAtlasNext = (DigitAtlasNext + 1) % DIGIT_ATLAS_CACHE;
+    Atlas->Font = Font;
+    Atlas->Foreground = Color_Foreground;
+    Atlas->Background = Color_Background;
+
+    const UWORD *Shade = Paint_BlendTable(Color_Foreground, Color_Background);
+    UWORD Row_Bytes = (Font->Width + 1) / 2;
+    for (i = 0; i < NUM_GLYPHS; i++) {
+        char Acsii_Char = NumGlyphChars[i];
+        const unsigned char *ptr = &Font->table[(Acsii_Char - ' ') * Font->Height * Row_Bytes];
+        UWORD *Dst = &Atlas->Pixels[i * Cell];
+        //Digits share one advance; center the narrower '-' and '.' in it
+        UWORD Advance = Paint_CharAdvance(Font, Acsii_Char);
+        UWORD Shift = Advance < Width ? (Width - Advance) / 2 : 0;
+        for (UWORD Page = 0; Page < Font->Height; Page++, ptr += Row_Bytes) {
+            for (UWORD Column = 0; Column < Width; Column++) {
+                UWORD Source = Column - Shift;
+                UBYTE Level = 0;
+                if (Column >= Shift && Source < Font->Width)
+                    Level = Source % 2 ? ptr[Source / 2] & 0x0F : ptr[Source / 2] >> 4;
+                *Dst++ = Shade[Level];
+            }
+        }
+    }
+    return Atlas->Pixels;
+}
+
+/******************************************************************************
+function:	Display an anti-aliased fixed-point number
+parameter:
+    Xpoint           ：X coordinate
+    Ypoint           : Y coordinate
+    Number           : The value times 10^Decimals, e.g. 1234 with 2 is 12.34
+    Decimals         : Digits after the point, 0 for an integer
+    Min_Width        : Right-align in this many digit cells, like "%4d"
+    Font             ：4-bpp font, see fonts.h
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    Every glyph takes one digit advance, so the digits of a changing value
+    stay in place, and the cells are painted whole. Returns the width drawn
+    in pixels.
+******************************************************************************/
+UWORD Paint_DrawFixedAA(UWORD Xpoint, UWORD Ypoint, int32_t Number, UBYTE Decimals, UBYTE Min_Width,
+                        const sFONT_AA* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    UBYTE Glyphs[NUM_MAX_GLYPHS];
+    UBYTE i;
+
+    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
+        Debug("Paint_DrawFixedAA Input exceeds the normal display range\r\n");
+        return 0;
+    }
+
+    UBYTE Count = Paint_FormatNumber(Number, Decimals, Min_Width, Glyphs);
+    UWORD Width = Paint_DigitWidthAA(Font);
+    UDOUBLE Cell = (UDOUBLE)Width * Font->Height;
+    const UWORD *Atlas = Paint_DigitAtlas(Font, Color_Foreground, Color_Background);
+    if (Atlas == NULL) {
+        for (i = 0; i < Count; i++) {
+            Paint_DrawCharAA(Xpoint + i * Width, Ypoint, NumGlyphChars[Glyphs[i]], Font,
+                             Color_Foreground, Color_Background);
+        }
+        return Count * Width;
+    }
+
+    if (Paint.Scale == 65 && Paint.Rotate == ROTATE_0 && Paint.Mirror == MIRROR_NONE) {
+        //Unrotated RGB565: each glyph row is one copy out of the atlas
+        for (UWORD Page = 0; Page < Font->Height; Page++) {
+            UWORD Y = Ypoint + Page;
+            if (Y < Paint.StripStart || Y >= Paint.StripEnd)
+                continue;
+            UWORD *Row = (UWORD *)&Paint.Image[(Y - Paint.StripStart)*Paint.WidthByte];
+            for (i = 0; i < Count; i++) {
+                UWORD X = Xpoint + i * Width;
+                if (X >= Paint.WidthMemory)
+                    break;
+                UWORD Copy = X + Width > Paint.WidthMemory ? Paint.WidthMemory - X : Width;
+                Blit_Copy565(&Row[X], &Atlas[Glyphs[i] * Cell + Page * Width], Copy);
+            }
+        }
+        return Count * Width;
+    }
+
+    for (i = 0; i < Count; i++) {
+        const UWORD *Src = &Atlas[Glyphs[i] * Cell];
+        for (UWORD Page = 0; Page < Font->Height; Page++) {
+            for (UWORD Column = 0; Column < Width; Column++) {
+                UWORD Pixel = Src[Page * Width + Column];
+                Paint_SetPixel(Xpoint + i * Width + Column, Ypoint + Page, FB_PIXEL(Pixel));
+            }
+        }
+    }
+    return Count * Width;
+}
+
 /******************************************************************************
 function:	Display nummber
 parameter:
@@ -546,65 +1082,32 @@ parameter:
 	Digit						 : Fractional width
     Color_Foreground : Select the foreground color
     Color_Background : Select the background color
+info:
+    Kept for existing callers: the value is truncated to Digit decimals once,
+    saturated to the int32_t range (NaN draws as 0) and drawn by
+    Paint_DrawFixed.
+    The colors are now used as named. The original implementation passed
+    them swapped to Paint_DrawString_EN, so callers written against it got
+    Color_Background text on a Color_Foreground box and must swap theirs.
 ******************************************************************************/
-#define  ARRAY_LEN 255
 void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, double Nummber,
                    sFONT* Font, UWORD Digit,UWORD Color_Foreground, UWORD Color_Background)
 {
-    int16_t Num_Bit = 0, Str_Bit = 0;
-    uint8_t Str_Array[ARRAY_LEN] = {0}, Num_Array[ARRAY_LEN] = {0};
-    uint8_t *pStr = Str_Array;
-	int temp = Nummber>0?Nummber:-Nummber;
-	float decimals;
-	uint8_t i;
-    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
-        Debug("Paint_DisNum Input exceeds the normal display range\r\n");
-        return;
-    }
-
-
-	if(Digit > 0) {		
-		decimals = Nummber>0?Nummber - temp:-(Nummber+temp);
-		for(i=Digit; i > 0; i--) {
-			decimals*=10;
-		}
-		temp = decimals;
-		//Converts a number to a string
-		for(i=Digit; i>0; i--) {
-			Num_Array[Num_Bit] = temp % 10 + '0';
-			Num_Bit++;
-			temp /= 10;						
-		}	
-		Num_Array[Num_Bit] = '.';
-		Num_Bit++;
-	}
-
-	temp = Nummber>0?Nummber:-Nummber;
-    //Converts a number to a string
-    while (temp) {
-        Num_Array[Num_Bit] = temp % 10 + '0';
-        Num_Bit++;
-        temp /= 10;
-    }
-    if((Nummber<1)&&(-1<Nummber))
-    {
-        Num_Array[Num_Bit] = '0';
-        Num_Bit++;
-    }
-	if(Nummber<0)
-    {
-        Num_Array[Num_Bit] = '-';
-        Num_Bit++;
-    }	
-    //The string is inverted
-    while (Num_Bit > 0) {
-        Str_Array[Str_Bit] = Num_Array[Num_Bit - 1];
-        Str_Bit ++;
-        Num_Bit --;
-    }
-
-    //show
-    Paint_DrawString_EN(Xpoint, Ypoint, (const char*)pStr, Font, Color_Background, Color_Foreground);
+    int32_t Scale = 1;
+    if (Digit > 9)
+        Digit = 9;
+    for (UWORD i = 0; i < Digit; i++)
+        Scale *= 10;
+    //Out of range double to int conversion is undefined
+    double Scaled = Nummber * Scale;
+    if (Scaled != Scaled)
+        Scaled = 0;
+    else if (Scaled >= 2147483647.0)
+        Scaled = 2147483647.0;
+    else if (Scaled <= -2147483648.0)
+        Scaled = -2147483648.0;
+    Paint_DrawFixed(Xpoint, Ypoint, (int32_t)Scaled, Digit, 0, Font,
+                    Color_Foreground, Color_Background);
 }
 
 /******************************************************************************
@@ -636,6 +1139,31 @@ void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font,
     
 }
 
+/******************************************************************************
+function: Copy a full-frame image into the current image or strip
+parameter:
+    image : WidthMemory x HeightMemory RGB565 pixels in panel byte order
+info:
+    Scale 65 or 256, no rotation. On the round panel only the visible span
+    of each row is copied.
+******************************************************************************/
+void Paint_DrawFullImage(const UWORD *image)
+{
+    UBYTE Round = RoundMask_Applies(Paint.WidthMemory, Paint.HeightMemory);
+    for (UWORD Y = Paint.StripStart; Y < Paint.StripEnd; Y++) {
+        UWORD Xstart = Round ? RoundMask_SpanStart(Y) : 0;
+        UWORD Xend = Round ? RoundMask_SpanEnd(Y) : Paint.WidthMemory;
+        const UWORD *Src = &image[(UDOUBLE)Y*Paint.WidthMemory];
+        UBYTE *Row = &Paint.Image[(Y - Paint.StripStart)*Paint.WidthByte];
+        if (Paint.Scale == 256) {
+            for (UWORD X = Xstart; X < Xend; X++) {
+                Palette_Store(&Row[X], FB_PIXEL(Src[X]));
+            }
+        } else {
+            Blit_Copy565((UWORD *)&Row[Xstart * 2], &Src[Xstart], Xend - Xstart);
+        }
+    }
+}
 
 void Paint_DrawImage(const unsigned char *image, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image) 
 {
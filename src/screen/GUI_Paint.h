@@ -19,6 +19,8 @@ typedef struct {
     UWORD WidthByte;
     UWORD HeightByte;
     UWORD Scale;
+    UWORD StripStart;   // memory rows held by Image: [StripStart, StripEnd),
+    UWORD StripEnd;     // the whole image unless rendering in strips
 } PAINT;
 extern PAINT Paint;
 
@@ -103,6 +105,15 @@ typedef enum {
     DRAW_FILL_FULL,
 } DRAW_FILL;
 
+/**
+ * Horizontal text alignment
+**/
+typedef enum {
+    TEXT_ALIGN_LEFT = 0,
+    TEXT_ALIGN_CENTER,
+    TEXT_ALIGN_RIGHT,
+} TEXT_ALIGN;
+
 /**
  * Custom structure of a time attribute
 **/
@@ -119,10 +130,11 @@ extern PAINT_TIME sPaint_time;
 //init and Clear
 void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color);
 void Paint_SelectImage(UBYTE *image);
+void Paint_SelectStrip(UBYTE *image, UWORD Ystart, UWORD Yend);
 void Paint_SetRotate(UWORD Rotate);
 void Paint_SetMirroring(UBYTE mirror);
 void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color);
-void Paint_SetScale(UBYTE scale);
+void Paint_SetScale(UWORD scale);
 
 void Paint_Clear(UWORD Color);
 void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
@@ -136,6 +148,15 @@ void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color,
 //Display string
 void Paint_DrawChar(UWORD Xstart, UWORD Ystart, const char Acsii_Char, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawCharAA(UWORD Xstart, UWORD Ystart, const char Acsii_Char, const sFONT_AA* Font, UWORD Color_Foreground, UWORD Color_Background);
+void Paint_DrawStringAA(UWORD Xstart, UWORD Ystart, const char * pString, const sFONT_AA* Font, UWORD Color_Foreground, UWORD Color_Background);
+UWORD Paint_MeasureString(const char * pString, sFONT* Font);
+UWORD Paint_MeasureStringAA(const char * pString, const sFONT_AA* Font);
+UWORD Paint_AlignString(UWORD Xstart, UWORD Xend, UWORD Text_Width, TEXT_ALIGN Align);
+void Paint_DrawStringAlignedAA(UWORD Xstart, UWORD Xend, UWORD Ystart, const char * pString, const sFONT_AA* Font, TEXT_ALIGN Align, UWORD Color_Foreground, UWORD Color_Background);
+UWORD Paint_DrawFixed(UWORD Xpoint, UWORD Ypoint, int32_t Number, UBYTE Decimals, UBYTE Min_Width, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+UWORD Paint_DrawFixedAA(UWORD Xpoint, UWORD Ypoint, int32_t Number, UBYTE Decimals, UBYTE Min_Width, const sFONT_AA* Font, UWORD Color_Foreground, UWORD Color_Background);
+UWORD Paint_DigitWidthAA(const sFONT_AA* Font);
 void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, double Nummber, sFONT* Font, UWORD Digit,UWORD Color_Foreground, UWORD Color_Background);
 void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
 
@@ -143,6 +164,7 @@ void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font,
 void Paint_DrawBitMap(const unsigned char* image_buffer);
 void Paint_DrawBitMap_Block(const unsigned char* image_buffer, UBYTE Region);
 
+void Paint_DrawFullImage(const UWORD *image);
 void Paint_DrawImage(const unsigned char *image, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image) ;
 void Paint_DrawImage1(const unsigned char *image, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image);
  void Paint_BmpWindows(unsigned char x,unsigned char y,const unsigned char *pBmp,\
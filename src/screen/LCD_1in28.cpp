@@ -12,6 +12,10 @@
 *
 ******************************************************************************/
 #include "LCD_1in28.h"
+#include "RoundMask.h"
+#include "FrameBuffer.h"
+#include "Blit.h"
+#include "src/profiler/Profiler.h"
 #include "DEV_Config.h"
 
 #include <stdlib.h>		//itoa()
@@ -19,6 +23,9 @@
 
 LCD_1IN28_ATTRIBUTES LCD_1IN28;
 
+//GRAM writes are dropped while the controller sleeps
+static volatile UBYTE LCD_1IN28_On = 1;
+
 
 /******************************************************************************
 function :	Hardware reset
@@ -362,6 +369,13 @@ void LCD_1IN28_Init(UBYTE Scan_dir)
     
     //Set the initialization register
     LCD_1IN28_InitReg();
+
+    //Only the circle inscribed in the panel is visible
+    RoundMask_Init(LCD_1IN28_WIDTH, LCD_1IN28_HEIGHT, LCD_1IN28_WINDOW_OVERHEAD);
+    UDOUBLE Full = (UDOUBLE)LCD_1IN28_WIDTH * LCD_1IN28_HEIGHT * 2 + LCD_1IN28_WINDOW_OVERHEAD;
+    LOG_I("LCD: round-mask flush %lu bytes/frame instead of %lu (%lu saved, %u windows)",
+          (unsigned long)RoundMask_FlushBytes(), (unsigned long)Full,
+          (unsigned long)(Full - RoundMask_FlushBytes()), RoundMask_BandCount());
 }
 
 /********************************************************************************
@@ -376,16 +390,16 @@ void LCD_1IN28_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
 {
     //set the X coordinates
     LCD_1IN28_SendCommand(0x2A);
-    LCD_1IN28_SendData_8Bit(0x00);
+    LCD_1IN28_SendData_8Bit(Xstart>>8);
     LCD_1IN28_SendData_8Bit(Xstart);
 	LCD_1IN28_SendData_8Bit((Xend-1)>>8);
     LCD_1IN28_SendData_8Bit(Xend-1);
 
     //set the Y coordinates
     LCD_1IN28_SendCommand(0x2B);
-    LCD_1IN28_SendData_8Bit(0x00);
+    LCD_1IN28_SendData_8Bit(Ystart>>8);
 	LCD_1IN28_SendData_8Bit(Ystart);
-	LCD_1IN28_SendData_8Bit((Xend-1)>>8);
+	LCD_1IN28_SendData_8Bit((Yend-1)>>8);
     LCD_1IN28_SendData_8Bit(Yend-1);
 
     LCD_1IN28_SendCommand(0X2C);
@@ -394,59 +408,120 @@ void LCD_1IN28_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
 /******************************************************************************
 function :	Clear screen
 parameter:
+    Image : framebuffer to fill and send, panel byte order
+    Color : RGB565 color
 ******************************************************************************/
-extern UWORD *BlackImage;
-void LCD_1IN28_Clear(UWORD Color)
+void LCD_1IN28_Clear(UWORD *Image, UWORD Color)
 {
-    UWORD j;
-    UWORD *Image = NULL;
-    Image = BlackImage;
+    UWORD i, j;
 
-    Color = ((Color<<8)&0xff00)|(Color>>8);
+    Color = FB_PIXEL(Color);
 
-    for (j = 0; j < LCD_1IN28_HEIGHT*LCD_1IN28_WIDTH; j++) {
-        Image[j] = Color;
+    for (j = 0; j < LCD_1IN28_HEIGHT; j++) {
+        i = RoundMask_SpanStart(j);
+        Blit_Fill565(&Image[j*LCD_1IN28_WIDTH + i], Color, RoundMask_SpanEnd(j) - i);
     }
     
-    LCD_1IN28_SetWindows(0, 0, LCD_1IN28_WIDTH, LCD_1IN28_HEIGHT);
-    DEV_Digital_Write(LCD_DC_PIN, 1);
-    for(j = 0; j < LCD_1IN28_HEIGHT; j++){
-        DEV_SPI_Write_nByte((uint8_t *)&Image[j*LCD_1IN28_WIDTH], LCD_1IN28_WIDTH*2);
-    }
+    LCD_1IN28_Display(Image);
 }
 
 /******************************************************************************
 function :	Sends the image buffer in RAM to displays
 parameter:
 ******************************************************************************/
-void LCD_1IN28_Display(UWORD *Image)
+void LCD_1IN28_Display(const UWORD *Image)
 {
-    UWORD j;
-    LCD_1IN28_SetWindows(0, 0, LCD_1IN28_WIDTH, LCD_1IN28_HEIGHT);
-    DEV_Digital_Write(LCD_DC_PIN, 1);;
-    for (j = 0; j < LCD_1IN28_HEIGHT; j++) {
-        DEV_SPI_Write_nByte((uint8_t *)&Image[j*LCD_1IN28_WIDTH], LCD_1IN28_WIDTH*2);
+    if (!LCD_1IN28_On) return;
+    PROFILE_ZONE("lcd.flush");
+    UWORD i, j;
+    // One window per band of the round mask: wide bands in the middle,
+    // single rows near the top and bottom where the corners are skipped
+    for (i = 0; i < RoundMask_BandCount(); i++) {
+        const ROUND_MASK_BAND *b = RoundMask_Band(i);
+        LCD_1IN28_SetWindows(b->Xstart, b->Ystart, b->Xend, b->Yend);
+        DEV_Digital_Write(LCD_DC_PIN, 1);
+        for (j = b->Ystart; j < b->Yend; j++) {
+            DEV_SPI_Write_nByte((const uint8_t *)&Image[j*LCD_1IN28_WIDTH + b->Xstart], (b->Xend - b->Xstart)*2);
+        }
     }
 }
 
-void LCD_1IN28_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image)
+void LCD_1IN28_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, const UWORD *Image)
 {
-    // display
-    UDOUBLE Addr = 0;
+    LCD_1IN28_DisplayRows(Xstart, Ystart, Xend, Yend,
+                          &Image[Xstart + (UDOUBLE)Ystart * LCD_1IN28_WIDTH], LCD_1IN28_WIDTH);
+}
+
+/******************************************************************************
+function :	Sends a window from any buffer, e.g. a render strip or a sprite
+parameter:
+    Rows   : pixel (Xstart, Ystart), panel byte order
+    Stride : pixels from one row to the next
+******************************************************************************/
+void LCD_1IN28_DisplayRows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, const UWORD *Rows, UWORD Stride)
+{
+    PROFILE_ZONE("lcd.window");
+    if (!LCD_1IN28_StartWindow(Xstart, Ystart, Xend, Yend)) return;
 
     UWORD j;
-    LCD_1IN28_SetWindows(Xstart, Ystart, Xend , Yend);
-    DEV_Digital_Write(LCD_DC_PIN, 1);;
-    for (j = Ystart; j < Yend ; j++) {
-        Addr = Xstart + j * LCD_1IN28_WIDTH ;
-        DEV_SPI_Write_nByte((uint8_t *)&Image[Addr], (Xend-Xstart)*2);
+    for (j = 0; j < Yend - Ystart; j++) {
+        LCD_1IN28_WritePixels(&Rows[(UDOUBLE)j * Stride], Xend - Xstart);
     }
 }
 
+/******************************************************************************
+function :	Opens a window for pixel data written piecewise, e.g. rows
+			converted on the fly. Returns 0 while the panel is off.
+******************************************************************************/
+UBYTE LCD_1IN28_StartWindow(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    if (!LCD_1IN28_On) return 0;
+    LCD_1IN28_SetWindows(Xstart, Ystart, Xend, Yend);
+    DEV_Digital_Write(LCD_DC_PIN, 1);
+    return 1;
+}
+
+void LCD_1IN28_WritePixels(const UWORD *Pixels, UWORD Count)
+{
+    DEV_SPI_Write_nByte((const uint8_t *)Pixels, (UDOUBLE)Count * 2);
+}
+
 
 void LCD_1IN28_DisplayPoint(UWORD X, UWORD Y, UWORD Color)
 {
+    if (!LCD_1IN28_On) return;
     LCD_1IN28_SetWindows(X,Y,X,Y);
     LCD_1IN28_SendData_16Bit(Color);
 }
 
+/******************************************************************************
+function :	Display off (0x28) and sleep in (0x10); GRAM keeps its contents
+parameter:
+******************************************************************************/
+void LCD_1IN28_Sleep(void)
+{
+    LCD_1IN28_On = 0;
+    LCD_1IN28_SendCommand(0x28);
+    LCD_1IN28_SendCommand(0x10);
+}
+
+/******************************************************************************
+function :	Sleep out (0x11). The controller needs 120 ms before the next
+            command, so LCD_1IN28_DisplayOn() is sent separately by the caller
+parameter:
+******************************************************************************/
+void LCD_1IN28_SleepOut(void)
+{
+    LCD_1IN28_SendCommand(0x11);
+}
+
+void LCD_1IN28_DisplayOn(void)
+{
+    LCD_1IN28_SendCommand(0x29);
+    LCD_1IN28_On = 1;
+}
+
+UBYTE LCD_1IN28_IsOn(void)
+{
+    return LCD_1IN28_On;
+}
@@ -25,6 +25,9 @@
 #define LCD_1IN28_HEIGHT 240
 #define LCD_1IN28_WIDTH 240
 
+// Bytes on the bus to set up one window: 0x2A + 4, 0x2B + 4, 0x2C
+#define LCD_1IN28_WINDOW_OVERHEAD 11
+
 
 #define HORIZONTAL 0
 #define VERTICAL   1
@@ -41,8 +44,17 @@ function:
 			Macro definition variable name
 ********************************************************************************/
 void LCD_1IN28_Init(UBYTE Scan_dir);
-void LCD_1IN28_Clear(UWORD Color);
-void LCD_1IN28_Display(UWORD *Image);
-void LCD_1IN28_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image);
+void LCD_1IN28_Clear(UWORD *Image, UWORD Color);
+void LCD_1IN28_Display(const UWORD *Image);
+void LCD_1IN28_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, const UWORD *Image);
+void LCD_1IN28_DisplayRows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, const UWORD *Rows, UWORD Stride);
+UBYTE LCD_1IN28_StartWindow(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+void LCD_1IN28_WritePixels(const UWORD *Pixels, UWORD Count);
 void LCD_1IN28_DisplayPoint(UWORD X, UWORD Y, UWORD Color);
+
+#define LCD_1IN28_SLEEP_OUT_MS 120
+void LCD_1IN28_Sleep(void);
+void LCD_1IN28_SleepOut(void);
+void LCD_1IN28_DisplayOn(void);
+UBYTE LCD_1IN28_IsOn(void);
 #endif
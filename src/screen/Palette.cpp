@@ -0,0 +1,122 @@
+#include "Palette.h"
+#include "FrameBuffer.h"
+#include <string.h>
+
+#define PALETTE_CACHE_SIZE 64
+
+static UWORD Entries[PALETTE_SIZE];     // panel byte order
+static UDOUBLE Counts[PALETTE_SIZE];    // pixels using each entry
+static UWORD CacheColor[PALETTE_CACHE_SIZE];
+static UBYTE CacheIndex[PALETTE_CACHE_SIZE];
+static UDOUBLE Fallbacks = 0;
+
+static const UBYTE CubeLevels[6] = {0, 51, 102, 153, 204, 255};
+
+// Nearest cube entry, straight from the 5/6/5-bit channels
+static UBYTE Palette_CubeIndex(UWORD Color)
+{
+    UWORD R = Color >> 11, G = (Color >> 5) & 0x3F, B = Color & 0x1F;
+    return ((R * 5 + 15) / 31) * 36 + ((G * 5 + 31) / 63) * 6 + (B * 5 + 15) / 31;
+}
+
+void Palette_Init(UDOUBLE Pixels)
+{
+    for (UWORD i = 0; i < PALETTE_CUBE; i++) {
+        UBYTE R = CubeLevels[i / 36], G = CubeLevels[(i / 6) % 6], B = CubeLevels[i % 6];
+        UWORD Color = ((R & 0xF8) << 8) | ((G & 0xFC) << 3) | (B >> 3);
+        Entries[i] = FB_PIXEL(Color);
+    }
+    memset(&Entries[PALETTE_CUBE], 0, (PALETTE_SIZE - PALETTE_CUBE) * sizeof(UWORD));
+    memset(Counts, 0, sizeof(Counts));
+    Counts[0] = Pixels;                 // buffers start out zeroed: black
+    memset(CacheColor, 0, sizeof(CacheColor));
+    memset(CacheIndex, 0, sizeof(CacheIndex));
+    Fallbacks = 0;
+}
+
+UBYTE Palette_Index(UWORD Color)
+{
+    UWORD Panel = FB_PIXEL(Color);
+    UBYTE Slot = (Color ^ (Color >> 6)) % PALETTE_CACHE_SIZE;
+    UBYTE Index = CacheIndex[Slot];
+    // An exact entry may have been handed to another color since; a cube
+    // fallback stays valid
+    if (CacheColor[Slot] == Color && (Entries[Index] == Panel || Index < PALETTE_CUBE)) {
+        return Index;
+    }
+
+    Index = Palette_CubeIndex(Color);
+    if (Entries[Index] != Panel) {
+        int16_t Free = -1;
+        UWORD i;
+        for (i = PALETTE_CUBE; i < PALETTE_SIZE; i++) {
+            if (Counts[i] == 0) {
+                if (Free < 0) Free = i;
+            } else if (Entries[i] == Panel) {
+                break;
+            }
+        }
+        if (i < PALETTE_SIZE) {
+            Index = i;
+        } else if (Free >= 0) {
+            Index = Free;
+            Entries[Index] = Panel;
+        } else {
+            Fallbacks++;
+        }
+    }
+    CacheColor[Slot] = Color;
+    CacheIndex[Slot] = Index;
+    return Index;
+}
+
+UWORD Palette_Color(UBYTE Index)
+{
+    return FB_PIXEL(Entries[Index]);
+}
+
+void Palette_Store(UBYTE *Dst, UWORD Color)
+{
+    UBYTE Index = Palette_Index(Color);
+    Counts[*Dst]--;
+    Counts[Index]++;
+    *Dst = Index;
+}
+
+void Palette_Fill(UBYTE *Dst, UWORD Count, UWORD Color)
+{
+    UBYTE Index = Palette_Index(Color);
+    for (UWORD i = 0; i < Count; i++) {
+        Counts[Dst[i]]--;
+    }
+    Counts[Index] += Count;
+    memset(Dst, Index, Count);
+}
+
+void Palette_ExpandRow(UWORD *Dst, const UBYTE *Src, UWORD Count)
+{
+    UWORD i = 0;
+    for (; i + 4 <= Count; i += 4) {
+        Dst[i] = Entries[Src[i]];
+        Dst[i + 1] = Entries[Src[i + 1]];
+        Dst[i + 2] = Entries[Src[i + 2]];
+        Dst[i + 3] = Entries[Src[i + 3]];
+    }
+    for (; i < Count; i++) {
+        Dst[i] = Entries[Src[i]];
+    }
+}
+
+UWORD Palette_Used(void)
+{
+    UWORD Used = 0;
+    for (UWORD i = PALETTE_CUBE; i < PALETTE_SIZE; i++) {
+        if (Counts[i]) Used++;
+    }
+    return Used;
+}
+
+UDOUBLE Palette_Fallbacks(void)
+{
+    return Fallbacks;
+}
@@ -0,0 +1,35 @@
+#ifndef PALETTE_H
+#define PALETTE_H
+
+#include "DEV_Config.h"
+
+/**
+ * 256-entry palette for the 8-bit indexed framebuffer (GUI_Paint scale
+ * 256). Indices 0..215 are a fixed 6x6x6 color cube; the rest hold exact
+ * RGB565 colors as they are first drawn. Every pixel store goes through
+ * the palette so it can count how many pixels use each entry; an exact
+ * entry is only reused once nothing on screen shows it any more. When all
+ * exact entries are in use a color falls back to its nearest cube entry.
+ * Entries are kept in panel byte order, so a flush expands a row with one
+ * table lookup per pixel.
+**/
+#define PALETTE_SIZE 256
+#define PALETTE_CUBE 216
+
+// Pixels: size of every indexed buffer combined, all starting at index 0.
+void Palette_Init(UDOUBLE Pixels);
+
+UBYTE Palette_Index(UWORD Color);
+UWORD Palette_Color(UBYTE Index);
+
+// Stores into an indexed buffer while keeping the usage counts.
+void Palette_Store(UBYTE *Dst, UWORD Color);
+void Palette_Fill(UBYTE *Dst, UWORD Count, UWORD Color);
+
+// Row of indices to RGB565 in panel byte order.
+void Palette_ExpandRow(UWORD *Dst, const UBYTE *Src, UWORD Count);
+
+UWORD Palette_Used(void);       // exact entries currently on screen
+UDOUBLE Palette_Fallbacks(void); // colors that had to use the cube
+
+#endif // PALETTE_H
@@ -0,0 +1,103 @@
+#include "RoundMask.h"
+#include <string.h>
+
+static UWORD MaskWidth = 0;
+static UWORD MaskHeight = 0;
+static UBYTE SpanStart[ROUND_MASK_MAX_ROWS];
+static ROUND_MASK_BAND Bands[ROUND_MASK_MAX_ROWS];
+static UWORD BandCount = 0;
+static UDOUBLE FlushBytes = 0;
+
+/******************************************************************************
+function:	Build the per-row span table and the flush band plan
+parameter:
+    Width, Height   : Panel size in pixels
+    Window_Overhead : Bytes spent on one LCD window setup (CASET+RASET+RAMWR)
+******************************************************************************/
+void RoundMask_Init(UWORD Width, UWORD Height, UWORD Window_Overhead)
+{
+    if (Height > ROUND_MASK_MAX_ROWS) Height = ROUND_MASK_MAX_ROWS;
+    MaskWidth = Width;
+    MaskHeight = Height;
+
+    // Work in half-pixel units so pixel centers are integers
+    int32_t R = Width < Height ? Width : Height;
+    int32_t R2 = R * R;
+    for (UWORD y = 0; y < Height; y++) {
+        int32_t dy = 2 * y + 1 - (int32_t)Height;
+        UWORD x = 0;
+        while (x < Width / 2) {
+            int32_t dx = 2 * x + 1 - (int32_t)Width;
+            if (dx * dx + dy * dy <= R2) break;
+            x++;
+        }
+        SpanStart[y] = x;
+    }
+
+    // Split rows into bands minimising total bytes. A band's window is as
+    // wide as its widest row. cost[i] = best cost for rows [0, i).
+    static UDOUBLE Cost[ROUND_MASK_MAX_ROWS + 1];
+    static UWORD From[ROUND_MASK_MAX_ROWS + 1];
+    Cost[0] = 0;
+    for (UWORD end = 1; end <= Height; end++) {
+        Cost[end] = 0xFFFFFFFF;
+        UWORD minStart = Width;
+        for (int32_t begin = end - 1; begin >= 0; begin--) {
+            if (SpanStart[begin] < minStart) minStart = SpanStart[begin];
+            UDOUBLE rowBytes = (UDOUBLE)(Width - 2 * minStart) * 2;
+            UDOUBLE c = Cost[begin] + Window_Overhead + rowBytes * (end - begin);
+            if (c < Cost[end]) {
+                Cost[end] = c;
+                From[end] = begin;
+            }
+        }
+    }
+
+    BandCount = 0;
+    for (UWORD end = Height; end > 0; end = From[end]) {
+        BandCount++;
+    }
+    UWORD i = BandCount;
+    for (UWORD end = Height; end > 0; end = From[end]) {
+        ROUND_MASK_BAND *b = &Bands[--i];
+        UWORD minStart = Width;
+        for (UWORD y = From[end]; y < end; y++) {
+            if (SpanStart[y] < minStart) minStart = SpanStart[y];
+        }
+        b->Ystart = From[end];
+        b->Yend = end;
+        b->Xstart = minStart;
+        b->Xend = Width - minStart;
+    }
+    FlushBytes = Cost[Height];
+}
+
+UBYTE RoundMask_Applies(UWORD Width, UWORD Height)
+{
+    return MaskWidth != 0 && Width == MaskWidth && Height == MaskHeight;
+}
+
+UWORD RoundMask_SpanStart(UWORD Y)
+{
+    return Y < MaskHeight ? SpanStart[Y] : 0;
+}
+
+UWORD RoundMask_SpanEnd(UWORD Y)
+{
+    return Y < MaskHeight ? MaskWidth - SpanStart[Y] : MaskWidth;
+}
+
+UWORD RoundMask_BandCount(void)
+{
+    return BandCount;
+}
+
+const ROUND_MASK_BAND* RoundMask_Band(UWORD Index)
+{
+    return &Bands[Index];
+}
+
+UDOUBLE RoundMask_FlushBytes(void)
+{
+    return FlushBytes;
+}
@@ -0,0 +1,32 @@
+#ifndef ROUND_MASK_H
+#define ROUND_MASK_H
+
+#include "DEV_Config.h"
+
+/**
+ * Visible area of the round 240x240 panel. A pixel is visible when its
+ * center lies inside the inscribed circle; each row is a single span
+ * [start, Width - start). About 21% of the frame (the corners) never
+ * shows, so clears, blits and flushes only touch the spans.
+**/
+#define ROUND_MASK_MAX_ROWS 240
+
+typedef struct {
+    UWORD Ystart;   // first row of the band
+    UWORD Yend;     // one past the last row
+    UWORD Xstart;   // window covering the widest row of the band
+    UWORD Xend;
+} ROUND_MASK_BAND;
+
+void RoundMask_Init(UWORD Width, UWORD Height, UWORD Window_Overhead);
+UBYTE RoundMask_Applies(UWORD Width, UWORD Height);
+UWORD RoundMask_SpanStart(UWORD Y);
+UWORD RoundMask_SpanEnd(UWORD Y);
+
+// Rows grouped into LCD windows so that window setup plus pixel bytes is
+// minimal (bands near the middle are full width, the caps are per row).
+UWORD RoundMask_BandCount(void);
+const ROUND_MASK_BAND* RoundMask_Band(UWORD Index);
+UDOUBLE RoundMask_FlushBytes(void);
+
+#endif // ROUND_MASK_H
@@ -0,0 +1,130 @@
+#include "SensorHub.h"
+#include "src/profiler/Profiler.h"
+
+SensorHub* SensorHub::instance = nullptr;
+
+SensorHub::SensorHub(Adafruit_TCS34725& sensor, FlipDetector& flip, uint8_t ledPin)
+    : tcs(sensor), flipDetector(flip), LEDPin(ledPin) {}
+
+void SensorHub::begin(TaskScheduler& uiScheduler, uint8_t uiTaskId,
+                      uint32_t samplePeriod, uint32_t flipCheck,
+                      uint32_t ambientPeriod) {
+    instance = this;
+    ui = &uiScheduler;
+    uiTask = uiTaskId;
+    samplePeriodMs = samplePeriod;
+    flipCheckMs = flipCheck;
+    ambientPeriodMs = ambientPeriod;
+
+    // Tasks are registered here so setMode() can be used before the
+    // acquisition task has had a chance to run.
+    cmdTask = scheduler.addTask("s.cmd", onCommand);
+    flipTask = scheduler.addTask("s.flip", onFlipCheck, flipCheckMs);
+    sampleTask = scheduler.addTask("s.sample", onSample, samplePeriodMs);
+    ambientTask = scheduler.addTask("s.ambient", onAmbient, ambientPeriodMs);
+    applyMode(SENSOR_MODE_IDLE);
+    flipDetector.onInterrupt(onImuIrq);
+
+    xTaskCreatePinnedToCore(taskEntry, "sensors", 4096, this, 2, nullptr, SENSOR_CORE);
+}
+
+void SensorHub::setMode(SensorMode mode) {
+    commands.push(mode);
+    scheduler.trigger(cmdTask);
+}
+
+void SensorHub::taskEntry(void* arg) {
+    static_cast<SensorHub*>(arg)->run();
+}
+
+void SensorHub::run() {
+    scheduler.begin();
+    for (;;) {
+        scheduler.runDue();
+        scheduler.sleepUntilNextDeadline();
+    }
+}
+
+void IRAM_ATTR SensorHub::onImuIrq() {
+    instance->scheduler.triggerFromISR(instance->flipTask);
+}
+
+void SensorHub::imuWake() {
+    flipDetector.markPending();
+    scheduler.trigger(flipTask);
+}
+
+void SensorHub::colorWake() {
+    scheduler.trigger(sampleTask);
+}
+
+void SensorHub::onCommand() {
+    SensorMode mode;
+    while (instance->commands.pop(mode)) {
+        instance->applyMode(mode);
+    }
+}
+
+void SensorHub::onFlipCheck() {
+    if (instance->flipDetector.isFlipped()) {
+        instance->events.push({SENSOR_EVENT_FLIPPED, millis(), 0});
+        instance->notifyUi();
+    }
+    if (instance->flipDetector.takeMotionStart()) {
+        instance->events.push({SENSOR_EVENT_MOTION, millis(), 0});
+        instance->notifyUi();
+    }
+}
+
+void SensorHub::onSample() {
+    instance->sampleColor();
+}
+
+void SensorHub::onAmbient() {
+    instance->sampleAmbient();
+}
+
+void SensorHub::applyMode(SensorMode mode) {
+    // The FIFO filled up and stopped while flip checks were off; judge the
+    // flip on live frames rather than on whatever was queued at boot
+    if (mode == SENSOR_MODE_WAIT_FLIP && this->mode != SENSOR_MODE_WAIT_FLIP) flipDetector.restart();
+    this->mode = mode;
+    scheduler.setEnabled(flipTask, mode == SENSOR_MODE_WAIT_FLIP);
+    scheduler.setEnabled(sampleTask, mode == SENSOR_MODE_SAMPLING);
+    // While sampling the sensor faces the cup contents, not the room
+    scheduler.setEnabled(ambientTask, ambientPeriodMs > 0 && mode != SENSOR_MODE_SAMPLING);
+}
+
+void SensorHub::sampleColor() {
+    PROFILE_ZONE("color.sample");
+    ColorSample s;
+
+    // light the TCS LED briefly for a stable reading
+    digitalWrite(LEDPin, HIGH);
+    delay(3);
+    tcs.getRawData(&s.r, &s.g, &s.b, &s.c);
+    digitalWrite(LEDPin, LOW);
+    // Release INT so the next integration can wake the chip again
+    tcs.clearInterrupt();
+    s.t = millis();
+
+    samples.push(s);
+    notifyUi();
+}
+
+void SensorHub::sampleAmbient() {
+    // Outside SAMPLING the LED is off, so the integration the TCS last
+    // completed is already an ambient reading. Fetch it straight from the
+    // data registers: getRawData() would wait out a whole integration on
+    // this task, stalling the flip checks behind it. INT is left latched,
+    // so it does not wake the chip for readings nobody is waiting on.
+    digitalWrite(LEDPin, LOW);
+    if (!(tcs.read8(TCS34725_STATUS) & TCS34725_STATUS_AVALID)) return;
+    uint16_t c = tcs.read16(TCS34725_CDATAL);
+    events.push({SENSOR_EVENT_AMBIENT, millis(), c});
+    notifyUi();
+}
+
+void SensorHub::notifyUi() {
+    if (ui) ui->trigger(uiTask);
+}
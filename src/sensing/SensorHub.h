@@ -0,0 +1,102 @@
+#ifndef SENSOR_HUB_H
+#define SENSOR_HUB_H
+
+#include <Arduino.h>
+#include <Adafruit_TCS34725.h>
+#include "src/flipsensor/FlipDetector.h"
+#include "src/scheduler/TaskScheduler.h"
+#include "src/scheduler/SpscQueue.h"
+
+// Core the acquisition task is pinned to. The Arduino loop (rendering and
+// BLE notifications) runs on ARDUINO_RUNNING_CORE, i.e. the other one.
+#define SENSOR_CORE 0
+
+struct ColorSample {
+    uint16_t r, g, b, c;
+    uint32_t t;
+};
+
+enum SensorEventType : uint8_t {
+    SENSOR_EVENT_FLIPPED,
+    SENSOR_EVENT_MOTION,   // wake-on-motion fired
+    SENSOR_EVENT_AMBIENT   // value = clear channel with the LED off
+};
+
+struct SensorEvent {
+    SensorEventType type;
+    uint32_t t;
+    uint16_t value;
+};
+
+enum SensorMode : uint8_t {
+    SENSOR_MODE_IDLE,
+    SENSOR_MODE_WAIT_FLIP,
+    SENSOR_MODE_SAMPLING
+};
+
+// Owns color and IMU acquisition on its own FreeRTOS task and core. Results
+// cross to the UI core through SPSC queues, so a slow frame or a congested
+// BLE link never delays a sensor read.
+class SensorHub {
+public:
+    SensorHub(Adafruit_TCS34725& sensor, FlipDetector& flip, uint8_t ledPin);
+
+    // uiTask on uiScheduler is triggered whenever new data is queued.
+    // Flip checks are driven by IMU interrupts; flipCheckMs is only a
+    // fallback in case an edge is missed.
+    // While not sampling, the clear channel is read with the LED off every
+    // ambientPeriodMs (0 disables) as an ambient light level.
+    void begin(TaskScheduler& uiScheduler, uint8_t uiTask,
+               uint32_t samplePeriodMs, uint32_t flipCheckMs,
+               uint32_t ambientPeriodMs = 0);
+
+    // Called from the UI core.
+    void setMode(SensorMode mode);
+    bool popSample(ColorSample& sample) { return samples.pop(sample); }
+    bool popEvent(SensorEvent& event) { return events.pop(event); }
+    uint32_t droppedSamples() const { return samples.dropped(); }
+
+    TaskScheduler& taskScheduler() { return scheduler; }
+
+    // Called from the UI core after a light-sleep wake on a sensor line,
+    // whose edge interrupt did not fire while the chip was asleep.
+    void imuWake();
+    void colorWake();
+
+private:
+    Adafruit_TCS34725& tcs;
+    FlipDetector& flipDetector;
+    uint8_t LEDPin;
+
+    TaskScheduler scheduler;
+    TaskScheduler* ui = nullptr;
+    uint8_t uiTask = TaskScheduler::INVALID_TASK;
+    uint32_t samplePeriodMs = 0;
+    uint32_t flipCheckMs = 0;
+    uint8_t cmdTask = TaskScheduler::INVALID_TASK;
+    uint8_t flipTask = TaskScheduler::INVALID_TASK;
+    uint8_t sampleTask = TaskScheduler::INVALID_TASK;
+    uint8_t ambientTask = TaskScheduler::INVALID_TASK;
+    uint32_t ambientPeriodMs = 0;
+    SensorMode mode = SENSOR_MODE_IDLE;
+
+    SpscQueue<SensorMode, 4> commands;    // UI -> sensor
+    SpscQueue<ColorSample, 16> samples;   // sensor -> UI
+    SpscQueue<SensorEvent, 8> events;     // sensor -> UI
+
+    static SensorHub* instance;
+    static void taskEntry(void* arg);
+    static void onCommand();
+    static void onFlipCheck();
+    static void IRAM_ATTR onImuIrq();
+    static void onSample();
+    static void onAmbient();
+
+    void run();
+    void applyMode(SensorMode mode);
+    void sampleColor();
+    void sampleAmbient();
+    void notifyUi();
+};
+
+#endif // SENSOR_HUB_H
@@ -0,0 +1,17 @@
+#ifndef SENSOR_TIMING_H
+#define SENSOR_TIMING_H
+
+#include <stdint.h>
+
+// Boot and acquisition timing shared by the sketch and the host boot
+// benchmark (test/boot_benchmark.cpp), which replays it to track the time
+// to first measurement.
+static const uint32_t SPLASH_MS = 3000;
+static const uint32_t SAMPLE_PERIOD_MS = 200;    // send 5 Hz; tweak as needed
+static const uint32_t FLIP_CHECK_MS = 1000;      // fallback, the IMU interrupts drive flip checks
+static const uint32_t AMBIENT_PERIOD_MS = 10000;
+
+// TCS34725 integration time; expands where Adafruit_TCS34725.h is included
+#define COLOR_INTEGRATION_TIME TCS34725_INTEGRATIONTIME_360MS
+
+#endif // SENSOR_TIMING_H
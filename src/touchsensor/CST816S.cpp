@@ -23,7 +23,6 @@
 */
 
 #include "Arduino.h"
-#include <Wire.h>
 #include <FunctionalInterrupt.h>
 
 #include "CST816S.h"
@@ -50,18 +49,34 @@ CST816S::CST816S(int sda, int scl, int rst, int irq) {
 }
 
 /*!
-    @brief  read touch data
+    @brief  queue a read of the touch report, completed on the I2C bus task
 */
 void CST816S::read_touch() {
-  byte data_raw[8];
-  delay(10);  // small delay to give chip time to wake
-  i2c_read(CST816S_ADDRESS, 0x02, data_raw, 6);
+  // No settle delay needed: the IRQ only fires once the report is ready
+  _read_pending = true;
+  if (!_bus->readAsync(_addr, 0x02, _raw, 6, on_read_done, this)) {
+    _read_pending = false;
+    _event_available = true;  // queue full, retry on the next call
+  }
+}
+
+void CST816S::on_read_done(void *ctx, I2CStatus status) {
+  CST816S *self = static_cast<CST816S *>(ctx);
+  self->_read_pending = false;
+  if (status != I2C_OK) return;
+  self->_report_ready = true;
+  if (self->_report_callback) self->_report_callback();
+}
 
-  data.gestureID = data_raw[0];
-  data.points = data_raw[1];
-  data.event = data_raw[2] >> 6;
-  data.x = ((data_raw[2] & 0xF) << 8) + data_raw[3];
-  data.y = ((data_raw[4] & 0xF) << 8) + data_raw[5];
+/*!
+    @brief  decode a 6-byte report starting at register 0x02
+*/
+void CST816S::parse_report(const byte *raw) {
+  data.gestureID = raw[0];
+  data.points = raw[1];
+  data.event = raw[2] >> 6;
+  data.x = ((raw[2] & 0xF) << 8) + raw[3];
+  data.y = ((raw[4] & 0xF) << 8) + raw[5];
 }
 
 /*!
@@ -69,7 +84,25 @@ void CST816S::read_touch() {
 */
 void IRAM_ATTR CST816S::handleISR(void) {
   _event_available = true;
+  if (_irq_callback) _irq_callback();
+}
+
+/*!
+    @brief  register a hook that runs from the interrupt handler
+	@param	cb
+			callback, must be IRAM safe
+*/
+void CST816S::onInterrupt(void (*cb)()) {
+  _irq_callback = cb;
+}
 
+/*!
+    @brief  register a hook that runs once an async report read has completed
+	@param	cb
+			callback, runs on the I2C bus task
+*/
+void CST816S::onReport(void (*cb)()) {
+  _report_callback = cb;
 }
 
 /*!
@@ -77,8 +110,8 @@ void IRAM_ATTR CST816S::handleISR(void) {
 	@param	interrupt
 			type of interrupt FALLING, RISING..
 */
-void CST816S::begin(TwoWire &wire, int interrupt) {
-  _wire = &wire;
+void CST816S::begin(I2CBus &bus, int interrupt) {
+  _bus = &bus;
 
   pinMode(_irq, INPUT_PULLUP);
   pinMode(_rst, OUTPUT);
@@ -91,10 +124,19 @@ void CST816S::begin(TwoWire &wire, int interrupt) {
   delay(50);
 
   detectAddress();
+  // Touch reports are what the user waits on; they go ahead of IMU bursts
+  _bus->addDevice("cst816s", _addr, I2C_PRIORITY_HIGH);
   i2c_read(_addr, 0x15, &data.version, 1);
   delay(5);
   i2c_read(_addr, 0xA7, data.versionInfo, 3);
 
+  // Pulse IRQ for every touch report and on state changes, and keep the
+  // controller out of auto-sleep so lift-off is reported too
+  byte irq_ctl = CST816S_IRQ_EN_TOUCH | CST816S_IRQ_EN_CHANGE;
+  i2c_write(_addr, CST816S_REG_IRQ_CTL, &irq_ctl, 1);
+  byte no_sleep = 0x01;
+  i2c_write(_addr, CST816S_REG_DIS_AUTO_SLEEP, &no_sleep, 1);
+
   attachInterrupt(_irq, std::bind(&CST816S::handleISR, this), interrupt);
 }
 
@@ -102,12 +144,17 @@ void CST816S::begin(TwoWire &wire, int interrupt) {
     @brief  check for a touch event
 */
 bool CST816S::available() {
-  if (_event_available) {
-    read_touch();
+  // Take the finished report out of _raw before the next read can land in it
+  bool ready = _report_ready;
+  if (ready) {
+    parse_report(_raw);
+    _report_ready = false;
+  }
+  if (_event_available && !_read_pending) {
     _event_available = false;
-    return true;
+    read_touch();
   }
-  return false;
+  return ready;
 }
 
 bool CST816S::poll() {
@@ -122,11 +169,7 @@ bool CST816S::poll() {
   if (data_raw[1] == 0) {
     return false;
   }
-  data.gestureID = data_raw[0];
-  data.points = data_raw[1];
-  data.event = data_raw[2] >> 6;
-  data.x = ((data_raw[2] & 0xF) << 8) + data_raw[3];
-  data.y = ((data_raw[4] & 0xF) << 8) + data_raw[5];
+  parse_report(data_raw);
   return true;
 }
 
@@ -209,22 +252,8 @@ String CST816S::gesture() {
 uint8_t CST816S::i2c_read(uint16_t addr, uint8_t reg_addr, uint8_t *reg_data, uint32_t length)
 {
   for (int attempt = 0; attempt < 3; attempt++) {
-    _wire->beginTransmission(addr);
-    _wire->write(reg_addr);
-    if (_wire->endTransmission(false) != 0) { // repeated start
-      delay(5);
-      continue;
-    }
-
-    if (_wire->requestFrom((uint8_t)addr, (uint8_t)length, (uint8_t)true) != length) {
-      delay(5);
-      continue;
-    }
-
-    for (int i = 0; i < length; i++) {
-      reg_data[i] = _wire->read();
-    }
-    return 0; // success
+    if (_bus->read(addr, reg_addr, reg_data, length) == I2C_OK) return 0; // success
+    delay(5);
   }
   return -1; // fail after retries
 }
@@ -244,11 +273,6 @@ uint8_t CST816S::i2c_read(uint16_t addr, uint8_t reg_addr, uint8_t *reg_data, ui
 */
 uint8_t CST816S::i2c_write(uint8_t addr, uint8_t reg_addr, const uint8_t *reg_data, uint32_t length)
 {
-  _wire->beginTransmission(addr);
-  _wire->write(reg_addr);
-  for (int i = 0; i < length; i++) {
-    _wire->write(*reg_data++);
-  }
-  if ( _wire->endTransmission(true))return -1;
+  if (_bus->write(addr, reg_addr, reg_data, length) != I2C_OK) return -1;
   return 0;
 }
@@ -26,10 +26,15 @@
 #define CST816S_H
 
 #include <Arduino.h>
-#include <Wire.h>
+#include "src/i2c/I2CBus.h"
 
 #define CST816S_ADDRESS     0x15
 
+#define CST816S_REG_IRQ_CTL         0xFA
+#define CST816S_REG_DIS_AUTO_SLEEP  0xFE
+#define CST816S_IRQ_EN_TOUCH        0x40
+#define CST816S_IRQ_EN_CHANGE       0x20
+
 enum GESTURE {
   NONE = 0x00,
   SWIPE_UP = 0x01,
@@ -58,27 +63,37 @@ class CST816S {
 
   public:
     CST816S(int sda, int scl, int rst, int irq);
-    void begin(TwoWire &wire, int interrupt = RISING);
+    void begin(I2CBus &bus, int interrupt = RISING);
     void sleep();
     bool available();
     bool probe();
     bool poll();  // poll over I2C when IRQ isn't firing
     bool detectAddress();  // try common addresses
+    uint8_t address() const { return _addr; }
+    void onInterrupt(void (*cb)());  // called from the IRQ handler, keep it short
+    void onReport(void (*cb)());     // called from the I2C bus task once a report is read
     data_struct data;
     String gesture();
 
 
   private:
-    TwoWire *_wire;
+    I2CBus *_bus;
     int _sda;
     int _scl;
     int _rst;
     int _irq;
     uint8_t _addr = CST816S_ADDRESS;
-    bool _event_available;
+    volatile bool _event_available;
+    volatile bool _read_pending = false;
+    volatile bool _report_ready = false;
+    byte _raw[6];
+    void (*_irq_callback)() = nullptr;
+    void (*_report_callback)() = nullptr;
 
     void IRAM_ATTR handleISR();
     void read_touch();
+    void parse_report(const byte *raw);
+    static void on_read_done(void *ctx, I2CStatus status);
 
     uint8_t i2c_read(uint16_t addr, uint8_t reg_addr, uint8_t * reg_data, uint32_t length);
     uint8_t i2c_write(uint8_t addr, uint8_t reg_addr, const uint8_t * reg_data, uint32_t length);
@@ -0,0 +1,90 @@
+#include "GestureRecognizer.h"
+
+static int32_t iabs(int32_t v) {
+    return v < 0 ? -v : v;
+}
+
+// px/s over at least 1 ms; a flick across the panel between two reports
+// exceeds int16_t, so saturate rather than wrap to the opposite sign
+static int16_t velocity(int32_t d, uint32_t ms) {
+    int32_t v = d * 1000 / (int32_t)ms;
+    if (v > INT16_MAX) return INT16_MAX;
+    if (v < INT16_MIN) return INT16_MIN;
+    return (int16_t)v;
+}
+
+const char* GestureRecognizer::name(TouchGesture g) {
+    switch (g) {
+        case TOUCH_GESTURE_TAP:         return "TAP";
+        case TOUCH_GESTURE_LONG_PRESS:  return "LONG PRESS";
+        case TOUCH_GESTURE_SWIPE_UP:    return "SWIPE UP";
+        case TOUCH_GESTURE_SWIPE_DOWN:  return "SWIPE DOWN";
+        case TOUCH_GESTURE_SWIPE_LEFT:  return "SWIPE LEFT";
+        case TOUCH_GESTURE_SWIPE_RIGHT: return "SWIPE RIGHT";
+        default:                        return "NONE";
+    }
+}
+
+bool GestureRecognizer::feed(const TouchEvent& ev, GestureEvent& out) {
+    if (state == IDLE) {
+        if (ev.type == TOUCH_UP) return false;
+        state = PRESSED;
+        start = ev;
+        last = ev;
+        return false;
+    }
+
+    if (ev.type == TOUCH_UP) {
+        last.t = ev.t;
+        return release(ev.t, out);
+    }
+    last = ev;
+    return false;
+}
+
+bool GestureRecognizer::tick(uint32_t now, GestureEvent& out) {
+    if (state == IDLE) return false;
+
+    if (now - last.t > RELEASE_TIMEOUT_MS) {
+        return release(last.t, out);
+    }
+
+    int32_t dx = (int32_t)last.x - start.x;
+    int32_t dy = (int32_t)last.y - start.y;
+    if (state == PRESSED && now - start.t >= LONG_PRESS_MS &&
+        iabs(dx) <= TAP_SLOP_PX && iabs(dy) <= TAP_SLOP_PX) {
+        state = LONG_PRESSED;
+        out = {TOUCH_GESTURE_LONG_PRESS, start.x, start.y, 0, 0, now - start.t};
+        return true;
+    }
+    return false;
+}
+
+bool GestureRecognizer::release(uint32_t t, GestureEvent& out) {
+    State was = state;
+    state = IDLE;
+    if (was == LONG_PRESSED) return false;  // already reported
+
+    int32_t dx = (int32_t)last.x - start.x;
+    int32_t dy = (int32_t)last.y - start.y;
+    uint32_t duration = t - start.t;
+    uint32_t ms = duration ? duration : 1;
+
+    out.x = start.x;
+    out.y = start.y;
+    out.durationMs = duration;
+    out.vx = velocity(dx, ms);
+    out.vy = velocity(dy, ms);
+
+    if (iabs(dx) > iabs(dy) && iabs(dx) > SWIPE_MIN_PX) {
+        out.type = dx > 0 ? TOUCH_GESTURE_SWIPE_RIGHT : TOUCH_GESTURE_SWIPE_LEFT;
+    } else if (iabs(dy) > SWIPE_MIN_PX) {
+        out.type = dy > 0 ? TOUCH_GESTURE_SWIPE_DOWN : TOUCH_GESTURE_SWIPE_UP;
+    } else if (iabs(dx) <= TAP_SLOP_PX && iabs(dy) <= TAP_SLOP_PX && duration < LONG_PRESS_MS) {
+        out.type = TOUCH_GESTURE_TAP;
+        out.vx = out.vy = 0;
+    } else {
+        return false;
+    }
+    return true;
+}
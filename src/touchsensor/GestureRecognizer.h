@@ -0,0 +1,60 @@
+#ifndef GESTURE_RECOGNIZER_H
+#define GESTURE_RECOGNIZER_H
+
+#include <stdint.h>
+
+enum TouchEventType : uint8_t {
+    TOUCH_DOWN = 0,
+    TOUCH_UP = 1,
+    TOUCH_CONTACT = 2
+};
+
+struct TouchEvent {
+    uint16_t x, y;
+    TouchEventType type;
+    uint32_t t;  // ms
+};
+
+enum TouchGesture : uint8_t {
+    TOUCH_GESTURE_NONE,
+    TOUCH_GESTURE_TAP,
+    TOUCH_GESTURE_LONG_PRESS,
+    TOUCH_GESTURE_SWIPE_UP,
+    TOUCH_GESTURE_SWIPE_DOWN,
+    TOUCH_GESTURE_SWIPE_LEFT,
+    TOUCH_GESTURE_SWIPE_RIGHT
+};
+
+struct GestureEvent {
+    TouchGesture type;
+    uint16_t x, y;        // where the touch started
+    int16_t vx, vy;       // average swipe velocity, px/s, saturated
+    uint32_t durationMs;
+};
+
+// Small state machine turning raw touch reports into gestures. Long press
+// and lift-off timeouts need tick() to be called while a touch is active.
+class GestureRecognizer {
+public:
+    // Returns true and fills out when a gesture completes.
+    bool feed(const TouchEvent& ev, GestureEvent& out);
+    bool tick(uint32_t now, GestureEvent& out);
+    bool isPressed() const { return state != IDLE; }
+
+    static const char* name(TouchGesture g);
+
+private:
+    static const uint16_t TAP_SLOP_PX = 12;
+    static const uint16_t SWIPE_MIN_PX = 30;
+    static const uint32_t LONG_PRESS_MS = 600;
+    static const uint32_t RELEASE_TIMEOUT_MS = 150;  // no report => finger lifted
+
+    enum State : uint8_t { IDLE, PRESSED, LONG_PRESSED };
+    State state = IDLE;
+    TouchEvent start = {0, 0, TOUCH_DOWN, 0};
+    TouchEvent last = {0, 0, TOUCH_DOWN, 0};
+
+    bool release(uint32_t t, GestureEvent& out);
+};
+
+#endif // GESTURE_RECOGNIZER_H
@@ -2,18 +2,17 @@
 
 TouchManager::TouchManager(CST816S& touchDriver) : touch(touchDriver) {}
 
-static void scanI2CBus(TwoWire& bus) {
+static void scanI2CBus(I2CBus& bus) {
     Serial.println("TouchManager: I2C scan start");
     for (uint8_t addr = 1; addr < 0x7F; addr++) {
-        bus.beginTransmission(addr);
-        if (bus.endTransmission() == 0) {
+        if (bus.writeRaw(addr, nullptr, 0) == I2C_OK) {
             Serial.printf("  found device at 0x%02X\n", addr);
         }
     }
     Serial.println("TouchManager: I2C scan done");
 }
 
-void TouchManager::begin(TwoWire& bus) {
+void TouchManager::begin(I2CBus& bus) {
     touch.begin(bus, FALLING);
     if (touch.detectAddress() && touch.probe()) {
         Serial.println("TouchManager: CST816S detected");
@@ -23,45 +22,38 @@ void TouchManager::begin(TwoWire& bus) {
     }
 }
 
-static String deriveGesture(uint16_t prevX, uint16_t prevY, uint16_t x, uint16_t y, const String& rawGesture) {
-    const int threshold = 30;
-    int dx = (int)x - (int)prevX;
-    int dy = (int)y - (int)prevY;
-    if (abs(dx) > abs(dy) && abs(dx) > threshold) {
-        return dx > 0 ? "SWIPE RIGHT" : "SWIPE LEFT";
-    } else if (abs(dy) > threshold) {
-        return dy > 0 ? "SWIPE DOWN" : "SWIPE UP";
-    }
-    return rawGesture;
-}
-
-bool TouchManager::isTouched() {
-    static unsigned long lastPollMs = 0;
+bool TouchManager::update() {
     bool got = false;
+    GestureEvent g;
 
-    if (touch.available()) {
+    // One read per flagged IRQ; reports that arrive while a read is in
+    // flight coalesce into the latest position, which is all a gesture needs
+    bool requested = readRequested;
+    readRequested = false;
+    if (touch.available() || (requested && touch.poll())) {
+        TouchEvent ev;
+        ev.x = touch.data.x;
+        ev.y = touch.data.y;
+        ev.type = touch.data.event <= TOUCH_CONTACT ? (TouchEventType)touch.data.event : TOUCH_CONTACT;
+        ev.t = millis();
+        lastX = ev.x;
+        lastY = ev.y;
         got = true;
-    } else {
-        unsigned long now = millis();
-        if (now - lastPollMs >= 50) {  // throttle polling to reduce I2C spam
-            got = touch.poll();
-            lastPollMs = now;
+        if (recognizer.feed(ev, g)) {
+            lastGestureType = g.type;
+            gestures.push(g);
         }
     }
 
-    if (got) {
-        prevX = lastX;
-        prevY = lastY;
-        lastX = touch.data.x;
-        lastY = touch.data.y;
-        lastGestureName = deriveGesture(prevX, prevY, lastX, lastY, touch.gesture());
-        return true;
+    if (recognizer.tick(millis(), g)) {
+        lastGestureType = g.type;
+        gestures.push(g);
     }
-    return false;
+    return got;
 }
 
-bool TouchManager::isTouchInRegion(const TouchRegion& region) {
-    return isTouched() &&
+bool TouchManager::isTouchInRegion(const TouchRegion& region) const {
+    return isPressed() &&
            lastX >= region.x &&
            lastX <= region.x + region.w &&
            lastY >= region.y &&
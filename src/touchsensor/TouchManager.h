@@ -3,29 +3,51 @@
 
 #include <Arduino.h>
 #include "sensors.h"  // for CST816S
+#include "src/scheduler/SpscQueue.h"
+#include "GestureRecognizer.h"
 
 struct TouchRegion {
     int x, y, w, h;
 };
 
+// Interrupt-driven touch input. The CST816S IRQ only flags a pending report;
+// update() runs from the touch task and queues one async read per flagged
+// report on the I2C bus task. The finished report (signalled through
+// CST816S::onReport) feeds the gesture recognizer on the next update(), so
+// the loop never waits on the bus.
 class TouchManager {
 public:
     TouchManager(CST816S& touchDriver);
 
-    void begin(TwoWire& bus);
-    bool isTouched();
-    bool isTouchInRegion(const TouchRegion& region);
+    void begin(I2CBus& bus);
+
+    // Drain pending reports and advance the recognizer. Returns true when a
+    // new touch report was read (i.e. user interaction).
+    bool update();
+    bool popGesture(GestureEvent& out) { return gestures.pop(out); }
+    // Makes the next update() poll the controller even without a flagged
+    // IRQ; the edge is lost when it wakes the chip from light-sleep.
+    void requestRead() { readRequested = true; }
+
+    // True while a finger is down; update() needs periodic calls meanwhile
+    // so long presses and lift-off timeouts are detected.
+    bool isPressed() const { return recognizer.isPressed(); }
+    bool isTouchInRegion(const TouchRegion& region) const;
     uint16_t getTouchX() const;
     uint16_t getTouchY() const;
-    String getGestureName() const { return lastGestureName; }
+    TouchGesture lastGesture() const { return lastGestureType; }
+    uint32_t droppedEvents() const { return gestures.dropped(); }
+
+    static const char* gestureName(TouchGesture g) { return GestureRecognizer::name(g); }
 
 private:
     CST816S& touch;
+    GestureRecognizer recognizer;
+    SpscQueue<GestureEvent, 8> gestures;
     uint16_t lastX = 0;
     uint16_t lastY = 0;
-    uint16_t prevX = 0;
-    uint16_t prevY = 0;
-    String lastGestureName = "NONE";
+    TouchGesture lastGestureType = TOUCH_GESTURE_NONE;
+    volatile bool readRequested = false;
 };
 
 #endif  // TOUCH_MANAGER_H
@@ -0,0 +1,78 @@
+#include "ColorGauge.h"
+
+static const UWORD HISTORY_COLORS[3] = {RED, GREEN, BLUE};
+
+// Each row is a fixed "R: ... = ..... raw" label in the monospaced font with
+// the two numbers as readouts over its gaps
+static const int16_t CELL = 8;          // FontAA16.Width
+static const int16_t ROW_X = 48;
+static const char* const ROW_FORMAT[3] = {"R:     =       raw", "G:     =       raw",
+                                          "B:     =       raw"};
+static const int16_t VALUE_X = ROW_X + 3 * CELL;
+static const int16_t RAW_X = ROW_X + 9 * CELL;
+
+static void clearScreen() {
+    Paint_Clear(WHITE);
+}
+
+ColorGauge::ColorGauge()
+    : title(45, 28, 150, &FontSans16),
+      redLabel(ROW_X, 52, 18 * CELL, &FontAA16, RED),
+      greenLabel(ROW_X, 74, 18 * CELL, &FontAA16, GREEN),
+      blueLabel(ROW_X, 96, 18 * CELL, &FontAA16, BLUE),
+      redValue(VALUE_X, 52, 3, 0, &FontAA16, RED),
+      greenValue(VALUE_X, 74, 3, 0, &FontAA16, GREEN),
+      blueValue(VALUE_X, 96, 3, 0, &FontAA16, BLUE),
+      redRaw(RAW_X, 52, 5, 0, &FontAA16, RED),
+      greenRaw(RAW_X, 74, 5, 0, &FontAA16, GREEN),
+      blueRaw(RAW_X, 96, 5, 0, &FontAA16, BLUE),
+      swatch(70, 122, 100, 42, WHITE),
+      history(42, 172, 156, 36, 3, HISTORY_COLORS) {
+    tree.setBackground(clearScreen);
+    tree.add(title);
+    tree.add(redLabel);
+    tree.add(greenLabel);
+    tree.add(blueLabel);
+    tree.add(redValue);
+    tree.add(greenValue);
+    tree.add(blueValue);
+    tree.add(redRaw);
+    tree.add(greenRaw);
+    tree.add(blueRaw);
+    tree.add(swatch);
+    tree.add(history);
+
+    title.setText("Live color");
+    redLabel.setText(ROW_FORMAT[0]);
+    greenLabel.setText(ROW_FORMAT[1]);
+    blueLabel.setText(ROW_FORMAT[2]);
+}
+
+void ColorGauge::show() {
+    tree.renderAll();
+}
+
+void ColorGauge::addSample(const ColorSample& s) {
+    latest = s;
+    pending = true;
+}
+
+uint32_t ColorGauge::update() {
+    if (pending) {
+        pending = false;
+        CorrectedColor c = ColorProcessor::correct(latest.r, latest.g, latest.b);
+
+        // Only the readouts whose value changed are redrawn
+        redValue.setValue(c.r);
+        greenValue.setValue(c.g);
+        blueValue.setValue(c.b);
+        redRaw.setValue(latest.r);
+        greenRaw.setValue(latest.g);
+        blueRaw.setValue(latest.b);
+        swatch.setColor(c.rgb565);
+
+        const uint8_t values[3] = {c.r, c.g, c.b};
+        history.push(values);
+    }
+    return tree.render();
+}
@@ -0,0 +1,39 @@
+#ifndef COLOR_GAUGE_H
+#define COLOR_GAUGE_H
+
+#include "Widgets.h"
+#include "src/sensing/SensorHub.h"
+#include "src/colordetection/ColorProcessor.h"
+
+// Live analysis screen: corrected RGB readouts, a swatch of the detected
+// color and a short R/G/B history. Samples are only recorded by
+// addSample(); update() redraws whatever changed, so a frame costs the
+// few readout/swatch/sparkline windows rather than a full refresh.
+class ColorGauge {
+public:
+    ColorGauge();
+
+    void show();       // clear the screen and draw every widget
+    void addSample(const ColorSample& s);
+    uint32_t update(); // returns the pixel bytes flushed
+
+private:
+    WidgetTree tree;
+    Label title;
+    Label redLabel;
+    Label greenLabel;
+    Label blueLabel;
+    Readout redValue;
+    Readout greenValue;
+    Readout blueValue;
+    Readout redRaw;
+    Readout greenRaw;
+    Readout blueRaw;
+    ColorSwatch swatch;
+    Sparkline history;
+
+    bool pending = false;
+    ColorSample latest = {0, 0, 0, 0, 0};
+};
+
+#endif // COLOR_GAUGE_H
@@ -0,0 +1,83 @@
+#include "Sprite.h"
+#include <math.h>
+#include "src/screen/FrameBuffer.h"
+
+Sprite::~Sprite() {
+    free(pixels);
+}
+
+bool Sprite::allocate(uint16_t width, uint16_t height, uint8_t frames) {
+    free(pixels);
+    size_t bytes = (size_t)width * height * frames * sizeof(UWORD);
+    pixels = (UWORD*)ps_malloc(bytes);
+    if (!pixels) pixels = (UWORD*)malloc(bytes);
+    if (!pixels) {
+        w = h = frameCount = 0;
+        return false;
+    }
+    w = width;
+    h = height;
+    frameCount = frames;
+    return true;
+}
+
+// Linear mix of two RGB565 colors, level 0..255 towards a
+static UWORD mix565(UWORD a, UWORD b, uint8_t level) {
+    uint16_t ra = a >> 11, ga = (a >> 5) & 0x3F, ba = a & 0x1F;
+    uint16_t rb = b >> 11, gb = (b >> 5) & 0x3F, bb = b & 0x1F;
+    uint16_t r = (ra * level + rb * (255 - level)) / 255;
+    uint16_t g = (ga * level + gb * (255 - level)) / 255;
+    uint16_t bl = (ba * level + bb * (255 - level)) / 255;
+    return (r << 11) | (g << 5) | bl;
+}
+
+bool Sprite::buildSpinner(uint8_t size, uint8_t dots, uint8_t stepsPerDot, UWORD fg, UWORD bg) {
+    if (!allocate(size, size, dots * stepsPerDot)) return false;
+
+    const float c = (size - 1) / 2.0f;
+    const float dotR = size / 9.0f;
+    const float ringR = c - dotR;
+    const float dotR2 = dotR * dotR;
+    const UWORD bgPanel = FB_PIXEL(bg);
+
+    for (uint8_t f = 0; f < frameCount; f++) {
+        UWORD* px = frame(f);
+        for (uint32_t i = 0; i < (uint32_t)w * h; i++) px[i] = bgPanel;
+
+        float base = f * (2.0f * (float)M_PI) / frameCount;
+        for (uint8_t d = 0; d < dots; d++) {
+            // d = 0 leads at full brightness, the tail fades out
+            float a = base - d * (2.0f * (float)M_PI) / dots;
+            float dx = c + ringR * sinf(a);
+            float dy = c - ringR * cosf(a);
+            UWORD col = FB_PIXEL(mix565(fg, bg, 255 - d * 255 / dots));
+
+            for (int16_t py = (int16_t)(dy - dotR); py <= (int16_t)(dy + dotR + 1); py++) {
+                if (py < 0 || py >= h) continue;
+                for (int16_t qx = (int16_t)(dx - dotR); qx <= (int16_t)(dx + dotR + 1); qx++) {
+                    if (qx < 0 || qx >= w) continue;
+                    float ex = qx - dx, ey = py - dy;
+                    if (ex * ex + ey * ey <= dotR2) px[py * w + qx] = col;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+void Animator::play(const Sprite& s, int16_t px, int16_t py) {
+    sprite = &s;
+    x = px;
+    y = py;
+    current = 0;
+}
+
+void Animator::step() {
+    if (!sprite || sprite->frameCount == 0) return;
+    uint32_t start = micros();
+
+    FrameBuffers.blit(x, y, sprite->w, sprite->h, sprite->frame(current), sprite->w);
+
+    current = (current + 1) % sprite->frameCount;
+    frameUs = micros() - start;
+}
@@ -0,0 +1,52 @@
+#ifndef SPRITE_H
+#define SPRITE_H
+
+#include <Arduino.h>
+#include "DEV_Config.h"
+
+// A strip of equally sized, pre-rendered frames stored in panel byte order
+// so they can be copied into the framebuffer without conversion.
+class Sprite {
+public:
+    ~Sprite();
+
+    bool allocate(uint16_t w, uint16_t h, uint8_t frames);
+    const UWORD* frame(uint8_t i) const { return pixels + (uint32_t)i * w * h; }
+    UWORD* frame(uint8_t i) { return pixels + (uint32_t)i * w * h; }
+
+    // Ring of dots whose brightness trails behind the leading dot; each
+    // frame advances the ring by 360/(dots*stepsPerDot) degrees.
+    bool buildSpinner(uint8_t size, uint8_t dots, uint8_t stepsPerDot, UWORD fg, UWORD bg);
+
+    uint16_t w = 0;
+    uint16_t h = 0;
+    uint8_t frameCount = 0;
+
+private:
+    UWORD* pixels = nullptr;
+};
+
+// Plays a sprite in a fixed screen region. Every step() blits one frame
+// and flushes only that window, so a spinner costs w*h*2 bytes per frame
+// instead of a full-screen refresh. The frame rate is set by the scheduler
+// task that calls step().
+class Animator {
+public:
+
+    void play(const Sprite& s, int16_t x, int16_t y);
+    void stop() { sprite = nullptr; }
+    bool isPlaying() const { return sprite != nullptr; }
+    void step();
+
+    uint32_t bytesPerFrame() const { return sprite ? (uint32_t)sprite->w * sprite->h * 2 : 0; }
+    uint32_t lastFrameUs() const { return frameUs; }
+
+private:
+    const Sprite* sprite = nullptr;
+    int16_t x = 0;
+    int16_t y = 0;
+    uint8_t current = 0;
+    uint32_t frameUs = 0;
+};
+
+#endif // SPRITE_H
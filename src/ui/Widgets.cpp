@@ -0,0 +1,274 @@
+#include "Widgets.h"
+#include <math.h>
+#include <string.h>
+#include "src/screen/LCD_1in28.h"
+#include "src/screen/FrameBuffer.h"
+#include "src/profiler/Profiler.h"
+
+void Widget::setVisible(bool v) {
+    if (visible == v) return;
+    visible = v;
+    dirty = true;
+}
+
+// Paint_DrawString_EN hands its two colors to Paint_DrawChar swapped, so the
+// widgets pass (background, foreground) to get fg text on bg.
+static void drawAligned(int16_t x, int16_t y, int16_t w, int16_t h, const char* s,
+                        sFONT* font, TEXT_ALIGN align, UWORD fg, UWORD bg) {
+    UWORD tx = Paint_AlignString(x, x + w, Paint_MeasureString(s, font), align);
+    Paint_DrawString_EN(tx, y + (h - font->Height) / 2, s, font, bg, fg);
+}
+
+static void drawAligned(int16_t x, int16_t y, int16_t w, int16_t h, const char* s,
+                        const sFONT_AA* font, TEXT_ALIGN align, UWORD fg, UWORD bg) {
+    Paint_DrawStringAlignedAA(x, x + w, y + (h - font->Height) / 2, s, font, align, fg, bg);
+}
+
+Label::Label(int16_t x, int16_t y, int16_t w, sFONT* font, UWORD fg, UWORD bg)
+    : Widget(x, y, w, font->Height), font(font), foreground(fg) {
+    background = bg;
+}
+
+Label::Label(int16_t x, int16_t y, int16_t w, const sFONT_AA* font, UWORD fg, UWORD bg)
+    : Widget(x, y, w, font->Height), aaFont(font), foreground(fg) {
+    background = bg;
+}
+
+void Label::setText(const char* text) {
+    if (strncmp(buf, text, MAX_TEXT - 1) == 0) return;
+    strncpy(buf, text, MAX_TEXT - 1);
+    buf[MAX_TEXT - 1] = '\0';
+    dirty = true;
+}
+
+void Label::setColor(UWORD fg) {
+    if (foreground == fg) return;
+    foreground = fg;
+    dirty = true;
+}
+
+void Label::setAlign(TEXT_ALIGN a) {
+    if (align == a) return;
+    align = a;
+    dirty = true;
+}
+
+void Label::draw() {
+    Paint_ClearWindows(x, y, x + w, y + h, background);
+    if (aaFont) drawAligned(x, y, w, h, buf, aaFont, align, foreground, background);
+    else drawAligned(x, y, w, h, buf, font, align, foreground, background);
+}
+
+Button::Button(int16_t x, int16_t y, int16_t w, int16_t h, const char* caption, sFONT* font,
+               UWORD fill, UWORD textColor)
+    : Widget(x, y, w, h), caption(caption), font(font), fill(fill), textColor(textColor) {}
+
+void Button::setFill(UWORD c) {
+    if (fill == c) return;
+    fill = c;
+    dirty = true;
+}
+
+void Button::draw() {
+    Paint_ClearWindows(x, y, x + w, y + h, fill);
+    drawAligned(x, y, w, h, caption, font, TEXT_ALIGN_CENTER, textColor, fill);
+}
+
+bool Button::onGesture(const GestureEvent& g) {
+    if (g.type != TOUCH_GESTURE_TAP) return false;
+    if (tapCallback) tapCallback();
+    return true;
+}
+
+Readout::Readout(int16_t x, int16_t y, uint8_t cells, uint8_t decimals, const sFONT_AA* font,
+                 UWORD fg, UWORD bg)
+    : Widget(x, y, cells * Paint_DigitWidthAA(font), font->Height),
+      font(font), cells(cells), decimals(decimals), foreground(fg) {
+    background = bg;
+}
+
+void Readout::setValue(int32_t v) {
+    if (hasValue && current == v) return;
+    current = v;
+    hasValue = true;
+    dirty = true;
+}
+
+// Largest magnitude, in units of the last decimal, written with this many
+// digit glyphs; -1 when not even a zero fits
+static int32_t readoutLimit(int digits, uint8_t decimals) {
+    if (digits < decimals + 1) return -1;
+    int32_t limit = 0;
+    for (int i = 0; i < digits && limit <= (INT32_MAX - 9) / 10; i++) limit = limit * 10 + 9;
+    return limit;
+}
+
+void Readout::draw() {
+    // Saturate to what fits the cells, e.g. 999 for 3 cells, so the text
+    // never runs past the rectangle
+    int point = decimals ? 1 : 0;
+    int32_t high = readoutLimit(cells - point, decimals);
+    int32_t negative = readoutLimit(cells - point - 1, decimals);  // one cell for '-'
+    int32_t low = negative < 0 ? 0 : -negative;
+    if (!hasValue || high < 0) {
+        Paint_ClearWindows(x, y, x + w, y + h, background);
+        return;
+    }
+    int32_t v = current;
+    if (v > high) v = high;
+    if (v < low) v = low;
+    // Padded to all cells, so the whole rectangle is repainted
+    Paint_DrawFixedAA(x, y, v, decimals, cells, font, foreground, background);
+}
+
+ColorSwatch::ColorSwatch(int16_t x, int16_t y, int16_t w, int16_t h, UWORD color)
+    : Widget(x, y, w, h), swatch(color) {}
+
+void ColorSwatch::setColor(UWORD c) {
+    if (swatch == c) return;
+    swatch = c;
+    dirty = true;
+}
+
+void ColorSwatch::draw() {
+    Paint_ClearWindows(x, y, x + w, y + h, swatch);
+}
+
+ProgressRing::ProgressRing(int16_t cx, int16_t cy, uint8_t radius, uint8_t thickness,
+                           UWORD fg, UWORD track)
+    : Widget(cx - radius, cy - radius, 2 * radius + 1, 2 * radius + 1),
+      radius(radius), thickness(thickness), foreground(fg), track(track) {}
+
+void ProgressRing::setProgress(uint8_t p) {
+    if (p > 100) p = 100;
+    if (percent == p) return;
+    percent = p;
+    dirty = true;
+}
+
+void ProgressRing::draw() {
+    const int32_t rOut2 = (int32_t)radius * radius;
+    const int32_t rIn = radius > thickness ? radius - thickness : 0;
+    const int32_t rIn2 = rIn * rIn;
+    const float sweep = percent * (2.0f * (float)M_PI / 100.0f);
+
+    for (int16_t dy = -radius; dy <= radius; dy++) {
+        for (int16_t dx = -radius; dx <= radius; dx++) {
+            int32_t d2 = (int32_t)dx * dx + (int32_t)dy * dy;
+            UWORD c = background;
+            if (d2 <= rOut2 && d2 >= rIn2) {
+                // Angle clockwise from 12 o'clock
+                float a = atan2f((float)dx, (float)-dy);
+                if (a < 0) a += 2.0f * (float)M_PI;
+                c = a < sweep ? foreground : track;
+            }
+            Paint_SetPixel(x + radius + dx, y + radius + dy, c);
+        }
+    }
+}
+
+Sparkline::Sparkline(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t channels,
+                     const UWORD* colors)
+    : Widget(x, y, w, h), channels(channels > 3 ? 3 : channels), colors(colors) {}
+
+void Sparkline::push(const uint8_t* values) {
+    for (uint8_t c = 0; c < channels; c++) {
+        history[c][head] = values[c];
+    }
+    head = (head + 1) % CAPACITY;
+    if (count < CAPACITY) count++;
+    dirty = true;
+}
+
+void Sparkline::reset() {
+    head = 0;
+    count = 0;
+    dirty = true;
+}
+
+void Sparkline::draw() {
+    Paint_ClearWindows(x, y, x + w, y + h, background);
+    if (count < 2) return;
+
+    // Spread the stored points over the full width. Paint_DrawPoint puts a
+    // 1x1 dot at (X - 1, Y - 1), so the line is given one-based coordinates
+    // to stay inside the rectangle.
+    for (uint8_t c = 0; c < channels; c++) {
+        int16_t px = 0, py = 0;
+        for (uint8_t i = 0; i < count; i++) {
+            uint8_t idx = (head + CAPACITY - count + i) % CAPACITY;
+            int16_t nx = x + (int32_t)i * (w - 1) / (count - 1);
+            int16_t ny = y + h - 1 - (int32_t)history[c][idx] * (h - 1) / 255;
+            if (i > 0) Paint_DrawLine(px + 1, py + 1, nx + 1, ny + 1, colors[c], DOT_PIXEL_1X1, LINE_STYLE_SOLID);
+            px = nx;
+            py = ny;
+        }
+    }
+}
+
+bool WidgetTree::add(Widget& w) {
+    if (count >= MAX_WIDGETS) return false;
+    widgets[count++] = &w;
+    w.invalidate();
+    return true;
+}
+
+static void drawOrErase(Widget* w) {
+    if (w->isVisible()) w->draw();
+    else Paint_ClearWindows(w->x, w->y, w->x + w->w, w->y + w->h, w->background);
+    w->clearDirty();
+}
+
+static void drawWidget(void* ctx) {
+    drawOrErase(static_cast<Widget*>(ctx));
+}
+
+void WidgetTree::drawTree(void* ctx) {
+    WidgetTree* tree = static_cast<WidgetTree*>(ctx);
+    if (tree->background) tree->background();
+    for (uint8_t i = 0; i < tree->count; i++) {
+        drawOrErase(tree->widgets[i]);
+    }
+}
+
+void WidgetTree::renderAll() {
+    FrameBuffers.renderFrame(drawTree, this);
+    totalBytes += (uint32_t)LCD_1IN28_WIDTH * LCD_1IN28_HEIGHT * 2;
+}
+
+uint32_t WidgetTree::render() {
+    PROFILE_ZONE("ui.render");
+    uint32_t bytes = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        Widget* w = widgets[i];
+        if (!w->isDirty()) continue;
+
+        int16_t x0 = max<int16_t>(w->x, 0);
+        int16_t y0 = max<int16_t>(w->y, 0);
+        int16_t x1 = min<int16_t>(w->x + w->w, LCD_1IN28_WIDTH);
+        int16_t y1 = min<int16_t>(w->y + w->h, LCD_1IN28_HEIGHT);
+        if (x0 >= x1 || y0 >= y1) {
+            w->clearDirty();
+            continue;
+        }
+        // Widgets paint their whole rectangle, so the window needs nothing
+        // from underneath
+        if (!FrameBuffers.render(x0, y0, x1, y1, drawWidget, w)) break;
+        bytes += (uint32_t)(x1 - x0) * (y1 - y0) * 2;
+    }
+    totalBytes += bytes;
+    return bytes;
+}
+
+Widget* WidgetTree::hitTest(int16_t px, int16_t py) {
+    // Last added is on top
+    for (int8_t i = count - 1; i >= 0; i--) {
+        if (widgets[i]->contains(px, py)) return widgets[i];
+    }
+    return nullptr;
+}
+
+bool WidgetTree::dispatch(const GestureEvent& g) {
+    Widget* w = hitTest(g.x, g.y);
+    return w && w->onGesture(g);
+}
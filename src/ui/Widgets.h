@@ -0,0 +1,181 @@
+#ifndef WIDGETS_H
+#define WIDGETS_H
+
+#include <Arduino.h>
+#include "src/screen/GUI_Paint.h"
+#include "src/touchsensor/GestureRecognizer.h"
+
+// Retained-mode widgets drawn through GUI_Paint. Setters only mark a widget
+// dirty when its content actually changes; WidgetTree::render() redraws the
+// dirty widgets and pushes just their rectangles to the panel.
+
+class Widget {
+public:
+    Widget(int16_t x, int16_t y, int16_t w, int16_t h) : x(x), y(y), w(w), h(h) {}
+    virtual ~Widget() {}
+
+    virtual void draw() = 0;
+    // Return true if the gesture was consumed.
+    virtual bool onGesture(const GestureEvent&) { return false; }
+
+    bool contains(int16_t px, int16_t py) const {
+        return visible && px >= x && px < x + w && py >= y && py < y + h;
+    }
+    void setVisible(bool v);
+    bool isVisible() const { return visible; }
+    void invalidate() { dirty = true; }
+    bool isDirty() const { return dirty; }
+    void clearDirty() { dirty = false; }
+
+    int16_t x, y, w, h;
+    UWORD background = WHITE;
+
+protected:
+    bool visible = true;
+    bool dirty = true;
+};
+
+class Label : public Widget {
+public:
+    Label(int16_t x, int16_t y, int16_t w, sFONT* font, UWORD fg = BLACK, UWORD bg = WHITE);
+    // Anti-aliased text, blended against bg.
+    Label(int16_t x, int16_t y, int16_t w, const sFONT_AA* font, UWORD fg = BLACK, UWORD bg = WHITE);
+
+    void setText(const char* text);
+    void setColor(UWORD fg);
+    // Within the label's width; centered by default.
+    void setAlign(TEXT_ALIGN a);
+    const char* text() const { return buf; }
+    void draw() override;
+
+private:
+    static const uint8_t MAX_TEXT = 32;
+    char buf[MAX_TEXT] = {0};
+    sFONT* font = nullptr;
+    const sFONT_AA* aaFont = nullptr;
+    UWORD foreground;
+    TEXT_ALIGN align = TEXT_ALIGN_CENTER;
+};
+
+class Button : public Widget {
+public:
+    Button(int16_t x, int16_t y, int16_t w, int16_t h, const char* caption, sFONT* font,
+           UWORD fill, UWORD textColor = WHITE);
+
+    void onTap(void (*cb)()) { tapCallback = cb; }
+    void setFill(UWORD c);
+    void draw() override;
+    bool onGesture(const GestureEvent& g) override;
+
+private:
+    const char* caption;
+    sFONT* font;
+    UWORD fill;
+    UWORD textColor;
+    void (*tapCallback)() = nullptr;
+};
+
+// Right-aligned number in a fixed number of digit cells, drawn from a
+// pre-rendered digit atlas. With decimals > 0 the value is shown divided by
+// 10^decimals. Values that need more cells are shown saturated, e.g. 999
+// for 3 cells. Blank until the first setValue().
+class Readout : public Widget {
+public:
+    Readout(int16_t x, int16_t y, uint8_t cells, uint8_t decimals, const sFONT_AA* font,
+            UWORD fg = BLACK, UWORD bg = WHITE);
+
+    void setValue(int32_t v);
+    int32_t value() const { return current; }
+    void draw() override;
+
+private:
+    const sFONT_AA* font;
+    uint8_t cells;
+    uint8_t decimals;
+    UWORD foreground;
+    int32_t current = 0;
+    bool hasValue = false;
+};
+
+class ColorSwatch : public Widget {
+public:
+    ColorSwatch(int16_t x, int16_t y, int16_t w, int16_t h, UWORD color = BLACK);
+
+    void setColor(UWORD c);
+    UWORD color() const { return swatch; }
+    void draw() override;
+
+private:
+    UWORD swatch;
+};
+
+// Arc from 12 o'clock clockwise, drawn per pixel inside its bounding box.
+class ProgressRing : public Widget {
+public:
+    ProgressRing(int16_t cx, int16_t cy, uint8_t radius, uint8_t thickness,
+                 UWORD fg, UWORD track = GRAY);
+
+    void setProgress(uint8_t percent);
+    uint8_t progress() const { return percent; }
+    void draw() override;
+
+private:
+    uint8_t radius;
+    uint8_t thickness;
+    UWORD foreground;
+    UWORD track;
+    uint8_t percent = 0;
+};
+
+// Short history of up to three 0..255 channels drawn as polylines, newest
+// on the right.
+class Sparkline : public Widget {
+public:
+    static const uint8_t CAPACITY = 64;
+
+    Sparkline(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t channels,
+              const UWORD* colors);
+
+    void push(const uint8_t* values);
+    void reset();
+    void draw() override;
+
+private:
+    uint8_t channels;
+    const UWORD* colors;
+    uint8_t history[3][CAPACITY];
+    uint8_t head = 0;
+    uint8_t count = 0;
+};
+
+class WidgetTree {
+public:
+    static const uint8_t MAX_WIDGETS = 16;
+
+    bool add(Widget& w);
+    void clear() { count = 0; }
+    // Paints everything behind the widgets, e.g. a clear or a logo. Part of
+    // every full frame, since strip rendering keeps no frame to draw over.
+    void setBackground(void (*draw)()) { background = draw; }
+
+    // Redraw the background and every widget and flush the whole frame.
+    void renderAll();
+    // Redraw dirty widgets and flush only their rectangles. Returns the
+    // number of pixel bytes sent.
+    uint32_t render();
+
+    Widget* hitTest(int16_t px, int16_t py);
+    bool dispatch(const GestureEvent& g);
+
+    uint32_t flushedBytes() const { return totalBytes; }
+
+private:
+    void (*background)() = nullptr;
+    Widget* widgets[MAX_WIDGETS];
+    uint8_t count = 0;
+    uint32_t totalBytes = 0;
+
+    static void drawTree(void* ctx);
+};
+
+#endif // WIDGETS_H
@@ -0,0 +1,183 @@
+#ifndef QMI8658_MODEL_H
+#define QMI8658_MODEL_H
+
+#include "src/flipsensor/QMI8658.h"
+#include <Wire.h>
+#include <functional>
+#include <vector>
+
+// Register model of the QMI8658 behind the fake Wire: a flat register file
+// with auto-increment, the CTRL9 command handshake and a FIFO that streams
+// out of FIFO_DATA. Every write burst and read is logged for the checks.
+//
+// With a motion source attached, advance() also runs the sensor in time:
+// it fills the FIFO at the 62.5 Hz ODR while accel and gyro are enabled,
+// raises INT2 when the watermark is reached and toggles INT1 when
+// wake-on-motion is armed and the accelerometer moves past its threshold.
+class Qmi8658Model : public WireModel {
+public:
+    static const uint8_t ADDR = 0x6B;
+
+    struct Access {
+        uint8_t reg;
+        std::vector<uint8_t> data;   // written bytes; empty for a read
+        size_t readLen;
+    };
+
+    uint8_t regs[128] = {};
+    std::vector<Access> log;
+    std::vector<uint8_t> ctrl9Log;
+    std::vector<uint8_t> fifo;
+    size_t fifoPos = 0;
+    int cmdDonePolls = 2;      // StatusInt reads before CmdDone shows up; <0 never
+    bool ackClears = true;
+    int failReadOf = -1;       // register whose reads come back short
+
+    // Raw accel and gyro at a given time; accel is in the driver's LSB
+    // scale (8 g range, 4096 LSB/g)
+    std::function<void(uint32_t ms, int16_t acc[3], int16_t gyro[3])> motion;
+    std::function<void()> onInt1, onInt2;
+
+    Qmi8658Model() {
+        regs[QMI8658Register_WhoAmI] = 0x05;
+        regs[QMI8658Register_Revision] = 0x7C;
+    }
+
+    void loadFifo(const std::vector<uint8_t>& bytes) {
+        fifo = bytes;
+        fifoPos = 0;
+        syncFifoCount();
+    }
+
+    void advance(uint64_t nowUs) {
+        if (!motion) return;
+        for (; nextSampleUs <= nowUs; nextSampleUs += SAMPLE_PERIOD_US) {
+            int16_t acc[3], gyro[3];
+            motion((uint32_t)(nextSampleUs / 1000), acc, gyro);
+            sample(acc, gyro);
+        }
+    }
+
+    std::vector<Access> writes() const {
+        std::vector<Access> w;
+        for (const Access& a : log) if (!a.data.empty()) w.push_back(a);
+        return w;
+    }
+    size_t readsOf(uint8_t reg) const {
+        size_t n = 0;
+        for (const Access& a : log) if (a.data.empty() && a.reg == reg) n++;
+        return n;
+    }
+
+    uint8_t write(uint8_t addr, const uint8_t* data, size_t len, bool stop) override {
+        if (addr != ADDR) return 2;
+        pointer = data[0];
+        if (len == 1 && !stop) return 0;           // register select for a read
+        log.push_back({pointer, std::vector<uint8_t>(data + 1, data + len), 0});
+        for (size_t i = 1; i < len; i++) store((uint8_t)(pointer + i - 1), data[i]);
+        return 0;
+    }
+
+    size_t read(uint8_t addr, uint8_t* buf, size_t len) override {
+        if (addr != ADDR) return 0;
+        log.push_back({pointer, {}, len});
+        if (pointer == failReadOf) return 0;
+        for (size_t i = 0; i < len; i++) {
+            if (pointer == QMI8658Register_FifoData) {
+                buf[i] = fifoPos < fifo.size() ? fifo[fifoPos++] : 0;
+            } else {
+                buf[i] = load((uint8_t)(pointer + i));
+            }
+        }
+        if (pointer == QMI8658Register_FifoData) syncFifoCount();
+        return len;
+    }
+
+private:
+    static const uint32_t SAMPLE_PERIOD_US = 16000;
+    static const size_t FRAME_BYTES = 12;
+
+    uint8_t pointer = 0;
+    int pollsLeft = -1;
+    uint64_t nextSampleUs = 0;
+    bool womArmed = false;
+    bool womReference = false;
+    int16_t womAcc[3] = {};
+
+    void syncFifoCount() {
+        uint16_t words = (uint16_t)((fifo.size() - fifoPos) / 2);
+        regs[QMI8658Register_FifoSmplCnt] = words & 0xFF;
+        regs[QMI8658Register_FifoStatus] = (words >> 8) & 0x03;
+    }
+
+    size_t fifoFrames() const { return (fifo.size() - fifoPos) / FRAME_BYTES; }
+
+    void sample(const int16_t acc[3], const int16_t gyro[3]) {
+        uint8_t ctrl7 = regs[QMI8658Register_Ctrl7] & QMI8658_CTRL7_ENABLE_MASK;
+        uint8_t fifoMode = regs[QMI8658Register_FifoCtrl] & 0x03;
+
+        if (womArmed && ctrl7 == QMI8658_CTRL7_ACC_ENABLE) {
+            if (!womReference) {
+                memcpy(womAcc, acc, sizeof(womAcc));
+                womReference = true;
+            } else if (womMoved(acc)) {
+                memcpy(womAcc, acc, sizeof(womAcc));
+                if (onInt1) onInt1();
+            }
+        }
+
+        if (fifoMode == QMI8658FifoMode_Bypass) return;
+        if (ctrl7 != (QMI8658_CTRL7_ACC_ENABLE | QMI8658_CTRL7_GYR_ENABLE)) return;
+        size_t capacity = (size_t)16 << ((regs[QMI8658Register_FifoCtrl] >> 2) & 0x03);
+        if (fifoFrames() >= capacity) {
+            if (fifoMode == QMI8658FifoMode_Fifo) return;
+            fifoPos += FRAME_BYTES;                // stream: drop the oldest
+        }
+        if (fifoPos) {
+            fifo.erase(fifo.begin(), fifo.begin() + fifoPos);
+            fifoPos = 0;
+        }
+        for (const int16_t* axes : {acc, gyro}) {
+            for (int i = 0; i < 3; i++) {
+                fifo.push_back(axes[i] & 0xFF);
+                fifo.push_back((axes[i] >> 8) & 0xFF);
+            }
+        }
+        syncFifoCount();
+        if (fifoFrames() == regs[QMI8658Register_FifoWtmTh] && onInt2) onInt2();
+    }
+
+    // Cal1_L is the threshold in mg, on any axis
+    bool womMoved(const int16_t acc[3]) const {
+        int32_t threshold = (int32_t)regs[QMI8658Register_Cal1_L] * 4096 / 1000;
+        for (int i = 0; i < 3; i++) {
+            if (abs(acc[i] - womAcc[i]) > threshold) return true;
+        }
+        return false;
+    }
+
+    void store(uint8_t reg, uint8_t value) {
+        regs[reg & 0x7F] = value;
+        if (reg != QMI8658Register_Ctrl9) return;
+        ctrl9Log.push_back(value);
+        if (value == QMI8658_Ctrl9_Cmd_Ack) {
+            if (ackClears) regs[QMI8658Register_StatusInt] &= ~QMI8658_STATUSINT_CMD_DONE;
+        } else {
+            pollsLeft = cmdDonePolls;
+        }
+        if (value == QMI8658_Ctrl9_Cmd_Rst_Fifo) loadFifo({});
+        if (value == QMI8658_Ctrl9_Cmd_WoM_Setting) {
+            womArmed = regs[QMI8658Register_Cal1_L] != 0;
+            womReference = false;
+        }
+    }
+
+    uint8_t load(uint8_t reg) {
+        if (reg == QMI8658Register_StatusInt && pollsLeft >= 0 && pollsLeft-- == 0) {
+            regs[reg] |= QMI8658_STATUSINT_CMD_DONE;
+        }
+        return regs[reg & 0x7F];
+    }
+};
+
+#endif // QMI8658_MODEL_H
@@ -0,0 +1,204 @@
+#include "src/power/BatteryMonitor.h"
+#include "DEV_Config.h"
+#include "check.h"
+#include <vector>
+
+// BatteryMonitor on synthetic ADC traces. DEC_ADC_Read() returns the queued
+// pin voltages in order and then holds the last one; a battery voltage
+// divisible by three reads back exactly through the 1/3 divider.
+static std::vector<uint16_t> adc;
+static size_t adcNext = 0;
+static uint16_t adcHold = 0;
+
+uint16_t DEC_ADC_Read(void) {
+    if (adcNext < adc.size()) adcHold = adc[adcNext++];
+    return adcHold;
+}
+
+// One update()'s worth of samples: OVERSAMPLE of them
+static const uint8_t OVERSAMPLE = 16;
+
+static void queueSteady(uint16_t batteryMv) {
+    for (uint8_t i = 0; i < OVERSAMPLE; i++) adc.push_back(batteryMv / 3);
+}
+
+// Holds the battery at batteryMv until the filter has settled on it
+static void settle(BatteryMonitor& bat, uint16_t batteryMv) {
+    adc.clear();
+    adcNext = 0;
+    adcHold = batteryMv / 3;
+    for (int i = 0; i < 40 && bat.millivolts() != batteryMv; i++) bat.update();
+}
+
+// Lowest battery voltage, on the divider's 3 mV grid, that reads as pct
+static uint16_t mvFor(uint8_t pct) {
+    for (uint16_t mv = 3270; mv <= 4200; mv += 3) {
+        if (BatteryMonitor::percentFor(mv) == pct) return mv;
+    }
+    return 0;
+}
+
+// Discharges (or charges) slowly enough for the filter to pass through
+// every percentage on the way, as a real cell does
+static void walkTo(BatteryMonitor& bat, uint8_t pct) {
+    uint8_t p = BatteryMonitor::percentFor(bat.millivolts());
+    while (p != pct) {
+        p = p < pct ? p + 1 : p - 1;
+        settle(bat, mvFor(p));
+    }
+}
+
+// 100 %, 95 %, ... 0 %, as in BatteryMonitor.cpp
+static const uint16_t CURVE_MV[] = {
+    4200, 4150, 4110, 4080, 4020, 3980, 3950, 3910, 3870, 3850, 3840,
+    3820, 3800, 3790, 3770, 3750, 3730, 3710, 3690, 3610, 3270
+};
+static const uint8_t CURVE_POINTS = sizeof(CURVE_MV) / sizeof(CURVE_MV[0]);
+
+static void testPercentFor() {
+    for (uint8_t i = 0; i < CURVE_POINTS; i++) CHECK_EQ(BatteryMonitor::percentFor(CURVE_MV[i]), 100 - 5 * i);
+    CHECK_EQ(BatteryMonitor::percentFor(4350), 100);
+    CHECK_EQ(BatteryMonitor::percentFor(3000), 0);
+    CHECK_EQ(BatteryMonitor::percentFor(0), 0);
+
+    // Linear between points, rounded half up
+    CHECK_EQ(BatteryMonitor::percentFor(4130), 93);   // 92.5
+    CHECK_EQ(BatteryMonitor::percentFor(4129), 92);
+    CHECK_EQ(BatteryMonitor::percentFor(3845), 53);   // 52.5
+    CHECK_EQ(BatteryMonitor::percentFor(3650), 8);    // 7.5
+    CHECK_EQ(BatteryMonitor::percentFor(3440), 3);    // 2.5
+    CHECK_EQ(BatteryMonitor::percentFor(3300), 0);    // 0.44
+
+    // Never rises as the voltage drops, and stays between its two points
+    uint8_t prev = 100;
+    for (uint16_t mv = 4200; mv >= 3270; mv--) {
+        uint8_t pct = BatteryMonitor::percentFor(mv);
+        CHECK(pct <= prev);
+        uint8_t i = 1;
+        while (i < CURVE_POINTS - 1 && mv < CURVE_MV[i]) i++;
+        CHECK(pct >= 100 - 5 * i && pct <= 100 - 5 * (i - 1));
+        prev = pct;
+    }
+}
+
+// The first reading seeds the filter and is published as is; after that the
+// filter moves a quarter of the way per update
+static void testSeeding() {
+    BatteryMonitor bat;
+    adc.clear();
+    adcNext = 0;
+    queueSteady(3900);
+    queueSteady(3780);
+    queueSteady(3780);
+    CHECK(bat.update());
+    CHECK_EQ(bat.millivolts(), 3900);
+    CHECK_EQ(bat.percent(), BatteryMonitor::percentFor(3900));
+    CHECK_EQ(bat.level(), BATTERY_OK);
+
+    bat.update();
+    CHECK_EQ(bat.millivolts(), 3870);       // 3900 - 120 / 4
+    bat.update();
+    CHECK_EQ(bat.millivolts(), 3847);       // 3870 - 90 / 4, truncated
+    settle(bat, 3780);
+    CHECK_EQ(bat.millivolts(), 3780);
+}
+
+// A single outlier in the 16 samples, high or low, is dropped entirely
+static void testTrimmedMean() {
+    static const uint16_t SPIKES[] = {4095, 0};
+    for (uint16_t spike : SPIKES) {
+        BatteryMonitor bat;
+        adc.clear();
+        adcNext = 0;
+        for (uint8_t i = 0; i < OVERSAMPLE; i++) adc.push_back(i == 7 ? spike : 1300);
+        bat.update();
+        CHECK_EQ(bat.millivolts(), 3900);
+    }
+
+    // One of each in the same read
+    BatteryMonitor bat;
+    adc.clear();
+    adcNext = 0;
+    for (uint8_t i = 0; i < OVERSAMPLE; i++) adc.push_back(i == 3 ? 4095 : i == 12 ? 0 : 1300);
+    bat.update();
+    CHECK_EQ(bat.millivolts(), 3900);
+
+    // Two high ones are not: the mean moves
+    bat = BatteryMonitor();
+    adc.clear();
+    adcNext = 0;
+    for (uint8_t i = 0; i < OVERSAMPLE; i++) adc.push_back(i == 3 || i == 12 ? 1314 : 1300);
+    bat.update();
+    CHECK_EQ(bat.millivolts(), 3903);       // (13 * 1300 + 1314) * 3 / 14
+}
+
+// Jitter of 1 % around the published figure is not published; 2 % is
+static void testPercentHysteresis() {
+    BatteryMonitor bat;
+    uint16_t at60 = mvFor(60), at61 = mvFor(61), at59 = mvFor(59), at58 = mvFor(58);
+    CHECK(at60 && at61 && at59 && at58);
+    settle(bat, at60);
+    CHECK_EQ(bat.percent(), 60);
+
+    for (int i = 0; i < 20; i++) {
+        adc.clear();
+        adcNext = 0;
+        queueSteady(i & 1 ? at59 : at61);
+        CHECK(!bat.update());
+        CHECK_EQ(bat.percent(), 60);
+    }
+    settle(bat, at59);
+    CHECK_EQ(bat.percent(), 60);
+    settle(bat, at58);
+    CHECK_EQ(bat.percent(), 58);
+
+    // Full and empty are always published
+    settle(bat, 4200);
+    CHECK_EQ(bat.percent(), 100);
+    settle(bat, mvFor(1));
+    settle(bat, 3270);
+    CHECK_EQ(bat.percent(), 0);
+}
+
+// LOW at 20 % and CRITICAL at 5 % going down; leaving either needs 3 % more.
+// The steps are even, so the 2 % publishing steps land on each of them.
+static void testLevelHysteresis() {
+    struct Step {
+        uint8_t pct;
+        BatteryLevel level;
+    };
+    static const Step DOWN[] = {
+        {30, BATTERY_OK}, {22, BATTERY_OK}, {20, BATTERY_LOW}, {12, BATTERY_LOW},
+        {6, BATTERY_LOW}, {4, BATTERY_CRITICAL},
+    };
+    static const Step UP[] = {
+        {6, BATTERY_CRITICAL}, {8, BATTERY_CRITICAL}, {10, BATTERY_LOW}, {20, BATTERY_LOW},
+        {22, BATTERY_LOW}, {24, BATTERY_OK}, {22, BATTERY_OK},
+    };
+    BatteryMonitor bat;
+    settle(bat, mvFor(DOWN[0].pct));
+    for (const Step& s : DOWN) {
+        walkTo(bat, s.pct);
+        CHECK_EQ(bat.percent(), s.pct);
+        CHECK_EQ(bat.level(), s.level);
+    }
+    for (const Step& s : UP) {
+        walkTo(bat, s.pct);
+        CHECK_EQ(bat.percent(), s.pct);
+        CHECK_EQ(bat.level(), s.level);
+    }
+
+    // From OK past both thresholds
+    walkTo(bat, 2);
+    CHECK_EQ(bat.level(), BATTERY_CRITICAL);
+    CHECK(!strcmp(BatteryMonitor::levelName(bat.level()), "critical"));
+}
+
+int main() {
+    testPercentFor();
+    testSeeding();
+    testTrimmedMean();
+    testPercentHysteresis();
+    testLevelHysteresis();
+    return checkResult("battery_monitor_test");
+}
@@ -0,0 +1,94 @@
+#include "src/screen/Blit.h"
+#include "src/screen/FrameBuffer.h"
+#include "check.h"
+#include <chrono>
+
+// Throughput of each Blit kernel over a full 240x240 frame, row by row,
+// against the per-pixel loop it replaces, from a word-aligned and a
+// half-word-offset start. Checks that every kernel produced the loop's
+// result; the Mpx/s figures are host times for comparison only and are not
+// checked. The PIE kernels run on the device only (Blit_SelfTest).
+static const UWORD W = 240, H = 240;
+static const int TIMED_FRAMES = 50;
+
+alignas(16) static UWORD src[W * H + 2];
+alignas(16) static UWORD dst[W * H + 2];
+static UWORD ref[W * H + 2];
+
+static const UWORD KEY = FB_PIXEL(0xF81F);
+static const UBYTE ALPHA = 96;
+
+static void loopCopy(UWORD* d, const UWORD* s, UDOUBLE n) { for (UDOUBLE i = 0; i < n; i++) d[i] = s[i]; }
+static void loopFill(UWORD* d, UWORD p, UDOUBLE n) { for (UDOUBLE i = 0; i < n; i++) d[i] = p; }
+static void loopSwap(UWORD* d, const UWORD* s, UDOUBLE n) { for (UDOUBLE i = 0; i < n; i++) d[i] = FB_PIXEL(s[i]); }
+static void loopMasked(UWORD* d, const UWORD* s, UWORD key, UDOUBLE n) {
+    for (UDOUBLE i = 0; i < n; i++) if (s[i] != key) d[i] = s[i];
+}
+// The same blend one channel at a time
+static void loopBlend(UWORD* d, const UWORD* s, UBYTE alpha, UDOUBLE n) {
+    int a = (alpha + 4) >> 3;
+    for (UDOUBLE i = 0; i < n; i++) {
+        UWORD S = FB_PIXEL(s[i]), D = FB_PIXEL(d[i]);
+        int r = (D >> 11) + ((((S >> 11) - (D >> 11)) * a) >> 5);
+        int g = ((D >> 5) & 0x3F) + (((((S >> 5) & 0x3F) - ((D >> 5) & 0x3F)) * a) >> 5);
+        int b = (D & 0x1F) + ((((S & 0x1F) - (D & 0x1F)) * a) >> 5);
+        d[i] = FB_PIXEL((UWORD)(r << 11 | g << 5 | b));
+    }
+}
+
+enum Kernel { COPY, FILL, SWAP, BLEND, MASKED, KERNELS };
+static const char* const NAMES[KERNELS] = {"copy", "fill", "swap", "blend", "masked"};
+
+// One frame of kernel k, row by row, starting off pixels into each buffer
+static void frame(Kernel k, bool kernel, int off) {
+    for (UWORD y = 0; y < H; y++) {
+        UWORD* d = &dst[off + y * W];
+        const UWORD* s = &src[off + y * W];
+        switch (k) {
+        case COPY: kernel ? Blit_Copy565(d, s, W) : loopCopy(d, s, W); break;
+        case FILL: kernel ? Blit_Fill565(d, s[0], W) : loopFill(d, s[0], W); break;
+        case SWAP: kernel ? Blit_Swap565(d, s, W) : loopSwap(d, s, W); break;
+        case BLEND: kernel ? Blit_Blend565(d, s, ALPHA, W) : loopBlend(d, s, ALPHA, W); break;
+        case MASKED: kernel ? Blit_MaskedCopy565(d, s, KEY, W) : loopMasked(d, s, KEY, W); break;
+        default: break;
+        }
+    }
+}
+
+static void resetBuffers() {
+    for (uint32_t i = 0; i < W * H + 2; i++) {
+        src[i] = (UWORD)(i * 2654435761u >> 16);
+        if (i % 7 == 0) src[i] = KEY;
+        dst[i] = (UWORD)(i * 40503u);
+    }
+}
+
+static double mpxPerSec(Kernel k, bool kernel, int off) {
+    auto start = std::chrono::steady_clock::now();
+    for (int f = 0; f < TIMED_FRAMES; f++) frame(k, kernel, off);
+    auto end = std::chrono::steady_clock::now();
+    double us = std::chrono::duration<double, std::micro>(end - start).count();
+    return (double)W * H * TIMED_FRAMES / us;
+}
+
+int main() {
+    printf("blit_benchmark: Mpx/s kernel/loop\n");
+    for (int k = 0; k < KERNELS; k++) {
+        double rates[2][2];
+        for (int off = 0; off < 2; off++) {
+            // The kernel must do what the loop does, once from fresh buffers
+            resetBuffers();
+            frame((Kernel)k, false, off);
+            memcpy(ref, dst, sizeof(ref));
+            resetBuffers();
+            frame((Kernel)k, true, off);
+            CHECK(memcmp(dst, ref, sizeof(ref)) == 0);
+
+            rates[off][0] = mpxPerSec((Kernel)k, true, off);
+            rates[off][1] = mpxPerSec((Kernel)k, false, off);
+        }
+        printf("  %-6s aligned=%.0f/%.0f offset=%.0f/%.0f\n", NAMES[k],
+               rates[0][0], rates[0][1], rates[1][0], rates[1][1]);
+    }
+    return checkResult("blit_benchmark");
+}
@@ -0,0 +1,172 @@
+#include "src/screen/Blit.h"
+#include "src/screen/FrameBuffer.h"
+#include "check.h"
+#include <stdlib.h>
+
+#if BLIT_USE_PIE
+// Host versions of the BlitPie.S kernels with the same contract, so the
+// head, tail and threshold logic around them runs here. The real kernels
+// are checked on the device with Blit_SelfTest (UART command '6').
+static int pieCalls = 0;
+
+extern "C" void Blit_CopyPie(void *Dst, const void *Src, UDOUBLE Blocks)
+{
+    CHECK((((uintptr_t)Dst | (uintptr_t)Src) & 15) == 0);
+    memcpy(Dst, Src, Blocks * 16);
+    pieCalls++;
+}
+
+extern "C" void Blit_FillPie(void *Dst, const UDOUBLE *Pattern, UDOUBLE Blocks)
+{
+    CHECK((((uintptr_t)Dst | (uintptr_t)Pattern) & 15) == 0);
+    for (UDOUBLE i = 0; i < Blocks; i++) memcpy((UBYTE *)Dst + i * 16, Pattern, 16);
+    pieCalls++;
+}
+#endif
+
+static void testSelfTest()
+{
+    CHECK_EQ(Blit_SelfTest(), 0);
+#if BLIT_USE_PIE
+    CHECK(pieCalls > 0);
+#endif
+}
+
+// Only runs of at least 64 bytes with matching alignment go to the kernels
+static void testPieThreshold()
+{
+#if BLIT_USE_PIE
+    UWORD Src[64] __attribute__((aligned(16)));
+    UWORD Dst[64] __attribute__((aligned(16)));
+    for (int i = 0; i < 64; i++) Src[i] = (UWORD)i;
+
+    pieCalls = 0;
+    Blit_Copy565(Dst, Src, 31);             // 62 bytes
+    Blit_Fill565(Dst, 0x1234, 31);
+    CHECK_EQ(pieCalls, 0);
+    Blit_Copy565(Dst + 1, Src, 40);         // alignments differ
+    CHECK_EQ(pieCalls, 0);
+    Blit_Copy565(Dst + 1, Src + 1, 40);     // 2-byte head
+    CHECK_EQ(pieCalls, 1);
+    Blit_Fill565(Dst + 1, 0x1234, 40);      // odd-pixel head, then words
+    CHECK_EQ(pieCalls, 2);
+#endif
+}
+
+// The other kernels against per-pixel references at every 2-byte offset
+static void testKernels()
+{
+    UWORD Src[40], Dst[40], Ref[40];
+    for (int Off = 0; Off < 2; Off++) {
+        for (UDOUBLE Count = 0; Count + Off <= 39; Count++) {
+            for (int i = 0; i < 40; i++) {
+                Src[i] = (UWORD)(i * 0x3301 + 7);
+                Dst[i] = Ref[i] = (UWORD)(i * 0x0F0F);
+            }
+            Src[3] = Src[4] = Src[9] = 0xF800;
+
+            Blit_Swap565(Dst + Off, Src + Off, Count);
+            for (UDOUBLE i = 0; i < Count; i++) Ref[Off + i] = FB_PIXEL(Src[Off + i]);
+            CHECK(memcmp(Dst, Ref, sizeof(Dst)) == 0);
+
+            Blit_MaskedCopy565(Dst + Off, Src + Off, 0xF800, Count);
+            for (UDOUBLE i = 0; i < Count; i++) {
+                if (Src[Off + i] != 0xF800) Ref[Off + i] = Src[Off + i];
+            }
+            CHECK(memcmp(Dst, Ref, sizeof(Dst)) == 0);
+        }
+    }
+
+    // Blend endpoints: alpha 255 is the source, 0 leaves the destination
+    UWORD A = FB_PIXEL(0xF81F), B = FB_PIXEL(0x07E0);
+    UWORD D = B;
+    Blit_Blend565(&D, &A, 255, 1);
+    CHECK_EQ(D, A);
+    D = B;
+    Blit_Blend565(&D, &A, 0, 1);
+    CHECK_EQ(D, B);
+}
+
+// One channel of a blend the way the kernel rounds it: alpha in 32 steps,
+// the difference scaled and floored
+static UWORD blendChannel(UWORD S, UWORD D, UBYTE Alpha)
+{
+    int A = (Alpha + 4) >> 3;
+    return (UWORD)(D + (((int)S - (int)D) * A >> 5));
+}
+
+// Plain RGB565 blend channel by channel
+static UWORD blendRef(UWORD S, UWORD D, UBYTE Alpha)
+{
+    return blendChannel(S >> 11, D >> 11, Alpha) << 11 |
+           blendChannel((S >> 5) & 0x3F, (D >> 5) & 0x3F, Alpha) << 5 |
+           blendChannel(S & 0x1F, D & 0x1F, Alpha);
+}
+
+// Distance from the exact Src * Alpha/255 + Dst * (255 - Alpha)/255, in
+// units of each channel, the largest of the three
+static int blendError(UWORD Got, UWORD S, UWORD D, UBYTE Alpha)
+{
+    static const int SHIFT[3] = {11, 5, 0}, MAX[3] = {31, 63, 31};
+    int Worst = 0;
+    for (int c = 0; c < 3; c++) {
+        int s = (S >> SHIFT[c]) & MAX[c], d = (D >> SHIFT[c]) & MAX[c];
+        int Exact = (s * Alpha + d * (255 - Alpha) + 127) / 255;
+        int Err = abs(((Got >> SHIFT[c]) & MAX[c]) - Exact);
+        // Green has one more bit, so twice the steps for the same error
+        if (c == 1) Err = (Err + 1) / 2;
+        if (Err > Worst) Worst = Err;
+    }
+    return Worst;
+}
+
+// Mid alphas against the per-channel reference, where one channel rising
+// while its neighbour falls would show a borrow between the packed fields
+static void testBlend()
+{
+    static const UWORD PAIRS[][2] = {
+        {0xFFFF, 0x0000}, {0x0000, 0xFFFF}, {0xF800, 0x07FF}, {0x07E0, 0xF81F},
+        {0x001F, 0xFFE0}, {0x8410, 0x7BEF}, {0x0821, 0xF7DE}, {0x229F, 0xFA20},
+    };
+    int Mismatches = 0, Worst = 0;
+    for (int Alpha = 0; Alpha < 256; Alpha++) {
+        for (const auto& P : PAIRS) {
+            UWORD Src = FB_PIXEL(P[0]), Dst = FB_PIXEL(P[1]);
+            Blit_Blend565(&Dst, &Src, (UBYTE)Alpha, 1);
+            UWORD Got = FB_PIXEL(Dst);
+            if (Got != blendRef(P[0], P[1], Alpha)) Mismatches++;
+            Worst = max(Worst, blendError(Got, P[0], P[1], Alpha));
+        }
+    }
+    CHECK_EQ(Mismatches, 0);
+    CHECK(Worst <= 1);
+
+    // Rows of pseudo-random pixels at a few alphas, from both 2-byte offsets
+    static const UBYTE ALPHAS[] = {1, 8, 64, 100, 127, 128, 191, 250};
+    UWORD Src[41], Dst[41], Ref[41];
+    uint32_t Seed = 7;
+    for (UBYTE Alpha : ALPHAS) {
+        for (int Off = 0; Off < 2; Off++) {
+            for (int i = 0; i < 41; i++) {
+                Seed = Seed * 1103515245 + 12345;
+                Src[i] = (UWORD)(Seed >> 16);
+                Seed = Seed * 1103515245 + 12345;
+                Dst[i] = Ref[i] = (UWORD)(Seed >> 16);
+            }
+            Blit_Blend565(Dst + Off, Src + Off, Alpha, 40);
+            for (int i = Off; i < Off + 40; i++) {
+                Ref[i] = FB_PIXEL(blendRef(FB_PIXEL(Src[i]), FB_PIXEL(Ref[i]), Alpha));
+            }
+            CHECK(memcmp(Dst, Ref, sizeof(Dst)) == 0);
+        }
+    }
+}
+
+int main()
+{
+    testSelfTest();
+    testPieThreshold();
+    testKernels();
+    testBlend();
+    return checkResult(BLIT_USE_PIE ? "blit_test (pie)" : "blit_test");
+}
@@ -0,0 +1,125 @@
+#include <Adafruit_TCS34725.h>
+#include "src/sensing/SensorHub.h"
+#include "src/sensing/SensorTiming.h"
+#include "src/flipsensor/QMI8658.h"
+#include "src/i2c/I2CBus.h"
+#include "Qmi8658Model.h"
+#include "check.h"
+#include <math.h>
+
+// Boot benchmark: replays the sketch's sensor bring-up against simulated
+// parts on the fake clock and reports the time to first measurement, i.e.
+// from reset until the first color sample is queued for the UI. Both cores
+// are stepped in 1 ms ticks; a blocking driver call (a TCS integration)
+// advances the clock by its real duration. Display and BLE bring-up before
+// the scheduler starts are not modelled.
+//
+// The user is scripted: the cup stands upright through the splash, is
+// flipped as soon as the wait-for-flip prompt appears, over
+// FLIP_DURATION_MS, and then stays inverted. Flipping before the first
+// fallback check also covers the IMU FIFO having filled up during the
+// splash.
+static const uint32_t FLIP_START_MS = 300;
+static const uint32_t FLIP_DURATION_MS = 600;
+static const uint32_t FLIPPED_AT_MS = SPLASH_MS + FLIP_START_MS + FLIP_DURATION_MS;
+
+// Regression budgets. The scripted user accounts for FLIPPED_AT_MS; the
+// rest is the firmware's own latency.
+static const uint32_t DETECT_BUDGET_MS = 300;    // cup settled -> flip event
+static const uint32_t SAMPLE_BUDGET_MS = 700;    // flip event -> first sample
+static const uint32_t RUN_LIMIT_MS = 15000;
+
+static const uint8_t LED_PIN = 15;
+static const int16_t ACC_1G = 4096;          // 8 g range
+static const int16_t GYRO_LSB_PER_DPS = 64;  // 512 dps range
+
+static TwoWire imuWire(1);
+static I2CBus imuBus(imuWire, "i2c1");
+static Qmi8658Model imu;
+static Adafruit_TCS34725 tcs(COLOR_INTEGRATION_TIME, TCS34725_GAIN_1X);
+static FlipDetector flipDetector(imuWire);
+static SensorHub sensorHub(tcs, flipDetector, LED_PIN);
+static TaskScheduler ui;
+static uint8_t sensorTask, splashTask;
+
+static bool waitingForFlip = false;
+static uint32_t flipEventMs = 0;
+static uint32_t firstSampleMs = 0;
+
+// Rotation about X from upright to inverted. Upright reads -1 g on Z;
+// rotating by +angle about X is a -X rate.
+static void userMotion(uint32_t ms, int16_t acc[3], int16_t gyro[3]) {
+    const uint32_t start = SPLASH_MS + FLIP_START_MS;
+    double turn = 0, rate = 0;
+    if (ms >= start + FLIP_DURATION_MS) {
+        turn = 1;
+    } else if (ms >= start) {
+        turn = (double)(ms - start) / FLIP_DURATION_MS;
+        rate = 180.0 * 1000 / FLIP_DURATION_MS;
+    }
+    double angle = turn * M_PI;
+    acc[0] = 0;
+    acc[1] = (int16_t)lround(sin(angle) * ACC_1G);
+    acc[2] = (int16_t)lround(-cos(angle) * ACC_1G);
+    gyro[0] = (int16_t)lround(-rate * GYRO_LSB_PER_DPS);
+    gyro[1] = 0;
+    gyro[2] = 0;
+}
+
+// The sketch's "sensors" task
+static void drainSensors() {
+    SensorEvent ev;
+    while (sensorHub.popEvent(ev)) {
+        if (ev.type == SENSOR_EVENT_FLIPPED && waitingForFlip) {
+            waitingForFlip = false;
+            flipEventMs = ev.t;
+            sensorHub.setMode(SENSOR_MODE_SAMPLING);
+        }
+    }
+    ColorSample s;
+    while (sensorHub.popSample(s)) {
+        if (firstSampleMs == 0) firstSampleMs = s.t;
+    }
+}
+
+static void endSplash() {
+    ui.setEnabled(splashTask, false);
+    waitingForFlip = true;
+    sensorHub.setMode(SENSOR_MODE_WAIT_FLIP);
+}
+
+int main() {
+    imuWire.attach(&imu);
+    imu.motion = userMotion;
+    imu.onInt1 = [] { hostFireInterrupt(IMU_INT1_PIN); };
+    imu.onInt2 = [] { hostFireInterrupt(IMU_INT2_PIN); };
+    tcs.clear = 1200;
+
+    // Same order as setup()
+    CHECK(tcs.begin());
+    CHECK(QMI8658_init(imuBus));
+    CHECK(flipDetector.begin());
+    ui.begin();
+    sensorTask = ui.addTask("sensors", drainSensors);
+    splashTask = ui.addTask("splash", endSplash, SPLASH_MS);
+    sensorHub.begin(ui, sensorTask, SAMPLE_PERIOD_MS, FLIP_CHECK_MS, AMBIENT_PERIOD_MS);
+
+    TaskScheduler& sensors = sensorHub.taskScheduler();
+    while (firstSampleMs == 0 && millis() < RUN_LIMIT_MS) {
+        imu.advance(micros());
+        sensors.runDue();
+        ui.runDue();
+        hostAdvanceUs(1000);
+    }
+
+    CHECK(flipEventMs != 0);
+    CHECK(firstSampleMs != 0);
+    uint32_t detectMs = flipEventMs > FLIPPED_AT_MS ? flipEventMs - FLIPPED_AT_MS : 0;
+    uint32_t sampleMs = firstSampleMs - flipEventMs;
+    printf("boot_benchmark: time_to_first_measurement_ms=%lu flip_detect_ms=%lu first_sample_ms=%lu\n",
+           (unsigned long)firstSampleMs, (unsigned long)detectMs, (unsigned long)sampleMs);
+    CHECK(flipEventMs >= FLIPPED_AT_MS - FLIP_DURATION_MS / 2);  // not before the cup turned over
+    CHECK(detectMs <= DETECT_BUDGET_MS);
+    CHECK(sampleMs <= SAMPLE_BUDGET_MS);
+    return checkResult("boot_benchmark");
+}
@@ -0,0 +1,38 @@
+#ifndef TEST_CHECK_H
+#define TEST_CHECK_H
+
+#include <stdio.h>
+
+// Minimal assertions for the host tests: a failed CHECK is reported and
+// counted, and the test keeps going so one run shows every failure.
+static int checkFailures = 0;
+
+#define CHECK(cond)                                                              \
+    do {                                                                         \
+        if (!(cond)) {                                                           \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            checkFailures++;                                                     \
+        }                                                                        \
+    } while (0)
+
+#define CHECK_EQ(actual, expected)                                               \
+    do {                                                                         \
+        long long a_ = (long long)(actual), e_ = (long long)(expected);          \
+        if (a_ != e_) {                                                          \
+            fprintf(stderr, "%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__, \
+                    #actual, a_, e_);                                            \
+            checkFailures++;                                                     \
+        }                                                                        \
+    } while (0)
+
+// Return value for main()
+static inline int checkResult(const char* name) {
+    if (checkFailures) {
+        fprintf(stderr, "%s: %d check(s) failed\n", name, checkFailures);
+        return 1;
+    }
+    printf("%s: ok\n", name);
+    return 0;
+}
+
+#endif // TEST_CHECK_H
@@ -0,0 +1,136 @@
+#include "src/ui/ColorGauge.h"
+#include "src/screen/FrameBuffer.h"
+#include "src/fonts/fonts.h"
+#include "recording_panel.h"
+#include "check.h"
+#include <vector>
+
+// ColorGauge on the recording panel: each update() flushes exactly the
+// readouts whose value changed, the swatch when the corrected color
+// changed and the sparkline, in tree order, and the panel ends up the same
+// as a full redraw. The layout mirrors ColorGauge.cpp.
+static const UWORD W = LCD_1IN28_WIDTH, H = LCD_1IN28_HEIGHT;
+static const UWORD VALUE_X = 72, RAW_X = 120;
+static const UWORD ROW_Y[3] = {52, 74, 96};
+static const PanelWindow SWATCH = {70, 122, 170, 164};
+static const PanelWindow HISTORY = {42, 172, 198, 208};
+
+static ColorGauge gauge;
+
+static PanelWindow readoutRect(UWORD x, UWORD y, uint8_t cells) {
+    return {x, y, (UWORD)(x + cells * Paint_DigitWidthAA(&FontAA16)), (UWORD)(y + FontAA16.Height)};
+}
+
+// What update() should send going from sample a to b; a null a is the
+// first sample, which fills every readout
+static std::vector<PanelWindow> expectedWindows(const ColorSample* a, const ColorSample& b) {
+    CorrectedColor cb = ColorProcessor::correct(b.r, b.g, b.b);
+    CorrectedColor ca = a ? ColorProcessor::correct(a->r, a->g, a->b) : cb;
+    const uint8_t valueA[3] = {ca.r, ca.g, ca.b}, valueB[3] = {cb.r, cb.g, cb.b};
+    const uint16_t rawA[3] = {a ? a->r : (uint16_t)0, a ? a->g : (uint16_t)0, a ? a->b : (uint16_t)0};
+    const uint16_t rawB[3] = {b.r, b.g, b.b};
+
+    std::vector<PanelWindow> out;
+    for (int i = 0; i < 3; i++) {
+        if (!a || valueA[i] != valueB[i]) out.push_back(readoutRect(VALUE_X, ROW_Y[i], 3));
+    }
+    for (int i = 0; i < 3; i++) {
+        if (!a || rawA[i] != rawB[i]) out.push_back(readoutRect(RAW_X, ROW_Y[i], 5));
+    }
+    // The swatch starts out white, as does a saturated sample
+    UWORD swatchA = a ? ca.rgb565 : WHITE;
+    if (swatchA != cb.rgb565) out.push_back(SWATCH);
+    out.push_back(HISTORY);
+    return out;
+}
+
+static uint32_t bytesOf(const std::vector<PanelWindow>& ws) {
+    uint32_t n = 0;
+    for (const PanelWindow& w : ws) n += w.area() * 2;
+    return n;
+}
+
+static bool sends(const ColorSample* prev, const ColorSample& s) {
+    std::vector<PanelWindow> expect = expectedWindows(prev, s);
+    panel.reset();
+    gauge.addSample(s);
+    uint32_t bytes = gauge.update();
+    return panel.windows == expect && bytes == bytesOf(expect) && panel.bytes == bytes;
+}
+
+static ColorSample sample(uint16_t r, uint16_t g, uint16_t b) {
+    return {r, g, b, (uint16_t)(r + g + b), millis()};
+}
+
+// Raw b that still corrects to the same color as b, e.g. above the white
+// point; 0 if none within range
+static uint16_t sameColorRaw(const ColorSample& s) {
+    CorrectedColor c = ColorProcessor::correct(s.r, s.g, s.b);
+    for (uint16_t b = s.b + 1; b < s.b + 2000; b++) {
+        CorrectedColor d = ColorProcessor::correct(s.r, s.g, b);
+        if (d.r == c.r && d.g == c.g && d.b == c.b && d.rgb565 == c.rgb565) return b;
+    }
+    return 0;
+}
+
+static void testShow() {
+    panel.reset();
+    gauge.show();
+    CHECK_EQ(panel.windows.size(), 1);
+    CHECK_EQ(panel.bytes, (uint32_t)W * H * 2);
+
+    // Nothing new: nothing sent
+    panel.reset();
+    CHECK_EQ(gauge.update(), 0);
+    CHECK(panel.windows.empty());
+}
+
+static void testSamples() {
+    ColorSample a = sample(800, 1200, 2100);    // blue above its white point
+    CHECK(sends(nullptr, a));
+    CHECK_EQ(panel.windows.size(), 8);
+
+    // The same reading again only scrolls the history
+    CHECK(sends(&a, a));
+    CHECK_EQ(panel.windows.size(), 1);
+
+    // A raw count that corrects to the same color: its raw readout only
+    ColorSample b = a;
+    b.b = sameColorRaw(a);
+    CHECK(b.b != 0);
+    CHECK(sends(&a, b));
+    CHECK(panel.windows.size() == 2 && panel.windows[0] == readoutRect(RAW_X, ROW_Y[2], 5));
+
+    // A noisy walk: whatever changed, and nothing else
+    uint32_t seed = 12345;
+    ColorSample prev = b;
+    int partial = 0;
+    for (int i = 0; i < 60; i++) {
+        ColorSample next = prev;
+        uint16_t* ch[3] = {&next.r, &next.g, &next.b};
+        seed = seed * 1103515245 + 12345;
+        int which = (seed >> 16) % 3;
+        int step = (int)((seed >> 8) % 41) - 20;
+        *ch[which] = (uint16_t)constrain((int)*ch[which] + step, 0, 4000);
+        CHECK(sends(&prev, next));
+        if (panel.windows.size() < 8) partial++;
+        prev = next;
+    }
+    CHECK(partial > 0);
+
+    // The windows that went out add up to the whole picture
+    static UWORD incremental[W * H];
+    memcpy(incremental, panel.pixels, sizeof(incremental));
+    gauge.show();
+    CHECK(!memcmp(incremental, panel.pixels, sizeof(incremental)));
+}
+
+int main() {
+    FrameBuffers.begin(W, H, 1);
+    Paint_NewImage((UBYTE*)FrameBuffers.front(), W, H, 0, WHITE);
+    Paint_SetScale(65);
+
+    testShow();
+    testSamples();
+    return checkResult("color_gauge_test");
+}
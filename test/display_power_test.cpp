@@ -0,0 +1,267 @@
+#include "src/power/DisplayPower.h"
+#include "src/screen/LCD_1in28.h"
+#include "src/screen/FrameBuffer.h"
+#include "check.h"
+#include <math.h>
+#include <vector>
+
+// DisplayPower replaying activity and ambient traces on the fake clock, as
+// the sketch drives it: update() runs when the period it returned is up,
+// and immediately after activity or a new ambient reading. The panel and
+// backlight are recorded, and an independent charge figure is integrated
+// from what they actually did each millisecond.
+static const float PANEL_AWAKE_MA = 6.0f;
+static const float PANEL_ASLEEP_MA = 0.02f;
+static const float BACKLIGHT_FULL_MA = 25.0f;
+
+struct PwmWrite {
+    uint32_t ms;
+    uint8_t value;
+};
+
+static std::vector<PwmWrite> pwm;
+static uint8_t backlight = 0;
+static bool panelAwake = true;      // out of sleep mode
+static bool displayOn = true;
+static uint32_t sleeps = 0, sleepOuts = 0, refreshes = 0;
+static uint32_t sleptAtMs = 0, displayOnAtMs = 0;
+
+void DEV_SET_PWM(uint8_t value) {
+    backlight = value;
+    pwm.push_back({millis(), value});
+}
+void LCD_1IN28_Sleep(void) {
+    displayOn = false;
+    panelAwake = false;
+    sleeps++;
+    sleptAtMs = millis();
+}
+void LCD_1IN28_SleepOut(void) {
+    panelAwake = true;
+    sleepOuts++;
+}
+void LCD_1IN28_DisplayOn(void) {
+    displayOn = true;
+    displayOnAtMs = millis();
+}
+UBYTE LCD_1IN28_IsOn(void) { return displayOn; }
+void LCD_1IN28_Display(const UWORD *Image) {
+    (void)Image;
+    refreshes++;
+}
+void LCD_1IN28_DisplayRows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, const UWORD *Rows, UWORD Stride) {
+    (void)Xstart; (void)Ystart; (void)Xend; (void)Yend; (void)Rows; (void)Stride;
+}
+UBYTE LCD_1IN28_StartWindow(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend) {
+    (void)Xstart; (void)Ystart; (void)Xend; (void)Yend;
+    return 1;
+}
+void LCD_1IN28_WritePixels(const UWORD *Pixels, UWORD Count) { (void)Pixels; (void)Count; }
+
+enum TraceKind : uint8_t { ACTIVITY, AMBIENT };
+
+struct TraceEvent {
+    uint32_t atMs;        // from the start of the replay
+    TraceKind kind;
+    uint16_t clear;
+};
+
+struct Transition {
+    uint32_t ms;
+    DisplayPowerState state;
+};
+
+static DisplayPower display;
+static uint32_t nextUpdateMs = 0;
+static double referenceMAs = 0;
+static std::vector<Transition> transitions;
+
+static void runUpdate() {
+    DisplayPowerState before = display.state();
+    nextUpdateMs = millis() + display.update();
+    if (display.state() != before) transitions.push_back({millis(), display.state()});
+}
+
+static void apply(const TraceEvent& ev) {
+    DisplayPowerState before = display.state();
+    if (ev.kind == ACTIVITY) display.activity();
+    else display.setAmbient(ev.clear);
+    if (display.state() != before) transitions.push_back({millis(), display.state()});
+    runUpdate();
+}
+
+// Replays the trace over ms milliseconds, 1 ms at a time
+static void replay(uint32_t ms, const TraceEvent* trace = nullptr, size_t count = 0) {
+    size_t next = 0;
+    for (uint32_t t = 0; t < ms; t++) {
+        while (next < count && trace[next].atMs == t) apply(trace[next++]);
+        if ((int32_t)(millis() - nextUpdateMs) >= 0) runUpdate();
+        float ma = (panelAwake ? PANEL_AWAKE_MA : PANEL_ASLEEP_MA) + BACKLIGHT_FULL_MA * backlight / 100.0f;
+        referenceMAs += ma / 1000.0;
+        hostAdvanceUs(1000);
+    }
+}
+
+static void clearRecords() {
+    pwm.clear();
+    transitions.clear();
+}
+
+// The PWM writes from index from on step by at most 2 %, 20 ms apart, and
+// the last one lands on target
+static bool rampsTo(size_t from, uint8_t target) {
+    if (from >= pwm.size() || pwm.back().value != target) return false;
+    for (size_t i = from + 1; i < pwm.size(); i++) {
+        int step = (int)pwm[i].value - pwm[i - 1].value;
+        if (step == 0 || abs(step) > 2 || pwm[i].ms - pwm[i - 1].ms != 20) return false;
+    }
+    return true;
+}
+
+// Ambient light sets the active brightness, reached in 2 % steps
+static void testAmbientRamp() {
+    clearRecords();
+    TraceEvent dark[] = {{0, AMBIENT, 0}};          // minimum, 15 %
+    TraceEvent full[] = {{0, AMBIENT, 1500}};
+    TraceEvent half[] = {{0, AMBIENT, 750}};        // 15 + 85 / 2
+    TraceEvent glare[] = {{0, AMBIENT, 4000}};      // clamped to full
+    uint32_t start = millis();
+    replay(2000, dark, 1);
+    CHECK_EQ(pwm.size(), 43);     // 100 -> 16 in 2 % steps, then 15
+    CHECK(rampsTo(0, 15));
+    CHECK_EQ(pwm.front().ms, start);   // the reading applies at once
+
+    size_t mark = pwm.size();
+    replay(2000, full, 1);
+    CHECK(rampsTo(mark, 100));
+    mark = pwm.size();
+    replay(2000, half, 1);
+    CHECK(rampsTo(mark, 57));
+    replay(2000, glare, 1);
+    CHECK_EQ(display.brightness(), 100);
+    CHECK(transitions.empty());
+}
+
+// No activity: dim after 60 s, off after 300 s; the controller sleeps only
+// once the backlight is dark. Activity wakes it with the backlight held off
+// until display-on, and catches up on the frame.
+static void testDimOffAndWake() {
+    clearRecords();
+    uint32_t start = millis();
+    TraceEvent trace[] = {
+        {0, ACTIVITY, 0},
+        {30000, ACTIVITY, 0},           // restarts the idle timer
+        {40000, AMBIENT, 1500},         // readings are not activity
+    };
+    replay(340000, trace, 3);
+
+    CHECK_EQ(transitions.size(), 2);
+    if (transitions.size() == 2) {
+        CHECK_EQ(transitions[0].state, DISPLAY_DIMMED);
+        CHECK(transitions[0].ms >= start + 90000 && transitions[0].ms <= start + 91000);
+        CHECK_EQ(transitions[1].state, DISPLAY_OFF);
+        CHECK(transitions[1].ms >= start + 330000 && transitions[1].ms <= start + 331000);
+    }
+    CHECK_EQ(display.brightness(), 0);
+    CHECK_EQ(sleeps, 1);
+    CHECK(!display.isOn());
+    // Dimmed to a quarter, then faded out before the controller slept
+    bool dimmedTo25 = false;
+    for (const PwmWrite& w : pwm) {
+        if (w.value == 25) dimmedTo25 = true;
+        CHECK(w.value == 0 || w.ms < sleptAtMs);
+    }
+    CHECK(dimmedTo25);
+    CHECK(sleptAtMs >= transitions.back().ms);
+
+    clearRecords();
+    uint32_t refreshesBefore = refreshes;
+    uint32_t wokeAt = millis();
+    TraceEvent touch[] = {{0, ACTIVITY, 0}};
+    replay(100, touch, 1);
+    CHECK_EQ(sleepOuts, 1);
+    CHECK(!display.isOn());
+    CHECK(pwm.empty());                 // dark until the panel shows a frame
+    replay(1900);
+    CHECK(display.isOn());
+    CHECK_EQ(displayOnAtMs, wokeAt + LCD_1IN28_SLEEP_OUT_MS);
+    CHECK_EQ(refreshes, refreshesBefore + 1);
+    CHECK(!pwm.empty() && pwm.front().ms >= displayOnAtMs);
+    CHECK(rampsTo(0, 100));
+    CHECK_EQ(transitions.size(), 1);
+    CHECK_EQ(display.state(), DISPLAY_ACTIVE);
+}
+
+// Power saving caps the backlight and shortens both timeouts; 0 restores
+// the defaults
+static void testLimits() {
+    clearRecords();
+    uint32_t start = millis();
+    display.setLimits(50, 20000, 60000);
+    replay(2000);
+    CHECK_EQ(display.brightness(), 50);
+    replay(68000);
+    CHECK_EQ(transitions.size(), 2);
+    if (transitions.size() == 2) {
+        CHECK(transitions[0].ms - start <= 21000);
+        CHECK(transitions[1].ms - start <= 61000);
+    }
+    bool dimmedTo12 = false;
+    for (const PwmWrite& w : pwm) if (w.value == 12) dimmedTo12 = true;
+    CHECK(dimmedTo12);
+    CHECK_EQ(display.brightness(), 0);
+
+    // Critical: 20 %, dimmed to the 5 % floor
+    clearRecords();
+    display.setLimits(20, 5000, 15000);
+    TraceEvent touch[] = {{0, ACTIVITY, 0}};
+    replay(3000, touch, 1);
+    CHECK_EQ(display.brightness(), 20);
+    replay(5000);
+    CHECK_EQ(display.state(), DISPLAY_DIMMED);
+    CHECK_EQ(display.brightness(), 5);
+
+    // Back to normal: full brightness and the 60 s timeout again
+    clearRecords();
+    display.setLimits(0);
+    replay(1000, touch, 1);
+    replay(2000);
+    CHECK_EQ(display.brightness(), 100);
+    replay(50000);
+    CHECK_EQ(display.state(), DISPLAY_ACTIVE);
+}
+
+// The estimate follows the documented model; it counts the panel as asleep
+// from the off transition rather than from the end of the fade, a few mA*s
+// over the whole replay
+static void testEnergy() {
+    double estimate = display.energyUsed();
+    CHECK(fabs(estimate - referenceMAs) < referenceMAs * 0.001);
+
+    // Steady state: panel on, backlight at 100 %, for 10 s
+    TraceEvent touch[] = {{0, ACTIVITY, 0}};
+    replay(1, touch, 1);
+    double before = display.energyUsed();
+    replay(10000, touch, 1);
+    CHECK(fabs(display.energyUsed() - before - 10 * (PANEL_AWAKE_MA + BACKLIGHT_FULL_MA)) < 0.01);
+
+    // Off: only the sleeping controller, 100 s of it
+    replay(301000);
+    CHECK_EQ(display.state(), DISPLAY_OFF);
+    CHECK_EQ(display.brightness(), 0);
+    before = display.energyUsed();
+    replay(100000);
+    CHECK(fabs(display.energyUsed() - before - 100 * PANEL_ASLEEP_MA) < 0.01);
+}
+
+int main() {
+    FrameBuffers.begin(LCD_1IN28_WIDTH, LCD_1IN28_HEIGHT, 1);
+    display.begin(100);
+    nextUpdateMs = millis() + display.update();
+
+    testAmbientRamp();
+    testDimOffAndWake();
+    testLimits();
+    testEnergy();
+    return checkResult("display_power_test");
+}
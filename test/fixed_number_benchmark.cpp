@@ -0,0 +1,91 @@
+#include "src/screen/GUI_Paint.h"
+#include "src/screen/FrameBuffer.h"
+#include "src/fonts/fonts.h"
+#include "check.h"
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+
+// A five-glyph reading ("%5.1f" of a temperature) updated over and over:
+// Paint_DrawFixed against sprintf of the double and Paint_DrawString_EN,
+// and Paint_DrawFixedAA from its digit atlas against sprintf and
+// Paint_DrawStringAA. Checks that both ways paint the same pixels for
+// every value; the ns per update are host times for comparison only and
+// are not checked.
+static const UWORD W = 240, H = 40;
+static const int VALUES = 1000;
+static const int TIMED_ROUNDS = 20;
+static const UWORD FG = BLACK, BG = WHITE;
+
+static UWORD image[W * H];
+static UWORD reference[W * H];
+
+// Tenths of a degree, -99.9 .. 99.9
+static int32_t tenths(int i) {
+    return (int32_t)((i * 7919) % 1999) - 999;
+}
+
+static void fixed(int i) {
+    Paint_DrawFixed(10, 4, tenths(i), 1, 5, &Font16, FG, BG);
+}
+
+// The colors go to Paint_DrawChar swapped, see fixed_number_test
+static void printed(int i) {
+    char text[16];
+    sprintf(text, "%5.1f", tenths(i) / 10.0);
+    Paint_DrawString_EN(10, 4, text, &Font16, BG, FG);
+}
+
+static void fixedAA(int i) {
+    Paint_DrawFixedAA(10, 4, tenths(i), 1, 5, &FontAA16, FG, BG);
+}
+
+static void printedAA(int i) {
+    char text[16];
+    sprintf(text, "%5.1f", tenths(i) / 10.0);
+    Paint_DrawStringAA(10, 4, text, &FontAA16, FG, BG);
+}
+
+static void select(UWORD* buffer) {
+    Paint_NewImage((UBYTE*)buffer, W, H, 0, WHITE);
+    Paint_SetScale(65);
+}
+
+// Values where the two functions paint differently
+template <typename A, typename B>
+static int mismatches(A a, B b) {
+    int n = 0;
+    for (int i = 0; i < VALUES; i++) {
+        select(image);
+        Paint_Clear(GRAY);
+        a(i);
+        select(reference);
+        Paint_Clear(GRAY);
+        b(i);
+        if (memcmp(image, reference, sizeof(image))) n++;
+    }
+    return n;
+}
+
+template <typename Fn>
+static double nsPer(Fn fn) {
+    select(image);
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < TIMED_ROUNDS; r++) {
+        for (int i = 0; i < VALUES; i++) fn(i);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (TIMED_ROUNDS * VALUES);
+}
+
+int main() {
+    CHECK_EQ(mismatches(fixed, printed), 0);
+    CHECK_EQ(mismatches(fixedAA, printedAA), 0);
+
+    double fixedNs = nsPer(fixed), printedNs = nsPer(printed);
+    double fixedAANs = nsPer(fixedAA), printedAANs = nsPer(printedAA);
+    printf("fixed_number_benchmark: fixed_ns=%.0f sprintf_string_ns=%.0f "
+           "fixed_aa_ns=%.0f sprintf_string_aa_ns=%.0f\n",
+           fixedNs, printedNs, fixedAANs, printedAANs);
+    return checkResult("fixed_number_benchmark");
+}
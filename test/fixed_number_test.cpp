@@ -0,0 +1,153 @@
+#include "src/screen/GUI_Paint.h"
+#include "src/screen/FrameBuffer.h"
+#include "src/fonts/fonts.h"
+#include "check.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Paint_DrawFixed and Paint_DrawFixedAA against the text sprintf makes of
+// the same value, drawn by the string functions: padding, negatives,
+// INT32_MIN and decimals must come out pixel for pixel the same, and
+// nothing may be painted outside the glyphs. The AA version puts every
+// glyph in one digit advance, '-' and '.' centered in theirs, so its
+// reference is each sprintf character drawn into such a cell.
+static const UWORD W = 240, H = 32;
+static const UWORD UNTOUCHED = 0x1234;
+static const UWORD X = 3, Y = 2;
+static const UWORD FG = BLACK, BG = 0xFA20;
+
+static UWORD drawn[W * H];
+static UWORD expected[W * H];
+static UWORD scratch[W * H];
+
+struct FixedCase {
+    int32_t number;
+    UBYTE decimals, minWidth;
+};
+
+static const FixedCase CASES[] = {
+    {0, 0, 0},
+    {7, 0, 4},
+    {-7, 0, 4},
+    {42, 0, 1},                 // wider than Min_Width
+    {0, 2, 0},
+    {1234, 2, 0},
+    {-5, 2, 0},                 // "-0.05"
+    {5, 3, 7},
+    {-100, 1, 6},
+    {INT32_MAX, 0, 0},
+    {INT32_MIN, 0, 0},
+    {INT32_MIN, 2, 14},
+    {INT32_MAX, 9, 0},          // "2.147483647"
+    {-123456789, 4, 16},
+};
+
+// The reference text: "%*d" for integers, sign, whole part, point and the
+// zero-padded fraction otherwise
+static void format(char* out, size_t size, const FixedCase& c) {
+    char digits[32];
+    if (c.decimals == 0) {
+        snprintf(digits, sizeof(digits), "%ld", (long)c.number);
+    } else {
+        int decimals = c.decimals > 9 ? 9 : c.decimals;     // as Paint_FormatNumber
+        long long scale = 1;
+        for (int i = 0; i < decimals; i++) scale *= 10;
+        long long magnitude = llabs((long long)c.number);
+        snprintf(digits, sizeof(digits), "%s%lld.%0*lld", c.number < 0 ? "-" : "",
+                 magnitude / scale, decimals, magnitude % scale);
+    }
+    snprintf(out, size, "%*s", (int)c.minWidth, digits);
+}
+
+static void clear(UWORD* image) {
+    Paint_NewImage((UBYTE*)image, W, H, 0, WHITE);
+    Paint_SetScale(65);
+    Paint_ClearWindows(0, 0, W, H, UNTOUCHED);
+}
+
+static void testFixed() {
+    static sFONT* const FONTS[] = {&Font8, &Font12, &Font16, &Font20};
+    for (sFONT* font : FONTS) {
+        int bad = 0;
+        for (const FixedCase& c : CASES) {
+            char text[32];
+            format(text, sizeof(text), c);
+            if (strlen(text) * font->Width > W - X) continue;
+            clear(drawn);
+            UWORD width = Paint_DrawFixed(X, Y, c.number, c.decimals, c.minWidth, font, FG, BG);
+            // Paint_DrawString_EN hands its colors to Paint_DrawChar swapped
+            clear(expected);
+            Paint_DrawString_EN(X, Y, text, font, BG, FG);
+            if (memcmp(drawn, expected, sizeof(drawn))) bad++;
+            if (width != strlen(text) * font->Width) bad++;
+        }
+        CHECK_EQ(bad, 0);
+    }
+}
+
+// Each character of text in its digit cell, clipped to the cell
+static void drawCells(const char* text, const sFONT_AA* font) {
+    UWORD cell = Paint_DigitWidthAA(font);
+    clear(expected);
+    for (UWORD i = 0; text[i]; i++) {
+        UWORD x = X + i * cell;
+        char one[2] = {text[i], 0};
+        UWORD advance = Paint_MeasureStringAA(one, font);
+        UWORD shift = advance < cell ? (cell - advance) / 2 : 0;
+        clear(scratch);
+        Paint_ClearWindows(x, Y, x + cell, Y + font->Height, BG);
+        Paint_DrawCharAA(x + shift, Y, text[i], font, FG, BG);
+        for (UWORD y = Y; y < Y + font->Height; y++) {
+            memcpy(&expected[y * W + x], &scratch[y * W + x], cell * sizeof(UWORD));
+        }
+    }
+}
+
+static bool isMirrorOf(const UWORD* image, const UWORD* reference) {
+    for (UWORD y = 0; y < H; y++) {
+        for (UWORD x = 0; x < W; x++) {
+            if (image[y * W + W - 1 - x] != reference[y * W + x]) return false;
+        }
+    }
+    return true;
+}
+
+static void testFixedAA() {
+    static const sFONT_AA* const FONTS[] = {&FontAA12, &FontAA16, &FontSans12, &FontSans16};
+    for (const sFONT_AA* font : FONTS) {
+        UWORD cell = Paint_DigitWidthAA(font);
+        int bad = 0;
+        for (const FixedCase& c : CASES) {
+            char text[32];
+            format(text, sizeof(text), c);
+            if (strlen(text) * cell > W - X) continue;
+            drawCells(text, font);
+
+            // Atlas rows, and the per-pixel path a mirrored image takes
+            // (the same picture flipped)
+            clear(drawn);
+            UWORD width = Paint_DrawFixedAA(X, Y, c.number, c.decimals, c.minWidth, font, FG, BG);
+            if (memcmp(drawn, expected, sizeof(drawn))) bad++;
+            if (width != strlen(text) * cell) bad++;
+            clear(drawn);
+            Paint_SetMirroring(MIRROR_HORIZONTAL);
+            Paint_DrawFixedAA(X, Y, c.number, c.decimals, c.minWidth, font, FG, BG);
+            if (!isMirrorOf(drawn, expected)) bad++;
+
+            // Monospaced: the whole string drawn as text is the same
+            if (font->Advance == NULL) {
+                clear(drawn);
+                Paint_DrawStringAA(X, Y, text, font, FG, BG);
+                if (memcmp(drawn, expected, sizeof(drawn))) bad++;
+            }
+        }
+        CHECK_EQ(bad, 0);
+    }
+}
+
+int main() {
+    testFixed();
+    testFixedAA();
+    return checkResult("fixed_number_test");
+}
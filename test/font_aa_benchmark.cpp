@@ -0,0 +1,71 @@
+#include "src/screen/GUI_Paint.h"
+#include "src/fonts/fonts.h"
+#include "check.h"
+#include <chrono>
+
+// Glyphs per second into a 240x240 RGB565 image: the 1-bpp Font16 through
+// Paint_DrawChar against the 16 px anti-aliased fonts through
+// Paint_DrawCharAA, on its row path and on its per-pixel path (taken here
+// by a mirrored image). Every printable character in turn, line by line
+// across the screen. Host times for comparison only; nothing is checked
+// beyond the run completing.
+static const UWORD W = 240, H = 240;
+static const int TIMED_GLYPHS = 40000;
+
+static UWORD image[W * H];
+
+struct Pen {
+    UWORD x = 0, y = 0;
+    char c = ' ';
+
+    // Next character and where it goes, wrapping at the edges
+    void advance(UWORD w, UWORD h) {
+        c = c == '~' ? ' ' : c + 1;
+        x += w;
+        if (x + w > W) {
+            x = 0;
+            y += h;
+            if (y + h > H) y = 0;
+        }
+    }
+};
+
+template <typename Fn>
+static double glyphsPerSec(UWORD w, UWORD h, Fn draw) {
+    Pen pen;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < TIMED_GLYPHS; i++) {
+        draw(pen);
+        pen.advance(w, h);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return TIMED_GLYPHS / std::chrono::duration<double>(end - start).count();
+}
+
+static double aa(const sFONT_AA* font, UBYTE mirror) {
+    Paint_SetMirroring(mirror);
+    double rate = glyphsPerSec(font->Width, font->Height, [font](const Pen& p) {
+        Paint_DrawCharAA(p.x, p.y, p.c, font, BLACK, WHITE);
+    });
+    Paint_SetMirroring(MIRROR_NONE);
+    return rate;
+}
+
+int main() {
+    Paint_NewImage((UBYTE*)image, W, H, 0, WHITE);
+    Paint_SetScale(65);
+    Paint_Clear(WHITE);
+
+    double mono = glyphsPerSec(Font16.Width, Font16.Height, [](const Pen& p) {
+        Paint_DrawChar(p.x, p.y, p.c, &Font16, WHITE, BLACK);
+    });
+    double aaRows = aa(&FontAA16, MIRROR_NONE);
+    double aaPixels = aa(&FontAA16, MIRROR_HORIZONTAL);
+    double sansRows = aa(&FontSans16, MIRROR_NONE);
+    double sansPixels = aa(&FontSans16, MIRROR_HORIZONTAL);
+
+    printf("font_aa_benchmark: glyphs/s font16_1bpp=%.0f fontaa16_rows=%.0f fontaa16_setpixel=%.0f "
+           "fontsans16_rows=%.0f fontsans16_setpixel=%.0f\n",
+           mono, aaRows, aaPixels, sansRows, sansPixels);
+    return checkResult("font_aa_benchmark");
+}
@@ -0,0 +1,99 @@
+#include "src/screen/GUI_Paint.h"
+#include "src/screen/FrameBuffer.h"
+#include "src/fonts/fonts.h"
+#include "check.h"
+#include <string.h>
+
+// Paint_DrawCharAA's row path (RGB565, unrotated) against its per-pixel
+// path through Paint_SetPixel, which a horizontally mirrored image takes:
+// every glyph of every AA font, over a patterned background so that
+// skipped (transparent) pixels count, at the edges and inside a strip.
+static const UWORD W = 64, H = 40;
+static UWORD rows[W * H];
+static UWORD mirrored[W * H];
+static UWORD strip[W * 9];         // 8 rows and a guard row
+
+static const sFONT_AA* const FONTS[] = {&FontAA12, &FontAA16, &FontSans12, &FontSans16};
+static const UWORD COLORS[][2] = {{BLACK, WHITE}, {WHITE, 0x229F}, {0xFA20, 0x07E0}};
+
+static UWORD pattern(UWORD x, UWORD y) {
+    return (UWORD)((x * 0x0841 + y * 0x1003) ^ 0x5A5A);
+}
+
+static void fill(UWORD* image, bool mirror) {
+    for (UWORD y = 0; y < H; y++) {
+        for (UWORD x = 0; x < W; x++) image[y * W + (mirror ? W - 1 - x : x)] = pattern(x, y);
+    }
+}
+
+static void drawInto(UWORD* image, UBYTE mirror, UWORD x, UWORD y, char c, const sFONT_AA* font,
+                     UWORD fg, UWORD bg) {
+    Paint_NewImage((UBYTE*)image, W, H, 0, WHITE);
+    Paint_SetScale(65);
+    Paint_SetMirroring(mirror);
+    Paint_DrawCharAA(x, y, c, font, fg, bg);
+}
+
+static bool sameAsMirrored() {
+    for (UWORD y = 0; y < H; y++) {
+        for (UWORD x = 0; x < W; x++) {
+            if (rows[y * W + x] != mirrored[y * W + W - 1 - x]) return false;
+        }
+    }
+    return true;
+}
+
+// At (x, y), both paths; glyphs that differ are counted
+static int differingGlyphs(UWORD x, UWORD y) {
+    int bad = 0;
+    for (const sFONT_AA* font : FONTS) {
+        for (const auto& col : COLORS) {
+            for (char c = ' '; c <= '~'; c++) {
+                fill(rows, false);
+                fill(mirrored, true);
+                drawInto(rows, MIRROR_NONE, x, y, c, font, col[0], col[1]);
+                drawInto(mirrored, MIRROR_HORIZONTAL, x, y, c, font, col[0], col[1]);
+                if (!sameAsMirrored()) bad++;
+            }
+        }
+    }
+    return bad;
+}
+
+static void testRowPath() {
+    CHECK_EQ(differingGlyphs(3, 2), 0);
+    // Cut off by the right edge, and with the last column on it
+    CHECK_EQ(differingGlyphs(W - 5, 2), 0);
+    CHECK_EQ(differingGlyphs(W - 1, 2), 0);
+    // Bottom rows past the image
+    CHECK_EQ(differingGlyphs(10, H - 6), 0);
+}
+
+// Drawn into a strip of rows 8..16, a glyph lands exactly as in the
+// full image and nothing outside the strip is touched
+static void testStrip() {
+    int bad = 0;
+    for (const sFONT_AA* font : FONTS) {
+        for (char c = ' '; c <= '~'; c++) {
+            fill(rows, false);
+            drawInto(rows, MIRROR_NONE, 7, 3, c, font, BLACK, WHITE);
+
+            fill(mirrored, false);
+            memcpy(strip, &mirrored[8 * W], W * 8 * 2);
+            for (UWORD x = 0; x < W; x++) strip[8 * W + x] = 0xA5A5;
+            Paint_NewImage(NULL, W, H, 0, WHITE);
+            Paint_SetScale(65);
+            Paint_SelectStrip((UBYTE*)strip, 8, 16);
+            Paint_DrawCharAA(7, 3, c, font, BLACK, WHITE);
+            if (memcmp(strip, &rows[8 * W], W * 8 * 2)) bad++;
+            for (UWORD x = 0; x < W; x++) if (strip[8 * W + x] != 0xA5A5) bad++;
+        }
+    }
+    CHECK_EQ(bad, 0);
+}
+
+int main() {
+    testRowPath();
+    testStrip();
+    return checkResult("font_aa_test");
+}
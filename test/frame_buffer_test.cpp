@@ -0,0 +1,196 @@
+#include "src/screen/FrameBuffer.h"
+#include "src/screen/LCD_1in28.h"
+#include "src/screen/GUI_Paint.h"
+#include "src/screen/RoundMask.h"
+#include "check.h"
+
+// Stand-in panel: records what reaches the bus and lets a test look at the
+// buffer states while a transfer is running.
+struct PanelSend {
+    UWORD x0, y0, x1, y1;
+};
+
+static PanelSend sends[64];
+static int sendCount = 0;
+static void (*duringSend)() = nullptr;
+
+static void recordSend(UWORD x0, UWORD y0, UWORD x1, UWORD y1) {
+    if (sendCount < 64) sends[sendCount] = {x0, y0, x1, y1};
+    sendCount++;
+    if (duringSend) duringSend();
+}
+
+void LCD_1IN28_Display(const UWORD *Image) {
+    (void)Image;
+    recordSend(0, 0, LCD_1IN28_WIDTH, LCD_1IN28_HEIGHT);
+}
+void LCD_1IN28_DisplayRows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, const UWORD *Rows, UWORD Stride) {
+    (void)Rows; (void)Stride;
+    recordSend(Xstart, Ystart, Xend, Yend);
+}
+UBYTE LCD_1IN28_StartWindow(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend) {
+    recordSend(Xstart, Ystart, Xend, Yend);
+    return 1;
+}
+void LCD_1IN28_WritePixels(const UWORD *Pixels, UWORD Count) { (void)Pixels; (void)Count; }
+
+static FrameBufferManager fbm;
+
+#if !FB_STRIP_RENDER
+// The frame a draw callback or transfer runs on, found by its state
+static FbPixel* bufferIn(FrameBufferState s) {
+    FbPixel* candidates[2] = {fbm.front(), fbm.back()};
+    for (FbPixel* fb : candidates) if (fbm.state(fb) == s) return fb;
+    return nullptr;
+}
+#endif
+
+struct DrawProbe {
+    int calls;
+    int rendering;         // buffers seen in FB_RENDERING, summed over calls
+    int refusedInside;     // present/flush/acquire attempts refused while drawing
+};
+
+static void drawAndMisbehave(void* ctx) {
+    DrawProbe* p = (DrawProbe*)ctx;
+    p->calls++;
+    Paint_Clear(WHITE);
+#if !FB_STRIP_RENDER
+    FbPixel* fb = bufferIn(FB_RENDERING);
+    if (fb) {
+        p->rendering++;
+        if (!fbm.present(fb)) p->refusedInside++;
+        if (!fbm.flushWindow(fb, 0, 0, 10, 10)) p->refusedInside++;
+        if (!fbm.acquire(fb)) p->refusedInside++;
+    }
+#else
+    p->rendering++;
+#endif
+}
+
+#if !FB_STRIP_RENDER
+static int flushingSeen = 0;
+static int refusedWhileFlushing = 0;
+
+static void checkFlushing() {
+    FbPixel* fb = bufferIn(FB_FLUSHING);
+    if (fb) {
+        flushingSeen++;
+        if (!fbm.acquire(fb)) refusedWhileFlushing++;
+        if (!fbm.present(fb)) refusedWhileFlushing++;
+    }
+}
+#endif
+
+static void testBegin() {
+    RoundMask_Init(LCD_1IN28_WIDTH, LCD_1IN28_HEIGHT, LCD_1IN28_WINDOW_OVERHEAD);
+#if FB_STRIP_RENDER
+    CHECK_EQ(fbm.begin(LCD_1IN28_WIDTH, LCD_1IN28_HEIGHT, 2), 2);
+    // Strips are not frames: drawing outside render() must find no image
+    CHECK(fbm.front() == nullptr);
+    CHECK(fbm.back() == nullptr);
+#else
+    CHECK_EQ(fbm.begin(LCD_1IN28_WIDTH, LCD_1IN28_HEIGHT, 2), 2);
+    CHECK(fbm.front() != fbm.back());
+    CHECK_EQ(fbm.state(fbm.front()), FB_IDLE);
+    CHECK_EQ(fbm.state(fbm.back()), FB_IDLE);
+#endif
+}
+
+// idle -> rendering -> idle -> flushing -> idle, with every out-of-turn
+// request refused and counted
+static void testOwnership() {
+#if !FB_STRIP_RENDER
+    FbPixel* fb = fbm.front();
+    uint32_t before = fbm.violations();
+
+    fbm.release(fb);                                 // not rendering
+    CHECK_EQ(fbm.violations(), before + 1);
+    int dummy;
+    CHECK(!fbm.acquire((FbPixel*)&dummy));           // not ours
+    CHECK_EQ(fbm.violations(), before + 2);
+
+    CHECK(fbm.acquire(fb));
+    CHECK_EQ(fbm.state(fb), FB_RENDERING);
+    CHECK(!fbm.acquire(fb));
+    sendCount = 0;
+    CHECK(!fbm.present(fb));
+    CHECK(!fbm.flushWindow(fb, 0, 0, 8, 8));
+    CHECK_EQ(sendCount, 0);                          // nothing reached the panel
+    CHECK_EQ(fbm.violations(), before + 5);
+    fbm.release(fb);
+    CHECK_EQ(fbm.state(fb), FB_IDLE);
+
+    duringSend = checkFlushing;
+    flushingSeen = refusedWhileFlushing = 0;
+    CHECK(fbm.present(fb));
+    duringSend = nullptr;
+    CHECK_EQ(fbm.state(fb), FB_IDLE);
+    CHECK(flushingSeen >= 1);
+    CHECK_EQ(refusedWhileFlushing, 2 * flushingSeen);
+    CHECK_EQ(fbm.violations(), before + 5 + refusedWhileFlushing);
+#endif
+}
+
+static void testRenderFrame() {
+    DrawProbe probe = {0, 0, 0};
+    uint32_t before = fbm.violations();
+    sendCount = 0;
+#if FB_STRIP_RENDER
+    CHECK(fbm.renderFrame(drawAndMisbehave, &probe));
+    // One draw per strip, and only visible spans of the round panel sent
+    CHECK_EQ(probe.calls, LCD_1IN28_HEIGHT / FB_STRIP_ROWS);
+    CHECK_EQ(sendCount, LCD_1IN28_HEIGHT / FB_STRIP_ROWS);
+    CHECK(sends[0].x0 > 0 && sends[0].x1 < LCD_1IN28_WIDTH);
+    CHECK_EQ(sends[0].y1 - sends[0].y0, FB_STRIP_ROWS);
+    CHECK_EQ(fbm.violations(), before);
+#else
+    FbPixel* oldFront = fbm.front();
+    FbPixel* oldBack = fbm.back();
+    CHECK(fbm.renderFrame(drawAndMisbehave, &probe));
+    CHECK_EQ(probe.calls, 1);
+    CHECK_EQ(probe.rendering, 1);
+    CHECK_EQ(probe.refusedInside, 3);
+    CHECK_EQ(fbm.violations(), before + 3);
+    // Drawn into the back buffer, then presented and swapped
+    CHECK(fbm.front() == oldBack);
+    CHECK(fbm.back() == oldFront);
+    CHECK_EQ(fbm.state(oldFront), FB_IDLE);
+    CHECK_EQ(fbm.state(oldBack), FB_IDLE);
+    CHECK(sendCount >= 1);
+#endif
+}
+
+static void testPartialRender() {
+    DrawProbe probe = {0, 0, 0};
+    sendCount = 0;
+    CHECK(fbm.render(40, 20, 200, 60, drawAndMisbehave, &probe));
+#if FB_STRIP_RENDER
+    // Rows 20..60 in strips of 16: 20-36, 36-52, 52-60
+    CHECK_EQ(probe.calls, 3);
+    CHECK_EQ(sendCount, 3);
+    CHECK_EQ(sends[0].y0, 20);
+    CHECK_EQ(sends[2].y1, 60);
+#else
+    CHECK_EQ(sendCount, 1);
+    CHECK_EQ(sends[0].x0, 40);
+    CHECK_EQ(sends[0].y0, 20);
+    CHECK_EQ(sends[0].x1, 200);
+    CHECK_EQ(sends[0].y1, 60);
+    CHECK_EQ(fbm.state(fbm.front()), FB_IDLE);
+#endif
+}
+
+int main() {
+    testBegin();
+    testOwnership();
+    testRenderFrame();
+    testPartialRender();
+#if FB_STRIP_RENDER
+    return checkResult("frame_buffer_test (strips)");
+#elif FB_PALETTE
+    return checkResult("frame_buffer_test (palette)");
+#else
+    return checkResult("frame_buffer_test");
+#endif
+}
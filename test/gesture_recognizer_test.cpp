@@ -0,0 +1,169 @@
+#include "src/touchsensor/GestureRecognizer.h"
+#include "check.h"
+
+// Each case is a sequence of touch reports and tick() calls, with the
+// gesture (or NONE) each step must produce.
+enum StepKind : uint8_t { DOWN, CONTACT, UP, TICK };
+
+struct Step {
+    StepKind kind;
+    uint32_t t;
+    uint16_t x, y;
+    TouchGesture expect;
+};
+
+struct GestureCase {
+    const char* name;
+    Step steps[8];
+    int count;
+};
+
+static const TouchGesture NONE = TOUCH_GESTURE_NONE;
+
+static const GestureCase CASES[] = {
+    {"tap", {
+        {DOWN, 0, 120, 120, NONE},
+        {CONTACT, 40, 122, 119, NONE},
+        {UP, 80, 0, 0, TOUCH_GESTURE_TAP},
+    }, 3},
+    {"tap within slop", {
+        {DOWN, 0, 120, 120, NONE},
+        {UP, 100, 132, 108, TOUCH_GESTURE_TAP},
+    }, 2},
+    {"stray up while idle", {
+        {UP, 0, 120, 120, NONE},
+        {TICK, 500, 0, 0, NONE},
+    }, 2},
+    {"long press", {
+        {DOWN, 0, 120, 120, NONE},
+        {CONTACT, 100, 121, 120, NONE},
+        {TICK, 120, 0, 0, NONE},
+        {CONTACT, 580, 121, 121, NONE},
+        {TICK, 600, 0, 0, TOUCH_GESTURE_LONG_PRESS},
+        {CONTACT, 700, 121, 121, NONE},
+        {TICK, 720, 0, 0, NONE},           // reported once only
+        {UP, 800, 0, 0, NONE},             // no tap on release
+    }, 8},
+    {"held but moved is not a long press", {
+        {DOWN, 0, 120, 120, NONE},
+        {CONTACT, 580, 140, 120, NONE},
+        {TICK, 600, 0, 0, NONE},
+        {UP, 650, 0, 0, NONE},             // 20 px: past tap slop, short of a swipe
+    }, 4},
+    {"swipe right", {
+        {DOWN, 0, 60, 120, NONE},
+        {CONTACT, 50, 120, 125, NONE},
+        {CONTACT, 100, 180, 130, NONE},
+        {UP, 110, 0, 0, TOUCH_GESTURE_SWIPE_RIGHT},
+    }, 4},
+    {"swipe left", {
+        {DOWN, 0, 180, 120, NONE},
+        {CONTACT, 100, 100, 110, NONE},
+        {UP, 120, 0, 0, TOUCH_GESTURE_SWIPE_LEFT},
+    }, 3},
+    {"swipe up", {
+        {DOWN, 0, 120, 180, NONE},
+        {CONTACT, 100, 110, 100, NONE},
+        {UP, 120, 0, 0, TOUCH_GESTURE_SWIPE_UP},
+    }, 3},
+    {"swipe down", {
+        {DOWN, 0, 120, 60, NONE},
+        {CONTACT, 100, 130, 140, NONE},
+        {UP, 120, 0, 0, TOUCH_GESTURE_SWIPE_DOWN},
+    }, 3},
+    {"fast swipe", {
+        {DOWN, 0, 20, 120, NONE},
+        {CONTACT, 3, 120, 121, NONE},
+        {UP, 6, 220, 122, TOUCH_GESTURE_SWIPE_RIGHT},
+    }, 3},
+    {"release timeout ends a tap", {
+        {DOWN, 0, 120, 120, NONE},
+        {CONTACT, 50, 121, 121, NONE},
+        {TICK, 200, 0, 0, NONE},           // exactly 150 ms since the last report
+        {TICK, 201, 0, 0, TOUCH_GESTURE_TAP},
+        {TICK, 400, 0, 0, NONE},
+    }, 5},
+    {"release timeout ends a swipe", {
+        {DOWN, 0, 60, 120, NONE},
+        {CONTACT, 80, 180, 120, NONE},
+        {TICK, 231, 0, 0, TOUCH_GESTURE_SWIPE_RIGHT},
+    }, 3},
+    {"reports keep the touch alive", {
+        {DOWN, 0, 120, 120, NONE},
+        {CONTACT, 140, 120, 120, NONE},
+        {TICK, 200, 0, 0, NONE},
+        {CONTACT, 280, 120, 120, NONE},
+        {TICK, 400, 0, 0, NONE},
+        {TICK, 431, 0, 0, TOUCH_GESTURE_TAP},
+    }, 6},
+};
+
+static void testSequences() {
+    for (const GestureCase& gc : CASES) {
+        GestureRecognizer rec;
+        for (int i = 0; i < gc.count; i++) {
+            const Step& s = gc.steps[i];
+            GestureEvent out = {NONE, 0, 0, 0, 0, 0};
+            bool fired;
+            if (s.kind == TICK) {
+                fired = rec.tick(s.t, out);
+            } else {
+                TouchEventType type = s.kind == DOWN ? TOUCH_DOWN :
+                                      s.kind == UP ? TOUCH_UP : TOUCH_CONTACT;
+                fired = rec.feed({s.x, s.y, type, s.t}, out);
+            }
+            TouchGesture got = fired ? out.type : NONE;
+            if (got != s.expect) {
+                fprintf(stderr, "case '%s' step %d: got %s, expected %s\n", gc.name, i,
+                        GestureRecognizer::name(got), GestureRecognizer::name(s.expect));
+                checkFailures++;
+            }
+        }
+        if (rec.isPressed()) {
+            fprintf(stderr, "case '%s': still pressed at the end\n", gc.name);
+            checkFailures++;
+        }
+    }
+}
+
+// A lift-off detected by the timeout is timed from the last report, not
+// from when tick() noticed it
+static void testTimeoutDuration() {
+    GestureRecognizer rec;
+    GestureEvent out;
+    CHECK(!rec.feed({60, 120, TOUCH_DOWN, 1000}, out));
+    CHECK(!rec.feed({160, 120, TOUCH_CONTACT, 1100}, out));
+    CHECK(rec.tick(1400, out));
+    CHECK_EQ(out.type, TOUCH_GESTURE_SWIPE_RIGHT);
+    CHECK_EQ(out.durationMs, 100);
+    CHECK_EQ(out.x, 60);
+    CHECK_EQ(out.y, 120);
+    CHECK_EQ(out.vx, 1000);
+    CHECK_EQ(out.vy, 0);
+}
+
+// Velocities beyond int16_t saturate instead of wrapping around
+static void testFastSwipeVelocity() {
+    GestureRecognizer rec;
+    GestureEvent out;
+    CHECK(!rec.feed({20, 20, TOUCH_DOWN, 0}, out));
+    CHECK(!rec.feed({220, 24, TOUCH_CONTACT, 6}, out));
+    CHECK(rec.feed({220, 24, TOUCH_UP, 6}, out));
+    CHECK_EQ(out.type, TOUCH_GESTURE_SWIPE_RIGHT);
+    CHECK_EQ(out.vx, INT16_MAX);     // 200 px in 6 ms
+    CHECK_EQ(out.vy, 666);
+
+    CHECK(!rec.feed({220, 230, TOUCH_DOWN, 100}, out));
+    CHECK(!rec.feed({210, 10, TOUCH_CONTACT, 104}, out));
+    CHECK(rec.feed({210, 10, TOUCH_UP, 104}, out));
+    CHECK_EQ(out.type, TOUCH_GESTURE_SWIPE_UP);
+    CHECK_EQ(out.vx, -2500);
+    CHECK_EQ(out.vy, INT16_MIN);     // -220 px in 4 ms
+}
+
+int main() {
+    testSequences();
+    testTimeoutDuration();
+    testFastSwipeVelocity();
+    return checkResult("gesture_recognizer_test");
+}
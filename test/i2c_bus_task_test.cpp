@@ -0,0 +1,232 @@
+#include "src/i2c/I2CBus.h"
+#include "check.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// The bus task running on a host thread, shared by the IMU and the touch
+// controller as on i2c1. A gate transaction holds the task on the wire
+// while the test queues traffic behind it, so the order the task picks
+// things up in is deterministic.
+static const uint8_t IMU_ADDR = 0x6B;      // QMI8658, low priority
+static const uint8_t TOUCH_ADDR = 0x15;    // CST816S, high priority
+static const uint8_t GATE_REG = 0x7F;
+static const uint32_t US_PER_BYTE = 10;
+static const uint32_t GATE_WAIT_US = 1000;
+
+struct Transfer {
+    uint8_t addr;
+    uint8_t reg;
+    uint16_t len;
+    bool isRead;
+};
+
+// Registers read back as their own address, plus 0x80 on the touch
+// controller; each transfer takes US_PER_BYTE per byte on the fake clock
+class SharedBus : public WireModel {
+public:
+    std::vector<Transfer> log;
+
+    uint8_t write(uint8_t addr, const uint8_t* data, size_t len, bool stop) override {
+        pointer = data[0];
+        if (stop) {
+            hostAdvanceUs(US_PER_BYTE * len);
+            note({addr, pointer, (uint16_t)(len - 1), false});
+        }
+        return 0;
+    }
+
+    size_t read(uint8_t addr, uint8_t* buf, size_t len) override {
+        if (addr == IMU_ADDR && pointer == GATE_REG) holdGate();
+        hostAdvanceUs(US_PER_BYTE * (len + 1));
+        for (size_t i = 0; i < len; i++) buf[i] = (uint8_t)(pointer + i + (addr == TOUCH_ADDR ? 0x80 : 0));
+        note({addr, pointer, (uint16_t)len, true});
+        return len;
+    }
+
+    void closeGate() {
+        std::lock_guard<std::mutex> guard(m);
+        gateOpen = false;
+        gateHeld = false;
+    }
+    void openGate() {
+        std::lock_guard<std::mutex> guard(m);
+        gateOpen = true;
+        changed.notify_all();
+    }
+    bool waitGateHeld() {
+        std::unique_lock<std::mutex> guard(m);
+        return changed.wait_for(guard, std::chrono::seconds(2), [this] { return gateHeld; });
+    }
+    std::vector<Transfer> takeLog() {
+        std::lock_guard<std::mutex> guard(m);
+        std::vector<Transfer> out;
+        out.swap(log);
+        return out;
+    }
+
+private:
+    uint8_t pointer = 0;
+    std::mutex m;
+    std::condition_variable changed;
+    bool gateOpen = true;
+    bool gateHeld = false;
+
+    void holdGate() {
+        std::unique_lock<std::mutex> guard(m);
+        gateHeld = true;
+        changed.notify_all();
+        changed.wait(guard, [this] { return gateOpen; });
+    }
+    void note(const Transfer& t) {
+        std::lock_guard<std::mutex> guard(m);
+        log.push_back(t);
+    }
+};
+
+static TwoWire wire(1);
+static SharedBus model;
+static I2CBus bus(wire, "i2c1");
+
+// Completions in the order the bus task ran the callbacks
+static std::mutex doneLock;
+static std::vector<int> completed;
+static std::vector<I2CStatus> statuses;
+
+static void onDone(void* ctx, I2CStatus status) {
+    std::lock_guard<std::mutex> guard(doneLock);
+    completed.push_back((int)(intptr_t)ctx);
+    statuses.push_back(status);
+}
+
+static bool readAsync(uint8_t addr, uint8_t reg, uint8_t* buf, uint16_t len, int id) {
+    return bus.readAsync(addr, reg, buf, len, onDone, (void*)(intptr_t)id);
+}
+
+template <typename Pred>
+static bool waitFor(Pred pred) {
+    for (int i = 0; i < 2000 && !pred(); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return pred();
+}
+
+static bool sameTransfer(const Transfer& t, uint8_t addr, uint8_t reg, uint16_t len, bool isRead) {
+    return t.addr == addr && t.reg == reg && t.len == len && t.isRead == isRead;
+}
+
+static uint8_t gateBuf;
+
+static void holdBus() {
+    model.closeGate();
+    CHECK(readAsync(IMU_ADDR, GATE_REG, &gateBuf, 1, 0));
+    CHECK(model.waitGateHeld());
+}
+
+// Touch goes before IMU, each device in submission order; adjacent and
+// overlapping reads share a burst, but not across a write to the device
+static void testOrderAndMerge() {
+    holdBus();
+    uint8_t a[6], b[6], c[6], e[6], f[2], g[1];
+    CHECK(readAsync(IMU_ADDR, 0x35, a, 6, 1));
+    CHECK(readAsync(IMU_ADDR, 0x3B, b, 6, 2));      // abuts a
+    CHECK(readAsync(TOUCH_ADDR, 0x01, c, 6, 3));
+
+    I2CStatus writeStatus = I2C_ERR_NACK;
+    std::thread writer([&] { writeStatus = bus.writeByte(IMU_ADDR, 0x08, 0x03); });
+    CHECK(waitFor([] { return bus.pending() == 5; }));
+
+    CHECK(readAsync(IMU_ADDR, 0x41, e, 6, 5));      // abuts b, but after the write
+    CHECK(readAsync(TOUCH_ADDR, 0x03, f, 2, 6));    // inside c
+    CHECK(readAsync(TOUCH_ADDR, 0x20, g, 1, 7));
+    CHECK_EQ(bus.pending(), 8);
+    CHECK(bus.busy());
+
+    hostAdvanceUs(GATE_WAIT_US);
+    model.openGate();
+    writer.join();
+    CHECK(waitFor([] { return !bus.busy(); }));
+    CHECK_EQ(writeStatus, I2C_OK);
+
+    std::vector<Transfer> log = model.takeLog();
+    CHECK_EQ(log.size(), 6);
+    if (log.size() == 6) {
+        CHECK(sameTransfer(log[0], IMU_ADDR, GATE_REG, 1, true));
+        CHECK(sameTransfer(log[1], TOUCH_ADDR, 0x01, 6, true));
+        CHECK(sameTransfer(log[2], TOUCH_ADDR, 0x20, 1, true));
+        CHECK(sameTransfer(log[3], IMU_ADDR, 0x35, 12, true));
+        CHECK(sameTransfer(log[4], IMU_ADDR, 0x08, 1, false));
+        CHECK(sameTransfer(log[5], IMU_ADDR, 0x41, 6, true));
+    }
+
+    std::vector<int> expectOrder = {0, 3, 6, 7, 1, 2, 5};
+    CHECK(completed == expectOrder);
+    for (I2CStatus s : statuses) CHECK_EQ(s, I2C_OK);
+    CHECK_EQ(b[0], 0x3B);
+    CHECK_EQ(b[5], 0x40);
+    CHECK_EQ(e[0], 0x41);
+    CHECK_EQ(f[0], 0x83);
+    CHECK_EQ(f[1], 0x84);
+    CHECK_EQ(g[0], 0xA0);
+
+    const I2CDeviceStats& touch = bus.stats(TOUCH_ADDR);
+    CHECK_EQ(touch.transactions, 3);
+    CHECK_EQ(touch.merged, 1);
+    CHECK_EQ(touch.errors, 0);
+    CHECK_EQ(touch.bytes, 9);
+    CHECK_EQ(touch.busUs, US_PER_BYTE * (7 + 2));
+    CHECK(touch.maxUs >= GATE_WAIT_US);
+
+    const I2CDeviceStats& imu = bus.stats(IMU_ADDR);
+    CHECK_EQ(imu.transactions, 5);
+    CHECK_EQ(imu.merged, 1);
+    CHECK_EQ(imu.bytes, 1 + 6 + 6 + 1 + 6);
+    CHECK(imu.maxUs > touch.maxUs);   // the last IMU read waited out the touch reads too
+    CHECK_EQ(bus.stats(0x50).transactions, 0);
+}
+
+// A full queue fails an async read outright; a blocking caller retries for
+// a while and then gives up, or gets in once the task drains the queue
+static void testQueueFull() {
+    completed.clear();
+    statuses.clear();
+    holdBus();
+    uint8_t bufs[I2CBus::QUEUE_DEPTH][1];
+    for (uint8_t i = 1; i < I2CBus::QUEUE_DEPTH; i++) {
+        CHECK(readAsync(TOUCH_ADDR, (uint8_t)(i * 4), bufs[i], 1, i));
+    }
+    uint8_t value = 0;
+    CHECK(!readAsync(TOUCH_ADDR, 0x60, &value, 1, 99));
+    CHECK_EQ(bus.queueFullCount(), 1);
+
+    CHECK_EQ(bus.read(TOUCH_ADDR, 0x60, &value, 1), I2C_ERR_QUEUE_FULL);
+    uint32_t fullAfterGiveUp = bus.queueFullCount();
+    CHECK(fullAfterGiveUp > 2);
+
+    std::thread releaser([fullAfterGiveUp] {
+        waitFor([fullAfterGiveUp] { return bus.queueFullCount() > fullAfterGiveUp; });
+        model.openGate();
+    });
+    CHECK_EQ(bus.read(TOUCH_ADDR, 0x60, &value, 1), I2C_OK);
+    releaser.join();
+    CHECK_EQ(value, 0xE0);
+    CHECK(waitFor([] { return !bus.busy(); }));
+    CHECK_EQ(completed.size(), I2CBus::QUEUE_DEPTH);
+    CHECK_EQ(bufs[5][0], 0x80 + 20);
+    model.takeLog();
+}
+
+int main() {
+    wire.attach(&model);
+    bus.addDevice("qmi8658", IMU_ADDR, I2C_PRIORITY_LOW);
+    bus.addDevice("cst816s", TOUCH_ADDR, I2C_PRIORITY_HIGH);
+    hostStartTasks(true);
+    bus.begin();
+    CHECK(!bus.busy());
+
+    testOrderAndMerge();
+    testQueueFull();
+    return checkResult("i2c_bus_task_test");
+}
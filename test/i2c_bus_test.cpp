@@ -0,0 +1,151 @@
+#include "src/i2c/I2CBus.h"
+#include "check.h"
+#include <vector>
+
+// Devices with one ID register each, on a bus that injects errors: above
+// a device's reliable clock every failEvery-th transfer to it fails with
+// the chosen error or returns a corrupted ID.
+enum Fault : uint8_t { FAULT_NACK, FAULT_TIMEOUT, FAULT_BAD_ID, FAULT_SHORT_READ };
+
+struct FakeDevice {
+    uint8_t addr;
+    uint8_t idReg;
+    uint8_t id;
+    uint32_t reliableHz;    // faults start above this clock; 0: always fault
+    Fault fault;
+    uint8_t failEvery;
+    uint32_t transfers;
+};
+
+class FaultyBus : public WireModel {
+public:
+    TwoWire& wire;
+    std::vector<FakeDevice> devices;
+    std::vector<uint32_t> clocksTried;
+
+    explicit FaultyBus(TwoWire& w) : wire(w) { wire.attach(this); }
+
+    uint8_t write(uint8_t addr, const uint8_t* data, size_t len, bool stop) override {
+        (void)len; (void)stop;
+        noteClock();
+        FakeDevice* d = find(addr);
+        if (!d) return 2;
+        pointer = data[0];
+        if (failing(*d) && d->fault == FAULT_NACK) return 2;
+        if (failing(*d) && d->fault == FAULT_TIMEOUT) return 5;
+        return 0;
+    }
+
+    size_t read(uint8_t addr, uint8_t* buf, size_t len) override {
+        FakeDevice* d = find(addr);
+        if (!d) return 0;
+        bool fail = failing(*d);
+        d->transfers++;
+        if (fail && d->fault == FAULT_SHORT_READ) return 0;
+        for (size_t i = 0; i < len; i++) buf[i] = (uint8_t)(pointer + i) == d->idReg ? d->id : 0;
+        if (fail && d->fault == FAULT_BAD_ID) buf[0] ^= 0x10;
+        return len;
+    }
+
+private:
+    uint8_t pointer = 0;
+
+    FakeDevice* find(uint8_t addr) {
+        for (FakeDevice& d : devices) if (d.addr == addr) return &d;
+        return nullptr;
+    }
+    bool failing(const FakeDevice& d) const {
+        return wire.getClock() > d.reliableHz && (d.transfers + 1) % d.failEvery == 0;
+    }
+    void noteClock() {
+        if (clocksTried.empty() || clocksTried.back() != wire.getClock()) {
+            clocksTried.push_back(wire.getClock());
+        }
+    }
+};
+
+static const I2CProbe IMU = {"imu", 0x6B, 0x00, 0x05, 0xFF, 400000};
+static const I2CProbe TOUCH = {"touch", 0x15, 0xA7, 0x00, 0x00, 400000};
+
+struct NegotiateCase {
+    const char* name;
+    uint32_t imuReliableHz, touchReliableHz;
+    Fault fault;
+    uint8_t failEvery;
+    uint32_t imuMaxHz;                  // overrides IMU.maxHz when non-zero
+    uint32_t expectHz;
+    std::vector<uint32_t> expectTried;
+};
+
+static void testNegotiate() {
+    const NegotiateCase cases[] = {
+        // Devices that would cope with 1 MHz still stop at their rating
+        {"capped at rating", 1000000, 1000000, FAULT_NACK, 1, 0, 400000, {400000}},
+        {"slowest rating wins", 1000000, 1000000, FAULT_NACK, 1, 1000000, 400000, {400000}},
+        {"nack falls back", 100000, 1000000, FAULT_NACK, 3, 0, 100000, {400000, 100000}},
+        {"timeout falls back", 1000000, 100000, FAULT_TIMEOUT, 5, 0, 100000, {400000, 100000}},
+        {"late failure falls back", 100000, 1000000, FAULT_NACK, 8, 0, 100000, {400000, 100000}},
+        {"bad id falls back", 100000, 1000000, FAULT_BAD_ID, 2, 0, 100000, {400000, 100000}},
+        {"short read falls back", 100000, 1000000, FAULT_SHORT_READ, 4, 0, 100000, {400000, 100000}},
+        {"nothing reliable", 0, 0, FAULT_NACK, 1, 0, 100000, {400000, 100000}},
+    };
+    for (const NegotiateCase& c : cases) {
+        TwoWire wire(0);
+        FaultyBus faulty(wire);
+        faulty.devices.push_back({0x6B, 0x00, 0x05, c.imuReliableHz, c.fault, c.failEvery, 0});
+        faulty.devices.push_back({0x15, 0xA7, 0xB5, c.touchReliableHz, c.fault, c.failEvery, 0});
+        I2CBus bus(wire, "test");
+
+        I2CProbe probes[2] = {IMU, TOUCH};
+        if (c.imuMaxHz) probes[0].maxHz = c.imuMaxHz;
+        uint32_t hz = bus.negotiateClock(probes, 2);
+
+        bool ok = hz == c.expectHz && bus.clockHz() == hz && wire.getClock() == hz;
+        ok = ok && faulty.clocksTried == c.expectTried;
+        if (!ok) {
+            fprintf(stderr, "case '%s': negotiated %lu Hz, tried", c.name, (unsigned long)hz);
+            for (uint32_t t : faulty.clocksTried) fprintf(stderr, " %lu", (unsigned long)t);
+            fprintf(stderr, "\n");
+            checkFailures++;
+        }
+    }
+
+    // Only the 1 MHz case differs once every device is rated for it
+    TwoWire wire(0);
+    FaultyBus faulty(wire);
+    faulty.devices.push_back({0x6B, 0x00, 0x05, 1000000, FAULT_NACK, 1, 0});
+    I2CBus bus(wire, "test");
+    I2CProbe fast = IMU;
+    fast.maxHz = 1000000;
+    CHECK_EQ(bus.negotiateClock(&fast, 1), 1000000);
+
+    // An unrated probe limits the bus to standard mode
+    I2CProbe unrated = IMU;
+    unrated.maxHz = 0;
+    CHECK_EQ(bus.negotiateClock(&unrated, 1), 100000);
+}
+
+// Transfer errors map to statuses and are counted per device
+static void testStatusMapping() {
+    TwoWire wire(0);
+    FaultyBus faulty(wire);
+    faulty.devices.push_back({0x6B, 0x00, 0x05, 0, FAULT_TIMEOUT, 1, 0});
+    faulty.devices.push_back({0x15, 0xA7, 0xB5, 0, FAULT_SHORT_READ, 1, 0});
+    faulty.devices.push_back({0x29, 0x12, 0x44, 1000000, FAULT_NACK, 1, 0});
+    I2CBus bus(wire, "test");
+    wire.setClock(400000);
+
+    uint8_t v = 0;
+    CHECK_EQ(bus.read(0x6B, 0x00, &v, 1), I2C_ERR_TIMEOUT);
+    CHECK_EQ(bus.read(0x15, 0xA7, &v, 1), I2C_ERR_SHORT_READ);
+    CHECK_EQ(bus.read(0x50, 0x00, &v, 1), I2C_ERR_NACK);        // nobody there
+    CHECK_EQ(bus.read(0x29, 0x12, &v, 1), I2C_OK);
+    CHECK_EQ(v, 0x44);
+    CHECK_EQ(bus.writeByte(0x6B, 0x02, 0x60), I2C_ERR_TIMEOUT);
+}
+
+int main() {
+    testNegotiate();
+    testStatusMapping();
+    return checkResult("i2c_bus_test");
+}
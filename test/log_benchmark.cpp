@@ -0,0 +1,95 @@
+#include "src/logging/Log.h"
+#include "check.h"
+#include <chrono>
+
+// Cost of a log call to its caller, before (Serial.printf straight to the
+// UART) and after (LOG_I into the ring, formatted later by Log::drain()).
+// The UART is modelled at 115200 baud with a 128-byte TX FIFO that does not
+// drain during the burst: once it is full the caller waits out every byte.
+// The burst is the lines the sketch logs around a flip. LOG_I never touches
+// the UART, so it never blocks; fails if the drained burst is not the same
+// bytes plus the "[t] I " prefixes, or a record of it is dropped. The host
+// CPU times are printed for comparison only.
+static const uint32_t UART_BAUD = 115200;
+static const uint32_t UART_FIFO = 128;
+static const int TIMED_BURSTS = 20000;
+
+class UartModel : public Print {
+public:
+    uint32_t bytes = 0;
+    size_t write(uint8_t) override {
+        bytes++;
+        return 1;
+    }
+    // Caller time spent waiting for FIFO room, 10 bits per byte
+    double blockedUs() const {
+        return bytes > UART_FIFO ? (bytes - UART_FIFO) * 10.0 * 1e6 / UART_BAUD : 0;
+    }
+};
+
+static const char* const STATES[] = {"upright", "tilted", "inverted"};
+
+static void burstBefore(Print& uart, uint32_t i) {
+    uart.printf("Orientation: %s (tilt %u deg)\n", STATES[i % 3], (unsigned)(i % 180));
+    uart.printf("Touch: %s x=%u y=%u v=(%d,%d)px/s %lums\n", "swipe", 120u, 88u, -340, 25, 210UL);
+    uart.printf("Battery: %u%% %u mV (%s)\n", 87u, 4012u, "discharging");
+    uart.printf("R=%u G=%u B=%u C=%u\n", 812u, 1190u, 2077u, 4100u);
+    uart.printf("Display: %s -> %s\n", "dim", "on");
+    uart.printf("I2C %s: %lu kHz\n", "i2c1", 400UL);
+}
+
+static void burstAfter(uint32_t i) {
+    LOG_I("Orientation: %s (tilt %u deg)", STATES[i % 3], (unsigned)(i % 180));
+    LOG_I("Touch: %s x=%u y=%u v=(%d,%d)px/s %lums", "swipe", 120u, 88u, -340, 25, 210UL);
+    LOG_I("Battery: %u%% %u mV (%s)", 87u, 4012u, "discharging");
+    LOG_I("R=%u G=%u B=%u C=%u", 812u, 1190u, 2077u, 4100u);
+    LOG_I("Display: %s -> %s", "dim", "on");
+    LOG_I("I2C %s: %lu kHz", "i2c1", 400UL);
+}
+static const int BURST_LINES = 6;
+
+template <typename Fn>
+static double nsPer(int n, Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) fn(i);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / n;
+}
+
+int main() {
+    // Bytes and blocking for one burst
+    UartModel before;
+    burstBefore(before, 0);
+    uint32_t burstBytes = before.bytes;
+
+    UartModel after;
+    uint32_t dropped = Log::dropped();
+    burstAfter(0);
+    CHECK_EQ(Log::dropped(), dropped);
+    // The same lines come out later, from the drain task
+    char prefix[16];
+    uint32_t prefixBytes = snprintf(prefix, sizeof(prefix), "[%lu] I ", (unsigned long)millis());
+    CHECK_EQ(Log::drain(after), BURST_LINES);
+    CHECK_EQ(after.bytes, burstBytes + BURST_LINES * prefixBytes);
+
+    // Host CPU per call; the ring is drained between bursts, untimed
+    UartModel sink;
+    double beforeNs = nsPer(TIMED_BURSTS, [&sink](int i) { burstBefore(sink, i); }) / BURST_LINES;
+    double afterNs = 0;
+    UartModel drained;
+    for (int i = 0; i < TIMED_BURSTS; i += 10) {
+        afterNs += nsPer(10, [](int j) { burstAfter(j); });
+        Log::drain(drained);
+    }
+    afterNs = afterNs * 10 / TIMED_BURSTS / BURST_LINES;
+    CHECK_EQ(Log::dropped(), dropped);
+    double writeDrainNs = nsPer(TIMED_BURSTS / 10, [&drained](int i) {
+        burstAfter(i);
+        Log::drain(drained);
+    }) / BURST_LINES;
+
+    printf("log_benchmark: burst_lines=%d burst_bytes=%lu before_blocked_us=%.0f after_blocked_us=0 "
+           "before_call_ns=%.0f after_call_ns=%.1f write_drain_ns=%.0f\n",
+           BURST_LINES, (unsigned long)burstBytes, before.blockedUs(), beforeNs, afterNs, writeDrainNs);
+    return checkResult("log_benchmark");
+}
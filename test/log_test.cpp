@@ -0,0 +1,151 @@
+#define LOG_LEVEL LOG_LEVEL_DEBUG
+#include "src/logging/Log.h"
+#include "check.h"
+#include <stdarg.h>
+#include <string>
+#include <vector>
+
+// Records written with LOG_* come back out of Log::drain() formatted as
+// printf would have formatted them at the call, with the time they were
+// logged at and their level tag.
+class LinePrint : public Print {
+public:
+    std::vector<std::string> lines;
+    std::string partial;
+    size_t write(uint8_t c) override {
+        if (c == '\n') {
+            lines.push_back(partial);
+            partial.clear();
+        } else {
+            partial += (char)c;
+        }
+        return 1;
+    }
+};
+
+// Drains everything queued and returns the one line it expects to find
+static std::string roundTrip() {
+    LinePrint out;
+    uint16_t n = Log::drain(out);
+    CHECK_EQ(n, 1);
+    CHECK_EQ(out.lines.size(), 1);
+    return out.lines.empty() ? std::string() : out.lines[0];
+}
+
+// The message part of a drained line, after "[t] L "
+static std::string message(const std::string& line) {
+    size_t at = line.find("] ");
+    return at == std::string::npos ? line : line.substr(at + 4);
+}
+
+static std::string printed(const char* fmt, ...) __attribute__((format(printf, 1, 2)));
+static std::string printed(const char* fmt, ...) {
+    char buf[160];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    return buf;
+}
+
+static void testInts() {
+    LOG_I("int %d neg %d zero %d", 42, -7, 0);
+    CHECK(message(roundTrip()) == "int 42 neg -7 zero 0");
+
+    LOG_I("%u %5d|%-5d|%05d", 4000000000u, -12, 34, 56);
+    CHECK(message(roundTrip()) == printed("%u %5d|%-5d|%05d", 4000000000u, -12, 34, 56));
+    LOG_I("%x %04X %c", 0xbeef, 0x2a, 'Q');
+    CHECK(message(roundTrip()) == printed("%x %04X %c", 0xbeef, 0x2a, 'Q'));
+
+    // Long and narrow types, and the extremes of a 32-bit int
+    LOG_I("%ld %lu %d %d %d", -100000L, 3000000000UL, (int8_t)-3, (uint16_t)65535, INT32_MIN);
+    CHECK(message(roundTrip()) == printed("%ld %lu %d %d %d", -100000L, 3000000000UL, -3, 65535, INT32_MIN));
+    LOG_I("%d %u", INT32_MAX, UINT32_MAX);
+    CHECK(message(roundTrip()) == printed("%d %u", INT32_MAX, UINT32_MAX));
+}
+
+static void testFloats() {
+    LOG_I("%f %.2f %8.3f|%-8.1f|%e", 3.14159f, -0.5f, 1000.0, 2.25f, 12345.678);
+    CHECK(message(roundTrip()) == printed("%f %.2f %8.3f|%-8.1f|%e", 3.14159f, -0.5f, 1000.0, 2.25f, 12345.678));
+
+    // Stored as float: a double argument keeps float precision
+    LOG_I("%.10f", 0.1);
+    CHECK(message(roundTrip()) == printed("%.10f", (double)0.1f));
+}
+
+static char nameBuf[16] = "buffered";
+
+static void testStrings() {
+    LOG_I("%s and %s", "literal", nameBuf);
+    CHECK(message(roundTrip()) == "literal and buffered");
+
+    LOG_I("[%8s][%-8s][%.3s]", "right", "left", "truncated");
+    CHECK(message(roundTrip()) == printed("[%8s][%-8s][%.3s]", "right", "left", "truncated"));
+
+    // Every type in one record, and a literal %
+    LOG_I("%s=%d (%.1f%%) %s", "rgb", 565, 99.5f, "ok");
+    CHECK(message(roundTrip()) == "rgb=565 (99.5%) ok");
+}
+
+// Timestamp, level tag and trailing newline handling
+static void testLine() {
+    hostAdvanceUs(1234567 - micros() % 1000000);
+    uint32_t t = millis();
+    LOG_E("error\n");
+    LOG_W("warn\r\n");
+    LOG_I("info");
+    LOG_D("debug %d", 4);
+    LinePrint out;
+    CHECK_EQ(Log::drain(out), 4);
+    CHECK_EQ(out.lines.size(), 4);
+    if (out.lines.size() == 4) {
+        CHECK(out.lines[0] == printed("[%lu] E error", (unsigned long)t));
+        CHECK(out.lines[1] == printed("[%lu] W warn", (unsigned long)t));
+        CHECK(out.lines[2] == printed("[%lu] I info", (unsigned long)t));
+        CHECK(out.lines[3] == printed("[%lu] D debug 4", (unsigned long)t));
+    }
+
+    // A message longer than a line is cut, not overrun
+    static const char LONG[] =
+        "0123456789012345678901234567890123456789012345678901234567890123456789"
+        "0123456789012345678901234567890123456789012345678901234567890123456789"
+        "0123456789012345678901234567890123456789";
+    LOG_I("%s %d", LONG, 1);
+    std::string line = roundTrip();
+    CHECK_EQ(line.size(), 159);
+    CHECK(line.find("0123456789") != std::string::npos);
+}
+
+// Drain takes records in order, up to the limit it is given; a full ring
+// drops and the next drain says how many
+static void testRing() {
+    for (int i = 0; i < 10; i++) LOG_I("n=%d", i);
+    LinePrint out;
+    CHECK_EQ(Log::drain(out, 4), 4);
+    CHECK_EQ(Log::drain(out), 6);
+    CHECK_EQ(out.lines.size(), 10);
+    for (size_t i = 0; i < out.lines.size(); i++) CHECK(message(out.lines[i]) == printed("n=%d", (int)i));
+
+    uint32_t dropped = Log::dropped();
+    for (int i = 0; i < LOG_RING_SIZE + 5; i++) LOG_I("n=%d", i);
+    CHECK_EQ(Log::dropped() - dropped, 6);    // one slot stays free
+    out.lines.clear();
+    CHECK_EQ(Log::drain(out), LOG_RING_SIZE - 1);
+    CHECK_EQ(out.lines.size(), LOG_RING_SIZE);
+    if (out.lines.size() == LOG_RING_SIZE) {
+        CHECK(message(out.lines[LOG_RING_SIZE - 2]) == printed("n=%d", LOG_RING_SIZE - 2));
+        CHECK(out.lines.back() == "[log] 6 records dropped");
+    }
+    out.lines.clear();
+    CHECK_EQ(Log::drain(out), 0);
+    CHECK(out.lines.empty());
+}
+
+int main() {
+    testInts();
+    testFloats();
+    testStrings();
+    testLine();
+    testRing();
+    return checkResult("log_test");
+}
@@ -0,0 +1,159 @@
+#include "src/flipsensor/OrientationEstimator.h"
+#include "check.h"
+#include <math.h>
+
+// Traces are rebuilt from a list of motion segments instead of being stored
+// raw: each segment swings the cup about the board X axis from the previous
+// angle to `toDeg` over `samples` samples, and the generator emits the accel
+// and gyro readings a QMI8658 at +-8 g / 512 dps would report at 62.5 Hz,
+// with a little deterministic sensor noise on top.
+static const uint16_t ACC_LSB = 4096;
+static const uint16_t GYRO_LSB = 64;
+static const uint32_t PERIOD_US = 16000;
+
+struct Segment {
+    uint16_t samples;
+    int16_t toDeg;      // 0 = upright, 180 = upside down
+    int16_t shakeMg;    // extra accel magnitude, e.g. a knock on the table
+};
+
+struct Replay {
+    Orientation finalState;
+    uint8_t finalTilt;
+    int transitions;
+    bool sawMoving;
+};
+
+static uint32_t noiseSeed;
+
+static int16_t noise(int16_t amplitude) {
+    noiseSeed = noiseSeed * 1664525u + 1013904223u;
+    return (int16_t)((int32_t)(noiseSeed >> 16) % (2 * amplitude + 1) - amplitude);
+}
+
+static Replay replay(OrientationEstimator& est, const Segment* trace, int count) {
+    Replay r = {ORIENT_UNKNOWN, 0, 0, false};
+    double angle = 0;
+    noiseSeed = 12345;
+    for (int s = 0; s < count; s++) {
+        double step = (trace[s].toDeg - angle) / trace[s].samples;
+        double rateDps = step * 1000000.0 / PERIOD_US;
+        for (int i = 0; i < trace[s].samples; i++) {
+            angle += step;
+            double rad = angle * M_PI / 180.0;
+            double gLsb = ACC_LSB * (1.0 + trace[s].shakeMg / 1000.0);
+            // Upright reads -1 g on Z; rotating by +angle about X is a -X rate
+            int16_t acc[3] = {
+                noise(40),
+                (int16_t)(gLsb * sin(rad) + noise(40)),
+                (int16_t)(-gLsb * cos(rad) + noise(40))
+            };
+            int16_t gyro[3] = {
+                (int16_t)(-rateDps * GYRO_LSB + noise(32)),
+                noise(32),
+                noise(32)
+            };
+            if (est.update(acc, gyro)) r.transitions++;
+            if (est.state() == ORIENT_MOVING) r.sawMoving = true;
+        }
+    }
+    r.finalState = est.state();
+    r.finalTilt = est.tiltDegrees();
+    return r;
+}
+
+struct TraceCase {
+    const char* name;
+    const Segment* trace;
+    int count;
+    Orientation expected;
+    uint8_t tiltMin, tiltMax;
+    bool expectMoving;
+};
+
+static const Segment UPRIGHT[] = {
+    {62, 0, 0},                 // 1 s resting on the table
+};
+static const Segment LEANING_UPRIGHT[] = {
+    {62, 0, 0},
+    {60, 35, 0},                // slow lean, inside the upright exit band
+    {62, 35, 0},
+};
+static const Segment TILTED[] = {
+    {62, 0, 0},
+    {120, 90, 0},               // ~45 dps: tipped onto its side
+    {62, 90, 0},
+};
+static const Segment FLIPPED[] = {
+    {31, 0, 0},
+    {62, 180, 0},               // 180 dps flip
+    {62, 180, 0},
+};
+static const Segment FLIPPED_BACK[] = {
+    {31, 0, 0},
+    {62, 180, 0},
+    {62, 180, 0},
+    {31, 0, 0},                 // 360 dps turn back upright
+    {62, 0, 0},
+};
+static const Segment KNOCKED[] = {
+    {62, 0, 0},
+    {3, 0, 600},                // knock shorter than the debounce window
+    {31, 0, 0},
+};
+
+static const TraceCase TRACES[] = {
+    {"upright", UPRIGHT, 1, ORIENT_UPRIGHT, 0, 5, false},
+    {"leaning upright", LEANING_UPRIGHT, 3, ORIENT_UPRIGHT, 30, 40, false},
+    {"tilted", TILTED, 3, ORIENT_TILTED, 85, 95, false},
+    {"flipped", FLIPPED, 3, ORIENT_INVERTED, 175, 180, true},
+    {"flipped back", FLIPPED_BACK, 5, ORIENT_UPRIGHT, 0, 5, true},
+    {"knocked", KNOCKED, 3, ORIENT_UPRIGHT, 0, 5, false},
+};
+
+static void testTraces() {
+    for (const TraceCase& tc : TRACES) {
+        OrientationEstimator est;
+        CHECK(est.configure(ACC_LSB, GYRO_LSB, PERIOD_US));
+        Replay r = replay(est, tc.trace, tc.count);
+        if (r.finalState != tc.expected || r.finalTilt < tc.tiltMin ||
+            r.finalTilt > tc.tiltMax || r.sawMoving != tc.expectMoving) {
+            fprintf(stderr, "trace '%s': state %d tilt %u moving %d\n", tc.name,
+                    r.finalState, r.finalTilt, r.sawMoving);
+            checkFailures++;
+        }
+    }
+}
+
+// The first settled state is only reported once the debounce window fills
+static void testDebounce() {
+    OrientationEstimator est;
+    CHECK(est.configure(ACC_LSB, GYRO_LSB, PERIOD_US));
+    int16_t acc[3] = {0, 0, -(int16_t)ACC_LSB};
+    int16_t gyro[3] = {0, 0, 0};
+    for (int i = 0; i < 5; i++) CHECK(!est.update(acc, gyro));
+    CHECK_EQ(est.state(), ORIENT_UNKNOWN);
+    CHECK(est.update(acc, gyro));
+    CHECK_EQ(est.state(), ORIENT_UPRIGHT);
+    CHECK(est.isStill());
+}
+
+// A failed IMU init reports zero scales; configure() must refuse them and
+// keep working with the previous ones instead of dividing by zero later.
+static void testZeroDivisors() {
+    OrientationEstimator est;
+    CHECK(!est.configure(0, GYRO_LSB, PERIOD_US));
+    CHECK(!est.configure(ACC_LSB, 0, PERIOD_US));
+    CHECK(!est.configure(ACC_LSB, GYRO_LSB, 0));
+    CHECK(!est.configure(0, 0, 0));
+
+    Replay r = replay(est, FLIPPED, 3);
+    CHECK_EQ(r.finalState, ORIENT_INVERTED);
+}
+
+int main() {
+    testTraces();
+    testDebounce();
+    testZeroDivisors();
+    return checkResult("orientation_estimator_test");
+}
@@ -0,0 +1,80 @@
+#include "src/screen/GUI_Paint.h"
+#include "src/screen/Palette.h"
+#include "src/screen/RoundMask.h"
+#include "src/screen/LCD_1in28.h"
+#include "src/screen/FrameBuffer.h"
+#include "src/fonts/fonts.h"
+#include "check.h"
+#include <chrono>
+
+// The same UI frame painted at GUI_Paint scale 256 (8-bit indexed, see
+// Palette.h) and scale 65 (RGB565): frame memory, host CPU time to draw it,
+// and for the indexed frame the palette expansion a flush adds per frame.
+// A UI frame fits the palette: every pixel must match the RGB565 render and
+// nothing may fall back to the cube. The CPU figures are host times for
+// comparison only and are not checked.
+static const UWORD W = 240, H = 240;
+static const int TIMED_FRAMES = 200;
+
+static UWORD rgb565[W * H];
+static UBYTE indexed[W * H];
+
+static void drawFrame() {
+    Paint_Clear(WHITE);
+    Paint_DrawCircle(120, 120, 100, 0x229f, DOT_PIXEL_3X3, DRAW_FILL_EMPTY);
+    Paint_ClearWindows(70, 122, 170, 164, 0xFA20);
+    Paint_DrawRectangle(42, 172, 198, 208, GRAY, DOT_PIXEL_1X1, DRAW_FILL_EMPTY);
+    Paint_DrawLine(44, 200, 196, 180, 0x229f, DOT_PIXEL_2X2, LINE_STYLE_SOLID);
+    Paint_DrawString_EN(80, 30, "Color", &Font16, WHITE, BLACK);
+    Paint_DrawStringAA(40, 52, "R 212   1873", &FontAA16, BLACK, WHITE);
+    Paint_DrawStringAA(40, 74, "G 140   1204", &FontAA16, BLACK, WHITE);
+    Paint_DrawStringAA(40, 96, "B  38    415", &FontAA16, BLACK, WHITE);
+    Paint_DrawStringAlignedAA(70, 170, 136, "Orange", &FontSans16, TEXT_ALIGN_CENTER, WHITE, 0xFA20);
+}
+
+template <typename Fn>
+static double nsPer(int n, Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) fn();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / n;
+}
+
+// What a flush of the indexed frame adds: each visible span through the
+// palette into a line buffer
+static UWORD line[W];
+static void expandFrame() {
+    for (UWORD y = 0; y < H; y++) {
+        UWORD xs = RoundMask_SpanStart(y);
+        Palette_ExpandRow(line, &indexed[(uint32_t)y * W + xs], RoundMask_SpanEnd(y) - xs);
+    }
+}
+
+int main() {
+    RoundMask_Init(W, H, LCD_1IN28_WINDOW_OVERHEAD);
+
+    Paint_NewImage((UBYTE*)rgb565, W, H, 0, WHITE);
+    Paint_SetScale(65);
+    drawFrame();
+    double rgbNs = nsPer(TIMED_FRAMES, drawFrame);
+
+    Palette_Init((UDOUBLE)W * H);
+    Paint_NewImage(indexed, W, H, 0, WHITE);
+    Paint_SetScale(256);
+    drawFrame();
+    double indexedNs = nsPer(TIMED_FRAMES, drawFrame);
+    double expandNs = nsPer(TIMED_FRAMES, expandFrame);
+
+    uint32_t mismatches = 0;
+    for (uint32_t i = 0; i < (uint32_t)W * H; i++) {
+        if (FB_PIXEL(Palette_Color(indexed[i])) != rgb565[i]) mismatches++;
+    }
+    CHECK_EQ(mismatches, 0);
+    CHECK_EQ(Palette_Fallbacks(), 0);
+
+    printf("palette_benchmark: rgb565_bytes=%lu indexed_bytes=%lu exact_colors=%u fallbacks=%lu "
+           "rgb565_draw_ns=%.0f indexed_draw_ns=%.0f expand_ns=%.0f\n",
+           (unsigned long)sizeof(rgb565), (unsigned long)sizeof(indexed), Palette_Used(),
+           (unsigned long)Palette_Fallbacks(), rgbNs, indexedNs, expandNs);
+    return checkResult("palette_benchmark");
+}
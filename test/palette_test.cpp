@@ -0,0 +1,183 @@
+#include "src/screen/Palette.h"
+#include "src/screen/FrameBuffer.h"
+#include "src/screen/GUI_Paint.h"
+#include "check.h"
+#include <string.h>
+
+// The 8-bit palette on its own, over a small indexed buffer: exact entries
+// are only handed to a new color once no pixel uses them, colors fall back
+// to the cube when all of them are in use, a cache slot never returns an
+// entry that now holds another color, and rows expand to the stored colors.
+static const UWORD PIXELS = 1024;
+static const UWORD EXACT = PALETTE_SIZE - PALETTE_CUBE;
+
+static UBYTE buffer[PIXELS];
+static UWORD intended[PIXELS];    // what each pixel was last set to
+
+static void reset() {
+    memset(buffer, 0, sizeof(buffer));
+    memset(intended, 0, sizeof(intended));
+    Palette_Init(PIXELS);
+}
+
+static void store(UWORD i, UWORD color) {
+    Palette_Store(&buffer[i], color);
+    intended[i] = color;
+}
+
+// Red 1/31 is no cube level, so none of these is in the cube
+static UWORD offCube(UWORD i) {
+    return (UWORD)(1 << 11 | (i % 64) << 5 | (i / 64) % 32);
+}
+
+// The nearest cube color, as a fallback shows it
+static UWORD cubeColor(UWORD color) {
+    UWORD R = color >> 11, G = (color >> 5) & 0x3F, B = color & 0x1F;
+    UBYTE r = ((R * 5 + 15) / 31) * 51, g = ((G * 5 + 31) / 63) * 51, b = ((B * 5 + 15) / 31) * 51;
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+static UWORD cacheSlot(UWORD color) {
+    return (color ^ (color >> 6)) % 64;
+}
+
+// Every pixel shows what was stored there, or its cube fallback
+static bool allPixelsShowIntended() {
+    for (UWORD i = 0; i < PIXELS; i++) {
+        UWORD shown = Palette_Color(buffer[i]);
+        if (shown != intended[i] && !(buffer[i] < PALETTE_CUBE && shown == cubeColor(intended[i]))) return false;
+    }
+    return true;
+}
+
+static void testCube() {
+    reset();
+    static const UWORD CUBE[] = {BLACK, WHITE, 0xF800, 0x07E0, 0x001F, 0x0000, 0x9CD3};
+    for (UWORD c : CUBE) {
+        UBYTE i = Palette_Index(c);
+        CHECK(i < PALETTE_CUBE);
+        CHECK_EQ(Palette_Color(i), c);
+    }
+    CHECK_EQ(Palette_Used(), 0);
+    CHECK_EQ(Palette_Fallbacks(), 0);
+}
+
+// A freed entry is taken by the next new color; one still on screen never is
+static void testReuseAtZero() {
+    reset();
+    for (UWORD k = 0; k < EXACT; k++) {
+        store(2 * k, offCube(k));
+        store(2 * k + 1, offCube(k));
+        CHECK_EQ(buffer[2 * k], PALETTE_CUBE + k);
+    }
+    CHECK_EQ(Palette_Used(), EXACT);
+
+    // One of two pixels overwritten: entry 216 + 7 is still in use
+    store(15, BLACK);
+    UWORD next = offCube(EXACT);
+    store(100, next);
+    CHECK(buffer[100] < PALETTE_CUBE);
+    CHECK_EQ(Palette_Color(buffer[14]), offCube(7));
+
+    // Both gone: the entry is free, and only that one
+    store(14, BLACK);
+    CHECK_EQ(Palette_Used(), EXACT - 1);
+    UWORD other = offCube(EXACT + 1);
+    store(101, other);
+    CHECK_EQ(buffer[101], PALETTE_CUBE + 7);
+    CHECK_EQ(Palette_Color(buffer[101]), other);
+    CHECK_EQ(Palette_Used(), EXACT);
+    CHECK(allPixelsShowIntended());
+
+    // Fill() keeps the counts too: wiping a row frees what it covered
+    Palette_Fill(&buffer[0], 14, WHITE);
+    for (UWORD i = 0; i < 14; i++) intended[i] = WHITE;
+    CHECK_EQ(Palette_Used(), EXACT - 7);
+    CHECK(allPixelsShowIntended());
+}
+
+// With all 40 exact entries on screen a new color shows as its nearest cube
+// entry and is counted, without touching the colors in use
+static void testCubeFallback() {
+    reset();
+    for (UWORD k = 0; k < EXACT; k++) store(k, offCube(k));
+    CHECK_EQ(Palette_Used(), EXACT);
+    CHECK_EQ(Palette_Fallbacks(), 0);
+
+    UWORD late = offCube(300);
+    store(200, late);
+    CHECK(buffer[200] < PALETTE_CUBE);
+    CHECK_EQ(Palette_Color(buffer[200]), cubeColor(late));
+    CHECK_EQ(Palette_Fallbacks(), 1);
+    // A cube color itself is exact and no fallback
+    store(201, 0x07E0);
+    CHECK_EQ(Palette_Color(buffer[201]), 0x07E0);
+    CHECK_EQ(Palette_Fallbacks(), 1);
+    for (UWORD k = 0; k < EXACT; k++) CHECK_EQ(Palette_Color(buffer[k]), offCube(k));
+    CHECK_EQ(Palette_Used(), EXACT);
+}
+
+// A cache slot remembers an exact entry that has since gone to another
+// color: the lookup must notice and not hand out the other color
+static void testStaleCacheSlot() {
+    reset();
+    UWORD a = offCube(0), b = offCube(1);
+    CHECK(cacheSlot(a) != cacheSlot(b));
+    store(0, a);                                // a -> 216, cached
+    CHECK_EQ(buffer[0], PALETTE_CUBE);
+    store(0, BLACK);                            // 216 free again
+    store(1, b);                                // b takes 216
+    CHECK_EQ(buffer[1], PALETTE_CUBE);
+    store(2, a);                                // a's slot still says 216
+    CHECK_EQ(Palette_Color(buffer[2]), a);
+    CHECK_EQ(Palette_Color(buffer[1]), b);
+    CHECK(buffer[2] != buffer[1]);
+
+    // Two colors sharing one slot, alternating
+    UWORD c = 0;
+    for (UWORD k = 2; k < 4096 && !c; k++) {
+        if (cacheSlot(offCube(k)) == cacheSlot(a)) c = offCube(k);
+    }
+    CHECK(c != 0);
+    for (UWORD i = 10; i < 30; i++) store(i, i % 2 ? a : c);
+    CHECK(allPixelsShowIntended());
+    CHECK_EQ(Palette_Used(), 3);
+
+    // Random stores over a pool bigger than the palette keep every pixel right
+    uint32_t seed = 1;
+    for (int n = 0; n < 20000; n++) {
+        seed = seed * 1103515245 + 12345;
+        UWORD i = (seed >> 8) % PIXELS;
+        UWORD color = (seed >> 20) % 8 ? offCube((seed >> 24) % 60) : cubeColor(offCube(seed >> 16));
+        store(i, color);
+    }
+    CHECK(allPixelsShowIntended());
+    CHECK(Palette_Fallbacks() > 0);
+}
+
+static void testExpandRow() {
+    reset();
+    for (UWORD k = 0; k < EXACT; k++) store(k, offCube(k));
+    UBYTE src[PIXELS];
+    for (UWORD i = 0; i < PIXELS; i++) src[i] = (UBYTE)(i * 7 + 3);
+    UWORD row[PIXELS + 1];
+    // Every length around the four-pixel unroll, and a full row
+    static const UWORD COUNTS[] = {0, 1, 2, 3, 4, 5, 7, 8, 9, 240, 256};
+    for (UWORD count : COUNTS) {
+        for (UWORD i = 0; i <= count; i++) row[i] = 0xA5A5;
+        Palette_ExpandRow(row, src, count);
+        bool same = true;
+        for (UWORD i = 0; i < count; i++) same &= row[i] == FB_PIXEL(Palette_Color(src[i]));
+        CHECK(same);
+        CHECK_EQ(row[count], 0xA5A5);
+    }
+}
+
+int main() {
+    testCube();
+    testReuseAtZero();
+    testCubeFallback();
+    testStaleCacheSlot();
+    testExpandRow();
+    return checkResult("palette_test");
+}
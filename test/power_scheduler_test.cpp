@@ -0,0 +1,204 @@
+#include "src/power/PowerScheduler.h"
+#include "check.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// PowerScheduler against the host light-sleep model (stubs/esp_sleep.h) on
+// the fake clock. The test thread is the UI core; the sensor scheduler runs
+// on a task thread as it does on the other core, so isIdle() is true only
+// while that thread is parked in sleepUntilNextDeadline().
+static const uint8_t TOUCH_PIN = 5;   // active low, latched until read
+static const uint8_t IMU1_PIN = 6;    // WoM, toggles
+static const uint8_t IMU2_PIN = 7;    // FIFO watermark, active high
+static const uint8_t TCS_PIN = 8;     // active low, latched
+static const uint32_t UI_PERIOD_MS = 200;
+static const uint32_t FLIP_PERIOD_MS = 300;
+
+static TaskScheduler ui, sensors;
+static PowerScheduler power(ui, sensors);
+static uint8_t colorTask;
+static std::atomic<int> flipRuns{0}, colorRuns{0};
+static std::atomic<bool> holdColor{false};   // keeps the sensor core busy
+static int touchWakes = 0, imuWakes = 0, colorWakes = 0;
+
+static void uiTask() {}
+static void flipTask() { flipRuns++; }
+static void onColor() {
+    colorRuns++;
+    while (holdColor) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+static void onTouchWake() { touchWakes++; }
+static void onImuWake() { imuWakes++; }
+static void onColorWake() { colorWakes++; }
+
+static void sensorCore(void*) {
+    sensors.begin();
+    for (;;) {
+        sensors.runDue();
+        sensors.sleepUntilNextDeadline();
+    }
+}
+
+// Waits (in real time) until the sensor thread has run whatever is due and
+// parked again
+static bool settle() {
+    for (int i = 0; i < 2000; i++) {
+        if (sensors.isIdle() && sensors.msUntilNextDeadline(1) > 0) return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+static void idleLevels() {
+    digitalWrite(TOUCH_PIN, HIGH);
+    digitalWrite(IMU1_PIN, HIGH);
+    digitalWrite(IMU2_PIN, LOW);
+    digitalWrite(TCS_PIN, HIGH);
+}
+
+// One pass of loop(): UI work, then idle
+static void loopOnce(uint32_t maxSleepMs = 1000) {
+    ui.runDue();
+    CHECK(settle());
+    power.idle(maxSleepMs);
+}
+
+// The timer is set for whichever core has the earlier deadline
+static void testSleepLength() {
+    std::vector<uint32_t> timers;
+    for (int i = 0; i < 6; i++) {
+        uint32_t starts = hostSleep.starts;
+        loopOnce();
+        CHECK_EQ(hostSleep.starts, starts + 1);
+        CHECK_EQ(hostSleep.cause, ESP_SLEEP_WAKEUP_TIMER);
+        timers.push_back((uint32_t)(hostSleep.timerUs / 1000));
+    }
+    // UI at 200, 400, 600, 800; flip checks at 300, 600, 900
+    std::vector<uint32_t> expect = {200, 100, 100, 200, 200, 100};
+    CHECK(timers == expect);
+    CHECK(settle());
+    CHECK_EQ(flipRuns, 3);
+
+    // maxSleepMs caps it too
+    loopOnce(50);
+    CHECK_EQ(hostSleep.timerUs, 50000);
+}
+
+// A pin still at its active level is left out, or it would wake us at
+// once; toggling lines are armed for the opposite of their current level.
+// Each armed pin gets its edge interrupt back after waking.
+static void testArming() {
+    idleLevels();
+    digitalWrite(TOUCH_PIN, LOW);
+    loopOnce();
+    CHECK(!hostSleep.armedAtStart[TOUCH_PIN]);
+    CHECK(hostSleep.armedAtStart[IMU1_PIN]);
+    CHECK_EQ(hostSleep.wakeTypeAtStart[IMU1_PIN], GPIO_INTR_LOW_LEVEL);
+    CHECK(hostSleep.armedAtStart[IMU2_PIN]);
+    CHECK_EQ(hostSleep.wakeTypeAtStart[IMU2_PIN], GPIO_INTR_HIGH_LEVEL);
+    CHECK(hostSleep.armedAtStart[TCS_PIN]);
+    CHECK_EQ(hostSleep.wakeTypeAtStart[TCS_PIN], GPIO_INTR_LOW_LEVEL);
+    CHECK_EQ(hostSleep.cause, ESP_SLEEP_WAKEUP_TIMER);
+
+    for (uint8_t p = 0; p < HostSleep::PINS; p++) CHECK(!hostSleep.wakeEnabled[p]);
+    CHECK_EQ(hostSleep.intrType[IMU1_PIN], GPIO_INTR_ANYEDGE);
+    CHECK_EQ(hostSleep.intrType[IMU2_PIN], GPIO_INTR_POSEDGE);
+    CHECK_EQ(hostSleep.intrType[TCS_PIN], GPIO_INTR_NEGEDGE);
+
+    idleLevels();
+    digitalWrite(IMU1_PIN, LOW);
+    loopOnce();
+    CHECK(hostSleep.armedAtStart[TOUCH_PIN]);
+    CHECK_EQ(hostSleep.wakeTypeAtStart[TOUCH_PIN], GPIO_INTR_LOW_LEVEL);
+    CHECK_EQ(hostSleep.wakeTypeAtStart[IMU1_PIN], GPIO_INTR_HIGH_LEVEL);
+    idleLevels();
+}
+
+// A pin wake ends the sleep early and re-raises only that pin's event
+static void testPinWake() {
+    for (;;) {
+        ui.runDue();
+        CHECK(settle());
+        if (min(ui.msUntilNextDeadline(1000), sensors.msUntilNextDeadline(1000)) > 20) break;
+        power.idle();
+    }
+    hostSleep.pinScheduled = true;
+    hostSleep.pin = IMU2_PIN;
+    hostSleep.level = HIGH;
+    hostSleep.pinAfterUs = 15000;
+    uint32_t start = millis();
+    power.idle();
+    CHECK_EQ(hostSleep.cause, ESP_SLEEP_WAKEUP_GPIO);
+    CHECK_EQ(millis() - start, 15);
+    CHECK_EQ(imuWakes, 1);
+    CHECK_EQ(touchWakes, 0);
+    CHECK_EQ(colorWakes, 0);
+    idleLevels();
+}
+
+// A rejected sleep falls back to the plain wait and is not retried for
+// REJECT_BACKOFF_MS
+static void testRejectBackoff() {
+    hostSleep.result = ESP_ERR_SLEEP_REJECT;
+    uint32_t starts = hostSleep.starts;
+    uint32_t rejectedAt = millis();
+    loopOnce();
+    CHECK_EQ(hostSleep.starts, starts + 1);
+    CHECK(millis() > rejectedAt);     // waited out the deadline regardless
+    hostSleep.result = ESP_OK;
+
+    while (millis() - rejectedAt < 900) loopOnce();
+    CHECK_EQ(hostSleep.starts, starts + 1);
+    while (millis() - rejectedAt < 1000) loopOnce();
+    loopOnce();
+    CHECK_EQ(hostSleep.starts, starts + 2);
+}
+
+// The sensor core triggered after idle() saw it parked, here by the TCS INT
+// going low before the pins are armed: no sleep while the work is pending
+// or running. The color task holds the sensor core until released, so
+// either way the check sees it busy.
+static void testTriggerBeforeSleep() {
+    holdColor = true;
+    hostSleep.onPrepare = [] {
+        digitalWrite(TCS_PIN, LOW);
+        sensors.triggerFromISR(colorTask);
+    };
+    uint32_t starts = hostSleep.starts;
+    loopOnce();
+    hostSleep.onPrepare = nullptr;
+    CHECK_EQ(hostSleep.starts, starts);
+    for (uint8_t p = 0; p < HostSleep::PINS; p++) CHECK(!hostSleep.wakeEnabled[p]);
+    holdColor = false;
+    CHECK(settle());
+    CHECK_EQ(colorRuns, 1);
+    idleLevels();
+
+    loopOnce();
+    CHECK_EQ(hostSleep.starts, starts + 1);
+}
+
+int main() {
+    idleLevels();
+    power.begin();
+    CHECK(power.addWakePin("touch", TOUCH_PIN, LOW, FALLING, onTouchWake));
+    CHECK(power.addWakePin("imu1", IMU1_PIN, PowerScheduler::WAKE_ON_CHANGE, CHANGE, onImuWake));
+    CHECK(power.addWakePin("imu2", IMU2_PIN, HIGH, RISING, onImuWake));
+    CHECK(power.addWakePin("tcs", TCS_PIN, LOW, FALLING, onColorWake));
+
+    ui.begin();
+    ui.addTask("ui", uiTask, UI_PERIOD_MS);
+    sensors.addTask("flip", flipTask, FLIP_PERIOD_MS);
+    colorTask = sensors.addTask("color", onColor);
+    hostStartTasks(true);
+    xTaskCreatePinnedToCore(sensorCore, "sensors", 4096, nullptr, 2, nullptr, 0);
+
+    testSleepLength();
+    testArming();
+    testPinWake();
+    testRejectBackoff();
+    testTriggerBeforeSleep();
+    return checkResult("power_scheduler_test");
+}
@@ -0,0 +1,245 @@
+#include "src/profiler/Profiler.h"
+#include "check.h"
+#include <string>
+#include <thread>
+#include <vector>
+
+// Profiler built with PROFILER_ENABLED=1, timed on the fake clock: a zone's
+// body burns an exact number of microseconds, so the histogram buckets,
+// min/avg/p99/max and the dumps are all deterministic.
+#if !PROFILER_ENABLED
+#error "profiler_test needs PROFILER_ENABLED=1"
+#endif
+
+static void zoneA(uint32_t us) {
+    PROFILE_ZONE("a");
+    delayMicroseconds(us);
+}
+
+static void zoneB(uint32_t us) {
+    PROFILE_ZONE("b");
+    delayMicroseconds(us);
+}
+
+struct ZoneLine {
+    std::string name;
+    unsigned long n, min, avg, p99, max;
+};
+
+static std::vector<std::string> lines;
+static void collect(const char* line) { lines.push_back(line); }
+
+static std::vector<ZoneLine> zonesInDump() {
+    lines.clear();
+    Profiler::dumpJSON(collect);
+    std::vector<ZoneLine> out;
+    for (const std::string& l : lines) {
+        char name[32];
+        ZoneLine z;
+        if (sscanf(l.c_str(), "{\"zone\":\"%31[^\"]\",\"n\":%lu,\"min\":%lu,\"avg\":%lu,\"p99\":%lu,\"max\":%lu}",
+                   name, &z.n, &z.min, &z.avg, &z.p99, &z.max) == 6) {
+            z.name = name;
+            out.push_back(z);
+        }
+    }
+    return out;
+}
+
+static bool findZone(const char* name, ZoneLine& out) {
+    for (const ZoneLine& z : zonesInDump()) {
+        if (z.name == name) {
+            out = z;
+            return true;
+        }
+    }
+    return false;
+}
+
+// The trailing {"spi":..,"i2c":..,"ms":..} line
+static bool counters(unsigned long& spi, unsigned long& i2c, unsigned long& ms) {
+    lines.clear();
+    Profiler::dumpJSON(collect);
+    return !lines.empty() && sscanf(lines.back().c_str(), "{\"spi\":%lu,\"i2c\":%lu,\"ms\":%lu}", &spi, &i2c, &ms) == 3;
+}
+
+// min, avg and max are exact; p99 is the upper end of the log2 bucket
+// holding the 99th percentile, never above max
+static void testStatistics() {
+    Profiler::reset();
+    for (int i = 0; i < 99; i++) zoneA(3);
+    zoneA(1000);
+    ZoneLine z;
+    CHECK(findZone("a", z));
+    CHECK_EQ(z.n, 100);
+    CHECK_EQ(z.min, 3);
+    CHECK_EQ(z.avg, (99 * 3 + 1000) / 100);
+    CHECK_EQ(z.max, 1000);
+    CHECK_EQ(z.p99, 3);            // [2, 4)
+
+    // A second slow run pushes the 99th percentile into [512, 1024), capped
+    zoneA(600);
+    CHECK(findZone("a", z));
+    CHECK_EQ(z.p99, 1000);
+
+    // Zones that did not run since the reset are left out
+    CHECK(!findZone("b", z));
+    zoneB(0);
+    CHECK(findZone("b", z));
+    CHECK_EQ(z.min, 0);
+    CHECK_EQ(z.p99, 0);
+}
+
+static ProfileZone zoneWith(std::initializer_list<uint32_t> samples) {
+    ProfileZone z = {};
+    z.minUs = UINT32_MAX;
+    for (uint32_t us : samples) {
+        uint8_t b = us < 2 ? 0 : 31 - __builtin_clz(us);
+        if (b >= PROFILER_BUCKETS) b = PROFILER_BUCKETS - 1;
+        z.histogram[b]++;
+        z.count++;
+        z.totalUs += us;
+        if (us < z.minUs) z.minUs = us;
+        if (us > z.maxUs) z.maxUs = us;
+    }
+    return z;
+}
+
+// Bucket edges as record() places them: [0, 2), [2, 4), ..., [2^19, inf)
+static void testBuckets() {
+    static const struct {
+        uint32_t us, upper;
+    } EDGES[] = {
+        {0, 1}, {1, 1}, {2, 3}, {3, 3}, {4, 7}, {1023, 1023}, {1024, 2047},
+        {(1u << 19) - 1, (1u << 19) - 1}, {1u << 19, 1u << 19},
+    };
+    for (const auto& e : EDGES) {
+        // A larger sample keeps max out of the way of the bucket's upper end
+        ProfileZone z = zoneWith({e.us, e.us, e.us, e.us, e.us, e.us, e.us, e.us, e.us, e.us});
+        z.maxUs = UINT32_MAX;
+        CHECK_EQ(Profiler::percentileUs(z, 50), e.upper == (1u << 19) ? UINT32_MAX : e.upper);
+    }
+
+    // The last bucket is open-ended: its percentile is the max itself
+    ProfileZone slow = zoneWith({3000000, 5000000});
+    CHECK_EQ(Profiler::percentileUs(slow, 99), 5000000);
+    ProfileZone mixed = zoneWith({10, 10, 10, 700000});
+    CHECK_EQ(Profiler::percentileUs(mixed, 50), 15);
+    CHECK_EQ(Profiler::percentileUs(mixed, 99), 700000);
+
+    ProfileZone empty = zoneWith({});
+    CHECK_EQ(Profiler::percentileUs(empty, 99), 0);
+
+    // Through record(), a 1.5 s zone
+    Profiler::reset();
+    zoneB(1500000);
+    ZoneLine z;
+    CHECK(findZone("b", z));
+    CHECK_EQ(z.p99, 1500000);
+}
+
+static const char* const NAMES[] = {
+    "z2", "z3", "z4", "z5", "z6", "z7", "z8", "z9", "z10", "z11", "z12", "z13", "z14", "z15",
+    "extra1", "extra2",
+};
+
+// Past PROFILER_MAX_ZONES names share the last slot instead of failing;
+// known names keep their own
+static void testOverflow() {
+    uint8_t a = Profiler::registerZone("a");
+    uint8_t b = Profiler::registerZone("b");
+    CHECK_EQ(a, 0);
+    CHECK_EQ(b, 1);
+    uint8_t ids[16];
+    for (int i = 0; i < 16; i++) ids[i] = Profiler::registerZone(NAMES[i]);
+    for (int i = 0; i < 14; i++) CHECK_EQ(ids[i], i + 2);
+    CHECK_EQ(ids[14], PROFILER_MAX_ZONES - 1);
+    CHECK_EQ(ids[15], PROFILER_MAX_ZONES - 1);
+    CHECK_EQ(Profiler::registerZone("z9"), ids[7]);
+    CHECK_EQ(Profiler::registerZone("b"), 1);
+
+    Profiler::reset();
+    Profiler::record(ids[14], 100);
+    Profiler::record(ids[15], 200);
+    Profiler::record(ids[13], 50);
+    std::vector<ZoneLine> dumped = zonesInDump();
+    CHECK_EQ(dumped.size(), 1);
+    if (dumped.size() == 1) {
+        CHECK(dumped[0].name == "z15");
+        CHECK_EQ(dumped[0].n, 3);
+        CHECK_EQ(dumped[0].max, 200);
+    }
+}
+
+// Byte counters from both cores add up exactly and clear on reset, along
+// with the window the dump covers
+static void testCounters() {
+    Profiler::reset();
+    uint32_t since = millis();
+    std::thread other([] {
+        for (int i = 0; i < 10000; i++) {
+            PROFILE_COUNT_SPI(3);
+            PROFILE_COUNT_I2C(1);
+        }
+    });
+    for (int i = 0; i < 10000; i++) {
+        PROFILE_COUNT_SPI(5);
+        PROFILE_COUNT_I2C(2);
+    }
+    other.join();
+    delay(250);
+    unsigned long spi, i2c, ms;
+    CHECK(counters(spi, i2c, ms));
+    CHECK_EQ(spi, 80000);
+    CHECK_EQ(i2c, 30000);
+    CHECK_EQ(ms, millis() - since);
+
+    // Zones recorded from two threads lose no runs either
+    std::thread worker([] { for (int i = 0; i < 5000; i++) Profiler::record(0, 7); });
+    for (int i = 0; i < 5000; i++) Profiler::record(0, 9);
+    worker.join();
+    ZoneLine z;
+    CHECK(findZone("a", z));
+    CHECK_EQ(z.n, 10000);
+    CHECK_EQ(z.avg, 8);
+
+    Profiler::reset();
+    CHECK(counters(spi, i2c, ms));
+    CHECK_EQ(spi, 0);
+    CHECK_EQ(i2c, 0);
+    CHECK_EQ(ms, 0);
+    CHECK(zonesInDump().empty());
+}
+
+class StringPrint : public Print {
+public:
+    std::string text;
+    size_t write(uint8_t c) override {
+        text += (char)c;
+        return 1;
+    }
+};
+
+static void testDump() {
+    Profiler::reset();
+    uint32_t since = millis();
+    zoneA(40);
+    zoneA(60);
+    PROFILE_COUNT_SPI(1234);
+    StringPrint out;
+    Profiler::dump(out);
+    char expect[64];
+    snprintf(expect, sizeof(expect), "Profile over %lu ms\n", (unsigned long)(millis() - since));
+    CHECK(out.text.rfind(expect, 0) == 0);
+    // count, min, avg, p99 (top of [32, 64), capped at max) and max
+    CHECK(out.text.find("  a                     2       40       50       60       60\n") != std::string::npos);
+    CHECK(out.text.find("  SPI 1234 bytes, I2C 0 bytes\n") != std::string::npos);
+}
+
+int main() {
+    testStatistics();
+    testBuckets();
+    testOverflow();
+    testCounters();
+    testDump();
+    return checkResult("profiler_test");
+}
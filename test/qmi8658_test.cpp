@@ -0,0 +1,259 @@
+#include "Qmi8658Model.h"
+#include "check.h"
+
+static TwoWire wire(0);
+static I2CBus bus(wire, "test");
+
+// A fresh chip with the driver initialised on it and the log cleared
+static void startChip(Qmi8658Model& chip) {
+    wire.attach(&chip);
+    CHECK(QMI8658_init(bus));
+    chip.log.clear();
+    chip.ctrl9Log.clear();
+}
+
+static std::vector<uint8_t> fifoFrames(int count) {
+    std::vector<uint8_t> bytes;
+    for (int f = 0; f < count; f++) {
+        for (int i = 0; i < 6; i++) {
+            int16_t v = (int16_t)(f * 100 + i * 10 - 300);
+            bytes.push_back(v & 0xFF);
+            bytes.push_back((v >> 8) & 0xFF);
+        }
+    }
+    return bytes;
+}
+
+// Write bursts to CTRL1..CTRL8 as (first register, bytes)
+typedef std::vector<std::pair<uint8_t, std::vector<uint8_t>>> CtrlWrites;
+
+static CtrlWrites ctrlWrites(const Qmi8658Model& chip) {
+    CtrlWrites w;
+    for (const auto& a : chip.writes()) {
+        if (a.reg >= QMI8658Register_Ctrl1 && a.reg <= QMI8658Register_Ctrl8) w.push_back({a.reg, a.data});
+    }
+    return w;
+}
+
+// What QMI8658_init applies
+static QMI8658Config defaultConfig() {
+    QMI8658Config c;
+    c.inputSelection = QMI8658_CONFIG_ACCGYR_ENABLE;
+    c.accRange = QMI8658AccRange_8g;
+    c.accOdr = QMI8658AccOdr_62_5Hz;
+    c.gyrRange = QMI8658GyrRange_512dps;
+    c.gyrOdr = QMI8658GyrOdr_62_5Hz;
+    c.aeOdr = QMI8658AeOdr_128Hz;
+    c.magOdr = QMI8658MagOdr_125Hz;
+    c.magDev = MagDev_AKM09918;
+    return c;
+}
+
+// Init seeds the shadow with one CTRL1..CTRL8 read, then writes each run
+// of changed registers as a single burst, in register order
+static void testInitCoalescesRuns() {
+    Qmi8658Model chip;
+    wire.attach(&chip);
+    CHECK(QMI8658_init(bus));
+    CHECK_EQ(chip.readsOf(QMI8658Register_Ctrl1), 1);
+    CHECK(ctrlWrites(chip) == CtrlWrites({
+        {QMI8658Register_Ctrl1, {0x60}},
+        {QMI8658Register_Ctrl2, {0x27, 0x47}},     // CTRL2 + CTRL3
+        {QMI8658Register_Ctrl5, {0x77}},
+        {QMI8658Register_Ctrl7, {0x03}},
+    }));
+
+    // A chip that already holds the configuration, e.g. after a soft reset
+    // of the ESP32 alone, gets no control writes at all
+    Qmi8658Model warm;
+    memcpy(&warm.regs[QMI8658Register_Ctrl1], &chip.regs[QMI8658Register_Ctrl1], 8);
+    wire.attach(&warm);
+    CHECK(QMI8658_init(bus));
+    CHECK(ctrlWrites(warm).empty());
+}
+
+static void testShadowSkipsUnchanged() {
+    Qmi8658Model chip;
+    startChip(chip);
+    QMI8658Config config = defaultConfig();
+
+    QMI8658BusStats before, after;
+    QMI8658_get_bus_stats(&before);
+    QMI8658_Config_apply(&config);
+    QMI8658_enableSensors(QMI8658_CONFIG_ACCGYR_ENABLE);
+    QMI8658_get_bus_stats(&after);
+    CHECK(chip.log.empty());
+    CHECK_EQ(after.skippedWrites - before.skippedWrites, 9);
+    CHECK_EQ(after.writes, before.writes);
+
+    // Read-modify-write of CTRL1 comes from the shadow, no bus read
+    QMI8658_enableInterrupts(QMI8658_CTRL1_INT1_ENABLE);
+    CHECK_EQ(chip.log.size(), 1);
+    CHECK(ctrlWrites(chip) == CtrlWrites({{QMI8658Register_Ctrl1, {0x68}}}));
+
+    // Adjacent changes go out as one burst; the rest is skipped
+    chip.log.clear();
+    config.accRange = QMI8658AccRange_4g;
+    config.gyrRange = QMI8658GyrRange_256dps;
+    QMI8658_Config_apply(&config);
+    CHECK(ctrlWrites(chip) == CtrlWrites({{QMI8658Register_Ctrl2, {0x17, 0x37}}}));
+    CHECK_EQ(QMI8658_get_acc_lsb_div(), 1 << 13);
+    CHECK_EQ(QMI8658_get_gyro_lsb_div(), 128);
+}
+
+// Leaving wake-on-motion restores the saved configuration by writing only
+// the registers wake-on-motion changed
+static void testWakeOnMotionRoundTrip() {
+    Qmi8658Model chip;
+    startChip(chip);
+    uint8_t configured[8];
+    memcpy(configured, &chip.regs[QMI8658Register_Ctrl1], 8);
+
+    QMI8658_enableWakeOnMotion();
+    CHECK_EQ(chip.regs[QMI8658Register_Ctrl2], QMI8658AccRange_8g | QMI8658AccOdr_LowPower_21Hz);
+    CHECK_EQ(chip.regs[QMI8658Register_Ctrl7], QMI8658_CTRL7_ACC_ENABLE);
+    CHECK_EQ(chip.regs[QMI8658Register_Cal1_L], QMI8658WomThreshold_low);
+    CHECK(chip.ctrl9Log == std::vector<uint8_t>({QMI8658_Ctrl9_Cmd_WoM_Setting, QMI8658_Ctrl9_Cmd_Ack}));
+
+    chip.log.clear();
+    QMI8658_disableWakeOnMotion();
+    CHECK(ctrlWrites(chip) == CtrlWrites({
+        {QMI8658Register_Ctrl7, {0x00}},
+        {QMI8658Register_Ctrl2, {0x27}},
+        {QMI8658Register_Ctrl5, {0x77}},
+        {QMI8658Register_Ctrl7, {0x03}},
+    }));
+    CHECK(memcmp(configured, &chip.regs[QMI8658Register_Ctrl1], 8) == 0);
+}
+
+static void testCtrl9Handshake() {
+    Qmi8658Model chip;
+    startChip(chip);
+    CHECK_EQ(QMI8658_send_ctrl9(QMI8658_Ctrl9_Cmd_Rst_Fifo), 1);
+    CHECK(chip.ctrl9Log == std::vector<uint8_t>({QMI8658_Ctrl9_Cmd_Rst_Fifo, QMI8658_Ctrl9_Cmd_Ack}));
+    CHECK_EQ(chip.regs[QMI8658Register_StatusInt] & QMI8658_STATUSINT_CMD_DONE, 0);
+
+    // CmdDone never set: no ack is sent
+    Qmi8658Model silent;
+    silent.cmdDonePolls = -1;
+    startChip(silent);
+    CHECK_EQ(QMI8658_send_ctrl9(QMI8658_Ctrl9_Cmd_Rst_Fifo), 0);
+    CHECK(silent.ctrl9Log == std::vector<uint8_t>({QMI8658_Ctrl9_Cmd_Rst_Fifo}));
+
+    // Ack written but CmdDone stays up
+    Qmi8658Model stuck;
+    stuck.ackClears = false;
+    startChip(stuck);
+    CHECK_EQ(QMI8658_send_ctrl9(QMI8658_Ctrl9_Cmd_Rst_Fifo), 0);
+    CHECK_EQ(stuck.ctrl9Log.size(), 2);
+}
+
+static void testFifoRead() {
+    Qmi8658Model chip;
+    startChip(chip);
+    QMI8658_config_fifo(QMI8658FifoMode_Stream, QMI8658FifoSize_32, 4);
+    CHECK_EQ(chip.regs[QMI8658Register_FifoWtmTh], 4);
+    CHECK_EQ(chip.regs[QMI8658Register_FifoCtrl], QMI8658FifoMode_Stream | QMI8658FifoSize_32);
+    CHECK(chip.ctrl9Log == std::vector<uint8_t>({QMI8658_Ctrl9_Cmd_Rst_Fifo, QMI8658_Ctrl9_Cmd_Ack}));
+
+    // 25 frames come out in bursts of at most 10
+    short acc[32][3], gyro[32][3];
+    chip.loadFifo(fifoFrames(25));
+    chip.log.clear();
+    chip.regs[QMI8658Register_FifoCtrl] |= QMI8658_FIFO_CTRL_RD_MODE;
+    CHECK_EQ(QMI8658_read_fifo_raw(acc, gyro, 32), 25);
+    CHECK_EQ(acc[0][0], -300);
+    CHECK_EQ(gyro[0][2], -300 + 50);
+    CHECK_EQ(acc[24][1], 2400 - 300 + 10);
+    CHECK_EQ(gyro[24][0], 2400 - 300 + 30);
+    std::vector<size_t> bursts;
+    for (const auto& a : chip.log) {
+        if (a.data.empty() && a.reg == QMI8658Register_FifoData) bursts.push_back(a.readLen);
+    }
+    CHECK(bursts == std::vector<size_t>({120, 120, 60}));
+    CHECK_EQ(chip.regs[QMI8658Register_FifoCtrl] & QMI8658_FIFO_CTRL_RD_MODE, 0);
+
+    // The caller's limit wins over the count
+    chip.loadFifo(fifoFrames(25));
+    CHECK_EQ(QMI8658_read_fifo_raw(acc, gyro, 8), 8);
+    CHECK_EQ(acc[7][0], 700 - 300);
+
+    // A failed count read drains nothing and still leaves read mode
+    chip.loadFifo(fifoFrames(25));
+    chip.failReadOf = QMI8658Register_FifoSmplCnt;
+    chip.log.clear();
+    chip.regs[QMI8658Register_FifoCtrl] |= QMI8658_FIFO_CTRL_RD_MODE;
+    CHECK_EQ(QMI8658_read_fifo_raw(acc, gyro, 32), 0);
+    CHECK_EQ(chip.readsOf(QMI8658Register_FifoData), 0);
+    CHECK_EQ(chip.regs[QMI8658Register_FifoCtrl] & QMI8658_FIFO_CTRL_RD_MODE, 0);
+
+    // No frames unless the FIFO request was acknowledged
+    Qmi8658Model silent;
+    silent.cmdDonePolls = -1;
+    startChip(silent);
+    silent.loadFifo(fifoFrames(5));
+    CHECK_EQ(QMI8658_read_fifo_raw(acc, gyro, 32), 0);
+    CHECK_EQ(silent.readsOf(QMI8658Register_FifoData), 0);
+}
+
+static void putLE16(uint8_t* regs, int16_t v) {
+    regs[0] = v & 0xFF;
+    regs[1] = (v >> 8) & 0xFF;
+}
+
+// One 17-byte burst from Timestamp_L to Gz_H, decoded at the 8 g and
+// 512 dps ranges init sets up
+static void testReadXyz() {
+    Qmi8658Model chip;
+    startChip(chip);
+    chip.regs[QMI8658Register_Timestamp_L] = 0x12;
+    chip.regs[QMI8658Register_Timestamp_L + 1] = 0x34;
+    chip.regs[QMI8658Register_Timestamp_L + 2] = 0x56;
+    putLE16(&chip.regs[QMI8658Register_Ax_L - 2], 0x7FFF);     // temperature, ignored
+    static const int16_t ACC[3] = {4096, -2048, 32767};
+    static const int16_t GYRO[3] = {64, -32768, -1};
+    for (int i = 0; i < 3; i++) {
+        putLE16(&chip.regs[QMI8658Register_Ax_L + 2 * i], ACC[i]);
+        putLE16(&chip.regs[QMI8658Register_Ax_L + 6 + 2 * i], GYRO[i]);
+    }
+
+    float acc[3], gyro[3];
+    unsigned int tim = 0;
+    QMI8658_read_xyz(acc, gyro, &tim);
+    CHECK_EQ(chip.log.size(), 1);
+    CHECK_EQ(chip.log[0].reg, QMI8658Register_Timestamp_L);
+    CHECK(chip.log[0].data.empty());
+    CHECK_EQ(chip.log[0].readLen, 17);
+    CHECK_EQ(tim, 0x563412);
+    CHECK_EQ(acc[0], 1000.0f);                 // mg
+    CHECK_EQ(acc[1], -500.0f);
+    CHECK_EQ(acc[2], 32767 * 1000.0f / 4096);
+    CHECK_EQ(gyro[0], 1.0f);                   // dps
+    CHECK_EQ(gyro[1], -512.0f);
+    CHECK_EQ(gyro[2], -1.0f / 64);
+
+    // No timestamp wanted: the same single read
+    chip.log.clear();
+    QMI8658_read_xyz(acc, gyro, nullptr);
+    CHECK_EQ(chip.log.size(), 1);
+    CHECK_EQ(acc[0], 1000.0f);
+
+    // A failed read reports zeros, not the previous sample
+    chip.failReadOf = QMI8658Register_Timestamp_L;
+    QMI8658_read_xyz(acc, gyro, &tim);
+    CHECK_EQ(tim, 0);
+    for (int i = 0; i < 3; i++) {
+        CHECK_EQ(acc[i], 0.0f);
+        CHECK_EQ(gyro[i], 0.0f);
+    }
+}
+
+int main() {
+    testInitCoalescesRuns();
+    testShadowSkipsUnchanged();
+    testWakeOnMotionRoundTrip();
+    testCtrl9Handshake();
+    testFifoRead();
+    testReadXyz();
+    return checkResult("qmi8658_test");
+}
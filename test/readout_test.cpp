@@ -0,0 +1,108 @@
+#include "src/ui/Widgets.h"
+#include "src/screen/GUI_Paint.h"
+#include "src/screen/LCD_1in28.h"
+#include "src/fonts/fonts.h"
+#include "recording_panel.h"
+#include "check.h"
+#include <math.h>
+
+// Number drawing into a small RGB565 image: a Readout stays inside its
+// rectangle whatever the value, and Paint_DrawNum saturates instead of
+// converting an out-of-range double.
+static const UWORD W = 160, H = 40;
+static UWORD image[W * H];
+
+static void clearImage() {
+    Paint_NewImage((UBYTE*)image, W, H, 0, WHITE);
+    Paint_SetScale(65);
+    Paint_Clear(WHITE);
+}
+
+// Pixels that differ from white outside [x0, x1) x [y0, y1)
+static int paintedOutside(int x0, int y0, int x1, int y1) {
+    int n = 0;
+    for (int y = 0; y < H; y++) {
+        for (int x = 0; x < W; x++) {
+            bool inside = x >= x0 && x < x1 && y >= y0 && y < y1;
+            if (!inside && image[y * W + x] != WHITE) n++;
+        }
+    }
+    return n;
+}
+
+// The w x h block at (ax, ay) matches the one at (bx, by)
+static bool sameBlock(int ax, int ay, int bx, int by, int w, int h) {
+    for (int y = 0; y < h; y++) {
+        if (memcmp(&image[(ay + y) * W + ax], &image[(by + y) * W + bx], w * sizeof(UWORD))) return false;
+    }
+    return true;
+}
+
+struct ReadoutCase {
+    uint8_t cells, decimals;
+    int32_t value, shown;
+};
+
+static void testReadoutSaturates() {
+    static const ReadoutCase CASES[] = {
+        {3, 0, 123456, 999},
+        {3, 0, -123456, -99},
+        {5, 2, 1234567, 9999},     // 99.99
+        {5, 2, -1234567, -999},    // -9.99
+        {2, 0, INT32_MIN, -9},
+        {11, 0, INT32_MAX, INT32_MAX},
+        {4, 2, -5, 0},             // "-0.05" needs five cells
+        {3, 0, 42, 42},
+    };
+    UWORD digit = Paint_DigitWidthAA(&FontAA16);
+    for (const ReadoutCase& c : CASES) {
+        clearImage();
+        Readout r(4, 2, c.cells, c.decimals, &FontAA16, BLACK, WHITE);
+        r.setValue(c.value);
+        r.draw();
+        CHECK_EQ(paintedOutside(4, 2, 4 + c.cells * digit, 2 + FontAA16.Height), 0);
+        CHECK_EQ(r.value(), c.value);   // only the drawing saturates
+
+        // Pixel for pixel what the saturated value draws as
+        if (4 + c.cells * digit <= W / 2) {
+            Paint_DrawFixedAA(W / 2 + 4, 2, c.shown, c.decimals, c.cells, &FontAA16, BLACK, WHITE);
+            CHECK(sameBlock(4, 2, W / 2 + 4, 2, c.cells * digit, FontAA16.Height));
+        }
+    }
+
+    // Not even "0.00" fits three cells: left blank
+    clearImage();
+    Readout tiny(4, 2, 3, 2, &FontAA16, BLACK, WHITE);
+    tiny.setValue(1);
+    tiny.draw();
+    CHECK_EQ(paintedOutside(0, 0, 0, 0), 0);
+}
+
+static void testDrawNumSaturates() {
+    clearImage();
+    Paint_DrawNum(0, 0, 1e12, &Font12, 0, BLACK, WHITE);
+    Paint_DrawFixed(0, 20, INT32_MAX, 0, 0, &Font12, BLACK, WHITE);
+    CHECK(sameBlock(0, 0, 0, 20, 10 * Font12.Width, Font12.Height));
+
+    clearImage();
+    Paint_DrawNum(0, 0, -1e12, &Font12, 2, BLACK, WHITE);
+    Paint_DrawFixed(0, 20, INT32_MIN, 2, 0, &Font12, BLACK, WHITE);
+    CHECK(sameBlock(0, 0, 0, 20, 12 * Font12.Width, Font12.Height));
+
+    clearImage();
+    Paint_DrawNum(0, 0, NAN, &Font12, 1, BLACK, WHITE);
+    Paint_DrawFixed(0, 20, 0, 1, 0, &Font12, BLACK, WHITE);
+    CHECK(sameBlock(0, 0, 0, 20, 3 * Font12.Width, Font12.Height));
+
+    // Colors as named: black digits on white
+    clearImage();
+    Paint_DrawNum(0, 0, 8, &Font12, 0, BLACK, WHITE);
+    CHECK(image[0] == WHITE);
+    CHECK(paintedOutside(0, 0, 0, 0) > 0);
+}
+
+int main() {
+    testReadoutSaturates();
+    testDrawNumSaturates();
+    return checkResult("readout_test");
+}
@@ -0,0 +1,78 @@
+#ifndef RECORDING_PANEL_H
+#define RECORDING_PANEL_H
+
+#include "src/screen/LCD_1in28.h"
+#include <string.h>
+#include <vector>
+
+// Stand-in GC9A01 for host tests: keeps what reached the panel, pixel for
+// pixel in the order it was sent, and records every window and the pixel
+// bytes that went over the bus. It defines the LCD_1IN28 transfer
+// functions, so include it from one file of a test only.
+struct PanelWindow {
+    UWORD x0, y0, x1, y1;
+
+    uint32_t area() const { return (uint32_t)(x1 - x0) * (y1 - y0); }
+    bool operator==(const PanelWindow& o) const {
+        return x0 == o.x0 && y0 == o.y0 && x1 == o.x1 && y1 == o.y1;
+    }
+};
+
+struct RecordingPanel {
+    UWORD pixels[LCD_1IN28_WIDTH * LCD_1IN28_HEIGHT];
+    std::vector<PanelWindow> windows;
+    uint32_t bytes = 0;
+
+    // Forgets the transfers; the pixels stay as they are on a real panel
+    void reset() {
+        windows.clear();
+        bytes = 0;
+    }
+    UWORD at(UWORD x, UWORD y) const { return pixels[(uint32_t)y * LCD_1IN28_WIDTH + x]; }
+
+    // Open StartWindow() window and the next pixel WritePixels() fills
+    PanelWindow open = {0, 0, 0, 0};
+    uint32_t cursor = 0;
+};
+
+static RecordingPanel panel;
+
+void LCD_1IN28_Display(const UWORD *Image) {
+    memcpy(panel.pixels, Image, sizeof(panel.pixels));
+    panel.windows.push_back({0, 0, LCD_1IN28_WIDTH, LCD_1IN28_HEIGHT});
+    panel.bytes += sizeof(panel.pixels);
+}
+void LCD_1IN28_DisplayRows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, const UWORD *Rows, UWORD Stride) {
+    PanelWindow win = {Xstart, Ystart, Xend, Yend};
+    UWORD w = Xend > LCD_1IN28_WIDTH ? LCD_1IN28_WIDTH - Xstart : Xend - Xstart;
+    for (UWORD y = Ystart; y < Yend && y < LCD_1IN28_HEIGHT && Xstart < LCD_1IN28_WIDTH; y++) {
+        memcpy(&panel.pixels[(uint32_t)y * LCD_1IN28_WIDTH + Xstart], &Rows[(uint32_t)(y - Ystart) * Stride], w * 2);
+    }
+    panel.windows.push_back(win);
+    panel.bytes += win.area() * 2;
+}
+UBYTE LCD_1IN28_StartWindow(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend) {
+    panel.open = {Xstart, Ystart, Xend, Yend};
+    panel.cursor = 0;
+    panel.windows.push_back(panel.open);
+    return 1;
+}
+void LCD_1IN28_WritePixels(const UWORD *Pixels, UWORD Count) {
+    // Row by row through the open window, as the controller wraps
+    const PanelWindow& win = panel.open;
+    UWORD w = win.x1 - win.x0;
+    panel.bytes += (uint32_t)Count * 2;
+    while (Count && w) {
+        UWORD x = win.x0 + panel.cursor % w, y = win.y0 + panel.cursor / w;
+        UWORD run = min<UWORD>(Count, win.x1 - x);
+        if (y < LCD_1IN28_HEIGHT && x < LCD_1IN28_WIDTH) {
+            UWORD fits = min<UWORD>(run, LCD_1IN28_WIDTH - x);
+            memcpy(&panel.pixels[(uint32_t)y * LCD_1IN28_WIDTH + x], Pixels, fits * 2);
+        }
+        Pixels += run;
+        Count -= run;
+        panel.cursor += run;
+    }
+}
+
+#endif // RECORDING_PANEL_H
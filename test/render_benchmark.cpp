@@ -0,0 +1,113 @@
+#include "src/screen/FrameBuffer.h"
+#include "src/screen/GUI_Paint.h"
+#include "src/screen/RoundMask.h"
+#include "src/fonts/fonts.h"
+#include "recording_panel.h"
+#include "check.h"
+#include <chrono>
+
+// A full frame and a partial window rendered through FrameBuffers, built
+// once with full frames and once with FB_STRIP_RENDER. Every visible pixel
+// that reaches the panel must equal the same scene painted in one go into
+// a plain image, so strip clipping loses or adds nothing at the strip
+// edges (the scene crosses them on purpose). Prints the SPI bytes and bus
+// time per frame and the host CPU time of renderFrame() (draw + flush) for
+// comparing the modes; the CPU figures are not checked.
+static const UWORD W = LCD_1IN28_WIDTH, H = LCD_1IN28_HEIGHT;
+static const uint32_t SPI_HZ = 80000000;
+static const int TIMED_FRAMES = 50;
+
+#if FB_STRIP_RENDER
+static const char* const MODE = "strip";
+#else
+static const char* const MODE = "frame";
+#endif
+
+static UWORD background[W * H];
+static UWORD reference[W * H];
+
+static void drawScene(void*) {
+    Paint_DrawFullImage(background);
+    Paint_DrawCircle(120, 120, 70, GREEN, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    Paint_DrawCircle(120, 120, 90, BLUE, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
+    Paint_DrawRectangle(30, 44, 210, 81, BLACK, DOT_PIXEL_1X1, DRAW_FILL_EMPTY);
+    Paint_DrawLine(20, 20, 220, 220, RED, DOT_PIXEL_1X1, LINE_STYLE_SOLID);
+    Paint_DrawLine(220, 40, 40, 200, BLUE, DOT_PIXEL_2X2, LINE_STYLE_DOTTED);
+    Paint_DrawString_EN(50, 25, "Strip 16", &Font16, BLACK, WHITE);
+    Paint_DrawStringAA(40, 56, "Hold the cup", &FontAA16, BLACK, WHITE);
+    Paint_DrawStringAlignedAA(0, W, 122, "centered", &FontSans16, TEXT_ALIGN_CENTER, WHITE, GREEN);
+    Paint_DrawFixedAA(80, 150, -12345, 2, 7, &FontAA16, RED, WHITE);
+    Paint_ClearWindows(100, 186, 140, 200, GRAY);
+}
+
+// The scene painted into reference without strips; leaves Paint on the
+// frame buffer (null in strip mode) as main() set it up
+static void paintReference() {
+    Paint_NewImage((UBYTE*)reference, W, H, 0, WHITE);
+    Paint_SetScale(65);
+    drawScene(nullptr);
+    Paint_NewImage((UBYTE*)FrameBuffers.front(), W, H, 0, WHITE);
+    Paint_SetScale(65);
+}
+
+static uint32_t visibleMismatches(UWORD x0, UWORD y0, UWORD x1, UWORD y1) {
+    uint32_t n = 0;
+    for (UWORD y = y0; y < y1; y++) {
+        UWORD xs = max(x0, RoundMask_SpanStart(y)), xe = min(x1, RoundMask_SpanEnd(y));
+        for (UWORD x = xs; x < xe; x++) {
+            if (panel.at(x, y) != reference[(uint32_t)y * W + x]) n++;
+        }
+    }
+    return n;
+}
+
+// Bytes on the bus for what the panel model recorded. A full frame goes
+// through the real driver's round-mask flush, which round_mask_benchmark
+// measures.
+static uint32_t spiBytes() {
+    if (panel.windows.size() == 1 && panel.windows[0] == PanelWindow{0, 0, W, H}) return RoundMask_FlushBytes();
+    return panel.bytes + panel.windows.size() * LCD_1IN28_WINDOW_OVERHEAD;
+}
+
+template <typename Fn>
+static double nsPer(int n, Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) fn();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / n;
+}
+
+int main() {
+    RoundMask_Init(W, H, LCD_1IN28_WINDOW_OVERHEAD);
+    CHECK(FrameBuffers.begin(W, H, FB_STRIP_RENDER ? 2 : 1) > 0);
+    Paint_NewImage((UBYTE*)FrameBuffers.front(), W, H, 0, WHITE);
+    Paint_SetScale(65);
+    for (uint32_t i = 0; i < (uint32_t)W * H; i++) background[i] = (UWORD)(i * 2654435761u >> 16);
+    paintReference();
+
+    // Whole frame: in strip mode one window per strip
+    memset(panel.pixels, 0, sizeof(panel.pixels));
+    panel.reset();
+    CHECK(FrameBuffers.renderFrame(drawScene, nullptr));
+    CHECK_EQ(visibleMismatches(0, 0, W, H), 0);
+    CHECK_EQ(panel.windows.size(), FB_STRIP_RENDER ? H / FB_STRIP_ROWS : 1);
+    uint32_t frameSpi = spiBytes();
+
+    // A window that starts and ends inside strips, on a cleared panel
+    memset(panel.pixels, 0, sizeof(panel.pixels));
+    panel.reset();
+    CHECK(FrameBuffers.render(30, 20, 210, 90, drawScene, nullptr));
+    CHECK_EQ(visibleMismatches(30, 20, 210, 90), 0);
+    CHECK_EQ(panel.windows.size(), FB_STRIP_RENDER ? 5 : 1);    // 20-36 ... 84-90
+    uint32_t windowSpi = spiBytes();
+    CHECK_EQ(panel.bytes, 180u * 70 * 2);
+
+    double frameNs = nsPer(TIMED_FRAMES, [] { FrameBuffers.renderFrame(drawScene, nullptr); });
+    double windowNs = nsPer(TIMED_FRAMES, [] { FrameBuffers.render(30, 20, 210, 90, drawScene, nullptr); });
+
+    printf("render_benchmark(%s): frame_spi_bytes=%lu frame_bus_us=%.0f frame_ns=%.0f "
+           "window_spi_bytes=%lu window_bus_us=%.0f window_ns=%.0f\n",
+           MODE, (unsigned long)frameSpi, frameSpi * 8.0 * 1e6 / SPI_HZ, frameNs,
+           (unsigned long)windowSpi, windowSpi * 8.0 * 1e6 / SPI_HZ, windowNs);
+    return checkResult("render_benchmark");
+}
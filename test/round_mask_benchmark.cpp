@@ -0,0 +1,125 @@
+#include "src/screen/LCD_1in28.h"
+#include "src/screen/RoundMask.h"
+#include "check.h"
+#include <string.h>
+
+// SPI traffic of one frame flush, masked (LCD_1IN28_Display, band by band)
+// against a plain full-screen window. The real LCD driver runs on a GC9A01
+// modelled at the DEV_SPI level: every byte is counted, and the column/row
+// address and memory write commands are decoded into a GRAM image, so the
+// masked flush is also checked to put every visible pixel on the glass.
+// Prints the figures and fails if the masked flush stops saving at least
+// MIN_SAVED_PERCENT.
+static const uint32_t SPI_HZ = 80000000;
+static const uint32_t MIN_SAVED_PERCENT = 18;
+static const UWORD W = LCD_1IN28_WIDTH, H = LCD_1IN28_HEIGHT;
+
+struct Gc9a01 {
+    uint8_t gram[W * H * 2];
+    uint32_t bytes = 0;
+    uint32_t windows = 0;        // memory writes (0x2C)
+
+    uint8_t dc = 0;
+    uint8_t command = 0;
+    uint8_t args[4];
+    uint8_t argCount = 0;
+    UWORD x0 = 0, x1 = 0, y0 = 0, y1 = 0;
+    uint32_t cursor = 0;         // byte within the open window
+
+    void commandByte(uint8_t c) {
+        command = c;
+        argCount = 0;
+        cursor = 0;
+        if (c == 0x2C) windows++;
+    }
+
+    void dataByte(uint8_t d) {
+        if (command == 0x2A || command == 0x2B) {
+            if (argCount < 4) args[argCount++] = d;
+            if (argCount == 4) {
+                UWORD s = args[0] << 8 | args[1], e = args[2] << 8 | args[3];
+                if (command == 0x2A) { x0 = s; x1 = e; }
+                else { y0 = s; y1 = e; }
+            }
+        } else if (command == 0x2C) {
+            // Inclusive end addresses; the panel wraps row by row
+            uint32_t w = x1 - x0 + 1;
+            uint32_t pixel = cursor / 2;
+            UWORD x = x0 + pixel % w, y = y0 + pixel / w;
+            if (x <= x1 && y <= y1 && x < W && y < H) gram[((uint32_t)y * W + x) * 2 + cursor % 2] = d;
+            cursor++;
+        }
+    }
+
+    void write(uint8_t b) {
+        bytes++;
+        if (dc) dataByte(b);
+        else commandByte(b);
+    }
+};
+
+static Gc9a01 lcd;
+
+void DEV_Digital_Write(uint16_t Pin, uint8_t Value) {
+    if (Pin == LCD_DC_PIN) lcd.dc = Value;
+}
+void DEV_Delay_ms(uint32_t xms) { delay(xms); }
+void DEV_SPI_WriteByte(uint8_t Value) { lcd.write(Value); }
+void DEV_SPI_Write_nByte(const uint8_t *pData, uint32_t Len) {
+    for (uint32_t i = 0; i < Len; i++) lcd.write(pData[i]);
+}
+
+static UWORD frame[W * H];
+
+static bool visiblePixelsMatch() {
+    for (UWORD y = 0; y < H; y++) {
+        for (UWORD x = RoundMask_SpanStart(y); x < RoundMask_SpanEnd(y); x++) {
+            uint32_t i = (uint32_t)y * W + x;
+            if (memcmp(&lcd.gram[i * 2], &frame[i], 2)) return false;
+        }
+    }
+    return true;
+}
+
+static uint32_t visiblePixels() {
+    uint32_t n = 0;
+    for (UWORD y = 0; y < H; y++) n += RoundMask_SpanEnd(y) - RoundMask_SpanStart(y);
+    return n;
+}
+
+static double busUs(uint32_t bytes) {
+    return bytes * 8.0 * 1e6 / SPI_HZ;
+}
+
+int main() {
+    LCD_1IN28_Init(HORIZONTAL);
+    for (uint32_t i = 0; i < (uint32_t)W * H; i++) frame[i] = (UWORD)(i * 2654435761u >> 16);
+
+    lcd.bytes = lcd.windows = 0;
+    memset(lcd.gram, 0, sizeof(lcd.gram));
+    LCD_1IN28_Display(frame);
+    uint32_t maskedBytes = lcd.bytes, maskedWindows = lcd.windows;
+    CHECK(visiblePixelsMatch());
+    CHECK_EQ(maskedBytes, RoundMask_FlushBytes());
+    CHECK_EQ(maskedWindows, RoundMask_BandCount());
+
+    lcd.bytes = lcd.windows = 0;
+    memset(lcd.gram, 0, sizeof(lcd.gram));
+    LCD_1IN28_DisplayWindows(0, 0, W, H, frame);
+    uint32_t fullBytes = lcd.bytes;
+    CHECK(visiblePixelsMatch());
+    CHECK(!memcmp(lcd.gram, frame, sizeof(frame)));
+    CHECK_EQ(fullBytes, (uint32_t)W * H * 2 + LCD_1IN28_WINDOW_OVERHEAD);
+    CHECK_EQ(lcd.windows, 1);
+
+    // The visible pixels alone: the least any flush can send
+    uint32_t floorBytes = visiblePixels() * 2;
+    uint32_t savedPercent = 100 * (fullBytes - maskedBytes) / fullBytes;
+    printf("round_mask_benchmark: masked_bytes=%lu full_bytes=%lu visible_bytes=%lu saved_pct=%lu "
+           "windows=%lu masked_us=%.0f full_us=%.0f\n",
+           (unsigned long)maskedBytes, (unsigned long)fullBytes, (unsigned long)floorBytes,
+           (unsigned long)savedPercent, (unsigned long)maskedWindows, busUs(maskedBytes), busUs(fullBytes));
+    CHECK(maskedBytes >= floorBytes);
+    CHECK(savedPercent >= MIN_SAVED_PERCENT);
+    return checkResult("round_mask_benchmark");
+}
@@ -0,0 +1,108 @@
+#include <Adafruit_TCS34725.h>
+#include "src/sensing/SensorHub.h"
+#include "check.h"
+#include <vector>
+
+// SensorHub on the fake clock with a simulated TCS34725. The IMU is left
+// unconfigured, so flip checks run but never touch the bus. Both
+// schedulers are stepped in 1 ms ticks, as the two cores would run them.
+static const uint8_t LED_PIN = 15;
+static const uint32_t SAMPLE_PERIOD_MS = 200;
+static const uint32_t FLIP_CHECK_MS = 1000;
+static const uint32_t AMBIENT_PERIOD_MS = 10000;
+
+static TwoWire imuWire(1);
+static Adafruit_TCS34725 tcs(TCS34725_INTEGRATIONTIME_360MS, TCS34725_GAIN_1X);
+static FlipDetector flipDetector(imuWire);
+static SensorHub hub(tcs, flipDetector, LED_PIN);
+static TaskScheduler ui;
+
+static std::vector<SensorEvent> events;
+static std::vector<ColorSample> samples;
+static uint32_t longestRunMs = 0;   // longest single pass of the sensor scheduler
+
+static void drain() {
+    SensorEvent ev;
+    while (hub.popEvent(ev)) events.push_back(ev);
+    ColorSample s;
+    while (hub.popSample(s)) samples.push_back(s);
+}
+
+static void runFor(uint32_t ms) {
+    uint32_t end = millis() + ms;
+    while ((int32_t)(millis() - end) < 0) {
+        uint32_t start = millis();
+        hub.taskScheduler().runDue();
+        if (millis() - start > longestRunMs) longestRunMs = millis() - start;
+        tcs.advance();
+        ui.runDue();
+        hostAdvanceUs(1000);
+    }
+}
+
+static size_t ambientEvents() {
+    size_t n = 0;
+    for (const SensorEvent& ev : events) if (ev.type == SENSOR_EVENT_AMBIENT) n++;
+    return n;
+}
+
+// While waiting for a flip the ambient level comes from the last completed
+// integration, without holding up the flip checks for another one
+static void testAmbientDoesNotBlock() {
+    tcs.clear = 321;
+    hub.setMode(SENSOR_MODE_WAIT_FLIP);
+    events.clear();
+    longestRunMs = 0;
+    uint32_t clears = tcs.intClears;
+    runFor(2 * AMBIENT_PERIOD_MS + 100);
+
+    CHECK_EQ(ambientEvents(), 2);
+    CHECK_EQ(events.back().value, 321);
+    CHECK(longestRunMs < 5);
+    // INT stays latched rather than waking the chip after each reading
+    CHECK_EQ(tcs.intClears, clears);
+    CHECK(tcs.intAsserted);
+    CHECK(samples.empty());
+}
+
+// No reading before the sensor has completed an integration
+static void testAmbientNeedsValidData() {
+    hub.setMode(SENSOR_MODE_IDLE);
+    tcs.disable();
+    events.clear();
+    runFor(AMBIENT_PERIOD_MS + 100);
+    CHECK_EQ(ambientEvents(), 0);
+    tcs.enable();
+}
+
+// Sampling reads with the LED lit and releases INT after each reading
+static void testSamplingClearsInterrupt() {
+    tcs.clear = 900;
+    tcs.red = 100;
+    hub.setMode(SENSOR_MODE_SAMPLING);
+    events.clear();
+    samples.clear();
+    uint32_t clears = tcs.intClears;
+    runFor(AMBIENT_PERIOD_MS);
+
+    CHECK(!samples.empty());
+    CHECK_EQ(tcs.intClears - clears, samples.size());
+    CHECK_EQ(samples.front().r, 100);
+    CHECK_EQ(samples.front().c, 900);
+    CHECK_EQ(ambientEvents(), 0);
+    CHECK_EQ(digitalRead(LED_PIN), LOW);
+}
+
+int main() {
+    CHECK(tcs.begin());
+    tcs.write8(TCS34725_PERS, TCS34725_PERS_NONE);
+    tcs.setInterrupt(true);
+    ui.begin();
+    uint8_t uiTask = ui.addTask("sensors", drain);
+    hub.begin(ui, uiTask, SAMPLE_PERIOD_MS, FLIP_CHECK_MS, AMBIENT_PERIOD_MS);
+
+    testAmbientDoesNotBlock();
+    testAmbientNeedsValidData();
+    testSamplingClearsInterrupt();
+    return checkResult("sensor_hub_test");
+}
@@ -0,0 +1,78 @@
+#include "src/scheduler/SpscQueue.h"
+#include "check.h"
+#include <thread>
+
+struct Item {
+    uint32_t seq;
+    uint32_t inverse;   // ~seq: a torn copy breaks the pair
+    uint64_t payload;
+};
+
+static void testSingleThread() {
+    SpscQueue<int, 4> q;
+    int v = 0;
+    CHECK(q.empty());
+    CHECK(!q.pop(v));
+    for (int i = 0; i < 4; i++) CHECK(q.push(i));
+    CHECK_EQ(q.size(), 4);
+    CHECK(!q.push(99));
+    CHECK_EQ(q.dropped(), 1);
+    for (int i = 0; i < 4; i++) {
+        CHECK(q.pop(v));
+        CHECK_EQ(v, i);
+    }
+    CHECK(q.empty());
+
+    // Many laps around the ring keep FIFO order
+    for (int i = 0; i < 1000; i++) {
+        CHECK(q.push(i));
+        if (i % 3 == 2) {
+            for (int k = 0; k < 3; k++) CHECK(q.pop(v));
+            CHECK_EQ(v, i);
+        }
+    }
+}
+
+// One producer, one consumer, a small ring so both sides keep hitting the
+// full and empty cases. Every item must arrive once, in order, intact.
+static void testStress() {
+    static const uint32_t COUNT = 2000000;
+    static SpscQueue<Item, 16> q;
+    uint32_t retries = 0;
+
+    std::thread producer([&] {
+        for (uint32_t i = 0; i < COUNT; i++) {
+            Item item = {i, ~i, (uint64_t)i * 2654435761u};
+            while (!q.push(item)) {
+                retries++;
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint32_t expected = 0, bad = 0;
+    while (expected < COUNT) {
+        Item item;
+        if (!q.pop(item)) {
+            std::this_thread::yield();
+            continue;
+        }
+        if (item.seq != expected || item.inverse != ~expected ||
+            item.payload != (uint64_t)expected * 2654435761u) {
+            bad++;
+        }
+        expected++;
+    }
+    producer.join();
+
+    CHECK_EQ(bad, 0);
+    CHECK(q.empty());
+    // Every refused push was retried, so the drop count is the retry count
+    CHECK_EQ(q.dropped(), retries);
+}
+
+int main() {
+    testSingleThread();
+    testStress();
+    return checkResult("spsc_queue_test");
+}
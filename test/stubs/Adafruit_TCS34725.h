@@ -0,0 +1,157 @@
+#ifndef ADAFRUIT_TCS34725_H
+#define ADAFRUIT_TCS34725_H
+
+// Host model of the Adafruit TCS34725 driver. Register values and timing
+// follow the library: getRawData() blocks for one integration time, which
+// here advances the fake clock. The channel values and the INT line state
+// are public so tests can set and inspect them.
+#include <Arduino.h>
+#include <Wire.h>
+
+#define TCS34725_ADDRESS (0x29)
+#define TCS34725_COMMAND_BIT (0x80)
+#define TCS34725_ENABLE (0x00)
+#define TCS34725_ENABLE_AIEN (0x10)
+#define TCS34725_ENABLE_AEN (0x02)
+#define TCS34725_ENABLE_PON (0x01)
+#define TCS34725_ATIME (0x01)
+#define TCS34725_AILTL (0x04)
+#define TCS34725_AIHTL (0x06)
+#define TCS34725_PERS (0x0C)
+#define TCS34725_PERS_NONE (0b0000)
+#define TCS34725_ID (0x12)
+#define TCS34725_STATUS (0x13)
+#define TCS34725_STATUS_AINT (0x10)
+#define TCS34725_STATUS_AVALID (0x01)
+#define TCS34725_CDATAL (0x14)
+#define TCS34725_RDATAL (0x16)
+#define TCS34725_GDATAL (0x18)
+#define TCS34725_BDATAL (0x1A)
+
+#define TCS34725_INTEGRATIONTIME_2_4MS (0xFF)
+#define TCS34725_INTEGRATIONTIME_24MS (0xF6)
+#define TCS34725_INTEGRATIONTIME_50MS (0xEB)
+#define TCS34725_INTEGRATIONTIME_101MS (0xD6)
+#define TCS34725_INTEGRATIONTIME_154MS (0xC0)
+#define TCS34725_INTEGRATIONTIME_360MS (0x6A)
+#define TCS34725_INTEGRATIONTIME_614MS (0x00)
+
+typedef enum {
+    TCS34725_GAIN_1X = 0x00,
+    TCS34725_GAIN_4X = 0x01,
+    TCS34725_GAIN_16X = 0x02,
+    TCS34725_GAIN_60X = 0x03
+} tcs34725Gain_t;
+
+class Adafruit_TCS34725 {
+public:
+    Adafruit_TCS34725(uint8_t it = TCS34725_INTEGRATIONTIME_2_4MS, tcs34725Gain_t gain = TCS34725_GAIN_1X)
+        : integrationTime(it), gain(gain) {
+        regs[TCS34725_ID] = 0x44;
+    }
+
+    bool begin(uint8_t addr = TCS34725_ADDRESS, TwoWire* wire = &Wire) {
+        (void)addr;
+        (void)wire;
+        if (present) enable();
+        return present;
+    }
+
+    void enable() {
+        regs[TCS34725_ENABLE] |= TCS34725_ENABLE_PON | TCS34725_ENABLE_AEN;
+        cycleStartUs = enabledAtUs = micros();
+    }
+    void disable() { regs[TCS34725_ENABLE] &= ~(TCS34725_ENABLE_PON | TCS34725_ENABLE_AEN); }
+
+    void setIntegrationTime(uint8_t it) { integrationTime = it; }
+    void setGain(tcs34725Gain_t g) { gain = g; }
+
+    // Same wait as the library: one full integration, rounded up
+    void getRawData(uint16_t* r, uint16_t* g, uint16_t* b, uint16_t* c) {
+        delay(integrationMs());
+        readChannels(r, g, b, c);
+    }
+
+    void setInterrupt(bool i) {
+        if (i) regs[TCS34725_ENABLE] |= TCS34725_ENABLE_AIEN;
+        else regs[TCS34725_ENABLE] &= ~TCS34725_ENABLE_AIEN;
+    }
+    void clearInterrupt() {
+        advance();
+        intAsserted = false;
+        intClears++;
+    }
+    void setIntLimits(uint16_t l, uint16_t h) {
+        intLow = l;
+        intHigh = h;
+    }
+
+    uint8_t read8(uint8_t reg) {
+        reads++;
+        if (reg == TCS34725_STATUS) return status();
+        return regs[reg & 0x1F];
+    }
+    uint16_t read16(uint8_t reg) {
+        uint16_t v[4];
+        readChannels(&v[1], &v[2], &v[3], &v[0]);
+        if (reg >= TCS34725_CDATAL && reg <= TCS34725_BDATAL) return v[(reg - TCS34725_CDATAL) / 2];
+        return (uint16_t)(regs[reg & 0x1F] | (regs[(reg + 1) & 0x1F] << 8));
+    }
+    void write8(uint8_t reg, uint32_t value) { regs[reg & 0x1F] = (uint8_t)value; }
+
+    // --- host side ---
+    bool present = true;
+    uint16_t red = 0, green = 0, blue = 0, clear = 0;
+    uint16_t intLow = 0, intHigh = 0;
+    bool intAsserted = false;   // INT is active low while set
+    uint32_t intClears = 0;
+    uint32_t reads = 0;         // register reads, a getRawData() counts once
+
+    uint32_t integrationMs() const { return (256 - integrationTime) * 12 / 5 + 1; }
+
+    // Runs the ADC cycle up to now. A finished integration asserts INT when
+    // AIEN is set and either PERS is PERS_NONE (every cycle) or the clear
+    // channel is outside the limits; longer persistence counts are not
+    // modelled. Returns true on a new assertion, i.e. a falling edge.
+    bool advance() {
+        if ((regs[TCS34725_ENABLE] & TCS34725_ENABLE_AEN) == 0) return false;
+        bool edge = false;
+        uint32_t cycleUs = integrationMs() * 1000;
+        while (micros() - cycleStartUs >= cycleUs) {
+            cycleStartUs += cycleUs;
+            bool outside = clear < intLow || clear > intHigh;
+            bool fire = (regs[TCS34725_PERS] & 0x0F) == TCS34725_PERS_NONE || outside;
+            if (fire && (regs[TCS34725_ENABLE] & TCS34725_ENABLE_AIEN) && !intAsserted) {
+                intAsserted = true;
+                edge = true;
+            }
+        }
+        return edge;
+    }
+
+private:
+    uint8_t integrationTime;
+    tcs34725Gain_t gain;
+    uint8_t regs[32] = {};
+    uint32_t cycleStartUs = 0;
+    uint32_t enabledAtUs = 0;
+
+    // AVALID once the first integration since enable() has completed
+    uint8_t status() const {
+        uint8_t st = intAsserted ? TCS34725_STATUS_AINT : 0;
+        if ((regs[TCS34725_ENABLE] & TCS34725_ENABLE_AEN) && micros() - enabledAtUs >= integrationMs() * 1000) {
+            st |= TCS34725_STATUS_AVALID;
+        }
+        return st;
+    }
+
+    void readChannels(uint16_t* r, uint16_t* g, uint16_t* b, uint16_t* c) {
+        *r = red;
+        *g = green;
+        *b = blue;
+        *c = clear;
+        reads++;
+    }
+};
+
+#endif // ADAFRUIT_TCS34725_H
@@ -0,0 +1,78 @@
+#include <Arduino.h>
+#include <Wire.h>
+#include <esp_timer.h>
+#include <stdarg.h>
+#include <atomic>
+
+HardwareSerial Serial;
+TwoWire Wire(0);
+
+static std::atomic<uint64_t> nowUs{0};   // tasks started by a test share it
+
+uint32_t millis() { return (uint32_t)(nowUs / 1000); }
+uint32_t micros() { return (uint32_t)nowUs; }
+void delay(uint32_t ms) { nowUs += (uint64_t)ms * 1000; }
+void delayMicroseconds(uint32_t us) { nowUs += us; }
+void hostAdvanceUs(uint32_t us) { nowUs += us; }
+int64_t esp_timer_get_time() { return (int64_t)nowUs; }
+
+static const uint8_t HOST_PINS = 64;
+static uint8_t pinLevels[HOST_PINS];
+static void (*pinHandlers[HOST_PINS])(void*);
+static void* pinArgs[HOST_PINS];
+
+void pinMode(uint8_t pin, uint8_t mode) { (void)pin; (void)mode; }
+void digitalWrite(uint8_t pin, uint8_t level) { if (pin < HOST_PINS) pinLevels[pin] = level; }
+int digitalRead(uint8_t pin) { return pin < HOST_PINS ? pinLevels[pin] : LOW; }
+
+void attachInterruptArg(uint8_t pin, void (*handler)(void*), void* arg, int mode) {
+    (void)mode;
+    if (pin >= HOST_PINS) return;
+    pinHandlers[pin] = handler;
+    pinArgs[pin] = arg;
+}
+
+void detachInterrupt(uint8_t pin) {
+    if (pin < HOST_PINS) pinHandlers[pin] = nullptr;
+}
+
+bool hostFireInterrupt(uint8_t pin) {
+    if (pin >= HOST_PINS || !pinHandlers[pin]) return false;
+    pinHandlers[pin](pinArgs[pin]);
+    return true;
+}
+
+size_t Print::write(uint8_t c) {
+    return fputc(c, stdout) == EOF ? 0 : 1;
+}
+
+size_t Print::write(const uint8_t* data, size_t len) {
+    size_t n = 0;
+    while (len--) n += write(*data++);
+    return n;
+}
+
+size_t Print::print(const char* s) {
+    return write((const uint8_t*)s, strlen(s));
+}
+
+size_t Print::print(long n) {
+    return printf("%ld", n);
+}
+
+size_t Print::println(long n) {
+    return print(n) + print("\n");
+}
+
+size_t Print::println(const char* s) {
+    return print(s) + print("\n");
+}
+
+size_t Print::printf(const char* fmt, ...) {
+    char buf[256];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    return print(buf);
+}
@@ -0,0 +1,79 @@
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+// Host stand-in for the parts of the Arduino-ESP32 core that the tested
+// modules touch. Time comes from a fake clock the tests move forward, and
+// unless a test starts tasks (freertos/task.h) code under test runs on the
+// calling thread.
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+
+using std::min;
+using std::max;
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define IRAM_ATTR
+#define PROGMEM
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define RISING 1
+#define FALLING 2
+#define CHANGE 3
+
+typedef uint8_t byte;
+
+// 32 bits wide, as on the ESP32
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);            // advances the fake clock
+void delayMicroseconds(uint32_t us);
+void hostAdvanceUs(uint32_t us);
+
+// GPIO levels are only recorded; hostFireInterrupt() runs whatever handler
+// is attached to the pin, as the edge would on the chip.
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int digitalRead(uint8_t pin);
+void attachInterruptArg(uint8_t pin, void (*handler)(void*), void* arg, int mode);
+void detachInterrupt(uint8_t pin);
+bool hostFireInterrupt(uint8_t pin);
+
+// Only as much of String as the headers under test declare
+class String : public std::string {
+public:
+    String(const char* s = "") : std::string(s) {}
+};
+
+static inline void* ps_malloc(size_t size) { return malloc(size); }
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c);
+    size_t write(const uint8_t* data, size_t len);
+    size_t print(const char* s);
+    size_t print(long n);
+    size_t println(const char* s = "");
+    size_t println(long n);
+    size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class HardwareSerial : public Print {
+public:
+    void begin(unsigned long baud) { (void)baud; }
+};
+
+extern HardwareSerial Serial;
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#endif // ARDUINO_H
@@ -0,0 +1,86 @@
+#include <Arduino.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include <driver/gpio.h>
+
+HostSleep hostSleep;
+
+static bool levelWakes(uint8_t pin, uint8_t level) {
+    if (!hostSleep.wakeEnabled[pin]) return false;
+    int type = hostSleep.wakeType[pin];
+    return (type == GPIO_INTR_HIGH_LEVEL && level) || (type == GPIO_INTR_LOW_LEVEL && !level);
+}
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t us) {
+    hostSleep.timerUs = us;
+    hostSleep.timerEnabled = true;
+    if (hostSleep.onPrepare) hostSleep.onPrepare();
+    return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_gpio_wakeup() {
+    hostSleep.gpioEnabled = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_sleep_disable_wakeup_source(esp_sleep_source_t source) {
+    if (source == ESP_SLEEP_WAKEUP_TIMER) hostSleep.timerEnabled = false;
+    if (source == ESP_SLEEP_WAKEUP_GPIO) hostSleep.gpioEnabled = false;
+    return ESP_OK;
+}
+
+esp_err_t esp_light_sleep_start() {
+    hostSleep.starts++;
+    for (uint8_t p = 0; p < HostSleep::PINS; p++) {
+        hostSleep.armedAtStart[p] = hostSleep.wakeEnabled[p];
+        hostSleep.wakeTypeAtStart[p] = hostSleep.wakeType[p];
+    }
+    if (hostSleep.result != ESP_OK) return hostSleep.result;
+
+    if (hostSleep.gpioEnabled) {
+        for (uint8_t p = 0; p < HostSleep::PINS; p++) {
+            if (levelWakes(p, digitalRead(p))) {
+                hostSleep.cause = ESP_SLEEP_WAKEUP_GPIO;
+                return ESP_OK;
+            }
+        }
+    }
+
+    bool pinFirst = hostSleep.pinScheduled &&
+                    (!hostSleep.timerEnabled || hostSleep.pinAfterUs < hostSleep.timerUs);
+    if (pinFirst) {
+        hostSleep.pinScheduled = false;
+        hostAdvanceUs(hostSleep.pinAfterUs);
+        digitalWrite(hostSleep.pin, hostSleep.level);
+        if (hostSleep.gpioEnabled && levelWakes(hostSleep.pin, hostSleep.level)) {
+            hostSleep.cause = ESP_SLEEP_WAKEUP_GPIO;
+            return ESP_OK;
+        }
+        hostAdvanceUs((uint32_t)(hostSleep.timerUs - hostSleep.pinAfterUs));
+    } else {
+        hostAdvanceUs((uint32_t)hostSleep.timerUs);
+    }
+    hostSleep.cause = ESP_SLEEP_WAKEUP_TIMER;
+    return ESP_OK;
+}
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause() { return hostSleep.cause; }
+
+esp_err_t gpio_wakeup_enable(gpio_num_t pin, gpio_int_type_t type) {
+    if (pin < 0 || pin >= HostSleep::PINS) return ESP_FAIL;
+    hostSleep.wakeEnabled[pin] = true;
+    hostSleep.wakeType[pin] = type;
+    return ESP_OK;
+}
+
+esp_err_t gpio_wakeup_disable(gpio_num_t pin) {
+    if (pin < 0 || pin >= HostSleep::PINS) return ESP_FAIL;
+    hostSleep.wakeEnabled[pin] = false;
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_intr_type(gpio_num_t pin, gpio_int_type_t type) {
+    if (pin < 0 || pin >= HostSleep::PINS) return ESP_FAIL;
+    hostSleep.intrType[pin] = type;
+    return ESP_OK;
+}
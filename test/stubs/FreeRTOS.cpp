@@ -0,0 +1,113 @@
+#include <Arduino.h>
+#include <freertos/semphr.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Host threads standing in for FreeRTOS tasks. One lock and condition
+// variable cover every notification and semaphore; tests are small enough
+// that waking all waiters on each give costs nothing.
+struct HostTask {
+    uint32_t notifications = 0;
+};
+
+static bool startTasks = false;
+static thread_local HostTask* currentTask = nullptr;
+
+// Never destroyed: task threads are still blocked on them when main()
+// returns, and other static constructors may log before this file's run
+static std::recursive_mutex& criticalLock() {
+    static std::recursive_mutex* m = new std::recursive_mutex();
+    return *m;
+}
+static std::mutex& waitLock() {
+    static std::mutex* m = new std::mutex();
+    return *m;
+}
+static std::condition_variable& waitChanged() {
+    static std::condition_variable* cv = new std::condition_variable();
+    return *cv;
+}
+void hostStartTasks(bool start) { startTasks = start; }
+
+void hostEnterCritical() { criticalLock().lock(); }
+void hostExitCritical() { criticalLock().unlock(); }
+
+BaseType_t xTaskCreatePinnedToCore(void (*fn)(void*), const char* name, uint32_t stack, void* arg,
+                                   UBaseType_t priority, TaskHandle_t* handle, BaseType_t core) {
+    (void)name; (void)stack; (void)priority; (void)core;
+    if (!startTasks) {
+        if (handle) *handle = nullptr;
+        return pdFALSE;
+    }
+    HostTask* task = new HostTask();
+    if (handle) *handle = task;
+    std::thread([fn, arg, task] {
+        currentTask = task;
+        fn(arg);
+    }).detach();
+    return pdPASS;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() { return currentTask; }
+
+void vTaskDelay(TickType_t ticks) {
+    delay(ticks);
+    if (startTasks) std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+void xTaskNotifyGive(TaskHandle_t task) {
+    if (!task) return;
+    std::lock_guard<std::mutex> guard(waitLock());
+    static_cast<HostTask*>(task)->notifications++;
+    waitChanged().notify_all();
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* woken) {
+    xTaskNotifyGive(task);
+    if (woken) *woken = pdTRUE;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks) {
+    HostTask* task = currentTask;
+    if (!task) return 0;
+    // A timeout runs on the fake clock, so a test moving time forward
+    // releases the task as the tick interrupt would
+    uint32_t deadline = millis() + ticks;
+    std::unique_lock<std::mutex> guard(waitLock());
+    while (task->notifications == 0) {
+        if (ticks != portMAX_DELAY && (int32_t)(millis() - deadline) >= 0) break;
+        waitChanged().wait_for(guard, std::chrono::milliseconds(1));
+    }
+    uint32_t n = task->notifications;
+    if (n) task->notifications = clear ? 0 : n - 1;
+    return n;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t* buf) {
+    buf->count = 0;
+    return buf;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks) {
+    StaticSemaphore_t* s = static_cast<StaticSemaphore_t*>(sem);
+    std::unique_lock<std::mutex> guard(waitLock());
+    auto given = [s] { return s->count != 0; };
+    if (!startTasks) {
+        if (!given()) return pdFALSE;
+    } else if (ticks == portMAX_DELAY) {
+        waitChanged().wait(guard, given);
+    } else if (!waitChanged().wait_for(guard, std::chrono::milliseconds(ticks), given)) {
+        return pdFALSE;
+    }
+    s->count = 0;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+    std::lock_guard<std::mutex> guard(waitLock());
+    static_cast<StaticSemaphore_t*>(sem)->count = 1;
+    waitChanged().notify_all();
+    return pdTRUE;
+}
@@ -0,0 +1,11 @@
+#ifndef SPI_H
+#define SPI_H
+
+#include <Arduino.h>
+
+class SPIClass {
+public:
+    void writeBytes(const uint8_t*, uint32_t) {}
+};
+
+#endif // SPI_H
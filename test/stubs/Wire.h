@@ -0,0 +1,71 @@
+#ifndef WIRE_H
+#define WIRE_H
+
+#include <Arduino.h>
+
+// Device side of the fake bus. Tests implement this to model registers
+// and inject errors; TwoWire hands it every transaction as it completes.
+class WireModel {
+public:
+    virtual ~WireModel() {}
+    // data[0] is the register byte when there is one. Returns a TwoWire
+    // error code: 0 ok, 2 address NACK, 3 data NACK, 5 timeout.
+    virtual uint8_t write(uint8_t addr, const uint8_t* data, size_t len, bool stop) = 0;
+    // Returns how many bytes the device delivered; fewer is a short read.
+    virtual size_t read(uint8_t addr, uint8_t* buf, size_t len) = 0;
+};
+
+class TwoWire {
+public:
+    explicit TwoWire(uint8_t busNum = 0) { (void)busNum; }
+
+    void attach(WireModel* m) { model = m; }
+    bool begin(int sda = -1, int scl = -1, uint32_t freq = 0) {
+        (void)sda; (void)scl;
+        if (freq) clock = freq;
+        return true;
+    }
+    bool setClock(uint32_t hz) { clock = hz; return true; }
+    uint32_t getClock() const { return clock; }
+
+    void beginTransmission(uint8_t addr) {
+        txAddr = addr;
+        txLen = 0;
+    }
+    size_t write(uint8_t b) {
+        if (txLen >= sizeof(tx)) return 0;
+        tx[txLen++] = b;
+        return 1;
+    }
+    size_t write(const uint8_t* data, size_t len) {
+        size_t n = 0;
+        while (n < len && write(data[n])) n++;
+        return n;
+    }
+    uint8_t endTransmission(bool stop = true) {
+        return model ? model->write(txAddr, tx, txLen, stop) : 2;
+    }
+
+    size_t requestFrom(uint8_t addr, size_t len) {
+        if (len > sizeof(rx)) len = sizeof(rx);
+        rxLen = model ? model->read(addr, rx, len) : 0;
+        rxPos = 0;
+        return rxLen;
+    }
+    int available() const { return (int)(rxLen - rxPos); }
+    int read() { return rxPos < rxLen ? rx[rxPos++] : -1; }
+
+private:
+    WireModel* model = nullptr;
+    uint32_t clock = 100000;
+    uint8_t txAddr = 0;
+    uint8_t tx[128];
+    size_t txLen = 0;
+    uint8_t rx[128];
+    size_t rxLen = 0;
+    size_t rxPos = 0;
+};
+
+extern TwoWire Wire;
+
+#endif // WIRE_H
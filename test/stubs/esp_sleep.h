@@ -0,0 +1,65 @@
+#ifndef ESP_SLEEP_H
+#define ESP_SLEEP_H
+
+#include <stdint.h>
+#include <functional>
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_SLEEP_REJECT 0x103
+
+typedef enum {
+    ESP_SLEEP_WAKEUP_UNDEFINED,
+    ESP_SLEEP_WAKEUP_ALL,
+    ESP_SLEEP_WAKEUP_EXT0,
+    ESP_SLEEP_WAKEUP_EXT1,
+    ESP_SLEEP_WAKEUP_TIMER,
+    ESP_SLEEP_WAKEUP_TOUCHPAD,
+    ESP_SLEEP_WAKEUP_ULP,
+    ESP_SLEEP_WAKEUP_GPIO,
+    ESP_SLEEP_WAKEUP_UART,
+    ESP_SLEEP_WAKEUP_WIFI,
+    ESP_SLEEP_WAKEUP_COCPU,
+    ESP_SLEEP_WAKEUP_COCPU_TRAP_TRIG,
+    ESP_SLEEP_WAKEUP_BT
+} esp_sleep_source_t;
+typedef esp_sleep_source_t esp_sleep_wakeup_cause_t;
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t us);
+esp_err_t esp_sleep_enable_gpio_wakeup();
+esp_err_t esp_sleep_disable_wakeup_source(esp_sleep_source_t source);
+esp_err_t esp_light_sleep_start();
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause();
+
+// Host model of light-sleep. esp_light_sleep_start() returns `result` at
+// once when it is not ESP_OK. Otherwise it wakes on the first armed pin
+// whose level matches, either straight away or when a scheduled pin change
+// gets there, else on the timer, and advances the fake clock accordingly.
+// Wake pins are configured with gpio_wakeup_enable() as on the chip.
+struct HostSleep {
+    static const uint8_t PINS = 64;
+
+    esp_err_t result = ESP_OK;
+    // A level change during the next sleep: pin goes to level after pinAfterUs
+    bool pinScheduled = false;
+    uint8_t pin = 0, level = 0;
+    uint32_t pinAfterUs = 0;
+    // Runs from esp_sleep_enable_timer_wakeup(), i.e. once sleep is decided
+    std::function<void()> onPrepare;
+
+    // Observed
+    uint32_t starts = 0;              // esp_light_sleep_start() calls
+    uint64_t timerUs = 0;             // timer of the last sleep
+    bool timerEnabled = false, gpioEnabled = false;
+    bool wakeEnabled[PINS] = {};
+    int wakeType[PINS] = {};          // gpio_int_type_t while enabled
+    bool armedAtStart[PINS] = {};     // wakeEnabled when the last sleep started
+    int wakeTypeAtStart[PINS] = {};
+    int intrType[PINS] = {};          // last gpio_set_intr_type()
+    esp_sleep_wakeup_cause_t cause = ESP_SLEEP_WAKEUP_UNDEFINED;
+};
+
+extern HostSleep hostSleep;
+
+#endif // ESP_SLEEP_H
@@ -0,0 +1,30 @@
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+#include <stdint.h>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void* TaskHandle_t;
+typedef void* SemaphoreHandle_t;
+typedef struct { volatile int count; } StaticSemaphore_t;
+typedef struct { int unused; } portMUX_TYPE;
+
+// Critical sections share one host lock, which only matters once a test
+// has started real tasks; see hostStartTasks()
+void hostEnterCritical();
+void hostExitCritical();
+
+#define portMUX_INITIALIZER_UNLOCKED {0}
+#define portENTER_CRITICAL(mux) ((void)(mux), hostEnterCritical())
+#define portEXIT_CRITICAL(mux) ((void)(mux), hostExitCritical())
+#define portMAX_DELAY 0xFFFFFFFFu
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS pdTRUE
+#define tskNO_AFFINITY 0x7FFFFFFF
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define portYIELD_FROM_ISR(woken) ((void)(woken))
+
+#endif // FREERTOS_H
@@ -0,0 +1,12 @@
+#ifndef FREERTOS_SEMPHR_H
+#define FREERTOS_SEMPHR_H
+
+#include "FreeRTOS.h"
+
+// Binary semaphores; a take without a give only blocks once tasks run
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t* buf);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem);
+static inline void vSemaphoreDelete(SemaphoreHandle_t) {}
+
+#endif // FREERTOS_SEMPHR_H
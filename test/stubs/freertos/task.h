@@ -0,0 +1,22 @@
+#ifndef FREERTOS_TASK_H
+#define FREERTOS_TASK_H
+
+#include "FreeRTOS.h"
+
+// By default there is no scheduler on the host: tasks are never started,
+// so modules keep running their "before begin()" inline paths. A test that
+// calls hostStartTasks(true) first gets one host thread per task instead,
+// with blocking notifications and semaphores; notification timeouts run on
+// the fake clock. The test's own thread is not a task, so
+// xTaskGetCurrentTaskHandle() returns nullptr there.
+void hostStartTasks(bool start);
+
+BaseType_t xTaskCreatePinnedToCore(void (*fn)(void*), const char* name, uint32_t stack, void* arg,
+                                   UBaseType_t priority, TaskHandle_t* handle, BaseType_t core);
+TaskHandle_t xTaskGetCurrentTaskHandle();
+void vTaskDelay(TickType_t ticks);   // advances the fake clock by as many ms
+void xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* woken);
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks);
+
+#endif // FREERTOS_TASK_H
@@ -0,0 +1,10 @@
+#ifndef PGMSPACE_H
+#define PGMSPACE_H
+
+// Flash and RAM share one address space on the ESP32; PROGMEM is in Arduino.h
+#include <Arduino.h>
+
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+
+#endif // PGMSPACE_H
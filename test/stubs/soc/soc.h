@@ -0,0 +1,8 @@
+#ifndef SOC_SOC_H
+#define SOC_SOC_H
+
+// Every valid pointer counts as internal RAM on the host
+#define SOC_DRAM_LOW 1
+#define SOC_DRAM_HIGH UINTPTR_MAX
+
+#endif // SOC_SOC_H
@@ -0,0 +1,152 @@
+#include "src/scheduler/TaskScheduler.h"
+#include "check.h"
+#include <vector>
+
+// TaskScheduler on the fake clock. The test thread is not a FreeRTOS task,
+// so sleepUntilNextDeadline() advances the clock to the next deadline
+// instead of blocking, and a loop of runDue() and sleeps replays the
+// firmware's main loop in virtual time.
+static TaskScheduler sched;
+static std::vector<uint32_t> fastRuns, slowRuns, eventRuns, burstRuns;
+static uint32_t burnMs = 0;        // next burst run takes this long
+static uint32_t burnUs = 0;        // every timed run takes this long
+
+static void fastTask() { fastRuns.push_back(millis()); }
+static void slowTask() { slowRuns.push_back(millis()); }
+static void eventTask() { eventRuns.push_back(millis()); }
+
+static void burstTask() {
+    burstRuns.push_back(millis());
+    delay(burnMs);
+    burnMs = 0;
+}
+
+static void timedTask() { delayMicroseconds(burnUs); }
+
+static void loopUntil(uint32_t endMs) {
+    while ((int32_t)(millis() - endMs) < 0) {
+        sched.runDue();
+        sched.sleepUntilNextDeadline(endMs - millis());
+    }
+}
+
+static void disableAll() {
+    for (uint8_t i = 0; i < sched.taskCount(); i++) sched.setEnabled(i, false);
+}
+
+// Periodic tasks run exactly on their deadlines, with no latency, and the
+// loop sleeps through the gaps in between
+static void testPeriodicCadence() {
+    uint32_t t0 = millis();
+    uint8_t fast = sched.addTask("fast", fastTask, 10);
+    uint8_t slow = sched.addTask("slow", slowTask, 25);
+    CHECK_EQ(sched.msUntilNextDeadline(1000), 10);
+    loopUntil(t0 + 1000);
+
+    CHECK_EQ(fastRuns.size(), 99);
+    CHECK_EQ(slowRuns.size(), 39);
+    for (size_t i = 0; i < fastRuns.size(); i++) CHECK_EQ(fastRuns[i], t0 + 10 * (i + 1));
+    for (size_t i = 0; i < slowRuns.size(); i++) CHECK_EQ(slowRuns[i], t0 + 25 * (i + 1));
+    CHECK_EQ(sched.stats(fast).maxLatencyUs, 0);
+    CHECK_EQ(sched.stats(slow).maxLatencyUs, 0);
+    CHECK_EQ(sched.stats(fast).runs, 99);
+    disableAll();
+}
+
+// A trigger makes the task due at once; its latency is measured from the
+// trigger, including the time until the loop gets around to it
+static void testTrigger() {
+    uint8_t ev = sched.addTask("event", eventTask);
+    uint32_t t0 = millis();
+    CHECK_EQ(sched.msUntilNextDeadline(500), 500);   // event-only: no deadline
+    loopUntil(t0 + 100);
+    CHECK(eventRuns.empty());
+
+    sched.triggerFromISR(ev);
+    CHECK_EQ(sched.msUntilNextDeadline(500), 0);
+    sched.sleepUntilNextDeadline(500);             // returns without sleeping
+    CHECK_EQ(millis(), t0 + 100);
+    hostAdvanceUs(300);
+    sched.runDue();
+    CHECK_EQ(eventRuns.size(), 1);
+    CHECK_EQ(sched.stats(ev).maxLatencyUs, 300);
+
+    // A disabled task drops its trigger
+    sched.trigger(ev);
+    sched.setEnabled(ev, false);
+    sched.setEnabled(ev, true);
+    sched.runDue();
+    CHECK_EQ(eventRuns.size(), 1);
+    disableAll();
+}
+
+// A run that overshoots by less than a period is caught up once, late, and
+// the cadence is kept; one that overshoots by more resyncs from now
+static void testOverrun() {
+    uint32_t t0 = millis();
+    uint8_t burst = sched.addTask("burst", burstTask, 10);
+    burnMs = 15;
+    loopUntil(t0 + 40);
+    std::vector<uint32_t> expectShort = {t0 + 10, t0 + 25, t0 + 30};
+    CHECK(burstRuns == expectShort);
+    CHECK_EQ(sched.stats(burst).maxLatencyUs, 5000);
+
+    burstRuns.clear();
+    sched.resetStats();
+    burnMs = 35;
+    loopUntil(t0 + 110);
+    // 40 runs until 75; the next deadline, 50, is missed by a whole period
+    std::vector<uint32_t> expectLong = {t0 + 40, t0 + 75, t0 + 85, t0 + 95, t0 + 105};
+    CHECK(burstRuns == expectLong);
+    CHECK_EQ(sched.stats(burst).maxLatencyUs, 25000);
+    CHECK_EQ(sched.stats(burst).runs, 5);
+
+    // Re-enabling starts a fresh period instead of catching up
+    sched.setEnabled(burst, false);
+    loopUntil(t0 + 200);
+    burstRuns.clear();
+    sched.setEnabled(burst, true);
+    loopUntil(t0 + 215);
+    std::vector<uint32_t> expectFresh = {t0 + 210};
+    CHECK(burstRuns == expectFresh);
+    disableAll();
+}
+
+// Time inside the callback is charged to the task: runs, total and max
+static void testRuntimeAccounting() {
+    uint32_t t0 = millis();
+    uint8_t timed = sched.addTask("timed", timedTask, 20);
+    burnUs = 700;
+    loopUntil(t0 + 100);
+    burnUs = 2500;
+    loopUntil(t0 + 120);
+
+    const TaskStats& s = sched.stats(timed);
+    CHECK_EQ(s.runs, 5);
+    CHECK_EQ(s.totalUs, 4 * 700 + 2500);
+    CHECK_EQ(s.maxUs, 2500);
+    CHECK(s.name && !strcmp(s.name, "timed"));
+
+    sched.resetStats();
+    CHECK_EQ(sched.stats(timed).runs, 0);
+    CHECK_EQ(sched.stats(timed).totalUs, 0);
+    CHECK_EQ(sched.stats(timed).maxUs, 0);
+    CHECK(!strcmp(sched.stats(timed).name, "timed"));
+    disableAll();
+}
+
+static void testLimits() {
+    CHECK_EQ(sched.addTask("null", nullptr), TaskScheduler::INVALID_TASK);
+    while (sched.taskCount() < TaskScheduler::MAX_TASKS) sched.addTask("filler", fastTask);
+    CHECK_EQ(sched.addTask("extra", fastTask, 10), TaskScheduler::INVALID_TASK);
+}
+
+int main() {
+    sched.begin();
+    testPeriodicCadence();
+    testTrigger();
+    testOverrun();
+    testRuntimeAccounting();
+    testLimits();
+    return checkResult("task_scheduler_test");
+}
@@ -0,0 +1,190 @@
+#include "src/screen/GUI_Paint.h"
+#include "src/screen/FrameBuffer.h"
+#include "src/fonts/fonts.h"
+#include "check.h"
+#include <string.h>
+#include <string>
+
+// Paint_MeasureStringAA against what Paint_DrawStringAA puts on screen.
+// Monospaced fonts paint whole cells, so the painted columns are exactly
+// the measured width. Proportional glyphs are painted at pen positions
+// from advances and kerning: the string must equal its glyphs drawn one by
+// one where the measurement of each prefix says they go, and its ink must
+// end where the last glyph's ink does. Paint_DrawStringAlignedAA is checked
+// the same way inside its span.
+static const UWORD W = 240, H = 20;
+static const UWORD UNTOUCHED = 0x1234;
+static const UWORD Y = 2;
+
+static UWORD drawn[W * H];
+static UWORD composed[W * H];
+
+static const sFONT_AA* const MONO[] = {&FontAA12, &FontAA16};
+static const sFONT_AA* const PROPORTIONAL[] = {&FontSans12, &FontSans16};
+static const char* const STRINGS[] = {
+    "Hold the cup still", "Temperature 21.5", "AVATAR", "0123456789", "Yu. W.We LV", "i", "fj!",
+};
+
+static void clear(UWORD* image) {
+    Paint_NewImage((UBYTE*)image, W, H, 0, WHITE);
+    Paint_SetScale(65);
+    Paint_ClearWindows(0, 0, W, H, UNTOUCHED);
+}
+
+// Painted columns [left, right) of an image; left == right when blank
+static void bounds(const UWORD* image, UWORD& left, UWORD& right) {
+    left = W;
+    right = 0;
+    for (UWORD y = 0; y < H; y++) {
+        for (UWORD x = 0; x < W; x++) {
+            if (image[y * W + x] == FB_PIXEL(UNTOUCHED)) continue;
+            if (x < left) left = x;
+            if (x + 1 > right) right = x + 1;
+        }
+    }
+    if (left > right) left = right;
+}
+
+static UWORD advance(const sFONT_AA* font, char c) {
+    char one[2] = {c, 0};
+    return Paint_MeasureStringAA(one, font);
+}
+
+// Right edge of a glyph's ink, from its pen position
+static UWORD inkRight(const sFONT_AA* font, char c) {
+    clear(composed);
+    Paint_DrawCharAA(0, Y, c, font, BLACK, WHITE);
+    UWORD l, r;
+    bounds(composed, l, r);
+    return r;
+}
+
+static void drawString(UWORD x, const char* s, const sFONT_AA* font) {
+    clear(drawn);
+    Paint_DrawStringAA(x, Y, s, font, BLACK, WHITE);
+}
+
+// Each glyph alone at x + (width of the string up to and including it)
+// - (its own advance)
+static void composeString(UWORD x, const char* s, const sFONT_AA* font) {
+    clear(composed);
+    std::string prefix;
+    for (const char* p = s; *p; p++) {
+        prefix += *p;
+        UWORD pen = x + Paint_MeasureStringAA(prefix.c_str(), font) - advance(font, *p);
+        Paint_DrawCharAA(pen, Y, *p, font, BLACK, WHITE);
+    }
+}
+
+// Proportional ink ends where the measurement puts the last glyph's
+static UWORD expectedRight(UWORD x, const char* s, const sFONT_AA* font) {
+    char last = s[strlen(s) - 1];
+    return x + Paint_MeasureStringAA(s, font) - advance(font, last) + inkRight(font, last);
+}
+
+static void testMonospaced() {
+    for (const sFONT_AA* font : MONO) {
+        for (const char* s : STRINGS) {
+            UWORD width = Paint_MeasureStringAA(s, font);
+            CHECK_EQ(width, strlen(s) * font->Width);
+            drawString(5, s, font);
+            UWORD l, r;
+            bounds(drawn, l, r);
+            CHECK_EQ(l, 5);
+            CHECK_EQ(r, 5 + width);
+        }
+    }
+}
+
+static void testProportional() {
+    for (const sFONT_AA* font : PROPORTIONAL) {
+        for (const char* s : STRINGS) {
+            drawString(5, s, font);
+            composeString(5, s, font);
+            CHECK(!memcmp(drawn, composed, sizeof(drawn)));
+            UWORD l, r;
+            bounds(drawn, l, r);
+            CHECK_EQ(r, expectedRight(5, s, font));
+            CHECK(l >= 5);
+            // Narrower than the cells, never wider than the measurement
+            // by more than the last glyph's overhang
+            CHECK(r <= 5 + Paint_MeasureStringAA(s, font) + font->Width - advance(font, s[strlen(s) - 1]));
+        }
+    }
+}
+
+// Every kerning pair of both proportional fonts moves the right glyph by
+// its offset, in the measurement and on screen
+static void testKerning() {
+    for (const sFONT_AA* font : PROPORTIONAL) {
+        CHECK(font->KerningCount > 0);
+        int bad = 0;
+        for (uint16_t i = 0; i < font->KerningCount; i++) {
+            char pair[3] = {(char)(font->Kerning[i].Pair >> 8), (char)(font->Kerning[i].Pair & 0xFF), 0};
+            int8_t offset = font->Kerning[i].Offset;
+            if (Paint_MeasureStringAA(pair, font) != advance(font, pair[0]) + advance(font, pair[1]) + offset) bad++;
+            drawString(20, pair, font);
+            clear(composed);
+            Paint_DrawCharAA(20, Y, pair[0], font, BLACK, WHITE);
+            Paint_DrawCharAA(20 + advance(font, pair[0]) + offset, Y, pair[1], font, BLACK, WHITE);
+            if (memcmp(drawn, composed, sizeof(drawn))) bad++;
+        }
+        CHECK_EQ(bad, 0);
+    }
+    // The widths of the test strings include their kerning
+    CHECK_EQ(Paint_MeasureStringAA("AV", &FontSans16), 9 + 9 - 1);
+    CHECK_EQ(Paint_MeasureStringAA("Y.", &FontSans16), 8 + 4 - 3);
+}
+
+static void drawAligned(UWORD x0, UWORD x1, const char* s, const sFONT_AA* font, TEXT_ALIGN align) {
+    clear(drawn);
+    Paint_DrawStringAlignedAA(x0, x1, Y, s, font, align, BLACK, WHITE);
+}
+
+static void testAligned() {
+    static const UWORD X0 = 30, X1 = 211;
+    for (const char* s : STRINGS) {
+        for (const sFONT_AA* font : MONO) {
+            UWORD width = Paint_MeasureStringAA(s, font);
+            UWORD l, r;
+            if (width >= X1 - X0) continue;     // see below
+            drawAligned(X0, X1, s, font, TEXT_ALIGN_RIGHT);
+            bounds(drawn, l, r);
+            CHECK_EQ(r, X1);
+            CHECK_EQ(l, X1 - width);
+            drawAligned(X0, X1, s, font, TEXT_ALIGN_CENTER);
+            bounds(drawn, l, r);
+            // Equal margins, the odd pixel on the right
+            CHECK_EQ(l - X0, (X1 - X0 - width) / 2);
+            CHECK_EQ((X1 - r) - (l - X0), (X1 - X0 - width) % 2);
+        }
+        for (const sFONT_AA* font : PROPORTIONAL) {
+            UWORD width = Paint_MeasureStringAA(s, font);
+            UWORD l, r;
+            drawAligned(X0, X1, s, font, TEXT_ALIGN_RIGHT);
+            bounds(drawn, l, r);
+            CHECK_EQ(r, expectedRight(X1 - width, s, font));
+            drawAligned(X0, X1, s, font, TEXT_ALIGN_CENTER);
+            UWORD pen = X0 + (X1 - X0 - width) / 2;
+            composeString(pen, s, font);
+            CHECK(!memcmp(drawn, composed, sizeof(drawn)));
+        }
+    }
+
+    // Wider than the span: starts at its left end whatever the alignment
+    UWORD l, r;
+    drawAligned(100, 120, "Hold", &FontAA16, TEXT_ALIGN_RIGHT);
+    bounds(drawn, l, r);
+    CHECK_EQ(l, 100);
+    CHECK_EQ(Paint_AlignString(100, 120, 20, TEXT_ALIGN_CENTER), 100);
+    CHECK_EQ(Paint_AlignString(100, 120, 19, TEXT_ALIGN_RIGHT), 101);
+    CHECK_EQ(Paint_AlignString(100, 120, 5, TEXT_ALIGN_CENTER), 107);
+}
+
+int main() {
+    testMonospaced();
+    testProportional();
+    testKerning();
+    testAligned();
+    return checkResult("text_measure_test");
+}
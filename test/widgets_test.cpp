@@ -0,0 +1,180 @@
+#include "src/ui/Widgets.h"
+#include "src/screen/FrameBuffer.h"
+#include "src/screen/GUI_Paint.h"
+#include "src/fonts/fonts.h"
+#include "recording_panel.h"
+#include "check.h"
+
+// WidgetTree against snapshots: after every render() the recording panel
+// must show exactly what a full redraw of the current widget state draws
+// into a separate image, while only the dirty widgets' rectangles go over
+// the bus.
+static const UWORD W = LCD_1IN28_WIDTH, H = LCD_1IN28_HEIGHT;
+static const UWORD SCREEN_BG = GRAY;
+static UWORD expected[W * H];
+
+static void drawBackground() { Paint_Clear(SCREEN_BG); }
+
+static Label title(40, 30, 160, &Font16, BLACK, WHITE);
+static Label caption(40, 52, 160, &FontAA16, BLUE, WHITE);
+static Readout reading(70, 80, 4, 1, &FontAA16, BLACK, WHITE);
+static ColorSwatch swatch(150, 110, 40, 40, RED);
+static ProgressRing ring(90, 130, 20, 5, GREEN);
+static const UWORD SPARK_COLORS[3] = {RED, GREEN, BLUE};
+static Sparkline spark(50, 160, 140, 30, 3, SPARK_COLORS);
+static Button button(60, 195, 120, 30, "Start", &Font16, BLUE);
+static WidgetTree tree;
+static Widget* const ALL[] = {&title, &caption, &reading, &swatch, &ring, &spark, &button};
+
+// The current state of every widget drawn from scratch into expected
+static void snapshot() {
+    Paint_NewImage((UBYTE*)expected, W, H, 0, WHITE);
+    Paint_SetScale(65);
+    drawBackground();
+    for (Widget* w : ALL) {
+        if (w->isVisible()) w->draw();
+        else Paint_ClearWindows(w->x, w->y, w->x + w->w, w->y + w->h, w->background);
+    }
+    Paint_NewImage((UBYTE*)FrameBuffers.front(), W, H, 0, WHITE);
+    Paint_SetScale(65);
+}
+
+static int differingPixels() {
+    int n = 0;
+    for (uint32_t i = 0; i < (uint32_t)W * H; i++) if (panel.pixels[i] != expected[i]) n++;
+    return n;
+}
+
+static PanelWindow rectOf(const Widget& w) {
+    return {(UWORD)w.x, (UWORD)w.y, (UWORD)(w.x + w.w), (UWORD)(w.y + w.h)};
+}
+
+// render() sent exactly these rectangles, in tree order
+static bool flushed(std::initializer_list<const Widget*> ws) {
+    if (panel.windows.size() != ws.size()) return false;
+    size_t i = 0;
+    for (const Widget* w : ws) if (!(panel.windows[i++] == rectOf(*w))) return false;
+    return true;
+}
+
+static void testRenderAll() {
+    title.setText("Color");
+    caption.setText("Hold the cup still");
+    reading.setValue(-125);
+    ring.setProgress(40);
+    uint8_t v[3] = {10, 128, 250};
+    for (int i = 0; i < 8; i++) {
+        v[0] += 30;
+        spark.push(v);
+    }
+    panel.reset();
+    tree.renderAll();
+    CHECK_EQ(panel.windows.size(), 1);
+    CHECK_EQ(panel.bytes, (uint32_t)W * H * 2);
+    snapshot();
+    CHECK_EQ(differingPixels(), 0);
+    for (Widget* w : ALL) CHECK(!w->isDirty());
+
+    // Nothing changed, nothing sent
+    panel.reset();
+    CHECK_EQ(tree.render(), 0);
+    CHECK(panel.windows.empty());
+}
+
+// Only the widgets whose content changed are redrawn and flushed, and the
+// panel still matches a full redraw
+static void testDirtyRects() {
+    uint32_t before = tree.flushedBytes(), sent = 0;
+    panel.reset();
+    reading.setValue(-125);          // same value: not dirty
+    title.setText("Color");
+    swatch.setColor(RED);
+    CHECK_EQ(tree.render(), 0);
+
+    reading.setValue(873);
+    swatch.setColor(YELLOW);
+    uint32_t bytes = tree.render();
+    sent += bytes;
+    CHECK(flushed({&reading, &swatch}));
+    CHECK_EQ(bytes, (rectOf(reading).area() + rectOf(swatch).area()) * 2);
+    CHECK_EQ(panel.bytes, bytes);
+    snapshot();
+    CHECK_EQ(differingPixels(), 0);
+
+    panel.reset();
+    uint8_t v[3] = {200, 20, 90};
+    spark.push(v);
+    caption.setAlign(TEXT_ALIGN_RIGHT);
+    ring.setProgress(75);
+    sent += tree.render();
+    CHECK(flushed({&caption, &ring, &spark}));
+    snapshot();
+    CHECK_EQ(differingPixels(), 0);
+
+    // Hiding erases the rectangle with the widget's background
+    panel.reset();
+    swatch.setVisible(false);
+    sent += tree.render();
+    CHECK(flushed({&swatch}));
+    snapshot();
+    CHECK_EQ(differingPixels(), 0);
+    CHECK_EQ(panel.at(swatch.x + 5, swatch.y + 5), FB_PIXEL(swatch.background));
+    swatch.setVisible(true);
+    sent += tree.render();
+    snapshot();
+    CHECK_EQ(differingPixels(), 0);
+
+    CHECK_EQ(tree.flushedBytes(), before + sent);
+}
+
+static int taps = 0;
+static void onStart() { taps++; }
+
+static GestureEvent gesture(TouchGesture type, uint16_t x, uint16_t y) {
+    return {type, x, y, 0, 0, 80};
+}
+
+// Hits go to the topmost visible widget, the last one added; only a
+// consumed gesture counts as dispatched
+static void testDispatch() {
+    button.onTap(onStart);
+    CHECK(tree.hitTest(100, 210) == &button);
+    CHECK(tree.dispatch(gesture(TOUCH_GESTURE_TAP, 100, 210)));
+    CHECK_EQ(taps, 1);
+    CHECK(!tree.dispatch(gesture(TOUCH_GESTURE_SWIPE_LEFT, 100, 210)));
+    CHECK(!tree.dispatch(gesture(TOUCH_GESTURE_LONG_PRESS, 100, 210)));
+    CHECK_EQ(taps, 1);
+
+    // Edges: x + w and y + h are outside
+    CHECK(tree.hitTest(60, 195) == &button);
+    CHECK(tree.hitTest(179, 224) == &button);
+    CHECK(tree.hitTest(180, 210) == nullptr);
+    CHECK(tree.hitTest(100, 225) == nullptr);
+    CHECK(!tree.dispatch(gesture(TOUCH_GESTURE_TAP, 5, 5)));
+
+    // A swatch over the button's corner takes the hit and does nothing with it
+    ColorSwatch cover(160, 190, 30, 20, BLACK);
+    tree.add(cover);
+    CHECK(tree.hitTest(170, 200) == &cover);
+    CHECK(!tree.dispatch(gesture(TOUCH_GESTURE_TAP, 170, 200)));
+    CHECK_EQ(taps, 1);
+    cover.setVisible(false);
+    CHECK(tree.dispatch(gesture(TOUCH_GESTURE_TAP, 170, 200)));
+    CHECK_EQ(taps, 2);
+
+    tree.clear();
+    CHECK(tree.hitTest(100, 210) == nullptr);
+}
+
+int main() {
+    FrameBuffers.begin(W, H, 1);
+    Paint_NewImage((UBYTE*)FrameBuffers.front(), W, H, 0, WHITE);
+    Paint_SetScale(65);
+    tree.setBackground(drawBackground);
+    for (Widget* w : ALL) CHECK(tree.add(*w));
+
+    testRenderAll();
+    testDirtyRects();
+    testDispatch();
+    return checkResult("widgets_test");
+}
@@ -0,0 +1,397 @@
+#!/usr/bin/env python3
+"""Generate a 4-bpp anti-aliased font table for GUI_Paint from a TrueType file.
+
+    python3 tools/fontgen.py --ttf /usr/share/fonts/truetype/dejavu/DejaVuSansMono.ttf \
+        --height 16 --name FontAA16 --out src/fonts/fontaa16.cpp
+    python3 tools/fontgen.py --ttf /usr/share/fonts/truetype/dejavu/DejaVuSans.ttf \
+        --height 16 --name FontSans16 --out src/fonts/fontsans16.cpp --proportional
+
+Every glyph from ' ' to '~' is rendered into a Width x Height cell, Height
+being the font's ascent plus descent scaled to --height pixels. Each pixel
+holds its coverage 0..15, two pixels per byte with the left one in the high
+nibble, rows padded to a whole byte: the same cell layout as the 1-bpp
+sFONT tables, at four bits per pixel.
+
+Monospaced glyphs are centered in the cell. With --proportional each glyph
+starts at its pen position instead, the cell is as wide as the widest
+glyph, and the per-glyph advances and the font's 'kern' pairs (rounded to
+whole pixels, zero pairs dropped) are written alongside the table.
+
+Only the standard library is used: the TrueType outlines are read straight
+from the glyf table and filled with a scanline rasterizer that measures the
+exact horizontal coverage of each span on SUBSAMPLES rows per pixel.
+"""
+
+import argparse
+import math
+import os
+import struct
+import sys
+
+FIRST_CHAR = 0x20
+LAST_CHAR = 0x7E
+SUBSAMPLES = 16
+
+SHADES = " .:-=+*#%@"
+
+
+class TrueType:
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        num_tables = self.u16(4)
+        self.tables = {}
+        for i in range(num_tables):
+            rec = 12 + 16 * i
+            tag = self.data[rec:rec + 4].decode("latin-1")
+            self.tables[tag] = self.u32(rec + 8)
+        for tag in ("head", "hhea", "hmtx", "maxp", "loca", "glyf", "cmap"):
+            if tag not in self.tables:
+                raise ValueError("%s: no '%s' table (CFF fonts are not supported)" % (path, tag))
+
+        head = self.tables["head"]
+        self.units_per_em = self.u16(head + 18)
+        self.long_loca = self.i16(head + 50) != 0
+        hhea = self.tables["hhea"]
+        self.ascent = self.i16(hhea + 4)
+        self.descent = -self.i16(hhea + 6)
+        self.num_hmetrics = self.u16(hhea + 34)
+        self.num_glyphs = self.u16(self.tables["maxp"] + 4)
+        self.cmap = self.read_cmap()
+
+    def u16(self, off):
+        return struct.unpack_from(">H", self.data, off)[0]
+
+    def i16(self, off):
+        return struct.unpack_from(">h", self.data, off)[0]
+
+    def u32(self, off):
+        return struct.unpack_from(">I", self.data, off)[0]
+
+    def read_cmap(self):
+        cmap = self.tables["cmap"]
+        sub = None
+        for i in range(self.u16(cmap + 2)):
+            rec = cmap + 4 + 8 * i
+            platform, encoding = self.u16(rec), self.u16(rec + 2)
+            if (platform, encoding) in ((3, 1), (0, 3), (0, 4)):
+                sub = cmap + self.u32(rec + 4)
+                break
+        if sub is None or self.u16(sub) != 4:
+            raise ValueError("no Unicode BMP (format 4) cmap subtable")
+        segs = self.u16(sub + 6) // 2
+        ends = sub + 14
+        starts = ends + 2 * segs + 2
+        deltas = starts + 2 * segs
+        ranges = deltas + 2 * segs
+        mapping = {}
+        for s in range(segs):
+            start, end = self.u16(starts + 2 * s), self.u16(ends + 2 * s)
+            delta, range_off = self.u16(deltas + 2 * s), self.u16(ranges + 2 * s)
+            for code in range(max(start, FIRST_CHAR), min(end, LAST_CHAR) + 1):
+                if range_off == 0:
+                    glyph = (code + delta) & 0xFFFF
+                else:
+                    glyph = self.u16(ranges + 2 * s + range_off + 2 * (code - start))
+                    if glyph:
+                        glyph = (glyph + delta) & 0xFFFF
+                mapping[code] = glyph
+        return mapping
+
+    def glyph(self, code):
+        return self.cmap.get(code, 0)
+
+    def advance(self, glyph):
+        hmtx = self.tables["hmtx"]
+        return self.u16(hmtx + 4 * min(glyph, self.num_hmetrics - 1))
+
+    def kerning(self):
+        """{(left glyph, right glyph): value} from a format 0 'kern' table."""
+        pairs = {}
+        kern = self.tables.get("kern")
+        if kern is None or self.u16(kern) != 0:
+            return pairs
+        p = kern + 4
+        for _ in range(self.u16(kern + 2)):
+            length, coverage = self.u16(p + 2), self.u16(p + 4)
+            # Format 0, horizontal, not minimum values or cross-stream
+            if coverage >> 8 == 0 and coverage & 0x07 == 0x01:
+                count = self.u16(p + 6)
+                for i in range(count):
+                    left, right, value = struct.unpack_from(">HHh", self.data, p + 14 + 6 * i)
+                    pairs[(left, right)] = value
+                # length is only 16 bits, too small for big subtables
+                length = 14 + 6 * count
+            p += length
+        return pairs
+
+    def glyph_range(self, glyph):
+        loca = self.tables["loca"]
+        if self.long_loca:
+            return self.u32(loca + 4 * glyph), self.u32(loca + 4 * glyph + 4)
+        return self.u16(loca + 2 * glyph) * 2, self.u16(loca + 2 * glyph + 2) * 2
+
+    def contours(self, glyph):
+        """Outline as a list of contours, each a list of (x, y, on_curve)."""
+        start, end = self.glyph_range(glyph)
+        if start == end:
+            return []
+        off = self.tables["glyf"] + start
+        count = self.i16(off)
+        if count < 0:
+            return self.composite(off + 10)
+
+        end_points = [self.u16(off + 10 + 2 * i) for i in range(count)]
+        num_points = end_points[-1] + 1 if count else 0
+        p = off + 10 + 2 * count
+        p += 2 + self.u16(p)            # skip the hinting instructions
+
+        flags = []
+        while len(flags) < num_points:
+            flag = self.data[p]
+            p += 1
+            repeat = 0
+            if flag & 0x08:
+                repeat = self.data[p]
+                p += 1
+            flags.extend([flag] * (repeat + 1))
+
+        def coords(p, short_bit, same_bit):
+            values, v = [], 0
+            for flag in flags:
+                if flag & short_bit:
+                    d = self.data[p]
+                    p += 1
+                    v += d if flag & same_bit else -d
+                elif not flag & same_bit:
+                    v += self.i16(p)
+                    p += 2
+                values.append(v)
+            return values, p
+
+        xs, p = coords(p, 0x02, 0x10)
+        ys, p = coords(p, 0x04, 0x20)
+        result, first = [], 0
+        for last in end_points:
+            result.append([(xs[i], ys[i], bool(flags[i] & 1)) for i in range(first, last + 1)])
+            first = last + 1
+        return result
+
+    def composite(self, p):
+        result = []
+        while True:
+            flags, glyph = self.u16(p), self.u16(p + 2)
+            p += 4
+            if flags & 0x0001:
+                dx, dy = struct.unpack_from(">hh", self.data, p)
+                p += 4
+            else:
+                dx, dy = struct.unpack_from(">bb", self.data, p)
+                p += 2
+            if not flags & 0x0002:
+                raise ValueError("point-matched composite glyphs are not supported")
+            a, b, c, d = 1.0, 0.0, 0.0, 1.0
+            if flags & 0x0008:
+                a = d = self.i16(p) / 16384.0
+                p += 2
+            elif flags & 0x0040:
+                a, d = self.i16(p) / 16384.0, self.i16(p + 2) / 16384.0
+                p += 4
+            elif flags & 0x0080:
+                a, b, c, d = (self.i16(p + 2 * i) / 16384.0 for i in range(4))
+                p += 8
+            for contour in self.contours(glyph):
+                result.append([(x * a + y * c + dx, x * b + y * d + dy, on)
+                               for x, y, on in contour])
+            if not flags & 0x0020:
+                return result
+
+
+def flatten(contour, transform):
+    """Closed polyline through a quadratic TrueType contour, in pixels."""
+    pts = [(transform(x, y), on) for x, y, on in contour]
+    if not pts:
+        return []
+    # Start on an on-curve point, or the midpoint of two off-curve ones
+    start = next((i for i, (_, on) in enumerate(pts) if on), None)
+    if start is None:
+        (x0, y0), _ = pts[0]
+        (x1, y1), _ = pts[1 % len(pts)]
+        pts.insert(0, (((x0 + x1) / 2, (y0 + y1) / 2), True))
+        start = 0
+    pts = pts[start:] + pts[:start]
+
+    out = [pts[0][0]]
+    control = None
+    for (x, y), on in pts[1:] + pts[:1]:
+        if on:
+            if control is None:
+                out.append((x, y))
+            else:
+                quad(out, control, (x, y))
+                control = None
+        else:
+            if control is not None:
+                mid = ((control[0] + x) / 2, (control[1] + y) / 2)
+                quad(out, control, mid)
+            control = (x, y)
+    return out
+
+
+def quad(out, control, end):
+    x0, y0 = out[-1]
+    cx, cy = control
+    x1, y1 = end
+    length = math.hypot(cx - x0, cy - y0) + math.hypot(x1 - cx, y1 - cy)
+    steps = max(2, int(length * 2))
+    for i in range(1, steps + 1):
+        t = i / steps
+        u = 1 - t
+        out.append((u * u * x0 + 2 * u * t * cx + t * t * x1,
+                    u * u * y0 + 2 * u * t * cy + t * t * y1))
+
+
+def rasterize(polylines, width, height):
+    """Coverage 0.0..1.0 of each pixel under the nonzero winding rule."""
+    edges = []
+    for poly in polylines:
+        for i in range(len(poly)):
+            (x0, y0), (x1, y1) = poly[i], poly[(i + 1) % len(poly)]
+            if y0 != y1:
+                edges.append((x0, y0, x1, y1))
+
+    cover = [[0.0] * width for _ in range(height)]
+    for row in range(height):
+        line = cover[row]
+        for s in range(SUBSAMPLES):
+            sy = row + (s + 0.5) / SUBSAMPLES
+            crossings = []
+            for x0, y0, x1, y1 in edges:
+                if (y0 <= sy < y1) or (y1 <= sy < y0):
+                    x = x0 + (sy - y0) * (x1 - x0) / (y1 - y0)
+                    crossings.append((x, 1 if y1 > y0 else -1))
+            crossings.sort()
+            winding = 0
+            for i, (x, direction) in enumerate(crossings):
+                winding += direction
+                if winding and i + 1 < len(crossings):
+                    add_span(line, x, crossings[i + 1][0], width)
+    return [[min(1.0, c / SUBSAMPLES) for c in line] for line in cover]
+
+
+def add_span(line, x0, x1, width):
+    x0, x1 = max(0.0, x0), min(float(width), x1)
+    if x1 <= x0:
+        return
+    first, last = int(x0), min(int(math.ceil(x1)) - 1, width - 1)
+    for px in range(first, last + 1):
+        line[px] += min(x1, px + 1) - max(x0, px)
+
+
+def render_font(font, height, proportional):
+    scale = height / float(font.ascent + font.descent)
+    baseline = round(font.ascent * scale)
+    codes = range(FIRST_CHAR, LAST_CHAR + 1)
+    advances = [round(font.advance(font.glyph(c)) * scale) for c in codes]
+
+    outlines = []
+    for code in codes:
+        glyph = font.glyph(code)
+        # Monospaced: center the advance in the cell, for fonts that are not
+        # quite monospaced
+        pad = 0.0 if proportional else (max(advances) - font.advance(glyph) * scale) / 2
+        transform = lambda x, y: (x * scale + pad, baseline - y * scale)
+        outlines.append([flatten(c, transform) for c in font.contours(glyph)])
+
+    width = max(advances)
+    if proportional:
+        # Room for ink that reaches past the advance, as in 'f'
+        ink = [x for polys in outlines for poly in polys for x, _ in poly]
+        width = max(width, int(math.ceil(max(ink) - 0.05)))
+
+    glyphs = []
+    for polylines in outlines:
+        cover = rasterize(polylines, width, height)
+        glyphs.append([[int(c * 15 + 0.5) for c in row] for row in cover])
+
+    kerning = []
+    if proportional:
+        index = {font.glyph(c): c for c in codes}
+        for (left, right), value in sorted(font.kerning().items()):
+            offset = round(value * scale)
+            if offset and left in index and right in index:
+                kerning.append((index[left], index[right], offset))
+        kerning.sort()
+    return width, glyphs, advances if proportional else None, kerning
+
+
+def write_table(out, name, source, width, height, glyphs, advances, kerning):
+    row_bytes = (width + 1) // 2
+    out.write("/* Includes ------------------------------------------------------------------*/\n")
+    out.write('#include "fonts.h"\n\n')
+    out.write("// \n")
+    out.write("//  Font data for %s, %u pixels high, anti-aliased\n" % (source, height))
+    out.write("//  Generated by tools/fontgen.py: 4 bits of coverage per pixel, two pixels\n")
+    out.write("//  per byte with the left one in the high nibble\n")
+    out.write("// \n\n")
+    out.write("const uint8_t %s_Table[] = \n{\n" % name)
+    offset = 0
+    for i, rows in enumerate(glyphs):
+        char = chr(FIRST_CHAR + i)
+        wide = advances[i] if advances else width
+        out.write("\t// @%u '%s' (%u pixels wide)\n" % (offset, char, wide))
+        for row in rows:
+            padded = row + [0] * (row_bytes * 2 - width)
+            data = [(padded[2 * b] << 4) | padded[2 * b + 1] for b in range(row_bytes)]
+            art = "".join(SHADES[(v * (len(SHADES) - 1) + 7) // 15] for v in row)
+            out.write("\t%s //%s\n" % (" ".join("0x%02X," % d for d in data), art))
+            offset += row_bytes
+        if i + 1 < len(glyphs):
+            out.write("\n")
+    out.write("};\n\n")
+
+    if advances:
+        out.write("static const uint8_t %s_Advance[] = \n{\n" % name)
+        for i in range(0, len(advances), 16):
+            out.write("\t%s\n" % " ".join("%u," % a for a in advances[i:i + 16]))
+        out.write("};\n\n")
+    if kerning:
+        out.write("// Sorted by pair, for a binary search\n")
+        out.write("static const sFONT_KERN %s_Kerning[] = \n{\n" % name)
+        for left, right, offset in kerning:
+            pair = "'%s%s'" % (chr(left).replace("\\", "\\\\").replace("'", "\\'"),
+                               chr(right).replace("\\", "\\\\").replace("'", "\\'"))
+            out.write("\t{0x%04X, %d}, // %s\n" % ((left << 8) | right, offset, pair))
+        out.write("};\n\n")
+
+    out.write("sFONT_AA %s = {\n" % name)
+    out.write("  %s_Table,\n" % name)
+    out.write("  %u, /* Width */\n" % width)
+    out.write("  %u, /* Height */\n" % height)
+    out.write("  %s, /* Advance */\n" % ("%s_Advance" % name if advances else "NULL"))
+    out.write("  %s, /* Kerning */\n" % ("%s_Kerning" % name if kerning else "NULL"))
+    out.write("  %u, /* KerningCount */\n" % len(kerning))
+    out.write("};\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--ttf", required=True, help="TrueType font with glyf outlines")
+    parser.add_argument("--height", type=int, required=True, help="line height in pixels")
+    parser.add_argument("--name", required=True, help="C name of the font, e.g. FontAA16")
+    parser.add_argument("--out", required=True, help="C++ file to write")
+    parser.add_argument("--proportional", action="store_true",
+                        help="keep per-glyph advances and kerning")
+    args = parser.parse_args()
+
+    font = TrueType(args.ttf)
+    width, glyphs, advances, kerning = render_font(font, args.height, args.proportional)
+    with open(args.out, "w", newline="\n") as out:
+        write_table(out, args.name, os.path.basename(args.ttf), width, args.height, glyphs,
+                    advances, kerning)
+    print("%s: %u x %u, %u glyphs, %u kerning pairs" % (args.out, width, args.height, len(glyphs),
+                                                       len(kerning)), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()